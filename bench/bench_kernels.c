@@ -0,0 +1,525 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Microbenchmark for the calendar-query matching kernels.
+ *
+ * A corpus of events is generated in memory, and each kernel is run
+ * over every event in the corpus for a number of iterations. The time
+ * and the number of heap allocations per call are reported, along with
+ * the fraction of calls that matched, so that a faster kernel can be
+ * shown to give the same answers. The i;ascii-casemap kernel is first
+ * checked against the reference definition in RFC4790 over the corpus.
+ *
+ * Usage: bench_kernels [-n events] [-i iterations] [-r rrule%]
+ *                      [-d description bytes] [-s seed]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dav_calendar_match.h"
+
+#ifdef __GLIBC__
+
+/*
+ * Count heap allocations by interposing on the allocator, this catches
+ * the allocations made inside libical as well as our own.
+ */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+static unsigned long bench_allocs;
+
+void *malloc(size_t size)
+{
+    bench_allocs++;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+    bench_allocs++;
+    return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    bench_allocs++;
+    return __libc_realloc(ptr, size);
+}
+
+#define BENCH_ALLOCS() bench_allocs
+
+#else
+
+#define BENCH_ALLOCS() 0UL
+
+#endif
+
+static const char *bench_words[] = {
+    "planning", "review", "standup", "budget", "lunch", "dentist", "flight",
+    "offsite", "retrospective", "interview", "training", "deadline", "launch",
+    "meeting", "workshop", "quarterly", "dinner", "holiday", "conference",
+    "maintenance", "release", "migration", "audit", "onboarding", "yoga",
+    "r\xc3\xa9union", "caf\xc3\xa9", "m\xc3\xbcller", "stra\xc3\x9f" "e"
+};
+
+#define BENCH_WORDS (sizeof(bench_words) / sizeof(bench_words[0]))
+
+static const char *bench_rrules[] = {
+    "FREQ=DAILY;COUNT=10",
+    "FREQ=WEEKLY;BYDAY=MO,WE,FR",
+    "FREQ=WEEKLY;INTERVAL=2;BYDAY=TU",
+    "FREQ=MONTHLY;BYMONTHDAY=1",
+    "FREQ=YEARLY"
+};
+
+#define BENCH_RRULES (sizeof(bench_rrules) / sizeof(bench_rrules[0]))
+
+typedef struct bench_corpus {
+    icalcomponent **calendars;
+    icalcomponent **events;
+    const char **summaries;
+    const char **descriptions;
+    int n;
+} bench_corpus;
+
+typedef struct bench_window {
+    icaltimetype start;
+    icaltimetype end;
+} bench_window;
+
+static unsigned long long bench_seed = 1;
+
+static unsigned long bench_random(void)
+{
+    /* reproducible across platforms, unlike rand() */
+    bench_seed = bench_seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (bench_seed >> 33) & 0x7fffffff;
+}
+
+static char *bench_text(char *buf, size_t size, int words)
+{
+    size_t len = 0;
+
+    buf[0] = 0;
+    while (words-- > 0 && len + 16 < size) {
+        const char *word = bench_words[bench_random() % BENCH_WORDS];
+        len += snprintf(buf + len, size - len, "%s%s",
+                len ? " " : "", word);
+    }
+    if (len) {
+        /* mixed case, so that the casemap collation has work to do */
+        buf[0] = buf[0] - 'a' + 'A';
+    }
+
+    return buf;
+}
+
+static void bench_corpus_make(bench_corpus *corpus, int n, int rrule,
+        int description)
+{
+    size_t size = description + 1024;
+    char *ical = malloc(size);
+    char *desc = malloc(description + 1);
+    char summary[128];
+    int i;
+
+    corpus->n = n;
+    corpus->calendars = calloc(n, sizeof(icalcomponent *));
+    corpus->events = calloc(n, sizeof(icalcomponent *));
+    corpus->summaries = calloc(n, sizeof(const char *));
+    corpus->descriptions = calloc(n, sizeof(const char *));
+
+    for (i = 0; i < n; i++) {
+        struct icaltimetype start = icaltime_from_string("20240101T000000Z");
+        int all_day = bench_random() % 10 == 0;
+        char rule[64] = "";
+        char dtstart[32];
+
+        icaltime_adjust(&start, bench_random() % 730,
+                (bench_random() % 96) / 4, (bench_random() % 4) * 15, 0);
+
+        if (all_day) {
+            snprintf(dtstart, sizeof(dtstart), "%04d%02d%02d",
+                    start.year, start.month, start.day);
+        }
+        else {
+            snprintf(dtstart, sizeof(dtstart), "%s",
+                    icaltime_as_ical_string(start));
+        }
+
+        if ((int)(bench_random() % 100) < rrule) {
+            snprintf(rule, sizeof(rule), "RRULE:%s\r\n",
+                    bench_rrules[bench_random() % BENCH_RRULES]);
+        }
+
+        bench_text(summary, sizeof(summary), 3);
+        bench_text(desc, description + 1, description / 8);
+
+        snprintf(ical, size,
+                "BEGIN:VCALENDAR\r\n"
+                "VERSION:2.0\r\n"
+                "PRODID:-//mod_dav_calendar//bench//EN\r\n"
+                "BEGIN:VEVENT\r\n"
+                "UID:bench-%d@example.com\r\n"
+                "DTSTAMP:20240101T000000Z\r\n"
+                "DTSTART%s:%s\r\n"
+                "DURATION:%s\r\n"
+                "%s"
+                "SUMMARY:%s\r\n"
+                "DESCRIPTION:%s\r\n"
+                "END:VEVENT\r\n"
+                "END:VCALENDAR\r\n",
+                i, all_day ? ";VALUE=DATE" : "", dtstart,
+                all_day ? "P1D" : "PT1H", rule, summary, desc);
+
+        corpus->calendars[i] = icalparser_parse_string(ical);
+        if (!corpus->calendars[i]) {
+            fprintf(stderr, "bench_kernels: could not parse event %d\n", i);
+            exit(1);
+        }
+        corpus->events[i] = icalcomponent_get_first_component(
+                corpus->calendars[i], ICAL_VEVENT_COMPONENT);
+        corpus->summaries[i] = icalcomponent_get_summary(corpus->events[i]);
+        corpus->descriptions[i] = icalcomponent_get_description(
+                corpus->events[i]);
+    }
+
+    free(desc);
+    free(ical);
+}
+
+static double bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_report(const char *name, double ns, unsigned long allocs,
+        unsigned long ops, unsigned long matches)
+{
+    printf("%-36s %12.1f %12.2f %9.1f%%\n", name, ns / ops,
+            (double)allocs / ops, 100.0 * matches / ops);
+}
+
+/*
+ * The i;ascii-casemap substring operation exactly as written in RFC4790
+ * section 9.2, used to check the optimised kernel.
+ */
+static int bench_reference_casemap(const char *match, const char *text)
+{
+    size_t mlen = strlen(match), tlen = strlen(text), i, j;
+
+    for (i = 0; i + mlen <= tlen; i++) {
+        for (j = 0; j < mlen; j++) {
+            unsigned char a = text[i + j], b = match[j];
+
+            if (a >= 'a' && a <= 'z') {
+                a -= 'a' - 'A';
+            }
+            if (b >= 'a' && b <= 'z') {
+                b -= 'a' - 'A';
+            }
+            if (a != b) {
+                break;
+            }
+        }
+        if (j == mlen) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Compare the casemap kernel against the reference with substrings of
+ * the corpus in random case, along with octets that a sloppy fold would
+ * confuse, and give up on the first disagreement.
+ */
+static void bench_verify_casemap(const bench_corpus *corpus)
+{
+    static const char *tricky[] = {
+        "", "@", "`", "[", "{", "^", "~", "\xc3\xa9", "\xc3\x89", "Z", "z"
+    };
+    char match[64];
+    int i, k;
+
+    for (i = 0; i < corpus->n; i++) {
+        const char *texts[2] = { corpus->summaries[i], corpus->descriptions[i] };
+
+        for (k = 0; k < 2 + (int)(sizeof(tricky) / sizeof(tricky[0])); k++) {
+            const char *text = texts[k & 1];
+            dav_calendar_casemap *casemap;
+            size_t len = strlen(text), off, n, c;
+
+            if (k < 2) {
+                off = len ? bench_random() % len : 0;
+                n = bench_random() % (sizeof(match) - 1);
+                if (n > len - off) {
+                    n = len - off;
+                }
+                memcpy(match, text + off, n);
+                match[n] = 0;
+                for (c = 0; c < n; c++) {
+                    if (bench_random() & 1 && match[c] >= 'a' && match[c] <= 'z') {
+                        match[c] -= 'a' - 'A';
+                    }
+                }
+            }
+            else {
+                snprintf(match, sizeof(match), "%s", tricky[k - 2]);
+            }
+
+            casemap = dav_calendar_casemap_compile(
+                    malloc(dav_calendar_casemap_size(match)), match);
+            if (dav_calendar_text_match_ascii_casecmp(casemap, text)
+                    != bench_reference_casemap(match, text)) {
+                fprintf(stderr, "bench_kernels: i;ascii-casemap kernel "
+                        "disagrees with RFC4790 for \"%s\" in \"%s\"\n",
+                        match, text);
+                exit(1);
+            }
+            free(casemap);
+        }
+    }
+}
+
+enum {
+    BENCH_ASCII_CASEMAP,
+    BENCH_OCTET,
+    BENCH_UNICODE_CASEMAP
+};
+
+static void bench_text_match(const char *name, const bench_corpus *corpus,
+        const char **texts, const char *match, int collation, int iterations)
+{
+    dav_calendar_casemap *casemap;
+    unsigned long allocs, matches = 0;
+    double start;
+    int i, j;
+
+    /* compiled once per filter in the module, so outside the timing */
+    if (collation == BENCH_UNICODE_CASEMAP) {
+        casemap = dav_calendar_unicode_casemap_compile(
+                malloc(dav_calendar_unicode_casemap_size(match)), match);
+    }
+    else {
+        casemap = dav_calendar_casemap_compile(
+                malloc(dav_calendar_casemap_size(match)), match);
+    }
+
+    allocs = BENCH_ALLOCS();
+    start = bench_now();
+
+    for (j = 0; j < iterations; j++) {
+        for (i = 0; i < corpus->n; i++) {
+            switch (collation) {
+            case BENCH_OCTET:
+                matches += dav_calendar_text_match_octet(match, texts[i]);
+                break;
+            case BENCH_UNICODE_CASEMAP:
+                matches += dav_calendar_text_match_unicode_casemap(casemap,
+                        texts[i]);
+                break;
+            default:
+                matches += dav_calendar_text_match_ascii_casecmp(casemap,
+                        texts[i]);
+            }
+        }
+    }
+
+    bench_report(name, bench_now() - start, BENCH_ALLOCS() - allocs,
+            (unsigned long)iterations * corpus->n, matches);
+
+    free(casemap);
+}
+
+static void bench_comp_time_range(const char *name,
+        const bench_corpus *corpus, const bench_window *window,
+        int iterations)
+{
+    unsigned long allocs, matches = 0;
+    double start;
+    int i, j;
+
+    allocs = BENCH_ALLOCS();
+    start = bench_now();
+
+    for (j = 0; j < iterations; j++) {
+        for (i = 0; i < corpus->n; i++) {
+            matches += dav_calendar_comp_time_range(corpus->events[i],
+                    (icaltimetype *)&window->start,
+                    (icaltimetype *)&window->end);
+        }
+    }
+
+    bench_report(name, bench_now() - start, BENCH_ALLOCS() - allocs,
+            (unsigned long)iterations * corpus->n, matches);
+}
+
+static void bench_prop_time_range(const char *name,
+        const bench_corpus *corpus, const bench_window *window,
+        int iterations)
+{
+    unsigned long allocs, matches = 0;
+    double start;
+    int i, j;
+
+    allocs = BENCH_ALLOCS();
+    start = bench_now();
+
+    for (j = 0; j < iterations; j++) {
+        for (i = 0; i < corpus->n; i++) {
+            icalproperty *prop = icalcomponent_get_first_property(
+                    corpus->events[i], ICAL_DTSTART_PROPERTY);
+
+            matches += dav_calendar_prop_time_range(corpus->events[i], prop,
+                    (icaltimetype *)&window->start,
+                    (icaltimetype *)&window->end);
+        }
+    }
+
+    bench_report(name, bench_now() - start, BENCH_ALLOCS() - allocs,
+            (unsigned long)iterations * corpus->n, matches);
+}
+
+static void bench_busy(const char *name, const bench_corpus *corpus,
+        const bench_window *window, int iterations)
+{
+    dav_calendar_busy *busy;
+    unsigned long allocs, periods = 0;
+    double start;
+    int i, j, nelts, max = 1024;
+
+    busy = malloc(sizeof(dav_calendar_busy) * max * corpus->n);
+
+    allocs = BENCH_ALLOCS();
+    start = bench_now();
+
+    for (j = 0; j < iterations; j++) {
+        nelts = 0;
+        for (i = 0; i < corpus->n; i++) {
+            int n = dav_calendar_busy_collect(corpus->calendars[i],
+                    window->start, window->end, busy + nelts, max);
+            if (n < 0) {
+                fprintf(stderr, "bench_kernels: out of memory\n");
+                exit(1);
+            }
+            nelts += n < max ? n : max;
+        }
+        periods = dav_calendar_busy_merge(busy, nelts);
+    }
+
+    bench_report(name, bench_now() - start, BENCH_ALLOCS() - allocs,
+            (unsigned long)iterations * corpus->n, periods);
+
+    free(busy);
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "Usage: %s [-n events] [-i iterations] [-r rrule%%] "
+            "[-d description bytes] [-s seed]\n", argv0);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    bench_corpus corpus;
+    bench_window month, year;
+    int events = 1000, iterations = 100, rrule = 20, description = 200;
+    int c, i;
+
+    while ((c = getopt(argc, argv, "n:i:r:d:s:")) != -1) {
+        switch (c) {
+        case 'n':
+            events = atoi(optarg);
+            break;
+        case 'i':
+            iterations = atoi(optarg);
+            break;
+        case 'r':
+            rrule = atoi(optarg);
+            break;
+        case 'd':
+            description = atoi(optarg);
+            break;
+        case 's':
+            bench_seed = strtoull(optarg, NULL, 10);
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (events < 1 || iterations < 1 || description < 16) {
+        usage(argv[0]);
+    }
+
+    bench_corpus_make(&corpus, events, rrule, description);
+    bench_verify_casemap(&corpus);
+
+    month.start = icaltime_from_string("20240601T000000Z");
+    month.end = icaltime_from_string("20240701T000000Z");
+    year.start = icaltime_from_string("20250101T000000Z");
+    year.end = icaltime_from_string("20260101T000000Z");
+
+    printf("%d events, %d iterations, %d%% recurring, %d byte descriptions\n\n",
+            events, iterations, rrule, description);
+    printf("%-36s %12s %12s %10s\n", "kernel", "ns/op", "allocs/op",
+            "matched");
+
+    bench_text_match("text-match casemap summary hit", &corpus,
+            corpus.summaries, "MEETING", BENCH_ASCII_CASEMAP, iterations);
+    bench_text_match("text-match casemap summary miss", &corpus,
+            corpus.summaries, "Nonexistent", BENCH_ASCII_CASEMAP, iterations);
+    bench_text_match("text-match casemap description", &corpus,
+            corpus.descriptions, "Retrospective Interview",
+            BENCH_ASCII_CASEMAP, iterations);
+    bench_text_match("text-match octet summary hit", &corpus,
+            corpus.summaries, "meeting", BENCH_OCTET, iterations);
+    bench_text_match("text-match octet description", &corpus,
+            corpus.descriptions, "retrospective interview", BENCH_OCTET,
+            iterations);
+    bench_text_match("text-match unicode summary hit", &corpus,
+            corpus.summaries, "R\xc3\x89UNION", BENCH_UNICODE_CASEMAP,
+            iterations);
+    bench_text_match("text-match unicode description", &corpus,
+            corpus.descriptions, "M\xc3\x9cller Caf\xc3\x89",
+            BENCH_UNICODE_CASEMAP, iterations);
+    bench_comp_time_range("comp time-range month", &corpus, &month,
+            iterations);
+    bench_comp_time_range("comp time-range year", &corpus, &year,
+            iterations);
+    bench_prop_time_range("prop time-range DTSTART month", &corpus, &month,
+            iterations);
+    bench_busy("free-busy collect and merge month", &corpus, &month,
+            iterations);
+
+    for (i = 0; i < corpus.n; i++) {
+        icalcomponent_free(corpus.calendars[i]);
+    }
+
+    return 0;
+}
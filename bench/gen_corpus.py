@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+"""Generate a synthetic calendar collection for benchmarking mod_dav_calendar.
+
+Each calendar resource is written to the output directory as a separate
+iCal file, along with a manifest.json describing the corpus so that the
+benchmark driver can pick realistic hrefs, search terms and time ranges.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import random
+import uuid
+
+WORDS = [
+    "planning", "review", "standup", "budget", "lunch", "dentist", "flight",
+    "offsite", "retrospective", "interview", "training", "deadline", "launch",
+    "meeting", "workshop", "quarterly", "dinner", "holiday", "conference",
+    "maintenance", "release", "migration", "audit", "onboarding", "yoga",
+]
+
+# Offsets are fixed per zone, enough to give the server realistic VTIMEZONE
+# components to parse and merge without pulling in a tz database.
+TIMEZONES = {
+    "UTC": (0, 0),
+    "Europe/London": (0, 60),
+    "Europe/Berlin": (60, 120),
+    "America/New_York": (-300, -240),
+    "America/Los_Angeles": (-480, -420),
+    "Asia/Tokyo": (540, 540),
+    "Australia/Sydney": (600, 660),
+}
+
+RRULES = [
+    "FREQ=DAILY;COUNT=10",
+    "FREQ=WEEKLY;BYDAY=MO,WE,FR",
+    "FREQ=WEEKLY;INTERVAL=2;BYDAY=TU",
+    "FREQ=MONTHLY;BYMONTHDAY=1",
+    "FREQ=MONTHLY;BYDAY=-1FR;COUNT=24",
+    "FREQ=YEARLY",
+]
+
+
+def fold(line):
+    """Fold a content line at 75 octets as required by RFC5545."""
+    data = line.encode("utf-8")
+    if len(data) <= 75:
+        return line + "\r\n"
+    out = []
+    first = True
+    while data:
+        size = 75 if first else 74
+        # never split a UTF-8 sequence
+        while size < len(data) and (data[size] & 0xC0) == 0x80:
+            size -= 1
+        out.append((b"" if first else b" ") + data[:size])
+        data = data[size:]
+        first = False
+    return b"\r\n".join(out).decode("utf-8") + "\r\n"
+
+
+def escape(text):
+    return (text.replace("\\", "\\\\").replace(";", "\\;")
+            .replace(",", "\\,").replace("\n", "\\n"))
+
+
+def offset(minutes):
+    sign = "-" if minutes < 0 else "+"
+    minutes = abs(minutes)
+    return "%s%02d%02d" % (sign, minutes // 60, minutes % 60)
+
+
+def vtimezone(tzid):
+    std, dst = TIMEZONES[tzid]
+    lines = ["BEGIN:VTIMEZONE", "TZID:" + tzid,
+             "BEGIN:STANDARD", "DTSTART:19701025T030000",
+             "TZOFFSETFROM:" + offset(dst), "TZOFFSETTO:" + offset(std)]
+    if std != dst:
+        lines.append("RRULE:FREQ=YEARLY;BYMONTH=10;BYDAY=-1SU")
+    lines.append("END:STANDARD")
+    if std != dst:
+        lines += ["BEGIN:DAYLIGHT", "DTSTART:19700329T020000",
+                  "TZOFFSETFROM:" + offset(std), "TZOFFSETTO:" + offset(dst),
+                  "RRULE:FREQ=YEARLY;BYMONTH=3;BYDAY=-1SU",
+                  "END:DAYLIGHT"]
+    lines.append("END:VTIMEZONE")
+    return lines
+
+
+def sentence(rnd, words):
+    return " ".join(rnd.choice(WORDS) for _ in range(words))
+
+
+def description(rnd, size):
+    text = []
+    length = 0
+    while length < size:
+        line = sentence(rnd, 12).capitalize() + "."
+        text.append(line)
+        length += len(line) + 1
+    return "\n".join(text)[:size]
+
+
+def vevent(rnd, args, uid, start, tzid, stamp):
+    duration = rnd.choice([15, 30, 30, 60, 60, 90, 120, 24 * 60])
+    end = start + datetime.timedelta(minutes=duration)
+    lines = ["BEGIN:VEVENT", "UID:" + uid, "DTSTAMP:" + stamp]
+    if duration == 24 * 60:
+        lines.append("DTSTART;VALUE=DATE:" + start.strftime("%Y%m%d"))
+        lines.append("DTEND;VALUE=DATE:" + end.strftime("%Y%m%d"))
+    elif tzid == "UTC":
+        lines.append("DTSTART:" + start.strftime("%Y%m%dT%H%M%SZ"))
+        lines.append("DTEND:" + end.strftime("%Y%m%dT%H%M%SZ"))
+    else:
+        lines.append("DTSTART;TZID=%s:%s" % (tzid, start.strftime("%Y%m%dT%H%M%S")))
+        lines.append("DTEND;TZID=%s:%s" % (tzid, end.strftime("%Y%m%dT%H%M%S")))
+    lines.append("SUMMARY:" + escape(sentence(rnd, 3).capitalize()))
+    if rnd.random() < args.rrule_density:
+        lines.append("RRULE:" + rnd.choice(RRULES))
+    if rnd.random() < args.large_description_density:
+        lines.append("DESCRIPTION:" + escape(description(rnd, args.large_description_size)))
+    elif args.description_size:
+        lines.append("DESCRIPTION:" + escape(description(rnd, args.description_size)))
+    lines.append("LOCATION:" + escape(sentence(rnd, 2).title()))
+    attendees = rnd.randint(0, args.attendees * 2) if args.attendees else 0
+    if attendees:
+        lines.append("ORGANIZER;CN=Organiser:mailto:organiser@example.com")
+    for i in range(attendees):
+        lines.append("ATTENDEE;CN=Attendee %d;PARTSTAT=%s;ROLE=REQ-PARTICIPANT:"
+                     "mailto:attendee%d@example.com"
+                     % (i, rnd.choice(["ACCEPTED", "TENTATIVE", "NEEDS-ACTION"]), i))
+    lines.append("TRANSP:" + rnd.choice(["OPAQUE", "OPAQUE", "TRANSPARENT"]))
+    lines.append("END:VEVENT")
+    return lines
+
+
+def generate(args):
+    rnd = random.Random(args.seed)
+    zones = [z.strip() for z in args.timezones.split(",") if z.strip()]
+    for zone in zones:
+        if zone not in TIMEZONES:
+            raise SystemExit("unknown timezone: %s (choose from %s)"
+                             % (zone, ", ".join(sorted(TIMEZONES))))
+
+    base = datetime.datetime.strptime(args.start, "%Y-%m-%d")
+    stamp = datetime.datetime.now(datetime.timezone.utc).strftime("%Y%m%dT%H%M%SZ")
+    os.makedirs(args.out, exist_ok=True)
+
+    members = []
+    total = 0
+    for _ in range(args.members):
+        uid = str(uuid.UUID(int=rnd.getrandbits(128)))
+        start = base + datetime.timedelta(
+            minutes=rnd.randrange(args.span_days * 24 * 4) * 15)
+        tzid = rnd.choice(zones) if rnd.random() < args.tz_mix else "UTC"
+
+        lines = ["BEGIN:VCALENDAR", "VERSION:2.0",
+                 "PRODID:-//mod_dav_calendar//bench//EN"]
+        if tzid != "UTC":
+            lines += vtimezone(tzid)
+        for i in range(args.events_per_file):
+            # events after the first are overridden instances of the first
+            event = vevent(rnd, args, uid, start, tzid, stamp)
+            if i:
+                recurrence = start + datetime.timedelta(days=7 * i)
+                event.insert(3, "RECURRENCE-ID:" + recurrence.strftime("%Y%m%dT%H%M%SZ"))
+            lines += event
+        lines.append("END:VCALENDAR")
+
+        name = uid + ".ics"
+        data = "".join(fold(line) for line in lines)
+        with open(os.path.join(args.out, name), "w", encoding="utf-8", newline="") as f:
+            f.write(data)
+        members.append(name)
+        total += len(data)
+
+    manifest = {
+        "members": members,
+        "words": WORDS,
+        "start": args.start,
+        "span_days": args.span_days,
+        "bytes": total,
+    }
+    with open(os.path.join(args.out, "manifest.json"), "w") as f:
+        json.dump(manifest, f)
+
+    return manifest
+
+
+def add_arguments(parser):
+    parser.add_argument("--members", type=int, default=1000,
+                        help="number of calendar resources in the collection")
+    parser.add_argument("--events-per-file", type=int, default=1,
+                        help="number of VEVENT components in each resource")
+    parser.add_argument("--rrule-density", type=float, default=0.2,
+                        help="fraction of events with a recurrence rule")
+    parser.add_argument("--timezones", default="Europe/London,America/New_York,Asia/Tokyo",
+                        help="comma separated TZIDs to choose from")
+    parser.add_argument("--tz-mix", type=float, default=0.5,
+                        help="fraction of resources using a TZID rather than UTC")
+    parser.add_argument("--attendees", type=int, default=3,
+                        help="average number of attendees per event")
+    parser.add_argument("--description-size", type=int, default=200,
+                        help="size in bytes of a typical DESCRIPTION")
+    parser.add_argument("--large-description-density", type=float, default=0.02,
+                        help="fraction of events with a large DESCRIPTION")
+    parser.add_argument("--large-description-size", type=int, default=64 * 1024,
+                        help="size in bytes of a large DESCRIPTION")
+    parser.add_argument("--start", default="2024-01-01",
+                        help="earliest event start date, YYYY-MM-DD")
+    parser.add_argument("--span-days", type=int, default=730,
+                        help="number of days over which events are spread")
+    parser.add_argument("--seed", type=int, default=1,
+                        help="random seed, the same seed gives the same corpus")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--out", required=True,
+                        help="directory to write the calendar resources to")
+    add_arguments(parser)
+    manifest = generate(parser.parse_args())
+    print("generated %d resources, %d bytes"
+          % (len(manifest["members"]), manifest["bytes"]))
+
+
+if __name__ == "__main__":
+    main()
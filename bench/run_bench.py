@@ -0,0 +1,533 @@
+#!/usr/bin/env python3
+"""Benchmark mod_dav_calendar against a locally started httpd.
+
+A scratch server root is created, httpd is started in the foreground with
+mod_dav, mod_dav_fs and mod_dav_calendar loaded, a synthetic calendar is
+uploaded with MKCALENDAR and PUT, and each scenario is run in turn.
+
+For each scenario the p50 and p99 latency, the throughput and the peak
+resident set size of the httpd processes are reported.
+"""
+
+import argparse
+import datetime
+import http.client
+import json
+import os
+import pwd
+import random
+import shutil
+import signal
+import socket
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import gen_corpus  # noqa: E402
+
+COLLECTION = "/calendars/bench/"
+
+SCENARIOS = ["time-range", "text-match", "multiget", "free-busy", "get"]
+
+CONFIG = """
+ServerRoot "{root}"
+ServerName localhost
+Listen 127.0.0.1:{port}
+PidFile "{root}/httpd.pid"
+ErrorLog "{root}/error_log"
+LogLevel {loglevel}
+{load}
+<IfModule unixd_module>
+  User {user}
+</IfModule>
+{mpm}
+DocumentRoot "{root}/htdocs"
+DavLockDB "{root}/var/DavLock"
+{server}
+<Directory "{root}/htdocs">
+  Require all granted
+  Dav on
+  DavCalendar on
+  DavCalendarMaxResourceSize {max_size}
+  FileETag INode MTime Size
+{directory}
+</Directory>
+"""
+
+MPM = """
+<IfModule mpm_event_module>
+  StartServers 1
+  ServerLimit 1
+  ThreadsPerChild {threads}
+  MaxRequestWorkers {threads}
+</IfModule>
+<IfModule mpm_worker_module>
+  StartServers 1
+  ServerLimit 1
+  ThreadsPerChild {threads}
+  MaxRequestWorkers {threads}
+</IfModule>
+<IfModule mpm_prefork_module>
+  StartServers {threads}
+  MinSpareServers {threads}
+  MaxRequestWorkers {threads}
+</IfModule>
+"""
+
+MODULES = [
+    ("mpm_event_module", "mod_mpm_event.so"),
+    ("unixd_module", "mod_unixd.so"),
+    ("authz_core_module", "mod_authz_core.so"),
+    ("dav_module", "mod_dav.so"),
+    ("dav_fs_module", "mod_dav_fs.so"),
+]
+
+REPORT_TIME_RANGE = """<?xml version="1.0" encoding="utf-8" ?>
+<C:calendar-query xmlns:D="DAV:" xmlns:C="urn:ietf:params:xml:ns:caldav">
+  <D:prop>
+    <D:getetag/>
+    <C:calendar-data/>
+  </D:prop>
+  <C:filter>
+    <C:comp-filter name="VCALENDAR">
+      <C:comp-filter name="VEVENT">
+        <C:time-range start="{start}" end="{end}"/>
+      </C:comp-filter>
+    </C:comp-filter>
+  </C:filter>
+</C:calendar-query>
+"""
+
+REPORT_TEXT_MATCH = """<?xml version="1.0" encoding="utf-8" ?>
+<C:calendar-query xmlns:D="DAV:" xmlns:C="urn:ietf:params:xml:ns:caldav">
+  <D:prop>
+    <D:getetag/>
+  </D:prop>
+  <C:filter>
+    <C:comp-filter name="VCALENDAR">
+      <C:comp-filter name="VEVENT">
+        <C:prop-filter name="{prop}">
+          <C:text-match collation="i;ascii-casemap">{text}</C:text-match>
+        </C:prop-filter>
+      </C:comp-filter>
+    </C:comp-filter>
+  </C:filter>
+</C:calendar-query>
+"""
+
+REPORT_MULTIGET = """<?xml version="1.0" encoding="utf-8" ?>
+<C:calendar-multiget xmlns:D="DAV:" xmlns:C="urn:ietf:params:xml:ns:caldav">
+  <D:prop>
+    <D:getetag/>
+    <C:calendar-data/>
+  </D:prop>
+{hrefs}
+</C:calendar-multiget>
+"""
+
+REPORT_FREE_BUSY = """<?xml version="1.0" encoding="utf-8" ?>
+<C:free-busy-query xmlns:C="urn:ietf:params:xml:ns:caldav">
+  <C:time-range start="{start}" end="{end}"/>
+</C:free-busy-query>
+"""
+
+MKCALENDAR = """<?xml version="1.0" encoding="utf-8" ?>
+<C:mkcalendar xmlns:D="DAV:" xmlns:C="urn:ietf:params:xml:ns:caldav">
+  <D:set>
+    <D:prop>
+      <D:displayname>Benchmark</D:displayname>
+    </D:prop>
+  </D:set>
+</C:mkcalendar>
+"""
+
+
+def apxs_query(apxs, name):
+    return subprocess.check_output([apxs, "-q", name], text=True).strip()
+
+
+def free_port():
+    with socket.socket() as s:
+        s.bind(("127.0.0.1", 0))
+        return s.getsockname()[1]
+
+
+class Server:
+    """An httpd started in the foreground with a scratch server root."""
+
+    def __init__(self, args):
+        self.args = args
+        self.root = tempfile.mkdtemp(prefix="dav_calendar_bench.")
+        self.port = args.port or free_port()
+        self.process = None
+
+    def config(self):
+        args = self.args
+        static = subprocess.run([args.httpd, "-l"], capture_output=True,
+                                text=True).stdout
+        load = []
+        for name, so in MODULES:
+            path = os.path.join(args.modules, so)
+            if so[:-3] + ".c" in static or not os.path.exists(path):
+                continue
+            load.append('LoadModule %s "%s"' % (name, path))
+        load.append('LoadModule dav_calendar_module "%s"'
+                    % os.path.abspath(args.module))
+        return CONFIG.format(
+            root=self.root, port=self.port, load="\n".join(load),
+            loglevel=args.loglevel, user=self.user(),
+            mpm=MPM.format(threads=args.concurrency * 2),
+            max_size=args.max_resource_size,
+            server="\n".join(args.server_directive),
+            directory="\n".join("  " + d for d in args.directive))
+
+    def user(self):
+        # httpd refuses to serve as root, so run the children as daemon
+        return "daemon" if os.getuid() == 0 else pwd.getpwuid(os.getuid()).pw_name
+
+    def start(self):
+        os.makedirs(os.path.join(self.root, "htdocs", "calendars"))
+        os.makedirs(os.path.join(self.root, "var"))
+        if os.getuid() == 0:
+            entry = pwd.getpwnam(self.user())
+            for path in ("htdocs", "htdocs/calendars", "var"):
+                os.chown(os.path.join(self.root, path), entry.pw_uid, entry.pw_gid)
+        conf = os.path.join(self.root, "httpd.conf")
+        with open(conf, "w") as f:
+            f.write(self.config())
+        self.process = subprocess.Popen(
+            [self.args.httpd, "-f", conf, "-DFOREGROUND"],
+            start_new_session=True)
+        deadline = time.time() + 10
+        while time.time() < deadline:
+            if self.process.poll() is not None:
+                self.fail("httpd exited with status %d" % self.process.returncode)
+            try:
+                socket.create_connection(("127.0.0.1", self.port), 0.2).close()
+                return
+            except OSError:
+                time.sleep(0.1)
+        self.fail("httpd did not start listening on port %d" % self.port)
+
+    def fail(self, message):
+        log = os.path.join(self.root, "error_log")
+        if os.path.exists(log):
+            with open(log) as f:
+                sys.stderr.write(f.read())
+        self.stop()
+        raise SystemExit(message)
+
+    def pids(self):
+        """The httpd parent and all of its children."""
+        if not self.process:
+            return []
+        pids = [self.process.pid]
+        for entry in os.listdir("/proc"):
+            if not entry.isdigit():
+                continue
+            try:
+                with open("/proc/%s/stat" % entry) as f:
+                    fields = f.read().rsplit(")", 1)[1].split()
+            except OSError:
+                continue
+            if int(fields[1]) == self.process.pid:
+                pids.append(int(entry))
+        return pids
+
+    def rss(self):
+        """Total resident set size of the server in kilobytes."""
+        total = 0
+        for pid in self.pids():
+            try:
+                with open("/proc/%d/status" % pid) as f:
+                    for line in f:
+                        if line.startswith("VmRSS:"):
+                            total += int(line.split()[1])
+            except OSError:
+                pass
+        return total
+
+    def stop(self):
+        if self.process and self.process.poll() is None:
+            os.killpg(self.process.pid, signal.SIGTERM)
+            try:
+                self.process.wait(10)
+            except subprocess.TimeoutExpired:
+                os.killpg(self.process.pid, signal.SIGKILL)
+                self.process.wait()
+        if not self.args.keep:
+            shutil.rmtree(self.root, ignore_errors=True)
+        else:
+            print("server root kept at %s" % self.root)
+
+
+class Client:
+    """One keepalive connection per thread."""
+
+    def __init__(self, host, port):
+        self.local = threading.local()
+        self.host = host
+        self.port = port
+
+    def request(self, method, path, body=None, headers=None):
+        conn = getattr(self.local, "conn", None)
+        if conn is None:
+            conn = self.local.conn = http.client.HTTPConnection(
+                self.host, self.port, timeout=300)
+        try:
+            conn.request(method, path, body, headers or {})
+            response = conn.getresponse()
+            data = response.read()
+        except (http.client.HTTPException, OSError):
+            conn.close()
+            self.local.conn = None
+            raise
+        return response.status, data
+
+
+class Sampler(threading.Thread):
+    """Sample the server RSS while a scenario runs, keeping the peak."""
+
+    def __init__(self, server, interval=0.05):
+        super().__init__(daemon=True)
+        self.server = server
+        self.interval = interval
+        self.peak = 0
+        self.done = threading.Event()
+
+    def run(self):
+        while not self.done.is_set():
+            self.peak = max(self.peak, self.server.rss())
+            self.done.wait(self.interval)
+
+    def stop(self):
+        self.done.set()
+        self.join()
+        self.peak = max(self.peak, self.server.rss())
+        return self.peak
+
+
+def ical_time(when):
+    return when.strftime("%Y%m%dT%H%M%SZ")
+
+
+class Scenarios:
+    """Build a request for each scenario from the corpus manifest."""
+
+    def __init__(self, manifest, args):
+        self.manifest = manifest
+        self.args = args
+        self.start = datetime.datetime.strptime(manifest["start"], "%Y-%m-%d")
+        self.span = manifest["span_days"]
+
+    def window(self, rnd, days):
+        start = self.start + datetime.timedelta(days=rnd.randrange(max(self.span - days, 1)))
+        return ical_time(start), ical_time(start + datetime.timedelta(days=days))
+
+    def build(self, name, rnd):
+        report = {"Depth": "1", "Content-Type": "application/xml; charset=utf-8"}
+        if name == "time-range":
+            start, end = self.window(rnd, self.args.window_days)
+            return "REPORT", COLLECTION, REPORT_TIME_RANGE.format(start=start, end=end), report
+        if name == "text-match":
+            prop = rnd.choice(["SUMMARY", "SUMMARY", "LOCATION", "DESCRIPTION"])
+            text = rnd.choice(self.manifest["words"])
+            return "REPORT", COLLECTION, REPORT_TEXT_MATCH.format(prop=prop, text=text), report
+        if name == "multiget":
+            members = self.manifest["members"]
+            count = min(self.args.multiget_hrefs, len(members))
+            hrefs = "\n".join("  <D:href>%s%s</D:href>" % (COLLECTION, m)
+                              for m in rnd.sample(members, count))
+            return "REPORT", COLLECTION, REPORT_MULTIGET.format(hrefs=hrefs), report
+        if name == "free-busy":
+            start, end = self.window(rnd, self.args.window_days)
+            return "REPORT", COLLECTION, REPORT_FREE_BUSY.format(start=start, end=end), report
+        if name == "get":
+            return "GET", COLLECTION, None, {}
+        raise SystemExit("unknown scenario: %s" % name)
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    k = (len(values) - 1) * p / 100.0
+    f = int(k)
+    c = min(f + 1, len(values) - 1)
+    return values[f] + (values[c] - values[f]) * (k - f)
+
+
+def upload(client, corpus, manifest, concurrency):
+    status, data = client.request("MKCALENDAR", COLLECTION, MKCALENDAR,
+                                  {"Content-Type": "application/xml; charset=utf-8"})
+    if status != 201:
+        raise SystemExit("MKCALENDAR %s failed with %d: %s"
+                         % (COLLECTION, status, data.decode("utf-8", "replace")))
+
+    def put(name):
+        with open(os.path.join(corpus, name), "rb") as f:
+            body = f.read()
+        status, data = client.request("PUT", COLLECTION + name, body,
+                                      {"Content-Type": "text/calendar; charset=utf-8"})
+        if status not in (201, 204):
+            raise SystemExit("PUT %s%s failed with %d: %s"
+                             % (COLLECTION, name, status, data.decode("utf-8", "replace")))
+
+    with ThreadPoolExecutor(concurrency) as pool:
+        list(pool.map(put, manifest["members"]))
+
+
+def run_scenario(name, server, client, scenarios, args):
+    rnd = random.Random(args.seed)
+    requests = [scenarios.build(name, rnd) for _ in range(args.requests)]
+
+    # warm up the server and any caches before measuring
+    for method, path, body, headers in requests[:args.warmup]:
+        client.request(method, path, body, headers)
+
+    latencies = []
+    errors = []
+    received = [0]
+    lock = threading.Lock()
+
+    def one(request):
+        method, path, body, headers = request
+        begin = time.perf_counter()
+        try:
+            status, data = client.request(method, path, body, headers)
+        except (http.client.HTTPException, OSError) as e:
+            with lock:
+                errors.append(str(e))
+            return
+        elapsed = time.perf_counter() - begin
+        with lock:
+            if status >= 400:
+                errors.append("%s %s: %d" % (method, path, status))
+            latencies.append(elapsed)
+            received[0] += len(data)
+
+    sampler = Sampler(server) if server else None
+    if sampler:
+        sampler.start()
+    begin = time.perf_counter()
+    with ThreadPoolExecutor(args.concurrency) as pool:
+        list(pool.map(one, requests))
+    wall = time.perf_counter() - begin
+    peak = sampler.stop() if sampler else 0
+
+    return {
+        "scenario": name,
+        "requests": len(latencies),
+        "errors": len(errors),
+        "first_error": errors[0] if errors else None,
+        "p50_ms": percentile(latencies, 50) * 1000,
+        "p99_ms": percentile(latencies, 99) * 1000,
+        "throughput_rps": len(latencies) / wall if wall else 0.0,
+        "bytes_per_request": received[0] // max(len(latencies), 1),
+        "peak_rss_kb": peak,
+    }
+
+
+def report(results, out):
+    out.write("%-12s %8s %7s %10s %10s %10s %12s %12s\n" % (
+        "scenario", "requests", "errors", "p50 ms", "p99 ms", "req/s",
+        "bytes/req", "peak RSS kB"))
+    for r in results:
+        out.write("%-12s %8d %7d %10.2f %10.2f %10.1f %12d %12d\n" % (
+            r["scenario"], r["requests"], r["errors"], r["p50_ms"], r["p99_ms"],
+            r["throughput_rps"], r["bytes_per_request"], r["peak_rss_kb"]))
+    for r in results:
+        if r["first_error"]:
+            out.write("%s: first error: %s\n" % (r["scenario"], r["first_error"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--apxs", default="apxs",
+                        help="apxs used to find httpd and its modules")
+    parser.add_argument("--httpd", help="httpd binary, defaults to SBINDIR/httpd from apxs")
+    parser.add_argument("--modules", help="modules directory, defaults to LIBEXECDIR from apxs")
+    parser.add_argument("--module", default=".libs/mod_dav_calendar.so",
+                        help="the mod_dav_calendar module to benchmark")
+    parser.add_argument("--url", help="benchmark an already running server at "
+                        "http://host:port/ instead of starting one, the "
+                        "collection %s is created on it" % COLLECTION)
+    parser.add_argument("--port", type=int, help="port to listen on, defaults to a free port")
+    parser.add_argument("--directive", action="append", default=[],
+                        help="extra directive for the calendar directory, may be repeated")
+    parser.add_argument("--server-directive", action="append", default=[],
+                        help="extra directive for the main server, may be repeated")
+    parser.add_argument("--max-resource-size", type=int, default=1024 * 1024 * 1024)
+    parser.add_argument("--loglevel", default="warn")
+    parser.add_argument("--keep", action="store_true",
+                        help="keep the server root and corpus afterwards")
+    parser.add_argument("--corpus", help="use an existing corpus from gen_corpus.py")
+    parser.add_argument("--scenario", action="append", choices=SCENARIOS,
+                        help="scenario to run, may be repeated, defaults to all")
+    parser.add_argument("--requests", type=int, default=200,
+                        help="number of measured requests per scenario")
+    parser.add_argument("--warmup", type=int, default=10,
+                        help="number of unmeasured requests per scenario")
+    parser.add_argument("--concurrency", type=int, default=4,
+                        help="number of concurrent client connections")
+    parser.add_argument("--window-days", type=int, default=31,
+                        help="width of time-range and free-busy windows")
+    parser.add_argument("--multiget-hrefs", type=int, default=50,
+                        help="number of hrefs in each calendar-multiget")
+    parser.add_argument("--json", help="also write the results as JSON to this file")
+    gen_corpus.add_arguments(parser)
+    args = parser.parse_args()
+
+    corpus = args.corpus
+    generated = None
+    if not corpus:
+        generated = corpus = tempfile.mkdtemp(prefix="dav_calendar_corpus.")
+        args.out = corpus
+        gen_corpus.generate(args)
+    with open(os.path.join(corpus, "manifest.json")) as f:
+        manifest = json.load(f)
+
+    server = None
+    if args.url:
+        host, _, port = args.url.split("//", 1)[-1].rstrip("/").partition(":")
+        client = Client(host, int(port or 80))
+    else:
+        args.httpd = args.httpd or os.path.join(apxs_query(args.apxs, "SBINDIR"), "httpd")
+        args.modules = args.modules or apxs_query(args.apxs, "LIBEXECDIR")
+        server = Server(args)
+        server.start()
+        client = Client("127.0.0.1", server.port)
+
+    try:
+        print("uploading %d resources (%d bytes)"
+              % (len(manifest["members"]), manifest["bytes"]))
+        upload(client, corpus, manifest, args.concurrency)
+
+        scenarios = Scenarios(manifest, args)
+        results = []
+        for name in args.scenario or SCENARIOS:
+            results.append(run_scenario(name, server, client, scenarios, args))
+        report(results, sys.stdout)
+        if args.json:
+            with open(args.json, "w") as f:
+                json.dump({"corpus": {k: v for k, v in manifest.items()
+                                      if k in ("start", "span_days", "bytes")},
+                           "members": len(manifest["members"]),
+                           "results": results}, f, indent=2)
+    finally:
+        if server:
+            server.stop()
+        if generated and not args.keep:
+            shutil.rmtree(generated, ignore_errors=True)
+
+    if any(r["errors"] for r in results):
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,3989 @@
+/* Generated by dav_calendar_casefold.py from Unicode 14.0.0, do not edit. */
+
+#ifndef DAV_CALENDAR_CASEFOLD_H
+#define DAV_CALENDAR_CASEFOLD_H
+
+#define DAV_CALENDAR_CASEFOLD_UNICODE "14.0.0"
+#define DAV_CALENDAR_CASEFOLD_SHIFT 7
+#define DAV_CALENDAR_CASEFOLD_MASK 0x7f
+/* code points from here on fold to themselves */
+#define DAV_CALENDAR_CASEFOLD_LIMIT 0x2fa80
+/* longest folded form of a single code point, in bytes */
+#define DAV_CALENDAR_CASEFOLD_MAX_BYTES 33
+/* most bytes a folded string can grow by per input byte */
+#define DAV_CALENDAR_CASEFOLD_GROWTH 11
+
+static const unsigned short dav_calendar_casefold_index[1525] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 14, 14, 14, 15, 16, 17, 14, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 14, 14,
+    14, 14, 14, 30, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 31, 14, 14, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 14,
+    46, 47, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    48, 49, 14, 14, 50, 51, 52, 14, 14, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 64, 65, 66, 67,
+    14, 14, 14, 14, 14, 14, 68, 69, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 70, 71, 72, 73, 74, 75,
+    76, 77, 78, 79, 80, 81, 82, 83, 14, 14, 14, 14,
+    14, 14, 14, 14, 84, 85, 14, 86, 14, 14, 14, 87,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 88, 14, 14,
+    14, 14, 14, 14, 14, 89, 90, 14, 14, 14, 91, 14,
+    14, 92, 14, 93, 14, 14, 14, 14, 14, 94, 95, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    96, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 97, 98, 14, 14, 14, 14,
+    99, 100, 101, 102, 103, 104, 105, 106, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 107, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 108, 109, 14, 14, 14, 14, 110, 111,
+    112, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 113, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 114, 115, 116, 117,
+    118
+};
+
+static const unsigned short dav_calendar_casefold_blocks[15232] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 3, 5,
+    7, 9, 11, 13, 15, 17, 19, 21, 23, 25,
+    27, 29, 31, 33, 35, 37, 39, 41, 43, 45,
+    47, 49, 51, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    53, 0, 0, 0, 0, 0, 0, 0, 55, 0,
+    59, 0, 0, 0, 0, 61, 0, 0, 65, 67,
+    69, 73, 0, 0, 76, 80, 82, 0, 84, 90,
+    96, 0, 102, 106, 110, 114, 118, 122, 0, 126,
+    130, 134, 138, 142, 146, 150, 154, 158, 0, 162,
+    166, 170, 174, 178, 182, 0, 0, 186, 190, 194,
+    198, 202, 0, 0, 206, 210, 214, 218, 222, 226,
+    230, 233, 237, 241, 245, 249, 253, 257, 261, 265,
+    269, 272, 276, 280, 284, 288, 292, 0, 296, 299,
+    303, 307, 311, 315, 319, 322, 326, 330, 334, 338,
+    342, 346, 350, 354, 358, 362, 366, 370, 374, 378,
+    382, 386, 0, 390, 393, 397, 401, 405, 409, 413,
+    417, 421, 425, 429, 433, 437, 441, 445, 449, 453,
+    457, 461, 465, 469, 0, 473, 476, 480, 484, 488,
+    492, 496, 500, 504, 508, 512, 514, 517, 520, 524,
+    528, 532, 0, 536, 540, 544, 548, 552, 556, 560,
+    564, 0, 568, 571, 575, 579, 583, 587, 591, 595,
+    0, 599, 602, 606, 610, 614, 618, 622, 0, 626,
+    629, 633, 637, 641, 645, 649, 653, 657, 661, 665,
+    669, 673, 677, 681, 685, 689, 693, 697, 0, 701,
+    704, 708, 712, 716, 720, 724, 728, 732, 736, 740,
+    744, 748, 752, 756, 760, 764, 768, 772, 776, 780,
+    784, 788, 792, 796, 798, 0, 0, 801, 0, 804,
+    0, 0, 807, 0, 0, 0, 810, 0, 0, 0,
+    0, 0, 813, 0, 0, 816, 0, 0, 0, 819,
+    822, 0, 0, 0, 825, 0, 828, 832, 0, 836,
+    0, 839, 0, 0, 842, 0, 0, 0, 0, 845,
+    0, 848, 852, 0, 0, 0, 856, 0, 859, 0,
+    0, 862, 0, 0, 0, 865, 0, 868, 0, 0,
+    0, 0, 871, 876, 881, 886, 889, 892, 895, 898,
+    901, 904, 908, 912, 916, 920, 924, 928, 932, 936,
+    942, 948, 954, 960, 966, 972, 978, 984, 987, 993,
+    999, 1005, 1011, 1016, 0, 1021, 1024, 1028, 1032, 1036,
+    1040, 1044, 1048, 1054, 1060, 1065, 1070, 1074, 1077, 1080,
+    1083, 1087, 0, 0, 1091, 1095, 1099, 1105, 1111, 1116,
+    1121, 1126, 1131, 1135, 1139, 1143, 1147, 1151, 1155, 1159,
+    1163, 1167, 1171, 1175, 1179, 1183, 1187, 1191, 1195, 1199,
+    1203, 1207, 1211, 1215, 1219, 1223, 1227, 1231, 1235, 1239,
+    0, 1243, 1246, 1250, 0, 0, 0, 1254, 0, 1257,
+    1260, 1264, 1268, 1272, 1276, 1282, 1288, 1294, 1300, 1304,
+    1308, 1314, 1320, 1324, 0, 0, 0, 0, 0, 0,
+    0, 0, 1328, 0, 0, 1331, 1335, 0, 1339, 0,
+    0, 0, 0, 1342, 0, 1345, 0, 1348, 0, 1351,
+    0, 1354, 1357, 1361, 1365, 1369, 1372, 0, 1375, 1378,
+    0, 1381, 0, 1384, 1387, 0, 0, 0, 1391, 1394,
+    0, 1398, 0, 1401, 1405, 0, 1409, 1412, 1415, 1419,
+    1423, 0, 0, 1427, 0, 1430, 1434, 0, 0, 1437,
+    0, 0, 0, 0, 0, 0, 0, 1440, 0, 0,
+    1444, 0, 1447, 1451, 0, 0, 0, 1454, 1458, 1461,
+    1464, 1467, 1470, 0, 0, 0, 0, 0, 1473, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1476,
+    1480, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1484, 1486,
+    1489, 1491, 1493, 1496, 1499, 1502, 1504, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1506, 1510,
+    1514, 1518, 1522, 1526, 0, 0, 1530, 1533, 1535, 1537,
+    1539, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1542, 1545, 0, 1548, 1551, 1556, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1559, 0, 1562, 1565, 0, 0, 1568, 0, 0,
+    1571, 1575, 1578, 1581, 1584, 0, 0, 0, 0, 0,
+    1586, 1590, 1596, 1601, 1604, 1609, 1614, 0, 1619, 0,
+    1624, 1629, 1634, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1641, 1646,
+    1651, 1656, 1661, 1666, 1671, 1678, 1681, 1684, 1687, 1690,
+    1693, 1696, 1699, 1702, 1705, 1708, 1711, 1714, 1717, 1720,
+    1723, 1726, 1729, 1732, 1735, 1738, 1741, 1744, 1747, 1750,
+    1753, 1758, 1763, 1768, 1773, 0, 1778, 1781, 1784, 1787,
+    1792, 1797, 1800, 1803, 0, 1806, 0, 1809, 0, 1812,
+    0, 1815, 0, 1818, 0, 1821, 0, 1824, 0, 1827,
+    0, 1830, 0, 1833, 0, 1836, 0, 1839, 1842, 1845,
+    1848, 1851, 1854, 1857, 0, 0, 1860, 1863, 0, 1866,
+    0, 0, 0, 0, 1869, 1874, 0, 1879, 0, 0,
+    0, 1884, 0, 0, 0, 0, 1889, 1894, 1899, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1904,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1909, 1912, 1915, 1918, 1921, 1924, 1927, 1930,
+    1933, 1936, 1941, 1944, 1947, 1950, 1953, 1956, 1959, 1962,
+    1965, 1968, 1971, 1974, 1977, 1980, 1983, 1986, 1989, 1992,
+    1995, 1998, 2001, 2004, 2007, 2012, 2017, 2020, 2025, 2028,
+    2031, 2034, 2039, 2042, 2045, 2048, 2051, 2056, 2061, 2066,
+    0, 2069, 0, 2072, 0, 2075, 0, 2078, 0, 2081,
+    0, 2084, 0, 2087, 0, 2090, 0, 2093, 0, 2096,
+    0, 2099, 2102, 2107, 0, 2112, 0, 2115, 0, 2118,
+    0, 2121, 0, 2124, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2127, 0, 2130, 0, 2133, 0, 2136,
+    0, 2139, 0, 2142, 0, 2145, 0, 2148, 0, 2151,
+    0, 2154, 0, 2157, 0, 2160, 0, 2163, 0, 2166,
+    0, 2169, 0, 2172, 0, 2175, 0, 2178, 0, 2181,
+    0, 2184, 0, 2187, 0, 2190, 0, 2193, 0, 2196,
+    0, 2199, 0, 2202, 0, 2205, 0, 2208, 2213, 0,
+    2218, 0, 2221, 0, 2224, 0, 2227, 0, 2230, 0,
+    2233, 2236, 2239, 2244, 2249, 2254, 0, 2259, 2262, 2267,
+    0, 2272, 2275, 2280, 2285, 2290, 2295, 2300, 0, 2305,
+    2308, 2313, 2318, 2323, 2328, 2333, 0, 2338, 2341, 2346,
+    2351, 2356, 2361, 2366, 2371, 2376, 2381, 2386, 2391, 2396,
+    0, 2401, 2404, 2409, 0, 2414, 0, 2417, 0, 2420,
+    0, 2423, 0, 2426, 0, 2429, 0, 2432, 0, 2435,
+    0, 2438, 0, 2441, 0, 2444, 0, 2447, 0, 2450,
+    0, 2453, 0, 2456, 0, 2459, 0, 2462, 0, 2465,
+    0, 2468, 0, 2471, 0, 2474, 0, 2477, 0, 2480,
+    0, 2483, 0, 2486, 0, 2489, 0, 2492, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2495, 2498, 2501,
+    2504, 2507, 2510, 2513, 2516, 2519, 2522, 2525, 2528, 2531,
+    2534, 2537, 2540, 2543, 2546, 2549, 2552, 2555, 2558, 2561,
+    2564, 2567, 2570, 2573, 2576, 2579, 2582, 2585, 2588, 2591,
+    2594, 2597, 2600, 2603, 2606, 2609, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2614, 2619, 2624, 2629, 2634, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2639, 2644, 2649, 2654, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2659, 0,
+    2664, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2669, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2674, 0, 0, 0, 0, 0, 0, 0, 2681,
+    0, 0, 2688, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2695, 2702,
+    2709, 2716, 2723, 2730, 2737, 2744, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2751, 2758, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2765, 2772, 0, 2779, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2786, 0, 0,
+    2793, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2800, 2807, 2814, 0, 0,
+    2821, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2828, 0, 0, 2835,
+    2842, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2849, 2856, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2863, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2870, 2877, 2884, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2891, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2898, 0, 0, 0, 0, 0, 0, 2905,
+    2912, 0, 2919, 2926, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2936, 2943, 2950, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2957, 0, 2964, 2971, 2981, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2988, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2995, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3002, 3009, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3016, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3020, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3027, 0, 0, 0, 0,
+    3034, 0, 0, 0, 0, 3041, 0, 0, 0, 0,
+    3048, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3055, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3062, 0, 3069, 3076, 3083, 3093, 3100,
+    0, 0, 0, 0, 0, 0, 0, 3110, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3117, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3124, 0, 0, 0, 0,
+    3131, 0, 0, 0, 0, 3138, 0, 0, 0, 0,
+    3145, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3152, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3159, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3166, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3170, 3174, 3178, 3182, 3186, 3190, 0, 0, 0, 0,
+    0, 0, 0, 0, 3194, 0, 3201, 0, 3208, 0,
+    3215, 0, 3222, 0, 0, 0, 3229, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3236, 0, 3243,
+    0, 0, 3250, 3257, 0, 3264, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3271, 3274, 3277, 3280,
+    3283, 3286, 3289, 3292, 3295, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3299, 3301,
+    3304, 0, 3306, 3308, 3310, 3313, 3315, 3317, 3319, 3321,
+    3323, 3325, 3327, 0, 3329, 3331, 3334, 3336, 3338, 3340,
+    3342, 3344, 3346, 3349, 3352, 3356, 3358, 3360, 3362, 3365,
+    3368, 3371, 0, 3373, 3375, 3377, 3380, 3382, 3385, 3389,
+    3393, 3395, 3397, 3399, 3403, 3406, 3408, 3412, 3415, 3418,
+    3421, 3424, 3427, 3429, 3431, 3433, 3435, 3438, 3441, 3444,
+    3447, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3450, 3453, 0, 0, 0, 3457,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3461, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3465,
+    3468, 3470, 3473, 3476, 3479, 3481, 3484, 3487, 3490, 3493,
+    3496, 3499, 3503, 3506, 3509, 3513, 3516, 3519, 3522, 3525,
+    3528, 3531, 3534, 3537, 3540, 3543, 3546, 3549, 3552, 3556,
+    3559, 3562, 3564, 3567, 3570, 3573, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3576, 3580, 3584, 3588, 3592, 3596, 3600, 3604, 3608, 3614,
+    3620, 3624, 3628, 3632, 3636, 3640, 3644, 3648, 3652, 3656,
+    3660, 3666, 3672, 3678, 3684, 3688, 3692, 3696, 3700, 3706,
+    3712, 3716, 3720, 3724, 3728, 3732, 3736, 3740, 3744, 3748,
+    3752, 3756, 3760, 3764, 3768, 3772, 3776, 3782, 3788, 3792,
+    3796, 3800, 3804, 3808, 3812, 3816, 3820, 3826, 3832, 3836,
+    3840, 3844, 3848, 3852, 3856, 3860, 3864, 3868, 3872, 3876,
+    3880, 3884, 3888, 3892, 3896, 3900, 3904, 3910, 3916, 3922,
+    3928, 3934, 3940, 3946, 3952, 3956, 3960, 3964, 3968, 3972,
+    3976, 3980, 3984, 3990, 3996, 4000, 4004, 4008, 4012, 4016,
+    4020, 4026, 4032, 4038, 4044, 4050, 4056, 4060, 4064, 4068,
+    4072, 4076, 4080, 4084, 4088, 4092, 4096, 4100, 4104, 4108,
+    4112, 4118, 4124, 4130, 4136, 4140, 4144, 4148, 4152, 4156,
+    4160, 4164, 4168, 4172, 4176, 4180, 4184, 4188, 4192, 4196,
+    4200, 4204, 4208, 4212, 4216, 4220, 4224, 4228, 4232, 4236,
+    4240, 4244, 4248, 4252, 4256, 4260, 0, 0, 0, 0,
+    4264, 4268, 4272, 4276, 4280, 4286, 4292, 4298, 4304, 4310,
+    4316, 4322, 4328, 4334, 4340, 4346, 4352, 4358, 4364, 4370,
+    4376, 4382, 4388, 4394, 4400, 4404, 4408, 4412, 4416, 4420,
+    4424, 4430, 4436, 4442, 4448, 4454, 4460, 4466, 4472, 4478,
+    4484, 4488, 4492, 4496, 4500, 4504, 4508, 4512, 4516, 4522,
+    4528, 4534, 4540, 4546, 4552, 4558, 4564, 4570, 4576, 4582,
+    4588, 4594, 4600, 4606, 4612, 4618, 4624, 4630, 4636, 4640,
+    4644, 4648, 4652, 4658, 4664, 4670, 4676, 4682, 4688, 4694,
+    4700, 4706, 4712, 4716, 4720, 4724, 4728, 4732, 4736, 4740,
+    0, 4744, 0, 4748, 0, 4752, 4756, 4761, 4766, 4773,
+    4780, 4787, 4794, 4801, 4808, 4813, 4818, 4825, 4832, 4839,
+    4846, 4853, 4860, 4865, 4870, 4877, 4884, 4891, 0, 0,
+    4898, 4903, 4908, 4915, 4922, 4929, 0, 0, 4936, 4941,
+    4946, 4953, 4960, 4967, 4974, 4981, 4988, 4993, 4998, 5005,
+    5012, 5019, 5026, 5033, 5040, 5045, 5050, 5057, 5064, 5071,
+    5078, 5085, 5092, 5097, 5102, 5109, 5116, 5123, 5130, 5137,
+    5144, 5149, 5154, 5161, 5168, 5175, 0, 0, 5182, 5187,
+    5192, 5199, 5206, 5213, 0, 0, 5220, 5225, 5230, 5237,
+    5244, 5251, 5258, 5265, 0, 5272, 0, 5277, 0, 5284,
+    0, 5291, 5298, 5303, 5308, 5315, 5322, 5329, 5336, 5343,
+    5350, 5355, 5360, 5367, 5374, 5381, 5388, 5395, 5402, 5407,
+    5412, 5417, 5422, 5427, 5432, 5437, 5442, 5447, 5452, 5457,
+    5462, 5467, 0, 0, 5472, 5479, 5486, 5495, 5504, 5513,
+    5522, 5531, 5540, 5547, 5554, 5563, 5572, 5581, 5590, 5599,
+    5608, 5615, 5622, 5631, 5640, 5649, 5658, 5667, 5676, 5683,
+    5690, 5699, 5708, 5717, 5726, 5735, 5744, 5751, 5758, 5767,
+    5776, 5785, 5794, 5803, 5812, 5819, 5826, 5835, 5844, 5853,
+    5862, 5871, 5880, 5885, 5890, 5897, 5902, 0, 5909, 5914,
+    5921, 5926, 5931, 5936, 5941, 5946, 5950, 5953, 5957, 5961,
+    5967, 5974, 5979, 0, 5986, 5991, 5998, 6003, 6008, 6013,
+    6018, 6023, 6029, 6035, 6041, 6046, 6051, 6058, 0, 0,
+    6065, 6070, 6077, 6082, 6087, 6092, 0, 6097, 6103, 6109,
+    6115, 6120, 6125, 6132, 6139, 6144, 6149, 6154, 6161, 6166,
+    6171, 6176, 6181, 6186, 6192, 6198, 0, 0, 6200, 6207,
+    6212, 0, 6219, 6224, 6231, 6236, 6241, 6246, 6251, 6256,
+    6260, 0, 6264, 6266, 6268, 6270, 6272, 6274, 6276, 6278,
+    6280, 6282, 6284, 0, 0, 0, 0, 0, 0, 6286,
+    0, 0, 0, 0, 0, 6290, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6294, 6296,
+    6299, 0, 0, 0, 0, 0, 0, 0, 0, 6303,
+    0, 0, 0, 6305, 6312, 0, 6322, 6329, 0, 0,
+    0, 0, 6339, 0, 6342, 0, 0, 0, 0, 0,
+    0, 0, 0, 6346, 6349, 6352, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6355,
+    0, 0, 0, 0, 0, 0, 0, 6368, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6370, 6372, 0, 0, 6374, 6376,
+    6378, 6380, 6382, 6384, 6386, 6388, 6392, 6394, 6396, 6398,
+    6400, 6402, 6404, 6406, 6408, 6410, 6412, 6414, 6416, 6418,
+    6420, 6422, 6426, 6428, 6430, 0, 6432, 6434, 6436, 6438,
+    6440, 6443, 6445, 6447, 6449, 6451, 6453, 6455, 6457, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6459, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6462, 6466,
+    6470, 6472, 0, 6476, 6480, 6484, 0, 6487, 6491, 6493,
+    6495, 6497, 6499, 6501, 6504, 6506, 6508, 6510, 0, 6512,
+    6514, 0, 0, 6517, 6519, 6521, 6523, 6525, 0, 0,
+    6527, 6530, 6534, 0, 6537, 0, 6539, 0, 6542, 0,
+    6544, 6546, 6550, 6552, 0, 6554, 6556, 6558, 0, 6560,
+    6562, 6564, 6567, 6570, 6573, 6576, 0, 6578, 6582, 6585,
+    6588, 6591, 6594, 0, 0, 0, 0, 6598, 6600, 6602,
+    6604, 6606, 0, 0, 0, 0, 6608, 0, 6612, 6618,
+    6624, 6631, 6637, 6643, 6649, 6655, 6661, 6667, 6673, 6679,
+    6685, 6691, 6697, 6703, 6708, 6710, 6713, 6717, 6720, 6722,
+    6725, 6729, 6734, 6737, 6739, 6742, 6746, 6748, 6750, 6752,
+    6754, 6756, 6759, 6763, 6766, 6768, 6771, 6775, 6780, 6783,
+    6785, 6788, 6792, 6794, 6796, 6798, 0, 0, 0, 0,
+    6800, 0, 0, 0, 0, 6804, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6810, 6816, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6822, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6828, 6834, 6840, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6846, 0,
+    0, 0, 0, 6852, 0, 0, 6858, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6864, 0, 6870, 0, 0, 0, 0, 0, 6876, 6883,
+    0, 6893, 6900, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6910,
+    0, 0, 6916, 0, 0, 6922, 0, 6928, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6934, 0, 6938, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6944, 6950, 6954, 6958, 6964, 0, 0,
+    6970, 6976, 0, 0, 6982, 6988, 0, 0, 0, 0,
+    0, 0, 6994, 7000, 0, 0, 7006, 7012, 0, 0,
+    7018, 7024, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7030, 7036, 7042, 7048,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 7054, 7060,
+    7066, 7072, 0, 0, 0, 0, 0, 0, 7078, 7084,
+    7090, 7096, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7102, 7106, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7110, 7112, 7114, 7116, 7118, 7120,
+    7122, 7124, 7126, 7128, 7131, 7134, 7137, 7140, 7143, 7146,
+    7149, 7152, 7155, 7158, 7161, 7165, 7169, 7173, 7177, 7181,
+    7185, 7189, 7193, 7197, 7202, 7207, 7212, 7217, 7222, 7227,
+    7232, 7237, 7242, 7247, 7252, 7255, 7258, 7261, 7264, 7267,
+    7270, 7273, 7276, 7279, 7283, 7287, 7291, 7295, 7299, 7303,
+    7307, 7311, 7315, 7319, 7323, 7327, 7331, 7335, 7339, 7343,
+    7347, 7351, 7355, 7359, 7363, 7367, 7371, 7375, 7379, 7383,
+    7387, 7391, 7395, 7399, 7403, 7407, 7411, 7415, 7419, 7423,
+    7427, 7429, 7431, 7433, 7435, 7437, 7439, 7441, 7443, 7445,
+    7447, 7449, 7451, 7453, 7455, 7457, 7459, 7461, 7463, 7465,
+    7467, 7469, 7471, 7473, 7475, 7477, 7479, 7481, 7483, 7485,
+    7487, 7489, 7491, 7493, 7495, 7497, 7499, 7501, 7503, 7505,
+    7507, 7509, 7511, 7513, 7515, 7517, 7519, 7521, 7523, 7525,
+    7527, 7529, 7531, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7533, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7546, 7550, 7553, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7557, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 7563, 7567,
+    7571, 7575, 7579, 7583, 7587, 7591, 7595, 7599, 7603, 7607,
+    7611, 7615, 7619, 7623, 7627, 7631, 7635, 7639, 7643, 7647,
+    7651, 7655, 7659, 7663, 7667, 7671, 7675, 7679, 7683, 7687,
+    7691, 7695, 7699, 7703, 7707, 7711, 7715, 7719, 7723, 7727,
+    7731, 7735, 7739, 7743, 7747, 7751, 0, 7755, 0, 0,
+    0, 7759, 7762, 0, 7765, 0, 7769, 0, 7773, 0,
+    0, 0, 0, 0, 0, 7777, 0, 0, 7781, 0,
+    0, 0, 0, 0, 7785, 7787, 0, 0, 0, 7789,
+    0, 7793, 0, 7797, 0, 7801, 0, 7805, 0, 7809,
+    0, 7813, 0, 7817, 0, 7821, 0, 7825, 0, 7829,
+    0, 7833, 0, 7837, 0, 7841, 0, 7845, 0, 7849,
+    0, 7853, 0, 7857, 0, 7861, 0, 7865, 0, 7869,
+    0, 7873, 0, 7877, 0, 7881, 0, 7885, 0, 7889,
+    0, 7893, 0, 7897, 0, 7901, 0, 7905, 0, 7909,
+    0, 7913, 0, 7917, 0, 7921, 0, 7925, 0, 7929,
+    0, 7933, 0, 7937, 0, 7941, 0, 7945, 0, 7949,
+    0, 7953, 0, 7957, 0, 7961, 0, 7965, 0, 7969,
+    0, 7973, 0, 7977, 0, 7981, 0, 7985, 0, 0,
+    0, 0, 0, 0, 0, 0, 7989, 0, 7993, 0,
+    0, 0, 0, 7997, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 8001, 8005, 8009, 8013,
+    8017, 8021, 8025, 8029, 8033, 8037, 8041, 8045, 8049, 8053,
+    8057, 8061, 8065, 8069, 8073, 8077, 8081, 8085, 8089, 8093,
+    8097, 8101, 8105, 8109, 8113, 8117, 8121, 8125, 8129, 8133,
+    8137, 8141, 8145, 8149, 0, 8153, 0, 0, 0, 0,
+    0, 8157, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8161, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8165, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 8169,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 8173, 8177, 8181, 8185, 8189, 8193, 8197, 8201,
+    8205, 8209, 8213, 8217, 8221, 8225, 8229, 8233, 8237, 8241,
+    8245, 8249, 8253, 8257, 8261, 8265, 8269, 8273, 8277, 8281,
+    8285, 8289, 8293, 8297, 8301, 8305, 8309, 8313, 8317, 8321,
+    8325, 8329, 8333, 8337, 8341, 8345, 8349, 8353, 8357, 8361,
+    8365, 8369, 8373, 8377, 8381, 8385, 8389, 8393, 8397, 8401,
+    8405, 8409, 8413, 8417, 8421, 8425, 8429, 8433, 8437, 8441,
+    8445, 8449, 8453, 8457, 8461, 8465, 8469, 8473, 8477, 8481,
+    8485, 8489, 8493, 8497, 8501, 8505, 8509, 8513, 8517, 8521,
+    8525, 8529, 8533, 8537, 8541, 8545, 8549, 8553, 8557, 8561,
+    8565, 8569, 8573, 8577, 8581, 8585, 8589, 8593, 8597, 8601,
+    8605, 8609, 8613, 8617, 8621, 8625, 8629, 8633, 8637, 8641,
+    8645, 8649, 8653, 8657, 8661, 8665, 8669, 8673, 8677, 8681,
+    8685, 8689, 8693, 8697, 8701, 8705, 8709, 8713, 8717, 8721,
+    8725, 8729, 8733, 8737, 8741, 8745, 8749, 8753, 8757, 8761,
+    8765, 8769, 8773, 8777, 8781, 8785, 8789, 8793, 8797, 8801,
+    8805, 8809, 8813, 8817, 8821, 8825, 8829, 8833, 8837, 8841,
+    8845, 8849, 8853, 8857, 8861, 8865, 8869, 8873, 8877, 8881,
+    8885, 8889, 8893, 8897, 8901, 8905, 8909, 8913, 8917, 8921,
+    8925, 8929, 8933, 8937, 8941, 8945, 8949, 8953, 8957, 8961,
+    8965, 8969, 8973, 8977, 8981, 8985, 8989, 8993, 8997, 9001,
+    9005, 9009, 9013, 9017, 9021, 9025, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 9029, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9031, 0, 9035, 9039, 9043, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9047, 0, 9054, 0, 9061, 0,
+    9068, 0, 9075, 0, 9082, 0, 9089, 0, 9096, 0,
+    9103, 0, 9110, 0, 9117, 0, 9124, 0, 0, 9131,
+    0, 9138, 0, 9145, 0, 0, 0, 0, 0, 0,
+    9152, 9159, 0, 9166, 9173, 0, 9180, 9187, 0, 9194,
+    9201, 0, 9208, 9215, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9222, 0, 0, 0,
+    0, 0, 0, 9229, 9234, 0, 9239, 9246, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9253, 0, 9260, 0, 9267, 0, 9274, 0, 9281, 0,
+    9288, 0, 9295, 0, 9302, 0, 9309, 0, 9316, 0,
+    9323, 0, 9330, 0, 0, 9337, 0, 9344, 0, 9351,
+    0, 0, 0, 0, 0, 0, 9358, 9365, 0, 9372,
+    9379, 0, 9386, 9393, 0, 9400, 9407, 0, 9414, 9421,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9428, 0, 0, 9435, 9442, 9449, 9456, 0,
+    0, 0, 9463, 9470, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9477, 9481, 9485, 9489, 9493, 9497, 9501,
+    9505, 9509, 9513, 9517, 9521, 9525, 9529, 9533, 9537, 9541,
+    9545, 9549, 9553, 9557, 9561, 9565, 9569, 9573, 9577, 9581,
+    9585, 9589, 9593, 9597, 9601, 9605, 9609, 9613, 9617, 9621,
+    9625, 9629, 9633, 9637, 9641, 9645, 9649, 9653, 9657, 9661,
+    9665, 9669, 9673, 9677, 9681, 9685, 9689, 9693, 9697, 9701,
+    9705, 9709, 9713, 9717, 9721, 9725, 9729, 9733, 9737, 9741,
+    9745, 9749, 9753, 9757, 9761, 9765, 9769, 9773, 9777, 9781,
+    9785, 9789, 9793, 9797, 9801, 9805, 9809, 9813, 9817, 9821,
+    9825, 9829, 9833, 9837, 9841, 9845, 9849, 0, 0, 0,
+    9853, 9857, 9861, 9865, 9869, 9873, 9877, 9881, 9885, 9889,
+    9893, 9897, 9901, 9905, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9909, 9915, 9921, 9927, 9933, 9939, 9945, 9951, 9957, 9963,
+    9969, 9975, 9981, 9987, 9993, 10002, 10011, 10020, 10029, 10038,
+    10047, 10056, 10065, 10074, 10083, 10092, 10101, 10110, 10119, 10128,
+    10146, 0, 10161, 10167, 10173, 10179, 10185, 10191, 10197, 10203,
+    10209, 10215, 10221, 10227, 10233, 10239, 10245, 10251, 10257, 10263,
+    10269, 10275, 10281, 10287, 10293, 10299, 10305, 10311, 10317, 10323,
+    10329, 10335, 10341, 10347, 10353, 10359, 10365, 10371, 10377, 10381,
+    10385, 10389, 0, 0, 0, 0, 0, 0, 0, 0,
+    10393, 10397, 10400, 10403, 10406, 10409, 10412, 10415, 10418, 10421,
+    10424, 10427, 10430, 10433, 10436, 10439, 10442, 10446, 10450, 10454,
+    10458, 10462, 10466, 10470, 10474, 10478, 10482, 10486, 10490, 10494,
+    10498, 10505, 10512, 10519, 10526, 10533, 10540, 10547, 10554, 10561,
+    10568, 10575, 10582, 10589, 10596, 10612, 10625, 0, 10632, 10636,
+    10640, 10644, 10648, 10652, 10656, 10660, 10664, 10668, 10672, 10676,
+    10680, 10684, 10688, 10692, 10696, 10700, 10704, 10708, 10712, 10716,
+    10720, 10724, 10728, 10732, 10736, 10740, 10744, 10748, 10752, 10756,
+    10760, 10764, 10768, 10772, 10776, 10780, 10784, 10788, 10792, 10796,
+    10800, 10804, 10808, 10812, 10816, 10820, 10824, 10828, 10831, 10834,
+    10837, 10840, 10843, 10846, 10849, 10852, 10855, 10858, 10861, 10864,
+    10867, 10870, 10873, 10878, 10883, 10888, 10893, 10898, 10903, 10908,
+    10913, 10918, 10924, 10930, 10936, 10939, 10943, 10946, 10950, 10954,
+    10958, 10962, 10966, 10970, 10974, 10978, 10982, 10986, 10990, 10994,
+    10998, 11002, 11006, 11010, 11014, 11018, 11022, 11026, 11030, 11034,
+    11038, 11042, 11046, 11050, 11054, 11058, 11062, 11066, 11070, 11074,
+    11078, 11082, 11086, 11090, 11094, 11098, 11102, 11106, 11110, 11114,
+    11118, 11122, 11126, 11130, 11134, 11138, 11145, 11161, 11174, 11190,
+    11200, 11216, 11226, 11236, 11255, 11268, 11278, 11288, 11298, 11311,
+    11324, 11337, 11350, 11363, 11376, 11389, 11408, 11415, 11434, 11453,
+    11469, 11482, 11501, 11520, 11533, 11543, 11553, 11566, 11579, 11595,
+    11611, 11621, 11631, 11644, 11654, 11664, 11671, 11678, 11688, 11698,
+    11717, 11730, 11746, 11765, 11778, 11788, 11798, 11817, 11830, 11849,
+    11859, 11875, 11885, 11898, 11908, 11921, 11937, 11950, 11966, 11979,
+    11986, 12002, 12012, 12022, 12035, 12045, 12055, 12065, 12081, 12094,
+    12101, 12120, 12130, 12146, 12159, 12172, 12182, 12192, 12205, 12212,
+    12225, 12241, 12248, 12267, 12277, 12282, 12287, 12292, 12297, 12302,
+    12307, 12312, 12317, 12322, 12327, 12333, 12339, 12345, 12351, 12357,
+    12363, 12369, 12375, 12381, 12387, 12393, 12399, 12405, 12411, 12417,
+    12421, 12424, 12427, 12431, 12434, 12437, 12440, 12444, 12448, 12451,
+    12458, 12465, 12472, 12479, 12492, 12495, 12498, 12502, 12505, 12508,
+    12511, 12514, 12517, 12521, 12526, 12529, 12532, 12536, 12540, 12543,
+    12546, 12549, 12553, 12557, 12561, 12565, 12569, 12572, 12575, 12578,
+    12581, 12584, 12588, 12591, 12594, 12597, 12601, 12605, 12608, 12612,
+    12616, 12620, 12623, 12627, 12633, 12640, 12643, 12647, 12651, 12655,
+    12659, 12667, 12676, 12679, 12682, 12686, 12689, 12692, 12695, 12699,
+    12702, 12705, 12708, 12711, 12714, 12718, 12721, 12724, 12727, 12731,
+    12735, 12740, 12743, 12746, 12749, 12756, 12760, 12763, 12766, 12769,
+    12772, 12775, 12778, 12781, 12784, 12787, 12790, 12794, 12797, 12800,
+    12804, 12808, 12811, 12816, 12820, 12823, 12826, 12829, 12832, 12838,
+    12844, 12849, 12854, 12859, 12864, 12869, 12874, 12879, 12884, 12889,
+    12895, 12901, 12907, 12913, 12919, 12925, 12931, 12937, 12943, 12949,
+    12955, 12961, 12967, 12973, 12979, 12985, 12991, 12997, 13003, 13009,
+    13015, 13021, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13025, 0, 13029,
+    0, 13033, 0, 13037, 0, 13041, 0, 13045, 0, 13049,
+    0, 13053, 0, 13057, 0, 13061, 0, 13065, 0, 13069,
+    0, 13073, 0, 13077, 0, 13081, 0, 13085, 0, 13089,
+    0, 13093, 0, 13097, 0, 13101, 0, 13105, 0, 13109,
+    0, 13113, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 13117, 0, 13121, 0, 13125, 0, 13129, 0, 13133,
+    0, 13137, 0, 13141, 0, 13145, 0, 13149, 0, 13153,
+    0, 13157, 0, 13161, 0, 13165, 0, 13169, 13173, 13176,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13179, 0, 13183, 0, 13187, 0, 13191,
+    0, 13195, 0, 13199, 0, 13203, 0, 0, 0, 13207,
+    0, 13211, 0, 13215, 0, 13219, 0, 13223, 0, 13227,
+    0, 13231, 0, 13235, 0, 13239, 0, 13243, 0, 13247,
+    0, 13251, 0, 13255, 0, 13259, 0, 13263, 0, 13267,
+    0, 13271, 0, 13275, 0, 13279, 0, 13283, 0, 13287,
+    0, 13291, 0, 13295, 0, 13299, 0, 13303, 0, 13307,
+    0, 13311, 0, 13315, 0, 13319, 0, 13323, 0, 13327,
+    13331, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13335, 0, 13339, 0, 0, 13343, 0, 13347, 0, 13351,
+    0, 13355, 0, 13359, 0, 0, 0, 0, 13363, 0,
+    0, 0, 0, 13367, 0, 13371, 13375, 0, 0, 13379,
+    0, 13383, 0, 13387, 0, 13391, 0, 13395, 0, 13399,
+    0, 13403, 0, 13407, 0, 13411, 0, 13415, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13419,
+    0, 13423, 0, 13427, 0, 13431, 0, 13435, 0, 13439,
+    0, 13443, 0, 13447, 0, 0, 0, 0, 13451, 0,
+    13455, 0, 0, 0, 0, 0, 0, 13459, 0, 0,
+    0, 0, 0, 13463, 0, 13467, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13471, 13473, 13475, 0, 13477, 0, 13481, 13484, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13487, 0, 0,
+    0, 0, 0, 0, 0, 0, 13491, 13495, 13499, 13502,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13506,
+    0, 0, 0, 0, 0, 0, 13509, 13513, 13517, 13521,
+    13525, 13529, 13533, 13537, 13541, 13545, 13549, 13553, 13557, 13561,
+    13565, 13569, 13573, 13577, 13581, 13585, 13589, 13593, 13597, 13601,
+    13605, 13609, 13613, 13617, 13621, 13625, 13629, 13633, 13637, 13641,
+    13645, 13649, 13653, 13657, 13661, 13665, 13669, 13673, 13677, 13681,
+    13685, 13689, 13693, 13697, 13701, 13705, 13709, 13713, 13717, 13721,
+    13725, 13729, 13733, 13737, 13741, 13745, 13749, 13753, 13757, 13761,
+    13765, 13769, 13773, 13777, 13781, 13785, 13789, 13793, 13797, 13801,
+    13805, 13809, 13813, 13817, 13821, 13825, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13829, 13833, 13837, 13841, 13845, 13849, 13853, 13857, 13861, 13865,
+    13869, 13873, 13877, 13881, 13885, 13889, 13893, 13897, 13901, 13905,
+    13909, 13913, 13917, 13921, 13925, 13929, 13933, 13937, 13941, 13945,
+    13949, 13953, 13957, 13961, 13965, 13969, 13973, 13977, 13981, 13985,
+    13989, 13993, 13997, 14001, 14005, 14009, 14013, 14017, 14021, 14025,
+    14029, 14033, 14037, 14041, 14045, 14049, 14053, 14057, 14061, 14065,
+    14069, 14073, 14077, 14081, 14085, 14089, 14093, 14097, 14101, 14105,
+    14109, 14113, 14117, 14121, 14125, 14129, 14133, 14137, 14141, 14145,
+    14149, 14153, 14157, 14161, 14165, 14169, 14173, 14177, 14181, 14185,
+    14189, 14193, 14197, 14201, 14205, 14209, 14213, 14217, 14221, 14225,
+    14229, 14233, 14237, 14241, 14245, 14249, 14253, 14257, 14261, 14265,
+    14269, 14273, 14277, 14281, 14285, 14289, 14293, 14297, 14301, 14305,
+    14309, 14313, 14317, 14321, 14325, 14329, 14333, 14337, 14341, 14345,
+    14349, 14353, 14357, 14361, 14365, 14369, 14373, 14377, 14381, 14385,
+    14389, 14393, 14397, 14401, 14405, 14409, 14413, 14417, 14421, 14425,
+    14429, 14433, 14437, 14441, 14445, 14449, 14453, 14457, 14461, 14465,
+    14469, 14473, 14477, 14481, 14485, 14489, 14493, 14497, 14501, 14505,
+    14509, 14513, 14517, 14521, 14525, 14529, 14533, 14537, 14541, 14545,
+    14549, 14553, 14557, 14561, 14565, 14569, 14573, 14577, 14581, 14585,
+    14589, 14593, 14597, 14601, 14605, 14609, 14613, 14617, 14621, 14625,
+    14629, 14633, 14637, 14641, 14645, 14649, 14653, 14657, 14661, 14665,
+    14669, 14673, 14677, 14681, 14685, 14689, 14693, 14697, 14701, 14705,
+    14709, 14713, 14717, 14721, 14725, 14729, 14733, 14737, 14741, 14745,
+    14749, 14753, 14757, 14761, 14765, 14769, 14773, 14777, 14781, 14785,
+    14789, 14793, 14797, 14801, 14805, 14809, 14813, 14817, 14821, 14825,
+    14829, 14833, 14837, 14841, 14845, 14849, 14853, 14857, 14861, 14865,
+    14869, 14873, 14877, 14881, 14885, 14889, 14893, 14897, 14901, 14905,
+    0, 0, 14909, 0, 14913, 0, 0, 14917, 14921, 14925,
+    14929, 14933, 14937, 14941, 14945, 14949, 14953, 0, 14957, 0,
+    14961, 0, 0, 14965, 14969, 0, 0, 0, 14973, 14977,
+    14981, 14985, 14989, 14993, 14997, 15001, 15005, 15009, 15013, 15017,
+    15021, 15025, 15029, 15033, 15037, 15041, 15045, 15049, 15053, 15057,
+    15061, 15065, 15069, 15073, 15077, 15081, 15085, 15089, 15093, 15097,
+    15101, 15105, 15109, 15113, 15117, 15121, 15125, 15129, 15133, 15137,
+    15141, 15145, 15149, 15153, 15157, 15161, 15165, 15169, 15173, 15177,
+    15181, 15185, 15189, 15193, 15197, 15201, 15205, 15209, 15213, 15217,
+    15221, 15225, 15229, 15233, 15237, 15242, 0, 0, 15246, 15250,
+    15254, 15258, 15262, 15266, 15270, 15274, 15278, 15282, 15286, 15290,
+    15294, 15298, 15302, 15306, 15310, 15314, 15318, 15322, 15326, 15330,
+    15334, 15338, 15342, 15346, 15350, 15354, 15358, 15362, 15366, 15370,
+    15374, 15378, 15382, 15386, 15390, 15394, 15398, 15402, 15406, 15410,
+    15414, 15418, 15422, 15426, 15430, 15434, 15438, 15442, 15446, 15450,
+    15454, 15458, 15462, 15466, 15470, 15474, 15478, 15482, 15486, 15490,
+    15494, 15498, 15502, 15506, 15510, 15514, 15518, 15522, 15526, 15530,
+    15534, 15538, 15542, 15546, 15550, 15554, 15558, 15562, 15566, 15570,
+    15574, 15578, 15582, 15586, 15590, 15594, 15598, 15602, 15606, 15610,
+    15614, 15618, 15622, 15626, 15631, 15636, 15641, 15645, 15649, 15653,
+    15658, 15663, 15668, 15672, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 15676, 15679, 15682, 15685, 15689, 15693, 15696, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 15699, 15704, 15709, 15714, 15719, 0, 0, 0, 0,
+    0, 15724, 0, 15729, 15734, 15737, 15740, 15743, 15746, 15749,
+    15752, 15755, 15758, 15761, 15763, 15768, 15773, 15780, 15787, 15792,
+    15797, 15802, 15807, 15812, 15817, 15822, 15827, 0, 15832, 15837,
+    15842, 15847, 15852, 0, 15857, 0, 15862, 15867, 0, 15872,
+    15877, 0, 15882, 15887, 15892, 15897, 15902, 15907, 15912, 15917,
+    15922, 15927, 15932, 15935, 15938, 15941, 15944, 15947, 15950, 15953,
+    15956, 15959, 15962, 15965, 15968, 15971, 15974, 15977, 15980, 15983,
+    15986, 15989, 15992, 15995, 15998, 16001, 16004, 16007, 16010, 16013,
+    16016, 16019, 16022, 16025, 16028, 16031, 16034, 16037, 16040, 16043,
+    16046, 16049, 16052, 16055, 16058, 16061, 16064, 16067, 16070, 16073,
+    16076, 16079, 16082, 16085, 16088, 16091, 16094, 16097, 16100, 16103,
+    16106, 16109, 16112, 16115, 16118, 16121, 16124, 16127, 16130, 16133,
+    16136, 16139, 16142, 16145, 16148, 16151, 16154, 16157, 16160, 16163,
+    16166, 16169, 16172, 16175, 16178, 16181, 16184, 16189, 16194, 16197,
+    16200, 16203, 16206, 16209, 16212, 16215, 16218, 16221, 16224, 16229,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 16234, 16237, 16240, 16243, 16246, 16249, 16252,
+    16255, 16258, 16261, 16264, 16269, 16272, 16275, 16278, 16281, 16284,
+    16287, 16290, 16293, 16296, 16299, 16302, 16305, 16312, 16319, 16326,
+    16333, 16340, 16347, 16354, 16361, 16368, 16375, 16382, 16389, 16396,
+    16403, 16410, 16417, 16424, 16431, 16434, 16437, 16440, 16443, 16450,
+    16457, 16464, 16471, 16478, 16483, 16488, 16493, 16498, 16503, 16508,
+    16513, 16518, 16523, 16528, 16533, 16538, 16543, 16548, 16553, 16558,
+    16563, 16568, 16573, 16578, 16583, 16588, 16593, 16598, 16603, 16608,
+    16613, 16618, 16623, 16628, 16633, 16638, 16643, 16648, 16653, 16658,
+    16663, 16668, 16673, 16678, 16683, 16688, 16693, 16698, 16703, 16708,
+    16713, 16718, 16723, 16728, 16733, 16738, 16743, 16748, 16753, 16758,
+    16763, 16768, 16773, 16778, 16783, 16788, 16793, 16798, 16803, 16808,
+    16813, 16818, 16823, 16828, 16833, 16838, 16843, 16848, 16853, 16858,
+    16863, 16868, 16873, 16878, 16883, 16888, 16893, 16898, 16903, 16908,
+    16913, 16918, 16923, 16929, 16935, 16941, 16947, 16953, 16959, 16966,
+    16973, 16980, 16987, 16994, 17001, 17006, 17011, 17016, 17021, 17026,
+    17031, 17036, 17041, 17046, 17051, 17056, 17061, 17066, 17071, 17076,
+    17081, 17086, 17091, 17096, 17101, 17106, 17111, 17116, 17121, 17126,
+    17131, 17136, 17141, 17146, 17151, 17156, 17161, 17166, 17171, 17176,
+    17181, 17186, 17191, 17196, 17201, 17206, 17211, 17216, 17221, 17226,
+    17233, 17240, 17247, 17254, 17261, 17266, 17271, 17276, 17281, 17286,
+    17291, 17296, 17301, 17306, 17311, 17316, 17321, 17326, 17331, 17336,
+    17341, 17346, 17351, 17356, 17361, 17366, 17371, 17376, 17381, 17386,
+    17391, 17396, 17401, 17406, 17411, 17416, 17421, 17426, 17431, 17436,
+    17441, 17446, 17451, 17456, 17461, 17466, 17471, 17476, 17481, 17486,
+    17491, 17496, 17501, 17506, 17511, 17516, 17521, 17526, 17531, 17536,
+    17541, 17546, 17551, 17556, 17561, 17566, 17571, 17576, 17581, 17586,
+    17591, 17596, 17603, 17610, 17615, 17620, 17625, 17630, 17635, 17640,
+    17645, 17650, 17655, 17660, 17665, 17670, 17675, 17680, 17685, 17690,
+    17695, 17702, 17709, 17716, 17721, 17726, 17731, 17736, 17741, 17746,
+    17751, 17756, 17761, 17766, 17771, 17776, 17781, 17786, 17791, 17796,
+    17801, 17806, 17811, 17816, 17821, 17826, 17831, 17836, 17841, 17846,
+    17851, 17856, 17861, 17866, 17871, 17876, 17881, 17886, 17891, 17896,
+    17901, 17906, 17911, 17916, 17921, 17926, 17931, 17936, 17941, 17946,
+    17951, 17956, 17961, 17966, 17971, 17976, 17981, 17986, 17991, 17996,
+    18001, 18006, 18011, 18016, 18021, 18026, 18031, 18036, 18041, 18046,
+    18051, 18056, 18061, 18066, 18071, 18076, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 18081, 18088, 18095, 18102, 18109, 18116,
+    18123, 18130, 18137, 18144, 18151, 18158, 18165, 18172, 18179, 18186,
+    18193, 18200, 18207, 18214, 18221, 18228, 18235, 18242, 18249, 18256,
+    18263, 18270, 18277, 18284, 18291, 18298, 18305, 18312, 18319, 18326,
+    18333, 18340, 18347, 18354, 18361, 18368, 18375, 18382, 18389, 18396,
+    18403, 18410, 18417, 18424, 18431, 18438, 18445, 18452, 18459, 18466,
+    18473, 18480, 18487, 18494, 18501, 18508, 18515, 18522, 0, 0,
+    18529, 18536, 18543, 18550, 18557, 18564, 18571, 18578, 18585, 18592,
+    18599, 18606, 18613, 18620, 18627, 18634, 18641, 18648, 18655, 18662,
+    18669, 18676, 18683, 18690, 18697, 18704, 18711, 18718, 18725, 18732,
+    18739, 18746, 18753, 18760, 18767, 18774, 18781, 18788, 18795, 18802,
+    18809, 18816, 18823, 18830, 18837, 18844, 18851, 18858, 18865, 18872,
+    18879, 18886, 18893, 18900, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 18907, 18914, 18921, 18930, 18939, 18948,
+    18957, 18966, 18975, 18984, 18991, 19025, 19041, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19050, 19052, 19056, 19060,
+    19062, 19064, 19066, 19068, 19072, 19076, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 19080, 19083,
+    19087, 19091, 19093, 19095, 19097, 19099, 19101, 19103, 19107, 19111,
+    19115, 19119, 19123, 19127, 19131, 19135, 19139, 19143, 19147, 0,
+    0, 19151, 19153, 19155, 19159, 19163, 19167, 19171, 19173, 19175,
+    19177, 19179, 19183, 0, 19185, 19187, 19189, 19191, 19193, 19197,
+    19199, 19201, 19203, 19205, 19209, 19213, 19215, 19217, 19219, 19221,
+    19223, 19225, 19227, 0, 19229, 19231, 19233, 19235, 0, 0,
+    0, 0, 19237, 19241, 19246, 0, 19250, 0, 19254, 19258,
+    19263, 19267, 19272, 19276, 19281, 19285, 19290, 19294, 19299, 19302,
+    19307, 19312, 19317, 19322, 19327, 19332, 19337, 19342, 19347, 19352,
+    19357, 19362, 19365, 19368, 19371, 19374, 19377, 19380, 19383, 19386,
+    19389, 19392, 19395, 19398, 19401, 19404, 19407, 19410, 19413, 19416,
+    19419, 19422, 19425, 19428, 19431, 19434, 19437, 19440, 19443, 19446,
+    19449, 19452, 19455, 19458, 19461, 19464, 19467, 19470, 19473, 19476,
+    19479, 19482, 19485, 19488, 19491, 19494, 19497, 19500, 19503, 19506,
+    19509, 19512, 19515, 19518, 19521, 19524, 19527, 19530, 19533, 19536,
+    19539, 19542, 19545, 19548, 19551, 19554, 19557, 19560, 19563, 19566,
+    19569, 19572, 19575, 19578, 19581, 19584, 19587, 19590, 19593, 19596,
+    19599, 19602, 19605, 19608, 19611, 19614, 19617, 19620, 19623, 19626,
+    19629, 19632, 19635, 19638, 19641, 19644, 19647, 19650, 19653, 19656,
+    19659, 19662, 19665, 19668, 19671, 19674, 19681, 19688, 19695, 19702,
+    19709, 19716, 19721, 0, 0, 0, 0, 19726, 19728, 19730,
+    19732, 19734, 19736, 19738, 19740, 19742, 19744, 19746, 19748, 19750,
+    19752, 19754, 19756, 19758, 19760, 19762, 19764, 19766, 19768, 19770,
+    19772, 19774, 19776, 19778, 19780, 19782, 19784, 19786, 19788, 19790,
+    19792, 19794, 19796, 19798, 19800, 19802, 19804, 19806, 19808, 19810,
+    19812, 19814, 19816, 19818, 19820, 19822, 19824, 19826, 19828, 19830,
+    19832, 19834, 19836, 19838, 19840, 19842, 19844, 19846, 19848, 19850,
+    19852, 19854, 19856, 19858, 19860, 19862, 19864, 19866, 19868, 19870,
+    19872, 19874, 19876, 19878, 19880, 19882, 19884, 19886, 19888, 19890,
+    19892, 19894, 19896, 19898, 19900, 19902, 19904, 19906, 19908, 19910,
+    19912, 19914, 19918, 19922, 19926, 19930, 19934, 19938, 19942, 19946,
+    19950, 19954, 19958, 19962, 19966, 19970, 19974, 19978, 19982, 19986,
+    19990, 19994, 19998, 20002, 20006, 20010, 20014, 20018, 20022, 20026,
+    20030, 20034, 20038, 20042, 20046, 20050, 20054, 20058, 20062, 20066,
+    20070, 20074, 20078, 20082, 20086, 20090, 20094, 20098, 20102, 20106,
+    20110, 20114, 20118, 20122, 20126, 20130, 20134, 20138, 20142, 20146,
+    20150, 20154, 20158, 20162, 20166, 20170, 20174, 20178, 20182, 20186,
+    20190, 20194, 20198, 20202, 20206, 20210, 20214, 20218, 20222, 20226,
+    20230, 20234, 20238, 20242, 20246, 20250, 20254, 20258, 20262, 20266,
+    20270, 20274, 20278, 20282, 20286, 20290, 20294, 0, 0, 0,
+    20298, 20302, 20306, 20310, 20314, 20318, 0, 0, 20322, 20326,
+    20330, 20334, 20338, 20342, 0, 0, 20346, 20350, 20354, 20358,
+    20362, 20366, 0, 0, 20370, 20374, 20378, 0, 0, 0,
+    20382, 20385, 20388, 20391, 20395, 20398, 20401, 0, 20405, 20409,
+    20413, 20417, 20421, 20425, 20429, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 20433, 20438, 20443, 20448, 20453, 20458, 20463, 20468,
+    20473, 20478, 20483, 20488, 20493, 20498, 20503, 20508, 20513, 20518,
+    20523, 20528, 20533, 20538, 20543, 20548, 20553, 20558, 20563, 20568,
+    20573, 20578, 20583, 20588, 20593, 20598, 20603, 20608, 20613, 20618,
+    20623, 20628, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 20633, 20638,
+    20643, 20648, 20653, 20658, 20663, 20668, 20673, 20678, 20683, 20688,
+    20693, 20698, 20703, 20708, 20713, 20718, 20723, 20728, 20733, 20738,
+    20743, 20748, 20753, 20758, 20763, 20768, 20773, 20778, 20783, 20788,
+    20793, 20798, 20803, 20808, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 20813, 20818, 20823, 20828, 20833, 20838, 20843, 20848, 20853,
+    20858, 20863, 0, 20868, 20873, 20878, 20883, 20888, 20893, 20898,
+    20903, 20908, 20913, 20918, 20923, 20928, 20933, 20938, 0, 20943,
+    20948, 20953, 20958, 20963, 20968, 20973, 0, 20978, 20983, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 20988, 20991, 20994,
+    20997, 21000, 0, 21003, 21006, 21010, 21013, 21016, 21019, 21022,
+    21026, 21029, 21032, 21035, 21038, 21041, 21044, 21047, 21050, 21053,
+    21056, 21059, 21062, 21065, 21068, 21073, 21077, 21080, 21085, 21088,
+    21093, 21096, 21099, 21102, 21104, 21107, 21112, 21115, 21118, 21121,
+    21124, 21127, 21131, 21134, 21137, 0, 21141, 21144, 21147, 21150,
+    21153, 21156, 21159, 21162, 21167, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 21172, 21177,
+    21182, 21187, 21192, 21197, 21202, 21207, 21212, 21217, 21222, 21227,
+    21232, 21237, 21242, 21247, 21252, 21257, 21262, 21267, 21272, 21277,
+    21282, 21287, 21292, 21297, 21302, 21307, 21312, 21317, 21322, 21327,
+    21332, 21337, 21342, 21347, 21352, 21357, 21362, 21367, 21372, 21377,
+    21382, 21387, 21392, 21397, 21402, 21407, 21412, 21417, 21422, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 21427, 0,
+    21436, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 21445, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 21454, 21463, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 21472, 21481, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 21490, 21499, 0, 21508, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 21517, 21526, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 21535, 21540, 21545, 21550,
+    21555, 21560, 21565, 21570, 21575, 21580, 21585, 21590, 21595, 21600,
+    21605, 21610, 21615, 21620, 21625, 21630, 21635, 21640, 21645, 21650,
+    21655, 21660, 21665, 21670, 21675, 21680, 21685, 21690, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 21695, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 21704, 21709, 21714, 21719, 21724, 21729,
+    21734, 21739, 21744, 21749, 21754, 21759, 21764, 21769, 21774, 21779,
+    21784, 21789, 21794, 21799, 21804, 21809, 21814, 21819, 21824, 21829,
+    21834, 21839, 21844, 21849, 21854, 21859, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    21864, 21873, 21882, 21895, 21908, 21921, 21934, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 21947, 21956, 21965, 21978, 21991, 22004, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 22017, 22019, 22021, 22023, 22025, 22027, 22029, 22031,
+    22033, 22035, 22037, 22039, 22041, 22043, 22045, 22047, 22049, 22051,
+    22053, 22055, 22057, 22059, 22061, 22063, 22065, 22067, 22069, 22071,
+    22073, 22075, 22077, 22079, 22081, 22083, 22085, 22087, 22089, 22091,
+    22093, 22095, 22097, 22099, 22101, 22103, 22105, 22107, 22109, 22111,
+    22113, 22115, 22117, 22119, 22121, 22123, 22125, 22127, 22129, 22131,
+    22133, 22135, 22137, 22139, 22141, 22143, 22145, 22147, 22149, 22151,
+    22153, 22155, 22157, 22159, 22161, 22163, 22165, 22167, 22169, 22171,
+    22173, 22175, 22177, 22179, 22181, 22183, 22185, 0, 22187, 22189,
+    22191, 22193, 22195, 22197, 22199, 22201, 22203, 22205, 22207, 22209,
+    22211, 22213, 22215, 22217, 22219, 22221, 22223, 22225, 22227, 22229,
+    22231, 22233, 22235, 22237, 22239, 22241, 22243, 22245, 22247, 22249,
+    22251, 22253, 22255, 22257, 22259, 22261, 22263, 22265, 22267, 22269,
+    22271, 22273, 22275, 22277, 22279, 22281, 22283, 22285, 22287, 22289,
+    22291, 22293, 22295, 22297, 22299, 22301, 22303, 22305, 22307, 22309,
+    22311, 22313, 22315, 22317, 22319, 22321, 22323, 22325, 22327, 0,
+    22329, 22331, 0, 0, 22333, 0, 0, 22335, 22337, 0,
+    0, 22339, 22341, 22343, 22345, 0, 22347, 22349, 22351, 22353,
+    22355, 22357, 22359, 22361, 22363, 22365, 22367, 22369, 0, 22371,
+    0, 22373, 22375, 22377, 22379, 22381, 22383, 22385, 0, 22387,
+    22389, 22391, 22393, 22395, 22397, 22399, 22401, 22403, 22405, 22407,
+    22409, 22411, 22413, 22415, 22417, 22419, 22421, 22423, 22425, 22427,
+    22429, 22431, 22433, 22435, 22437, 22439, 22441, 22443, 22445, 22447,
+    22449, 22451, 22453, 22455, 22457, 22459, 22461, 22463, 22465, 22467,
+    22469, 22471, 22473, 22475, 22477, 22479, 22481, 22483, 22485, 22487,
+    22489, 22491, 22493, 22495, 22497, 22499, 22501, 22503, 22505, 22507,
+    22509, 22511, 22513, 22515, 0, 22517, 22519, 22521, 22523, 0,
+    0, 22525, 22527, 22529, 22531, 22533, 22535, 22537, 22539, 0,
+    22541, 22543, 22545, 22547, 22549, 22551, 22553, 0, 22555, 22557,
+    22559, 22561, 22563, 22565, 22567, 22569, 22571, 22573, 22575, 22577,
+    22579, 22581, 22583, 22585, 22587, 22589, 22591, 22593, 22595, 22597,
+    22599, 22601, 22603, 22605, 22607, 22609, 0, 22611, 22613, 22615,
+    22617, 0, 22619, 22621, 22623, 22625, 22627, 0, 22629, 0,
+    0, 0, 22631, 22633, 22635, 22637, 22639, 22641, 22643, 0,
+    22645, 22647, 22649, 22651, 22653, 22655, 22657, 22659, 22661, 22663,
+    22665, 22667, 22669, 22671, 22673, 22675, 22677, 22679, 22681, 22683,
+    22685, 22687, 22689, 22691, 22693, 22695, 22697, 22699, 22701, 22703,
+    22705, 22707, 22709, 22711, 22713, 22715, 22717, 22719, 22721, 22723,
+    22725, 22727, 22729, 22731, 22733, 22735, 22737, 22739, 22741, 22743,
+    22745, 22747, 22749, 22751, 22753, 22755, 22757, 22759, 22761, 22763,
+    22765, 22767, 22769, 22771, 22773, 22775, 22777, 22779, 22781, 22783,
+    22785, 22787, 22789, 22791, 22793, 22795, 22797, 22799, 22801, 22803,
+    22805, 22807, 22809, 22811, 22813, 22815, 22817, 22819, 22821, 22823,
+    22825, 22827, 22829, 22831, 22833, 22835, 22837, 22839, 22841, 22843,
+    22845, 22847, 22849, 22851, 22853, 22855, 22857, 22859, 22861, 22863,
+    22865, 22867, 22869, 22871, 22873, 22875, 22877, 22879, 22881, 22883,
+    22885, 22887, 22889, 22891, 22893, 22895, 22897, 22899, 22901, 22903,
+    22905, 22907, 22909, 22911, 22913, 22915, 22917, 22919, 22921, 22923,
+    22925, 22927, 22929, 22931, 22933, 22935, 22937, 22939, 22941, 22943,
+    22945, 22947, 22949, 22951, 22953, 22955, 22957, 22959, 22961, 22963,
+    22965, 22967, 22969, 22971, 22973, 22975, 22977, 22979, 22981, 22983,
+    22985, 22987, 22989, 22991, 22993, 22995, 22997, 22999, 23001, 23003,
+    23005, 23007, 23009, 23011, 23013, 23015, 23017, 23019, 23021, 23023,
+    23025, 23027, 23029, 23031, 23033, 23035, 23037, 23039, 23041, 23043,
+    23045, 23047, 23049, 23051, 23053, 23055, 23057, 23059, 23061, 23063,
+    23065, 23067, 23069, 23071, 23073, 23075, 23077, 23079, 23081, 23083,
+    23085, 23087, 23089, 23091, 23093, 23095, 23097, 23099, 23101, 23103,
+    23105, 23107, 23109, 23111, 23113, 23115, 23117, 23119, 23121, 23123,
+    23125, 23127, 23129, 23131, 23133, 23135, 23137, 23139, 23141, 23143,
+    23145, 23147, 23149, 23151, 23153, 23155, 23157, 23159, 23161, 23163,
+    23165, 23167, 23169, 23171, 23173, 23175, 23177, 23179, 23181, 23183,
+    23185, 23187, 23189, 23191, 23193, 23195, 23197, 23199, 23201, 23203,
+    23205, 23207, 23209, 23211, 23213, 23215, 23217, 23219, 23221, 23223,
+    23225, 23227, 23229, 23231, 23233, 23235, 23237, 23239, 23241, 23243,
+    23245, 23247, 23249, 23251, 23253, 23255, 23257, 23259, 23261, 23263,
+    23265, 23267, 23269, 23271, 23273, 23275, 23277, 23279, 23281, 23283,
+    23285, 23287, 23289, 23291, 23293, 23295, 23297, 23299, 23301, 23303,
+    23305, 23307, 23309, 23311, 23313, 23315, 23317, 23319, 23321, 23324,
+    0, 0, 23327, 23330, 23333, 23336, 23339, 23342, 23345, 23348,
+    23351, 23354, 23357, 23360, 23363, 23366, 23369, 23372, 23375, 23378,
+    23381, 23384, 23387, 23390, 23393, 23396, 23399, 23402, 23406, 23409,
+    23412, 23415, 23418, 23421, 23424, 23427, 23430, 23433, 23436, 23439,
+    23442, 23445, 23448, 23451, 23454, 23457, 23460, 23463, 23466, 23469,
+    23472, 23475, 23478, 23481, 23485, 23488, 23491, 23494, 23497, 23500,
+    23503, 23506, 23509, 23512, 23515, 23518, 23521, 23524, 23527, 23530,
+    23533, 23536, 23539, 23542, 23545, 23548, 23551, 23554, 23557, 23560,
+    23563, 23566, 23569, 23572, 23575, 23578, 23582, 23585, 23588, 23591,
+    23594, 23597, 23600, 23603, 23606, 23609, 23612, 23615, 23618, 23621,
+    23624, 23627, 23630, 23633, 23636, 23639, 23642, 23645, 23648, 23651,
+    23654, 23657, 23661, 23664, 23667, 23670, 23673, 23676, 23679, 23682,
+    23685, 23688, 23691, 23694, 23697, 23700, 23703, 23706, 23709, 23712,
+    23715, 23718, 23721, 23724, 23727, 23730, 23733, 23736, 23739, 23742,
+    23745, 23748, 23751, 23754, 23758, 23761, 23764, 23767, 23770, 23773,
+    23776, 23779, 23782, 23785, 23788, 23791, 23794, 23797, 23800, 23803,
+    23806, 23809, 23812, 23815, 23818, 23821, 23824, 23827, 23830, 23833,
+    23837, 23840, 23843, 23846, 23849, 23852, 23855, 23858, 23861, 23864,
+    23867, 23870, 23873, 23876, 23879, 23882, 23885, 23888, 23891, 23894,
+    23897, 23900, 23903, 23906, 23909, 23912, 23915, 23918, 23921, 23924,
+    23927, 23930, 23934, 23937, 23940, 23943, 23946, 23949, 23952, 23955,
+    23958, 23961, 23964, 23967, 23970, 23973, 23976, 23979, 23982, 23985,
+    23988, 23991, 23994, 23997, 24000, 24003, 24006, 24009, 24013, 24016,
+    24019, 24022, 24025, 24028, 24031, 24034, 24037, 24040, 24043, 24046,
+    24049, 24052, 24055, 24058, 24061, 24064, 24067, 24070, 24073, 24076,
+    24079, 24082, 24085, 24088, 24091, 24094, 24097, 24100, 24103, 24106,
+    24110, 24113, 24116, 24119, 24122, 24125, 24128, 24131, 24134, 24137,
+    24140, 24143, 24146, 24149, 24152, 24155, 24158, 24161, 24164, 24167,
+    24170, 24173, 24176, 24179, 24182, 24185, 24189, 24192, 24195, 24198,
+    24201, 24204, 24207, 24210, 0, 0, 24213, 24215, 24217, 24219,
+    24221, 24223, 24225, 24227, 24229, 24231, 24233, 24235, 24237, 24239,
+    24241, 24243, 24245, 24247, 24249, 24251, 24253, 24255, 24257, 24259,
+    24261, 24263, 24265, 24267, 24269, 24271, 24273, 24275, 24277, 24279,
+    24281, 24283, 24285, 24287, 24289, 24291, 24293, 24295, 24297, 24299,
+    24301, 24303, 24305, 24307, 24309, 24311, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24313, 24318, 24323, 24328, 24333, 24338, 24343, 24348, 24353, 24358,
+    24363, 24368, 24373, 24378, 24383, 24388, 24393, 24398, 24403, 24408,
+    24413, 24418, 24423, 24428, 24433, 24438, 24443, 24448, 24453, 24458,
+    24463, 24468, 24473, 24478, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24483, 24486, 24489, 24492, 0, 24495,
+    24498, 24501, 24504, 24507, 24510, 24513, 24516, 24519, 24522, 24525,
+    24528, 24531, 24534, 24537, 24540, 24543, 24546, 24549, 24552, 24555,
+    24558, 24561, 24564, 24567, 24570, 24573, 0, 24576, 24579, 0,
+    24582, 0, 0, 24585, 0, 24588, 24591, 24594, 24597, 24600,
+    24603, 24606, 24609, 24612, 24615, 0, 24618, 24621, 24624, 24627,
+    0, 24630, 0, 24633, 0, 0, 0, 0, 0, 0,
+    24636, 0, 0, 0, 0, 24639, 0, 24642, 0, 24645,
+    0, 24648, 24651, 24654, 0, 24657, 24660, 0, 24663, 0,
+    0, 24666, 0, 24669, 0, 24672, 0, 24675, 0, 24678,
+    0, 24681, 24684, 0, 24687, 0, 0, 24690, 24693, 24696,
+    24699, 0, 24702, 24705, 24708, 24711, 24714, 24717, 24720, 0,
+    24723, 24726, 24729, 24732, 0, 24735, 24738, 24741, 24744, 0,
+    24747, 0, 24750, 24753, 24756, 24759, 24762, 24765, 24768, 24771,
+    24774, 24777, 0, 24780, 24783, 24786, 24789, 24792, 24795, 24798,
+    24801, 24804, 24807, 24810, 24813, 24816, 24819, 24822, 24825, 24828,
+    0, 0, 0, 0, 0, 24831, 24834, 24837, 0, 24840,
+    24843, 24846, 24849, 24852, 0, 24855, 24858, 24861, 24864, 24867,
+    24870, 24873, 24876, 24879, 24882, 24885, 24888, 24891, 24894, 24897,
+    24900, 24903, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24906, 24909, 24912, 24915, 24918, 24921, 24924, 24927, 24930, 24933,
+    24936, 0, 0, 0, 0, 0, 24939, 24943, 24947, 24951,
+    24955, 24959, 24963, 24967, 24971, 24975, 24979, 24983, 24987, 24991,
+    24995, 24999, 25003, 25007, 25011, 25015, 25019, 25023, 25027, 25031,
+    25035, 25039, 25043, 25051, 25053, 25055, 25058, 0, 25061, 25063,
+    25065, 25067, 25069, 25071, 25073, 25075, 25077, 25079, 25081, 25083,
+    25085, 25087, 25089, 25091, 25093, 25095, 25097, 25099, 25101, 25103,
+    25105, 25107, 25109, 25111, 25113, 25116, 25119, 25122, 25125, 25129,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 25132, 25135, 25138, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 25141, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 25144, 25151, 25158, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 25162, 25166, 25170, 25174, 25181, 25185, 25189, 25193,
+    25197, 25201, 25205, 25209, 25213, 25217, 25221, 25225, 25229, 25233,
+    25237, 25241, 25245, 25249, 25253, 25257, 25261, 25265, 25269, 25273,
+    25277, 25281, 25285, 25289, 25293, 25297, 25301, 25305, 25309, 25313,
+    25317, 25321, 25325, 25329, 25333, 25337, 0, 0, 0, 0,
+    25341, 25351, 25361, 25371, 25381, 25391, 25401, 25411, 25421, 0,
+    0, 0, 0, 0, 0, 0, 25431, 25435, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 25439, 25441, 25443, 25445,
+    25447, 25449, 25451, 25453, 25455, 25457, 0, 0, 0, 0,
+    0, 0, 25459, 25463, 25467, 25471, 25476, 25480, 25484, 25488,
+    25492, 25496, 25500, 25504, 25508, 25512, 25517, 25521, 25525, 25529,
+    25533, 25538, 25542, 25546, 25550, 25555, 25559, 25563, 25567, 25571,
+    25575, 25580, 25584, 25588, 25592, 25596, 25600, 25604, 25608, 25612,
+    25616, 25620, 25624, 25628, 25632, 25636, 25640, 25644, 25648, 25652,
+    25656, 25660, 25664, 25668, 25672, 25677, 25681, 25685, 25689, 25694,
+    25698, 25702, 25706, 25710, 25714, 25718, 25722, 25726, 25730, 25734,
+    25738, 25742, 25746, 25750, 25754, 25758, 25762, 25766, 25770, 25774,
+    25778, 25782, 25786, 25790, 25794, 25798, 25802, 25806, 25810, 25814,
+    25818, 25822, 25827, 25831, 25835, 25839, 25843, 25847, 25851, 25856,
+    25861, 25865, 25869, 25873, 25877, 25881, 25885, 25889, 25893, 25897,
+    25901, 25906, 25910, 25914, 25918, 25922, 25927, 25931, 25935, 25939,
+    25943, 25947, 25951, 25955, 25959, 25963, 25968, 25972, 25977, 25981,
+    25985, 25989, 25993, 25997, 26001, 26005, 26009, 26013, 26017, 26021,
+    26026, 26030, 26034, 26038, 26042, 26046, 26051, 26055, 26060, 26065,
+    26069, 26073, 26077, 26081, 26086, 26091, 26095, 26099, 26103, 26107,
+    26111, 26115, 26119, 26123, 26127, 26131, 26135, 26140, 26144, 26148,
+    26152, 26156, 26160, 26164, 26168, 26172, 26176, 26180, 26184, 26188,
+    26192, 26196, 26200, 26204, 26208, 26212, 26216, 26221, 26225, 26229,
+    26233, 26237, 26241, 26246, 26250, 26254, 26258, 26262, 26266, 26270,
+    26274, 26278, 26282, 26286, 26290, 26295, 26299, 26303, 26307, 26311,
+    26315, 26319, 26323, 26327, 26331, 26335, 26339, 26343, 26347, 26351,
+    26355, 26359, 26363, 26367, 26372, 26376, 26380, 26384, 26388, 26392,
+    26397, 26401, 26405, 26409, 26413, 26417, 26421, 26425, 26429, 26434,
+    26438, 26442, 26446, 26451, 26455, 26459, 26463, 26467, 26471, 26475,
+    26480, 26485, 26490, 26494, 26499, 26503, 26507, 26511, 26515, 26519,
+    26523, 26527, 26531, 26535, 26539, 26544, 26548, 26552, 26556, 26560,
+    26564, 26568, 26573, 26577, 26581, 26586, 26591, 26595, 26599, 26603,
+    26607, 26611, 26615, 26619, 26623, 26627, 26632, 26636, 26641, 26645,
+    26650, 26654, 26658, 26662, 26667, 26671, 26675, 26680, 26685, 26689,
+    26693, 26697, 26701, 26705, 26709, 26713, 26717, 26721, 26725, 26729,
+    26733, 26737, 26742, 26746, 26751, 26755, 26760, 26764, 26769, 26774,
+    26779, 26783, 26787, 26791, 26796, 26801, 26806, 26811, 26815, 26819,
+    26823, 26827, 26831, 26835, 26839, 26843, 26848, 26852, 26856, 26860,
+    26864, 26869, 26873, 26878, 26883, 26887, 26891, 26895, 26899, 26903,
+    26907, 26912, 26917, 26922, 26926, 26930, 26935, 26939, 26943, 26947,
+    26952, 26956, 26960, 26964, 26968, 26972, 26977, 26981, 26985, 26989,
+    26993, 26997, 27001, 27006, 27011, 27015, 27020, 27024, 27029, 27033,
+    27037, 27041, 27046, 27051, 27055, 27060, 27064, 27069, 27073, 27077,
+    27081, 27085, 27089, 27093, 27098, 27103, 27108, 27113, 27117, 27121,
+    27125, 27129, 27133, 27137, 27141, 27145, 27149, 27153, 27157, 27161,
+    27166, 27170, 27174, 27178, 27182, 27186, 27190, 27194, 27198, 27202,
+    27206, 27210, 27214, 27219, 27224, 27229, 27233, 27237, 27241, 27245,
+    27250, 27254, 27259, 27263, 27267, 27272, 27277, 27281, 27285, 27289,
+    27293, 27297, 27301, 27305, 27309, 27313, 27317, 27321, 27325, 27329,
+    27333, 27337, 27341, 27345, 27349, 27353, 27358, 27362, 27366, 27370,
+    27374, 27378, 27383, 27388, 27392, 27396, 27400, 27404, 27408, 27412,
+    27417, 27421, 27425, 27429, 27433, 27438, 27443, 27447, 27451, 27455,
+    27460, 27464, 27468, 27473, 27478, 27482, 27486, 27490, 27495, 27499,
+    27503, 27507, 27511, 27515, 27519, 27523, 27528, 27532, 27536, 27540,
+    27545, 27549, 27553, 27557, 27561, 27566, 27571, 27575, 27579, 27583,
+    27588, 27592, 27597, 27601, 27605, 27609, 27614, 27618, 27622, 27626,
+    27630, 27634, 27638, 27642, 27647, 27651, 27655, 27659, 27663, 27667,
+    27671, 27676, 27680, 27685, 27690, 27695, 27699, 27703, 27707, 27711,
+    27715, 27719, 27723, 27727, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0
+};
+
+/* the length of each folded form, followed by its UTF-8 */
+static const unsigned char dav_calendar_casefold_data[27732] = {
+    0x00, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01,
+    0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01,
+    0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01,
+    0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01,
+    0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x20, 0x03, 0x20, 0xcc, 0x88, 0x01,
+    0x61, 0x03, 0x20, 0xcc, 0x84, 0x01, 0x32, 0x01, 0x33, 0x03, 0x20, 0xcc,
+    0x81, 0x02, 0xce, 0x9c, 0x03, 0x20, 0xcc, 0xa7, 0x01, 0x31, 0x01, 0x6f,
+    0x05, 0x31, 0xe2, 0x81, 0x84, 0x34, 0x05, 0x31, 0xe2, 0x81, 0x84, 0x32,
+    0x05, 0x33, 0xe2, 0x81, 0x84, 0x34, 0x03, 0x41, 0xcc, 0x80, 0x03, 0x41,
+    0xcc, 0x81, 0x03, 0x41, 0xcc, 0x82, 0x03, 0x41, 0xcc, 0x83, 0x03, 0x41,
+    0xcc, 0x88, 0x03, 0x41, 0xcc, 0x8a, 0x03, 0x43, 0xcc, 0xa7, 0x03, 0x45,
+    0xcc, 0x80, 0x03, 0x45, 0xcc, 0x81, 0x03, 0x45, 0xcc, 0x82, 0x03, 0x45,
+    0xcc, 0x88, 0x03, 0x49, 0xcc, 0x80, 0x03, 0x49, 0xcc, 0x81, 0x03, 0x49,
+    0xcc, 0x82, 0x03, 0x49, 0xcc, 0x88, 0x03, 0x4e, 0xcc, 0x83, 0x03, 0x4f,
+    0xcc, 0x80, 0x03, 0x4f, 0xcc, 0x81, 0x03, 0x4f, 0xcc, 0x82, 0x03, 0x4f,
+    0xcc, 0x83, 0x03, 0x4f, 0xcc, 0x88, 0x03, 0x55, 0xcc, 0x80, 0x03, 0x55,
+    0xcc, 0x81, 0x03, 0x55, 0xcc, 0x82, 0x03, 0x55, 0xcc, 0x88, 0x03, 0x59,
+    0xcc, 0x81, 0x03, 0x41, 0xcc, 0x80, 0x03, 0x41, 0xcc, 0x81, 0x03, 0x41,
+    0xcc, 0x82, 0x03, 0x41, 0xcc, 0x83, 0x03, 0x41, 0xcc, 0x88, 0x03, 0x41,
+    0xcc, 0x8a, 0x02, 0xc3, 0x86, 0x03, 0x43, 0xcc, 0xa7, 0x03, 0x45, 0xcc,
+    0x80, 0x03, 0x45, 0xcc, 0x81, 0x03, 0x45, 0xcc, 0x82, 0x03, 0x45, 0xcc,
+    0x88, 0x03, 0x49, 0xcc, 0x80, 0x03, 0x49, 0xcc, 0x81, 0x03, 0x49, 0xcc,
+    0x82, 0x03, 0x49, 0xcc, 0x88, 0x02, 0xc3, 0x90, 0x03, 0x4e, 0xcc, 0x83,
+    0x03, 0x4f, 0xcc, 0x80, 0x03, 0x4f, 0xcc, 0x81, 0x03, 0x4f, 0xcc, 0x82,
+    0x03, 0x4f, 0xcc, 0x83, 0x03, 0x4f, 0xcc, 0x88, 0x02, 0xc3, 0x98, 0x03,
+    0x55, 0xcc, 0x80, 0x03, 0x55, 0xcc, 0x81, 0x03, 0x55, 0xcc, 0x82, 0x03,
+    0x55, 0xcc, 0x88, 0x03, 0x59, 0xcc, 0x81, 0x02, 0xc3, 0x9e, 0x03, 0x59,
+    0xcc, 0x88, 0x03, 0x41, 0xcc, 0x84, 0x03, 0x41, 0xcc, 0x84, 0x03, 0x41,
+    0xcc, 0x86, 0x03, 0x41, 0xcc, 0x86, 0x03, 0x41, 0xcc, 0xa8, 0x03, 0x41,
+    0xcc, 0xa8, 0x03, 0x43, 0xcc, 0x81, 0x03, 0x43, 0xcc, 0x81, 0x03, 0x43,
+    0xcc, 0x82, 0x03, 0x43, 0xcc, 0x82, 0x03, 0x43, 0xcc, 0x87, 0x03, 0x43,
+    0xcc, 0x87, 0x03, 0x43, 0xcc, 0x8c, 0x03, 0x43, 0xcc, 0x8c, 0x03, 0x44,
+    0xcc, 0x8c, 0x03, 0x44, 0xcc, 0x8c, 0x02, 0xc4, 0x90, 0x03, 0x45, 0xcc,
+    0x84, 0x03, 0x45, 0xcc, 0x84, 0x03, 0x45, 0xcc, 0x86, 0x03, 0x45, 0xcc,
+    0x86, 0x03, 0x45, 0xcc, 0x87, 0x03, 0x45, 0xcc, 0x87, 0x03, 0x45, 0xcc,
+    0xa8, 0x03, 0x45, 0xcc, 0xa8, 0x03, 0x45, 0xcc, 0x8c, 0x03, 0x45, 0xcc,
+    0x8c, 0x03, 0x47, 0xcc, 0x82, 0x03, 0x47, 0xcc, 0x82, 0x03, 0x47, 0xcc,
+    0x86, 0x03, 0x47, 0xcc, 0x86, 0x03, 0x47, 0xcc, 0x87, 0x03, 0x47, 0xcc,
+    0x87, 0x03, 0x47, 0xcc, 0xa7, 0x03, 0x47, 0xcc, 0xa7, 0x03, 0x48, 0xcc,
+    0x82, 0x03, 0x48, 0xcc, 0x82, 0x02, 0xc4, 0xa6, 0x03, 0x49, 0xcc, 0x83,
+    0x03, 0x49, 0xcc, 0x83, 0x03, 0x49, 0xcc, 0x84, 0x03, 0x49, 0xcc, 0x84,
+    0x03, 0x49, 0xcc, 0x86, 0x03, 0x49, 0xcc, 0x86, 0x03, 0x49, 0xcc, 0xa8,
+    0x03, 0x49, 0xcc, 0xa8, 0x03, 0x49, 0xcc, 0x87, 0x01, 0x49, 0x02, 0x49,
+    0x4a, 0x02, 0x49, 0x4a, 0x03, 0x4a, 0xcc, 0x82, 0x03, 0x4a, 0xcc, 0x82,
+    0x03, 0x4b, 0xcc, 0xa7, 0x03, 0x4b, 0xcc, 0xa7, 0x03, 0x4c, 0xcc, 0x81,
+    0x03, 0x4c, 0xcc, 0x81, 0x03, 0x4c, 0xcc, 0xa7, 0x03, 0x4c, 0xcc, 0xa7,
+    0x03, 0x4c, 0xcc, 0x8c, 0x03, 0x4c, 0xcc, 0x8c, 0x03, 0x4c, 0xc2, 0xb7,
+    0x03, 0x4c, 0xc2, 0xb7, 0x02, 0xc5, 0x81, 0x03, 0x4e, 0xcc, 0x81, 0x03,
+    0x4e, 0xcc, 0x81, 0x03, 0x4e, 0xcc, 0xa7, 0x03, 0x4e, 0xcc, 0xa7, 0x03,
+    0x4e, 0xcc, 0x8c, 0x03, 0x4e, 0xcc, 0x8c, 0x03, 0xca, 0xbc, 0x6e, 0x02,
+    0xc5, 0x8a, 0x03, 0x4f, 0xcc, 0x84, 0x03, 0x4f, 0xcc, 0x84, 0x03, 0x4f,
+    0xcc, 0x86, 0x03, 0x4f, 0xcc, 0x86, 0x03, 0x4f, 0xcc, 0x8b, 0x03, 0x4f,
+    0xcc, 0x8b, 0x02, 0xc5, 0x92, 0x03, 0x52, 0xcc, 0x81, 0x03, 0x52, 0xcc,
+    0x81, 0x03, 0x52, 0xcc, 0xa7, 0x03, 0x52, 0xcc, 0xa7, 0x03, 0x52, 0xcc,
+    0x8c, 0x03, 0x52, 0xcc, 0x8c, 0x03, 0x53, 0xcc, 0x81, 0x03, 0x53, 0xcc,
+    0x81, 0x03, 0x53, 0xcc, 0x82, 0x03, 0x53, 0xcc, 0x82, 0x03, 0x53, 0xcc,
+    0xa7, 0x03, 0x53, 0xcc, 0xa7, 0x03, 0x53, 0xcc, 0x8c, 0x03, 0x53, 0xcc,
+    0x8c, 0x03, 0x54, 0xcc, 0xa7, 0x03, 0x54, 0xcc, 0xa7, 0x03, 0x54, 0xcc,
+    0x8c, 0x03, 0x54, 0xcc, 0x8c, 0x02, 0xc5, 0xa6, 0x03, 0x55, 0xcc, 0x83,
+    0x03, 0x55, 0xcc, 0x83, 0x03, 0x55, 0xcc, 0x84, 0x03, 0x55, 0xcc, 0x84,
+    0x03, 0x55, 0xcc, 0x86, 0x03, 0x55, 0xcc, 0x86, 0x03, 0x55, 0xcc, 0x8a,
+    0x03, 0x55, 0xcc, 0x8a, 0x03, 0x55, 0xcc, 0x8b, 0x03, 0x55, 0xcc, 0x8b,
+    0x03, 0x55, 0xcc, 0xa8, 0x03, 0x55, 0xcc, 0xa8, 0x03, 0x57, 0xcc, 0x82,
+    0x03, 0x57, 0xcc, 0x82, 0x03, 0x59, 0xcc, 0x82, 0x03, 0x59, 0xcc, 0x82,
+    0x03, 0x59, 0xcc, 0x88, 0x03, 0x5a, 0xcc, 0x81, 0x03, 0x5a, 0xcc, 0x81,
+    0x03, 0x5a, 0xcc, 0x87, 0x03, 0x5a, 0xcc, 0x87, 0x03, 0x5a, 0xcc, 0x8c,
+    0x03, 0x5a, 0xcc, 0x8c, 0x01, 0x53, 0x02, 0xc9, 0x83, 0x02, 0xc6, 0x82,
+    0x02, 0xc6, 0x84, 0x02, 0xc6, 0x87, 0x02, 0xc6, 0x8b, 0x02, 0xc6, 0x91,
+    0x02, 0xc7, 0xb6, 0x02, 0xc6, 0x98, 0x02, 0xc8, 0xbd, 0x02, 0xc8, 0xa0,
+    0x03, 0x4f, 0xcc, 0x9b, 0x03, 0x4f, 0xcc, 0x9b, 0x02, 0xc6, 0xa2, 0x02,
+    0xc6, 0xa4, 0x02, 0xc6, 0xa7, 0x02, 0xc6, 0xac, 0x03, 0x55, 0xcc, 0x9b,
+    0x03, 0x55, 0xcc, 0x9b, 0x02, 0xc6, 0xb3, 0x02, 0xc6, 0xb5, 0x02, 0xc6,
+    0xb8, 0x02, 0xc6, 0xbc, 0x02, 0xc7, 0xb7, 0x04, 0x44, 0x7a, 0xcc, 0x8c,
+    0x04, 0x44, 0x7a, 0xcc, 0x8c, 0x04, 0x44, 0x7a, 0xcc, 0x8c, 0x02, 0x4c,
+    0x6a, 0x02, 0x4c, 0x6a, 0x02, 0x4c, 0x6a, 0x02, 0x4e, 0x6a, 0x02, 0x4e,
+    0x6a, 0x02, 0x4e, 0x6a, 0x03, 0x41, 0xcc, 0x8c, 0x03, 0x41, 0xcc, 0x8c,
+    0x03, 0x49, 0xcc, 0x8c, 0x03, 0x49, 0xcc, 0x8c, 0x03, 0x4f, 0xcc, 0x8c,
+    0x03, 0x4f, 0xcc, 0x8c, 0x03, 0x55, 0xcc, 0x8c, 0x03, 0x55, 0xcc, 0x8c,
+    0x05, 0x55, 0xcc, 0x88, 0xcc, 0x84, 0x05, 0x55, 0xcc, 0x88, 0xcc, 0x84,
+    0x05, 0x55, 0xcc, 0x88, 0xcc, 0x81, 0x05, 0x55, 0xcc, 0x88, 0xcc, 0x81,
+    0x05, 0x55, 0xcc, 0x88, 0xcc, 0x8c, 0x05, 0x55, 0xcc, 0x88, 0xcc, 0x8c,
+    0x05, 0x55, 0xcc, 0x88, 0xcc, 0x80, 0x05, 0x55, 0xcc, 0x88, 0xcc, 0x80,
+    0x02, 0xc6, 0x8e, 0x05, 0x41, 0xcc, 0x88, 0xcc, 0x84, 0x05, 0x41, 0xcc,
+    0x88, 0xcc, 0x84, 0x05, 0x41, 0xcc, 0x87, 0xcc, 0x84, 0x05, 0x41, 0xcc,
+    0x87, 0xcc, 0x84, 0x04, 0xc3, 0x86, 0xcc, 0x84, 0x04, 0xc3, 0x86, 0xcc,
+    0x84, 0x02, 0xc7, 0xa4, 0x03, 0x47, 0xcc, 0x8c, 0x03, 0x47, 0xcc, 0x8c,
+    0x03, 0x4b, 0xcc, 0x8c, 0x03, 0x4b, 0xcc, 0x8c, 0x03, 0x4f, 0xcc, 0xa8,
+    0x03, 0x4f, 0xcc, 0xa8, 0x05, 0x4f, 0xcc, 0xa8, 0xcc, 0x84, 0x05, 0x4f,
+    0xcc, 0xa8, 0xcc, 0x84, 0x04, 0xc6, 0xb7, 0xcc, 0x8c, 0x04, 0xc6, 0xb7,
+    0xcc, 0x8c, 0x03, 0x6a, 0xcc, 0x8c, 0x02, 0x44, 0x7a, 0x02, 0x44, 0x7a,
+    0x02, 0x44, 0x7a, 0x03, 0x47, 0xcc, 0x81, 0x03, 0x47, 0xcc, 0x81, 0x03,
+    0x4e, 0xcc, 0x80, 0x03, 0x4e, 0xcc, 0x80, 0x05, 0x41, 0xcc, 0x8a, 0xcc,
+    0x81, 0x05, 0x41, 0xcc, 0x8a, 0xcc, 0x81, 0x04, 0xc3, 0x86, 0xcc, 0x81,
+    0x04, 0xc3, 0x86, 0xcc, 0x81, 0x04, 0xc3, 0x98, 0xcc, 0x81, 0x04, 0xc3,
+    0x98, 0xcc, 0x81, 0x03, 0x41, 0xcc, 0x8f, 0x03, 0x41, 0xcc, 0x8f, 0x03,
+    0x41, 0xcc, 0x91, 0x03, 0x41, 0xcc, 0x91, 0x03, 0x45, 0xcc, 0x8f, 0x03,
+    0x45, 0xcc, 0x8f, 0x03, 0x45, 0xcc, 0x91, 0x03, 0x45, 0xcc, 0x91, 0x03,
+    0x49, 0xcc, 0x8f, 0x03, 0x49, 0xcc, 0x8f, 0x03, 0x49, 0xcc, 0x91, 0x03,
+    0x49, 0xcc, 0x91, 0x03, 0x4f, 0xcc, 0x8f, 0x03, 0x4f, 0xcc, 0x8f, 0x03,
+    0x4f, 0xcc, 0x91, 0x03, 0x4f, 0xcc, 0x91, 0x03, 0x52, 0xcc, 0x8f, 0x03,
+    0x52, 0xcc, 0x8f, 0x03, 0x52, 0xcc, 0x91, 0x03, 0x52, 0xcc, 0x91, 0x03,
+    0x55, 0xcc, 0x8f, 0x03, 0x55, 0xcc, 0x8f, 0x03, 0x55, 0xcc, 0x91, 0x03,
+    0x55, 0xcc, 0x91, 0x03, 0x53, 0xcc, 0xa6, 0x03, 0x53, 0xcc, 0xa6, 0x03,
+    0x54, 0xcc, 0xa6, 0x03, 0x54, 0xcc, 0xa6, 0x02, 0xc8, 0x9c, 0x03, 0x48,
+    0xcc, 0x8c, 0x03, 0x48, 0xcc, 0x8c, 0x02, 0xc8, 0xa2, 0x02, 0xc8, 0xa4,
+    0x03, 0x41, 0xcc, 0x87, 0x03, 0x41, 0xcc, 0x87, 0x03, 0x45, 0xcc, 0xa7,
+    0x03, 0x45, 0xcc, 0xa7, 0x05, 0x4f, 0xcc, 0x88, 0xcc, 0x84, 0x05, 0x4f,
+    0xcc, 0x88, 0xcc, 0x84, 0x05, 0x4f, 0xcc, 0x83, 0xcc, 0x84, 0x05, 0x4f,
+    0xcc, 0x83, 0xcc, 0x84, 0x03, 0x4f, 0xcc, 0x87, 0x03, 0x4f, 0xcc, 0x87,
+    0x05, 0x4f, 0xcc, 0x87, 0xcc, 0x84, 0x05, 0x4f, 0xcc, 0x87, 0xcc, 0x84,
+    0x03, 0x59, 0xcc, 0x84, 0x03, 0x59, 0xcc, 0x84, 0x02, 0xc8, 0xbb, 0x03,
+    0xe2, 0xb1, 0xbe, 0x03, 0xe2, 0xb1, 0xbf, 0x02, 0xc9, 0x81, 0x02, 0xc9,
+    0x86, 0x02, 0xc9, 0x88, 0x02, 0xc9, 0x8a, 0x02, 0xc9, 0x8c, 0x02, 0xc9,
+    0x8e, 0x03, 0xe2, 0xb1, 0xaf, 0x03, 0xe2, 0xb1, 0xad, 0x03, 0xe2, 0xb1,
+    0xb0, 0x02, 0xc6, 0x81, 0x02, 0xc6, 0x86, 0x02, 0xc6, 0x89, 0x02, 0xc6,
+    0x8a, 0x02, 0xc6, 0x8f, 0x02, 0xc6, 0x90, 0x03, 0xea, 0x9e, 0xab, 0x02,
+    0xc6, 0x93, 0x03, 0xea, 0x9e, 0xac, 0x02, 0xc6, 0x94, 0x03, 0xea, 0x9e,
+    0x8d, 0x03, 0xea, 0x9e, 0xaa, 0x02, 0xc6, 0x97, 0x02, 0xc6, 0x96, 0x03,
+    0xea, 0x9e, 0xae, 0x03, 0xe2, 0xb1, 0xa2, 0x03, 0xea, 0x9e, 0xad, 0x02,
+    0xc6, 0x9c, 0x03, 0xe2, 0xb1, 0xae, 0x02, 0xc6, 0x9d, 0x02, 0xc6, 0x9f,
+    0x03, 0xe2, 0xb1, 0xa4, 0x02, 0xc6, 0xa6, 0x03, 0xea, 0x9f, 0x85, 0x02,
+    0xc6, 0xa9, 0x03, 0xea, 0x9e, 0xb1, 0x02, 0xc6, 0xae, 0x02, 0xc9, 0x84,
+    0x02, 0xc6, 0xb1, 0x02, 0xc6, 0xb2, 0x02, 0xc9, 0x85, 0x02, 0xc6, 0xb7,
+    0x03, 0xea, 0x9e, 0xb2, 0x03, 0xea, 0x9e, 0xb0, 0x01, 0x68, 0x02, 0xc9,
+    0xa6, 0x01, 0x6a, 0x01, 0x72, 0x02, 0xc9, 0xb9, 0x02, 0xc9, 0xbb, 0x02,
+    0xca, 0x81, 0x01, 0x77, 0x01, 0x79, 0x03, 0x20, 0xcc, 0x86, 0x03, 0x20,
+    0xcc, 0x87, 0x03, 0x20, 0xcc, 0x8a, 0x03, 0x20, 0xcc, 0xa8, 0x03, 0x20,
+    0xcc, 0x83, 0x03, 0x20, 0xcc, 0x8b, 0x02, 0xc9, 0xa3, 0x01, 0x6c, 0x01,
+    0x73, 0x01, 0x78, 0x02, 0xca, 0x95, 0x02, 0xcc, 0x80, 0x02, 0xcc, 0x81,
+    0x02, 0xcc, 0x93, 0x04, 0xcc, 0x88, 0xcc, 0x81, 0x02, 0xce, 0x99, 0x02,
+    0xcd, 0xb0, 0x02, 0xcd, 0xb2, 0x02, 0xca, 0xb9, 0x02, 0xcd, 0xb6, 0x03,
+    0x20, 0xcd, 0x85, 0x02, 0xcf, 0xbd, 0x02, 0xcf, 0xbe, 0x02, 0xcf, 0xbf,
+    0x01, 0x3b, 0x03, 0x20, 0xcc, 0x81, 0x05, 0x20, 0xcc, 0x88, 0xcc, 0x81,
+    0x04, 0xce, 0x91, 0xcc, 0x81, 0x02, 0xc2, 0xb7, 0x04, 0xce, 0x95, 0xcc,
+    0x81, 0x04, 0xce, 0x97, 0xcc, 0x81, 0x04, 0xce, 0x99, 0xcc, 0x81, 0x04,
+    0xce, 0x9f, 0xcc, 0x81, 0x04, 0xce, 0xa5, 0xcc, 0x81, 0x04, 0xce, 0xa9,
+    0xcc, 0x81, 0x06, 0xce, 0xb9, 0xcc, 0x88, 0xcc, 0x81, 0x04, 0xce, 0x99,
+    0xcc, 0x88, 0x04, 0xce, 0xa5, 0xcc, 0x88, 0x04, 0xce, 0x91, 0xcc, 0x81,
+    0x04, 0xce, 0x95, 0xcc, 0x81, 0x04, 0xce, 0x97, 0xcc, 0x81, 0x04, 0xce,
+    0x99, 0xcc, 0x81, 0x06, 0xcf, 0x85, 0xcc, 0x88, 0xcc, 0x81, 0x02, 0xce,
+    0x91, 0x02, 0xce, 0x92, 0x02, 0xce, 0x93, 0x02, 0xce, 0x94, 0x02, 0xce,
+    0x95, 0x02, 0xce, 0x96, 0x02, 0xce, 0x97, 0x02, 0xce, 0x98, 0x02, 0xce,
+    0x99, 0x02, 0xce, 0x9a, 0x02, 0xce, 0x9b, 0x02, 0xce, 0x9c, 0x02, 0xce,
+    0x9d, 0x02, 0xce, 0x9e, 0x02, 0xce, 0x9f, 0x02, 0xce, 0xa0, 0x02, 0xce,
+    0xa1, 0x02, 0xce, 0xa3, 0x02, 0xce, 0xa3, 0x02, 0xce, 0xa4, 0x02, 0xce,
+    0xa5, 0x02, 0xce, 0xa6, 0x02, 0xce, 0xa7, 0x02, 0xce, 0xa8, 0x02, 0xce,
+    0xa9, 0x04, 0xce, 0x99, 0xcc, 0x88, 0x04, 0xce, 0xa5, 0xcc, 0x88, 0x04,
+    0xce, 0x9f, 0xcc, 0x81, 0x04, 0xce, 0xa5, 0xcc, 0x81, 0x04, 0xce, 0xa9,
+    0xcc, 0x81, 0x02, 0xce, 0x92, 0x02, 0xce, 0x98, 0x02, 0xce, 0xa5, 0x04,
+    0xce, 0xa5, 0xcc, 0x81, 0x04, 0xce, 0xa5, 0xcc, 0x88, 0x02, 0xce, 0xa6,
+    0x02, 0xce, 0xa0, 0x02, 0xcf, 0x8f, 0x02, 0xcf, 0x98, 0x02, 0xcf, 0x9a,
+    0x02, 0xcf, 0x9c, 0x02, 0xcf, 0x9e, 0x02, 0xcf, 0xa0, 0x02, 0xcf, 0xa2,
+    0x02, 0xcf, 0xa4, 0x02, 0xcf, 0xa6, 0x02, 0xcf, 0xa8, 0x02, 0xcf, 0xaa,
+    0x02, 0xcf, 0xac, 0x02, 0xcf, 0xae, 0x02, 0xce, 0x9a, 0x02, 0xce, 0xa1,
+    0x02, 0xce, 0xa3, 0x02, 0xcd, 0xbf, 0x02, 0xce, 0x98, 0x02, 0xce, 0x95,
+    0x02, 0xcf, 0xb7, 0x02, 0xce, 0xa3, 0x02, 0xcf, 0xba, 0x04, 0xd0, 0x95,
+    0xcc, 0x80, 0x04, 0xd0, 0x95, 0xcc, 0x88, 0x04, 0xd0, 0x93, 0xcc, 0x81,
+    0x04, 0xd0, 0x86, 0xcc, 0x88, 0x04, 0xd0, 0x9a, 0xcc, 0x81, 0x04, 0xd0,
+    0x98, 0xcc, 0x80, 0x04, 0xd0, 0xa3, 0xcc, 0x86, 0x04, 0xd0, 0x98, 0xcc,
+    0x86, 0x02, 0xd0, 0x90, 0x02, 0xd0, 0x91, 0x02, 0xd0, 0x92, 0x02, 0xd0,
+    0x93, 0x02, 0xd0, 0x94, 0x02, 0xd0, 0x95, 0x02, 0xd0, 0x96, 0x02, 0xd0,
+    0x97, 0x02, 0xd0, 0x98, 0x04, 0xd0, 0x98, 0xcc, 0x86, 0x02, 0xd0, 0x9a,
+    0x02, 0xd0, 0x9b, 0x02, 0xd0, 0x9c, 0x02, 0xd0, 0x9d, 0x02, 0xd0, 0x9e,
+    0x02, 0xd0, 0x9f, 0x02, 0xd0, 0xa0, 0x02, 0xd0, 0xa1, 0x02, 0xd0, 0xa2,
+    0x02, 0xd0, 0xa3, 0x02, 0xd0, 0xa4, 0x02, 0xd0, 0xa5, 0x02, 0xd0, 0xa6,
+    0x02, 0xd0, 0xa7, 0x02, 0xd0, 0xa8, 0x02, 0xd0, 0xa9, 0x02, 0xd0, 0xaa,
+    0x02, 0xd0, 0xab, 0x02, 0xd0, 0xac, 0x02, 0xd0, 0xad, 0x02, 0xd0, 0xae,
+    0x02, 0xd0, 0xaf, 0x04, 0xd0, 0x95, 0xcc, 0x80, 0x04, 0xd0, 0x95, 0xcc,
+    0x88, 0x02, 0xd0, 0x82, 0x04, 0xd0, 0x93, 0xcc, 0x81, 0x02, 0xd0, 0x84,
+    0x02, 0xd0, 0x85, 0x02, 0xd0, 0x86, 0x04, 0xd0, 0x86, 0xcc, 0x88, 0x02,
+    0xd0, 0x88, 0x02, 0xd0, 0x89, 0x02, 0xd0, 0x8a, 0x02, 0xd0, 0x8b, 0x04,
+    0xd0, 0x9a, 0xcc, 0x81, 0x04, 0xd0, 0x98, 0xcc, 0x80, 0x04, 0xd0, 0xa3,
+    0xcc, 0x86, 0x02, 0xd0, 0x8f, 0x02, 0xd1, 0xa0, 0x02, 0xd1, 0xa2, 0x02,
+    0xd1, 0xa4, 0x02, 0xd1, 0xa6, 0x02, 0xd1, 0xa8, 0x02, 0xd1, 0xaa, 0x02,
+    0xd1, 0xac, 0x02, 0xd1, 0xae, 0x02, 0xd1, 0xb0, 0x02, 0xd1, 0xb2, 0x02,
+    0xd1, 0xb4, 0x04, 0xd1, 0xb4, 0xcc, 0x8f, 0x04, 0xd1, 0xb4, 0xcc, 0x8f,
+    0x02, 0xd1, 0xb8, 0x02, 0xd1, 0xba, 0x02, 0xd1, 0xbc, 0x02, 0xd1, 0xbe,
+    0x02, 0xd2, 0x80, 0x02, 0xd2, 0x8a, 0x02, 0xd2, 0x8c, 0x02, 0xd2, 0x8e,
+    0x02, 0xd2, 0x90, 0x02, 0xd2, 0x92, 0x02, 0xd2, 0x94, 0x02, 0xd2, 0x96,
+    0x02, 0xd2, 0x98, 0x02, 0xd2, 0x9a, 0x02, 0xd2, 0x9c, 0x02, 0xd2, 0x9e,
+    0x02, 0xd2, 0xa0, 0x02, 0xd2, 0xa2, 0x02, 0xd2, 0xa4, 0x02, 0xd2, 0xa6,
+    0x02, 0xd2, 0xa8, 0x02, 0xd2, 0xaa, 0x02, 0xd2, 0xac, 0x02, 0xd2, 0xae,
+    0x02, 0xd2, 0xb0, 0x02, 0xd2, 0xb2, 0x02, 0xd2, 0xb4, 0x02, 0xd2, 0xb6,
+    0x02, 0xd2, 0xb8, 0x02, 0xd2, 0xba, 0x02, 0xd2, 0xbc, 0x02, 0xd2, 0xbe,
+    0x04, 0xd0, 0x96, 0xcc, 0x86, 0x04, 0xd0, 0x96, 0xcc, 0x86, 0x02, 0xd3,
+    0x83, 0x02, 0xd3, 0x85, 0x02, 0xd3, 0x87, 0x02, 0xd3, 0x89, 0x02, 0xd3,
+    0x8b, 0x02, 0xd3, 0x8d, 0x02, 0xd3, 0x80, 0x04, 0xd0, 0x90, 0xcc, 0x86,
+    0x04, 0xd0, 0x90, 0xcc, 0x86, 0x04, 0xd0, 0x90, 0xcc, 0x88, 0x04, 0xd0,
+    0x90, 0xcc, 0x88, 0x02, 0xd3, 0x94, 0x04, 0xd0, 0x95, 0xcc, 0x86, 0x04,
+    0xd0, 0x95, 0xcc, 0x86, 0x02, 0xd3, 0x98, 0x04, 0xd3, 0x98, 0xcc, 0x88,
+    0x04, 0xd3, 0x98, 0xcc, 0x88, 0x04, 0xd0, 0x96, 0xcc, 0x88, 0x04, 0xd0,
+    0x96, 0xcc, 0x88, 0x04, 0xd0, 0x97, 0xcc, 0x88, 0x04, 0xd0, 0x97, 0xcc,
+    0x88, 0x02, 0xd3, 0xa0, 0x04, 0xd0, 0x98, 0xcc, 0x84, 0x04, 0xd0, 0x98,
+    0xcc, 0x84, 0x04, 0xd0, 0x98, 0xcc, 0x88, 0x04, 0xd0, 0x98, 0xcc, 0x88,
+    0x04, 0xd0, 0x9e, 0xcc, 0x88, 0x04, 0xd0, 0x9e, 0xcc, 0x88, 0x02, 0xd3,
+    0xa8, 0x04, 0xd3, 0xa8, 0xcc, 0x88, 0x04, 0xd3, 0xa8, 0xcc, 0x88, 0x04,
+    0xd0, 0xad, 0xcc, 0x88, 0x04, 0xd0, 0xad, 0xcc, 0x88, 0x04, 0xd0, 0xa3,
+    0xcc, 0x84, 0x04, 0xd0, 0xa3, 0xcc, 0x84, 0x04, 0xd0, 0xa3, 0xcc, 0x88,
+    0x04, 0xd0, 0xa3, 0xcc, 0x88, 0x04, 0xd0, 0xa3, 0xcc, 0x8b, 0x04, 0xd0,
+    0xa3, 0xcc, 0x8b, 0x04, 0xd0, 0xa7, 0xcc, 0x88, 0x04, 0xd0, 0xa7, 0xcc,
+    0x88, 0x02, 0xd3, 0xb6, 0x04, 0xd0, 0xab, 0xcc, 0x88, 0x04, 0xd0, 0xab,
+    0xcc, 0x88, 0x02, 0xd3, 0xba, 0x02, 0xd3, 0xbc, 0x02, 0xd3, 0xbe, 0x02,
+    0xd4, 0x80, 0x02, 0xd4, 0x82, 0x02, 0xd4, 0x84, 0x02, 0xd4, 0x86, 0x02,
+    0xd4, 0x88, 0x02, 0xd4, 0x8a, 0x02, 0xd4, 0x8c, 0x02, 0xd4, 0x8e, 0x02,
+    0xd4, 0x90, 0x02, 0xd4, 0x92, 0x02, 0xd4, 0x94, 0x02, 0xd4, 0x96, 0x02,
+    0xd4, 0x98, 0x02, 0xd4, 0x9a, 0x02, 0xd4, 0x9c, 0x02, 0xd4, 0x9e, 0x02,
+    0xd4, 0xa0, 0x02, 0xd4, 0xa2, 0x02, 0xd4, 0xa4, 0x02, 0xd4, 0xa6, 0x02,
+    0xd4, 0xa8, 0x02, 0xd4, 0xaa, 0x02, 0xd4, 0xac, 0x02, 0xd4, 0xae, 0x02,
+    0xd4, 0xb1, 0x02, 0xd4, 0xb2, 0x02, 0xd4, 0xb3, 0x02, 0xd4, 0xb4, 0x02,
+    0xd4, 0xb5, 0x02, 0xd4, 0xb6, 0x02, 0xd4, 0xb7, 0x02, 0xd4, 0xb8, 0x02,
+    0xd4, 0xb9, 0x02, 0xd4, 0xba, 0x02, 0xd4, 0xbb, 0x02, 0xd4, 0xbc, 0x02,
+    0xd4, 0xbd, 0x02, 0xd4, 0xbe, 0x02, 0xd4, 0xbf, 0x02, 0xd5, 0x80, 0x02,
+    0xd5, 0x81, 0x02, 0xd5, 0x82, 0x02, 0xd5, 0x83, 0x02, 0xd5, 0x84, 0x02,
+    0xd5, 0x85, 0x02, 0xd5, 0x86, 0x02, 0xd5, 0x87, 0x02, 0xd5, 0x88, 0x02,
+    0xd5, 0x89, 0x02, 0xd5, 0x8a, 0x02, 0xd5, 0x8b, 0x02, 0xd5, 0x8c, 0x02,
+    0xd5, 0x8d, 0x02, 0xd5, 0x8e, 0x02, 0xd5, 0x8f, 0x02, 0xd5, 0x90, 0x02,
+    0xd5, 0x91, 0x02, 0xd5, 0x92, 0x02, 0xd5, 0x93, 0x02, 0xd5, 0x94, 0x02,
+    0xd5, 0x95, 0x02, 0xd5, 0x96, 0x04, 0xd5, 0xa5, 0xd6, 0x82, 0x04, 0xd8,
+    0xa7, 0xd9, 0x93, 0x04, 0xd8, 0xa7, 0xd9, 0x94, 0x04, 0xd9, 0x88, 0xd9,
+    0x94, 0x04, 0xd8, 0xa7, 0xd9, 0x95, 0x04, 0xd9, 0x8a, 0xd9, 0x94, 0x04,
+    0xd8, 0xa7, 0xd9, 0xb4, 0x04, 0xd9, 0x88, 0xd9, 0xb4, 0x04, 0xdb, 0x87,
+    0xd9, 0xb4, 0x04, 0xd9, 0x8a, 0xd9, 0xb4, 0x04, 0xdb, 0x95, 0xd9, 0x94,
+    0x04, 0xdb, 0x81, 0xd9, 0x94, 0x04, 0xdb, 0x92, 0xd9, 0x94, 0x06, 0xe0,
+    0xa4, 0xa8, 0xe0, 0xa4, 0xbc, 0x06, 0xe0, 0xa4, 0xb0, 0xe0, 0xa4, 0xbc,
+    0x06, 0xe0, 0xa4, 0xb3, 0xe0, 0xa4, 0xbc, 0x06, 0xe0, 0xa4, 0x95, 0xe0,
+    0xa4, 0xbc, 0x06, 0xe0, 0xa4, 0x96, 0xe0, 0xa4, 0xbc, 0x06, 0xe0, 0xa4,
+    0x97, 0xe0, 0xa4, 0xbc, 0x06, 0xe0, 0xa4, 0x9c, 0xe0, 0xa4, 0xbc, 0x06,
+    0xe0, 0xa4, 0xa1, 0xe0, 0xa4, 0xbc, 0x06, 0xe0, 0xa4, 0xa2, 0xe0, 0xa4,
+    0xbc, 0x06, 0xe0, 0xa4, 0xab, 0xe0, 0xa4, 0xbc, 0x06, 0xe0, 0xa4, 0xaf,
+    0xe0, 0xa4, 0xbc, 0x06, 0xe0, 0xa7, 0x87, 0xe0, 0xa6, 0xbe, 0x06, 0xe0,
+    0xa7, 0x87, 0xe0, 0xa7, 0x97, 0x06, 0xe0, 0xa6, 0xa1, 0xe0, 0xa6, 0xbc,
+    0x06, 0xe0, 0xa6, 0xa2, 0xe0, 0xa6, 0xbc, 0x06, 0xe0, 0xa6, 0xaf, 0xe0,
+    0xa6, 0xbc, 0x06, 0xe0, 0xa8, 0xb2, 0xe0, 0xa8, 0xbc, 0x06, 0xe0, 0xa8,
+    0xb8, 0xe0, 0xa8, 0xbc, 0x06, 0xe0, 0xa8, 0x96, 0xe0, 0xa8, 0xbc, 0x06,
+    0xe0, 0xa8, 0x97, 0xe0, 0xa8, 0xbc, 0x06, 0xe0, 0xa8, 0x9c, 0xe0, 0xa8,
+    0xbc, 0x06, 0xe0, 0xa8, 0xab, 0xe0, 0xa8, 0xbc, 0x06, 0xe0, 0xad, 0x87,
+    0xe0, 0xad, 0x96, 0x06, 0xe0, 0xad, 0x87, 0xe0, 0xac, 0xbe, 0x06, 0xe0,
+    0xad, 0x87, 0xe0, 0xad, 0x97, 0x06, 0xe0, 0xac, 0xa1, 0xe0, 0xac, 0xbc,
+    0x06, 0xe0, 0xac, 0xa2, 0xe0, 0xac, 0xbc, 0x06, 0xe0, 0xae, 0x92, 0xe0,
+    0xaf, 0x97, 0x06, 0xe0, 0xaf, 0x86, 0xe0, 0xae, 0xbe, 0x06, 0xe0, 0xaf,
+    0x87, 0xe0, 0xae, 0xbe, 0x06, 0xe0, 0xaf, 0x86, 0xe0, 0xaf, 0x97, 0x06,
+    0xe0, 0xb1, 0x86, 0xe0, 0xb1, 0x96, 0x06, 0xe0, 0xb2, 0xbf, 0xe0, 0xb3,
+    0x95, 0x06, 0xe0, 0xb3, 0x86, 0xe0, 0xb3, 0x95, 0x06, 0xe0, 0xb3, 0x86,
+    0xe0, 0xb3, 0x96, 0x06, 0xe0, 0xb3, 0x86, 0xe0, 0xb3, 0x82, 0x09, 0xe0,
+    0xb3, 0x86, 0xe0, 0xb3, 0x82, 0xe0, 0xb3, 0x95, 0x06, 0xe0, 0xb5, 0x86,
+    0xe0, 0xb4, 0xbe, 0x06, 0xe0, 0xb5, 0x87, 0xe0, 0xb4, 0xbe, 0x06, 0xe0,
+    0xb5, 0x86, 0xe0, 0xb5, 0x97, 0x06, 0xe0, 0xb7, 0x99, 0xe0, 0xb7, 0x8a,
+    0x06, 0xe0, 0xb7, 0x99, 0xe0, 0xb7, 0x8f, 0x09, 0xe0, 0xb7, 0x99, 0xe0,
+    0xb7, 0x8f, 0xe0, 0xb7, 0x8a, 0x06, 0xe0, 0xb7, 0x99, 0xe0, 0xb7, 0x9f,
+    0x06, 0xe0, 0xb9, 0x8d, 0xe0, 0xb8, 0xb2, 0x06, 0xe0, 0xbb, 0x8d, 0xe0,
+    0xba, 0xb2, 0x06, 0xe0, 0xba, 0xab, 0xe0, 0xba, 0x99, 0x06, 0xe0, 0xba,
+    0xab, 0xe0, 0xba, 0xa1, 0x03, 0xe0, 0xbc, 0x8b, 0x06, 0xe0, 0xbd, 0x82,
+    0xe0, 0xbe, 0xb7, 0x06, 0xe0, 0xbd, 0x8c, 0xe0, 0xbe, 0xb7, 0x06, 0xe0,
+    0xbd, 0x91, 0xe0, 0xbe, 0xb7, 0x06, 0xe0, 0xbd, 0x96, 0xe0, 0xbe, 0xb7,
+    0x06, 0xe0, 0xbd, 0x9b, 0xe0, 0xbe, 0xb7, 0x06, 0xe0, 0xbd, 0x80, 0xe0,
+    0xbe, 0xb5, 0x06, 0xe0, 0xbd, 0xb1, 0xe0, 0xbd, 0xb2, 0x06, 0xe0, 0xbd,
+    0xb1, 0xe0, 0xbd, 0xb4, 0x06, 0xe0, 0xbe, 0xb2, 0xe0, 0xbe, 0x80, 0x09,
+    0xe0, 0xbe, 0xb2, 0xe0, 0xbd, 0xb1, 0xe0, 0xbe, 0x80, 0x06, 0xe0, 0xbe,
+    0xb3, 0xe0, 0xbe, 0x80, 0x09, 0xe0, 0xbe, 0xb3, 0xe0, 0xbd, 0xb1, 0xe0,
+    0xbe, 0x80, 0x06, 0xe0, 0xbd, 0xb1, 0xe0, 0xbe, 0x80, 0x06, 0xe0, 0xbe,
+    0x92, 0xe0, 0xbe, 0xb7, 0x06, 0xe0, 0xbe, 0x9c, 0xe0, 0xbe, 0xb7, 0x06,
+    0xe0, 0xbe, 0xa1, 0xe0, 0xbe, 0xb7, 0x06, 0xe0, 0xbe, 0xa6, 0xe0, 0xbe,
+    0xb7, 0x06, 0xe0, 0xbe, 0xab, 0xe0, 0xbe, 0xb7, 0x06, 0xe0, 0xbe, 0x90,
+    0xe0, 0xbe, 0xb5, 0x06, 0xe1, 0x80, 0xa5, 0xe1, 0x80, 0xae, 0x03, 0xe1,
+    0x83, 0x9c, 0x03, 0xe1, 0x8f, 0xb0, 0x03, 0xe1, 0x8f, 0xb1, 0x03, 0xe1,
+    0x8f, 0xb2, 0x03, 0xe1, 0x8f, 0xb3, 0x03, 0xe1, 0x8f, 0xb4, 0x03, 0xe1,
+    0x8f, 0xb5, 0x06, 0xe1, 0xac, 0x85, 0xe1, 0xac, 0xb5, 0x06, 0xe1, 0xac,
+    0x87, 0xe1, 0xac, 0xb5, 0x06, 0xe1, 0xac, 0x89, 0xe1, 0xac, 0xb5, 0x06,
+    0xe1, 0xac, 0x8b, 0xe1, 0xac, 0xb5, 0x06, 0xe1, 0xac, 0x8d, 0xe1, 0xac,
+    0xb5, 0x06, 0xe1, 0xac, 0x91, 0xe1, 0xac, 0xb5, 0x06, 0xe1, 0xac, 0xba,
+    0xe1, 0xac, 0xb5, 0x06, 0xe1, 0xac, 0xbc, 0xe1, 0xac, 0xb5, 0x06, 0xe1,
+    0xac, 0xbe, 0xe1, 0xac, 0xb5, 0x06, 0xe1, 0xac, 0xbf, 0xe1, 0xac, 0xb5,
+    0x06, 0xe1, 0xad, 0x82, 0xe1, 0xac, 0xb5, 0x02, 0xd0, 0x92, 0x02, 0xd0,
+    0x94, 0x02, 0xd0, 0x9e, 0x02, 0xd0, 0xa1, 0x02, 0xd0, 0xa2, 0x02, 0xd0,
+    0xa2, 0x02, 0xd0, 0xaa, 0x02, 0xd1, 0xa2, 0x03, 0xea, 0x99, 0x8a, 0x01,
+    0x41, 0x02, 0xc3, 0x86, 0x01, 0x42, 0x01, 0x44, 0x01, 0x45, 0x02, 0xc6,
+    0x8e, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01,
+    0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x02, 0xc8, 0xa2, 0x01, 0x50,
+    0x01, 0x52, 0x01, 0x54, 0x01, 0x55, 0x01, 0x57, 0x01, 0x61, 0x02, 0xc9,
+    0x90, 0x02, 0xc9, 0x91, 0x03, 0xe1, 0xb4, 0x82, 0x01, 0x62, 0x01, 0x64,
+    0x01, 0x65, 0x02, 0xc9, 0x99, 0x02, 0xc9, 0x9b, 0x02, 0xc9, 0x9c, 0x01,
+    0x67, 0x01, 0x6b, 0x01, 0x6d, 0x02, 0xc5, 0x8b, 0x01, 0x6f, 0x02, 0xc9,
+    0x94, 0x03, 0xe1, 0xb4, 0x96, 0x03, 0xe1, 0xb4, 0x97, 0x01, 0x70, 0x01,
+    0x74, 0x01, 0x75, 0x03, 0xe1, 0xb4, 0x9d, 0x02, 0xc9, 0xaf, 0x01, 0x76,
+    0x03, 0xe1, 0xb4, 0xa5, 0x02, 0xce, 0xb2, 0x02, 0xce, 0xb3, 0x02, 0xce,
+    0xb4, 0x02, 0xcf, 0x86, 0x02, 0xcf, 0x87, 0x01, 0x69, 0x01, 0x72, 0x01,
+    0x75, 0x01, 0x76, 0x02, 0xce, 0xb2, 0x02, 0xce, 0xb3, 0x02, 0xcf, 0x81,
+    0x02, 0xcf, 0x86, 0x02, 0xcf, 0x87, 0x02, 0xd0, 0xbd, 0x03, 0xea, 0x9d,
+    0xbd, 0x03, 0xe2, 0xb1, 0xa3, 0x03, 0xea, 0x9f, 0x86, 0x02, 0xc9, 0x92,
+    0x01, 0x63, 0x02, 0xc9, 0x95, 0x02, 0xc3, 0xb0, 0x02, 0xc9, 0x9c, 0x01,
+    0x66, 0x02, 0xc9, 0x9f, 0x02, 0xc9, 0xa1, 0x02, 0xc9, 0xa5, 0x02, 0xc9,
+    0xa8, 0x02, 0xc9, 0xa9, 0x02, 0xc9, 0xaa, 0x03, 0xe1, 0xb5, 0xbb, 0x02,
+    0xca, 0x9d, 0x02, 0xc9, 0xad, 0x03, 0xe1, 0xb6, 0x85, 0x02, 0xca, 0x9f,
+    0x02, 0xc9, 0xb1, 0x02, 0xc9, 0xb0, 0x02, 0xc9, 0xb2, 0x02, 0xc9, 0xb3,
+    0x02, 0xc9, 0xb4, 0x02, 0xc9, 0xb5, 0x02, 0xc9, 0xb8, 0x02, 0xca, 0x82,
+    0x02, 0xca, 0x83, 0x02, 0xc6, 0xab, 0x02, 0xca, 0x89, 0x02, 0xca, 0x8a,
+    0x03, 0xe1, 0xb4, 0x9c, 0x02, 0xca, 0x8b, 0x02, 0xca, 0x8c, 0x01, 0x7a,
+    0x02, 0xca, 0x90, 0x02, 0xca, 0x91, 0x02, 0xca, 0x92, 0x02, 0xce, 0xb8,
+    0x03, 0x41, 0xcc, 0xa5, 0x03, 0x41, 0xcc, 0xa5, 0x03, 0x42, 0xcc, 0x87,
+    0x03, 0x42, 0xcc, 0x87, 0x03, 0x42, 0xcc, 0xa3, 0x03, 0x42, 0xcc, 0xa3,
+    0x03, 0x42, 0xcc, 0xb1, 0x03, 0x42, 0xcc, 0xb1, 0x05, 0x43, 0xcc, 0xa7,
+    0xcc, 0x81, 0x05, 0x43, 0xcc, 0xa7, 0xcc, 0x81, 0x03, 0x44, 0xcc, 0x87,
+    0x03, 0x44, 0xcc, 0x87, 0x03, 0x44, 0xcc, 0xa3, 0x03, 0x44, 0xcc, 0xa3,
+    0x03, 0x44, 0xcc, 0xb1, 0x03, 0x44, 0xcc, 0xb1, 0x03, 0x44, 0xcc, 0xa7,
+    0x03, 0x44, 0xcc, 0xa7, 0x03, 0x44, 0xcc, 0xad, 0x03, 0x44, 0xcc, 0xad,
+    0x05, 0x45, 0xcc, 0x84, 0xcc, 0x80, 0x05, 0x45, 0xcc, 0x84, 0xcc, 0x80,
+    0x05, 0x45, 0xcc, 0x84, 0xcc, 0x81, 0x05, 0x45, 0xcc, 0x84, 0xcc, 0x81,
+    0x03, 0x45, 0xcc, 0xad, 0x03, 0x45, 0xcc, 0xad, 0x03, 0x45, 0xcc, 0xb0,
+    0x03, 0x45, 0xcc, 0xb0, 0x05, 0x45, 0xcc, 0xa7, 0xcc, 0x86, 0x05, 0x45,
+    0xcc, 0xa7, 0xcc, 0x86, 0x03, 0x46, 0xcc, 0x87, 0x03, 0x46, 0xcc, 0x87,
+    0x03, 0x47, 0xcc, 0x84, 0x03, 0x47, 0xcc, 0x84, 0x03, 0x48, 0xcc, 0x87,
+    0x03, 0x48, 0xcc, 0x87, 0x03, 0x48, 0xcc, 0xa3, 0x03, 0x48, 0xcc, 0xa3,
+    0x03, 0x48, 0xcc, 0x88, 0x03, 0x48, 0xcc, 0x88, 0x03, 0x48, 0xcc, 0xa7,
+    0x03, 0x48, 0xcc, 0xa7, 0x03, 0x48, 0xcc, 0xae, 0x03, 0x48, 0xcc, 0xae,
+    0x03, 0x49, 0xcc, 0xb0, 0x03, 0x49, 0xcc, 0xb0, 0x05, 0x49, 0xcc, 0x88,
+    0xcc, 0x81, 0x05, 0x49, 0xcc, 0x88, 0xcc, 0x81, 0x03, 0x4b, 0xcc, 0x81,
+    0x03, 0x4b, 0xcc, 0x81, 0x03, 0x4b, 0xcc, 0xa3, 0x03, 0x4b, 0xcc, 0xa3,
+    0x03, 0x4b, 0xcc, 0xb1, 0x03, 0x4b, 0xcc, 0xb1, 0x03, 0x4c, 0xcc, 0xa3,
+    0x03, 0x4c, 0xcc, 0xa3, 0x05, 0x4c, 0xcc, 0xa3, 0xcc, 0x84, 0x05, 0x4c,
+    0xcc, 0xa3, 0xcc, 0x84, 0x03, 0x4c, 0xcc, 0xb1, 0x03, 0x4c, 0xcc, 0xb1,
+    0x03, 0x4c, 0xcc, 0xad, 0x03, 0x4c, 0xcc, 0xad, 0x03, 0x4d, 0xcc, 0x81,
+    0x03, 0x4d, 0xcc, 0x81, 0x03, 0x4d, 0xcc, 0x87, 0x03, 0x4d, 0xcc, 0x87,
+    0x03, 0x4d, 0xcc, 0xa3, 0x03, 0x4d, 0xcc, 0xa3, 0x03, 0x4e, 0xcc, 0x87,
+    0x03, 0x4e, 0xcc, 0x87, 0x03, 0x4e, 0xcc, 0xa3, 0x03, 0x4e, 0xcc, 0xa3,
+    0x03, 0x4e, 0xcc, 0xb1, 0x03, 0x4e, 0xcc, 0xb1, 0x03, 0x4e, 0xcc, 0xad,
+    0x03, 0x4e, 0xcc, 0xad, 0x05, 0x4f, 0xcc, 0x83, 0xcc, 0x81, 0x05, 0x4f,
+    0xcc, 0x83, 0xcc, 0x81, 0x05, 0x4f, 0xcc, 0x83, 0xcc, 0x88, 0x05, 0x4f,
+    0xcc, 0x83, 0xcc, 0x88, 0x05, 0x4f, 0xcc, 0x84, 0xcc, 0x80, 0x05, 0x4f,
+    0xcc, 0x84, 0xcc, 0x80, 0x05, 0x4f, 0xcc, 0x84, 0xcc, 0x81, 0x05, 0x4f,
+    0xcc, 0x84, 0xcc, 0x81, 0x03, 0x50, 0xcc, 0x81, 0x03, 0x50, 0xcc, 0x81,
+    0x03, 0x50, 0xcc, 0x87, 0x03, 0x50, 0xcc, 0x87, 0x03, 0x52, 0xcc, 0x87,
+    0x03, 0x52, 0xcc, 0x87, 0x03, 0x52, 0xcc, 0xa3, 0x03, 0x52, 0xcc, 0xa3,
+    0x05, 0x52, 0xcc, 0xa3, 0xcc, 0x84, 0x05, 0x52, 0xcc, 0xa3, 0xcc, 0x84,
+    0x03, 0x52, 0xcc, 0xb1, 0x03, 0x52, 0xcc, 0xb1, 0x03, 0x53, 0xcc, 0x87,
+    0x03, 0x53, 0xcc, 0x87, 0x03, 0x53, 0xcc, 0xa3, 0x03, 0x53, 0xcc, 0xa3,
+    0x05, 0x53, 0xcc, 0x81, 0xcc, 0x87, 0x05, 0x53, 0xcc, 0x81, 0xcc, 0x87,
+    0x05, 0x53, 0xcc, 0x8c, 0xcc, 0x87, 0x05, 0x53, 0xcc, 0x8c, 0xcc, 0x87,
+    0x05, 0x53, 0xcc, 0xa3, 0xcc, 0x87, 0x05, 0x53, 0xcc, 0xa3, 0xcc, 0x87,
+    0x03, 0x54, 0xcc, 0x87, 0x03, 0x54, 0xcc, 0x87, 0x03, 0x54, 0xcc, 0xa3,
+    0x03, 0x54, 0xcc, 0xa3, 0x03, 0x54, 0xcc, 0xb1, 0x03, 0x54, 0xcc, 0xb1,
+    0x03, 0x54, 0xcc, 0xad, 0x03, 0x54, 0xcc, 0xad, 0x03, 0x55, 0xcc, 0xa4,
+    0x03, 0x55, 0xcc, 0xa4, 0x03, 0x55, 0xcc, 0xb0, 0x03, 0x55, 0xcc, 0xb0,
+    0x03, 0x55, 0xcc, 0xad, 0x03, 0x55, 0xcc, 0xad, 0x05, 0x55, 0xcc, 0x83,
+    0xcc, 0x81, 0x05, 0x55, 0xcc, 0x83, 0xcc, 0x81, 0x05, 0x55, 0xcc, 0x84,
+    0xcc, 0x88, 0x05, 0x55, 0xcc, 0x84, 0xcc, 0x88, 0x03, 0x56, 0xcc, 0x83,
+    0x03, 0x56, 0xcc, 0x83, 0x03, 0x56, 0xcc, 0xa3, 0x03, 0x56, 0xcc, 0xa3,
+    0x03, 0x57, 0xcc, 0x80, 0x03, 0x57, 0xcc, 0x80, 0x03, 0x57, 0xcc, 0x81,
+    0x03, 0x57, 0xcc, 0x81, 0x03, 0x57, 0xcc, 0x88, 0x03, 0x57, 0xcc, 0x88,
+    0x03, 0x57, 0xcc, 0x87, 0x03, 0x57, 0xcc, 0x87, 0x03, 0x57, 0xcc, 0xa3,
+    0x03, 0x57, 0xcc, 0xa3, 0x03, 0x58, 0xcc, 0x87, 0x03, 0x58, 0xcc, 0x87,
+    0x03, 0x58, 0xcc, 0x88, 0x03, 0x58, 0xcc, 0x88, 0x03, 0x59, 0xcc, 0x87,
+    0x03, 0x59, 0xcc, 0x87, 0x03, 0x5a, 0xcc, 0x82, 0x03, 0x5a, 0xcc, 0x82,
+    0x03, 0x5a, 0xcc, 0xa3, 0x03, 0x5a, 0xcc, 0xa3, 0x03, 0x5a, 0xcc, 0xb1,
+    0x03, 0x5a, 0xcc, 0xb1, 0x03, 0x68, 0xcc, 0xb1, 0x03, 0x74, 0xcc, 0x88,
+    0x03, 0x77, 0xcc, 0x8a, 0x03, 0x79, 0xcc, 0x8a, 0x03, 0x61, 0xca, 0xbe,
+    0x03, 0x53, 0xcc, 0x87, 0x03, 0x41, 0xcc, 0xa3, 0x03, 0x41, 0xcc, 0xa3,
+    0x03, 0x41, 0xcc, 0x89, 0x03, 0x41, 0xcc, 0x89, 0x05, 0x41, 0xcc, 0x82,
+    0xcc, 0x81, 0x05, 0x41, 0xcc, 0x82, 0xcc, 0x81, 0x05, 0x41, 0xcc, 0x82,
+    0xcc, 0x80, 0x05, 0x41, 0xcc, 0x82, 0xcc, 0x80, 0x05, 0x41, 0xcc, 0x82,
+    0xcc, 0x89, 0x05, 0x41, 0xcc, 0x82, 0xcc, 0x89, 0x05, 0x41, 0xcc, 0x82,
+    0xcc, 0x83, 0x05, 0x41, 0xcc, 0x82, 0xcc, 0x83, 0x05, 0x41, 0xcc, 0xa3,
+    0xcc, 0x82, 0x05, 0x41, 0xcc, 0xa3, 0xcc, 0x82, 0x05, 0x41, 0xcc, 0x86,
+    0xcc, 0x81, 0x05, 0x41, 0xcc, 0x86, 0xcc, 0x81, 0x05, 0x41, 0xcc, 0x86,
+    0xcc, 0x80, 0x05, 0x41, 0xcc, 0x86, 0xcc, 0x80, 0x05, 0x41, 0xcc, 0x86,
+    0xcc, 0x89, 0x05, 0x41, 0xcc, 0x86, 0xcc, 0x89, 0x05, 0x41, 0xcc, 0x86,
+    0xcc, 0x83, 0x05, 0x41, 0xcc, 0x86, 0xcc, 0x83, 0x05, 0x41, 0xcc, 0xa3,
+    0xcc, 0x86, 0x05, 0x41, 0xcc, 0xa3, 0xcc, 0x86, 0x03, 0x45, 0xcc, 0xa3,
+    0x03, 0x45, 0xcc, 0xa3, 0x03, 0x45, 0xcc, 0x89, 0x03, 0x45, 0xcc, 0x89,
+    0x03, 0x45, 0xcc, 0x83, 0x03, 0x45, 0xcc, 0x83, 0x05, 0x45, 0xcc, 0x82,
+    0xcc, 0x81, 0x05, 0x45, 0xcc, 0x82, 0xcc, 0x81, 0x05, 0x45, 0xcc, 0x82,
+    0xcc, 0x80, 0x05, 0x45, 0xcc, 0x82, 0xcc, 0x80, 0x05, 0x45, 0xcc, 0x82,
+    0xcc, 0x89, 0x05, 0x45, 0xcc, 0x82, 0xcc, 0x89, 0x05, 0x45, 0xcc, 0x82,
+    0xcc, 0x83, 0x05, 0x45, 0xcc, 0x82, 0xcc, 0x83, 0x05, 0x45, 0xcc, 0xa3,
+    0xcc, 0x82, 0x05, 0x45, 0xcc, 0xa3, 0xcc, 0x82, 0x03, 0x49, 0xcc, 0x89,
+    0x03, 0x49, 0xcc, 0x89, 0x03, 0x49, 0xcc, 0xa3, 0x03, 0x49, 0xcc, 0xa3,
+    0x03, 0x4f, 0xcc, 0xa3, 0x03, 0x4f, 0xcc, 0xa3, 0x03, 0x4f, 0xcc, 0x89,
+    0x03, 0x4f, 0xcc, 0x89, 0x05, 0x4f, 0xcc, 0x82, 0xcc, 0x81, 0x05, 0x4f,
+    0xcc, 0x82, 0xcc, 0x81, 0x05, 0x4f, 0xcc, 0x82, 0xcc, 0x80, 0x05, 0x4f,
+    0xcc, 0x82, 0xcc, 0x80, 0x05, 0x4f, 0xcc, 0x82, 0xcc, 0x89, 0x05, 0x4f,
+    0xcc, 0x82, 0xcc, 0x89, 0x05, 0x4f, 0xcc, 0x82, 0xcc, 0x83, 0x05, 0x4f,
+    0xcc, 0x82, 0xcc, 0x83, 0x05, 0x4f, 0xcc, 0xa3, 0xcc, 0x82, 0x05, 0x4f,
+    0xcc, 0xa3, 0xcc, 0x82, 0x05, 0x4f, 0xcc, 0x9b, 0xcc, 0x81, 0x05, 0x4f,
+    0xcc, 0x9b, 0xcc, 0x81, 0x05, 0x4f, 0xcc, 0x9b, 0xcc, 0x80, 0x05, 0x4f,
+    0xcc, 0x9b, 0xcc, 0x80, 0x05, 0x4f, 0xcc, 0x9b, 0xcc, 0x89, 0x05, 0x4f,
+    0xcc, 0x9b, 0xcc, 0x89, 0x05, 0x4f, 0xcc, 0x9b, 0xcc, 0x83, 0x05, 0x4f,
+    0xcc, 0x9b, 0xcc, 0x83, 0x05, 0x4f, 0xcc, 0x9b, 0xcc, 0xa3, 0x05, 0x4f,
+    0xcc, 0x9b, 0xcc, 0xa3, 0x03, 0x55, 0xcc, 0xa3, 0x03, 0x55, 0xcc, 0xa3,
+    0x03, 0x55, 0xcc, 0x89, 0x03, 0x55, 0xcc, 0x89, 0x05, 0x55, 0xcc, 0x9b,
+    0xcc, 0x81, 0x05, 0x55, 0xcc, 0x9b, 0xcc, 0x81, 0x05, 0x55, 0xcc, 0x9b,
+    0xcc, 0x80, 0x05, 0x55, 0xcc, 0x9b, 0xcc, 0x80, 0x05, 0x55, 0xcc, 0x9b,
+    0xcc, 0x89, 0x05, 0x55, 0xcc, 0x9b, 0xcc, 0x89, 0x05, 0x55, 0xcc, 0x9b,
+    0xcc, 0x83, 0x05, 0x55, 0xcc, 0x9b, 0xcc, 0x83, 0x05, 0x55, 0xcc, 0x9b,
+    0xcc, 0xa3, 0x05, 0x55, 0xcc, 0x9b, 0xcc, 0xa3, 0x03, 0x59, 0xcc, 0x80,
+    0x03, 0x59, 0xcc, 0x80, 0x03, 0x59, 0xcc, 0xa3, 0x03, 0x59, 0xcc, 0xa3,
+    0x03, 0x59, 0xcc, 0x89, 0x03, 0x59, 0xcc, 0x89, 0x03, 0x59, 0xcc, 0x83,
+    0x03, 0x59, 0xcc, 0x83, 0x03, 0xe1, 0xbb, 0xba, 0x03, 0xe1, 0xbb, 0xbc,
+    0x03, 0xe1, 0xbb, 0xbe, 0x04, 0xce, 0x91, 0xcc, 0x93, 0x04, 0xce, 0x91,
+    0xcc, 0x94, 0x06, 0xce, 0x91, 0xcc, 0x93, 0xcc, 0x80, 0x06, 0xce, 0x91,
+    0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce, 0x91, 0xcc, 0x93, 0xcc, 0x81, 0x06,
+    0xce, 0x91, 0xcc, 0x94, 0xcc, 0x81, 0x06, 0xce, 0x91, 0xcc, 0x93, 0xcd,
+    0x82, 0x06, 0xce, 0x91, 0xcc, 0x94, 0xcd, 0x82, 0x04, 0xce, 0x91, 0xcc,
+    0x93, 0x04, 0xce, 0x91, 0xcc, 0x94, 0x06, 0xce, 0x91, 0xcc, 0x93, 0xcc,
+    0x80, 0x06, 0xce, 0x91, 0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce, 0x91, 0xcc,
+    0x93, 0xcc, 0x81, 0x06, 0xce, 0x91, 0xcc, 0x94, 0xcc, 0x81, 0x06, 0xce,
+    0x91, 0xcc, 0x93, 0xcd, 0x82, 0x06, 0xce, 0x91, 0xcc, 0x94, 0xcd, 0x82,
+    0x04, 0xce, 0x95, 0xcc, 0x93, 0x04, 0xce, 0x95, 0xcc, 0x94, 0x06, 0xce,
+    0x95, 0xcc, 0x93, 0xcc, 0x80, 0x06, 0xce, 0x95, 0xcc, 0x94, 0xcc, 0x80,
+    0x06, 0xce, 0x95, 0xcc, 0x93, 0xcc, 0x81, 0x06, 0xce, 0x95, 0xcc, 0x94,
+    0xcc, 0x81, 0x04, 0xce, 0x95, 0xcc, 0x93, 0x04, 0xce, 0x95, 0xcc, 0x94,
+    0x06, 0xce, 0x95, 0xcc, 0x93, 0xcc, 0x80, 0x06, 0xce, 0x95, 0xcc, 0x94,
+    0xcc, 0x80, 0x06, 0xce, 0x95, 0xcc, 0x93, 0xcc, 0x81, 0x06, 0xce, 0x95,
+    0xcc, 0x94, 0xcc, 0x81, 0x04, 0xce, 0x97, 0xcc, 0x93, 0x04, 0xce, 0x97,
+    0xcc, 0x94, 0x06, 0xce, 0x97, 0xcc, 0x93, 0xcc, 0x80, 0x06, 0xce, 0x97,
+    0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce, 0x97, 0xcc, 0x93, 0xcc, 0x81, 0x06,
+    0xce, 0x97, 0xcc, 0x94, 0xcc, 0x81, 0x06, 0xce, 0x97, 0xcc, 0x93, 0xcd,
+    0x82, 0x06, 0xce, 0x97, 0xcc, 0x94, 0xcd, 0x82, 0x04, 0xce, 0x97, 0xcc,
+    0x93, 0x04, 0xce, 0x97, 0xcc, 0x94, 0x06, 0xce, 0x97, 0xcc, 0x93, 0xcc,
+    0x80, 0x06, 0xce, 0x97, 0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce, 0x97, 0xcc,
+    0x93, 0xcc, 0x81, 0x06, 0xce, 0x97, 0xcc, 0x94, 0xcc, 0x81, 0x06, 0xce,
+    0x97, 0xcc, 0x93, 0xcd, 0x82, 0x06, 0xce, 0x97, 0xcc, 0x94, 0xcd, 0x82,
+    0x04, 0xce, 0x99, 0xcc, 0x93, 0x04, 0xce, 0x99, 0xcc, 0x94, 0x06, 0xce,
+    0x99, 0xcc, 0x93, 0xcc, 0x80, 0x06, 0xce, 0x99, 0xcc, 0x94, 0xcc, 0x80,
+    0x06, 0xce, 0x99, 0xcc, 0x93, 0xcc, 0x81, 0x06, 0xce, 0x99, 0xcc, 0x94,
+    0xcc, 0x81, 0x06, 0xce, 0x99, 0xcc, 0x93, 0xcd, 0x82, 0x06, 0xce, 0x99,
+    0xcc, 0x94, 0xcd, 0x82, 0x04, 0xce, 0x99, 0xcc, 0x93, 0x04, 0xce, 0x99,
+    0xcc, 0x94, 0x06, 0xce, 0x99, 0xcc, 0x93, 0xcc, 0x80, 0x06, 0xce, 0x99,
+    0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce, 0x99, 0xcc, 0x93, 0xcc, 0x81, 0x06,
+    0xce, 0x99, 0xcc, 0x94, 0xcc, 0x81, 0x06, 0xce, 0x99, 0xcc, 0x93, 0xcd,
+    0x82, 0x06, 0xce, 0x99, 0xcc, 0x94, 0xcd, 0x82, 0x04, 0xce, 0x9f, 0xcc,
+    0x93, 0x04, 0xce, 0x9f, 0xcc, 0x94, 0x06, 0xce, 0x9f, 0xcc, 0x93, 0xcc,
+    0x80, 0x06, 0xce, 0x9f, 0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce, 0x9f, 0xcc,
+    0x93, 0xcc, 0x81, 0x06, 0xce, 0x9f, 0xcc, 0x94, 0xcc, 0x81, 0x04, 0xce,
+    0x9f, 0xcc, 0x93, 0x04, 0xce, 0x9f, 0xcc, 0x94, 0x06, 0xce, 0x9f, 0xcc,
+    0x93, 0xcc, 0x80, 0x06, 0xce, 0x9f, 0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce,
+    0x9f, 0xcc, 0x93, 0xcc, 0x81, 0x06, 0xce, 0x9f, 0xcc, 0x94, 0xcc, 0x81,
+    0x04, 0xcf, 0x85, 0xcc, 0x93, 0x04, 0xce, 0xa5, 0xcc, 0x94, 0x06, 0xcf,
+    0x85, 0xcc, 0x93, 0xcc, 0x80, 0x06, 0xce, 0xa5, 0xcc, 0x94, 0xcc, 0x80,
+    0x06, 0xcf, 0x85, 0xcc, 0x93, 0xcc, 0x81, 0x06, 0xce, 0xa5, 0xcc, 0x94,
+    0xcc, 0x81, 0x06, 0xcf, 0x85, 0xcc, 0x93, 0xcd, 0x82, 0x06, 0xce, 0xa5,
+    0xcc, 0x94, 0xcd, 0x82, 0x04, 0xce, 0xa5, 0xcc, 0x94, 0x06, 0xce, 0xa5,
+    0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce, 0xa5, 0xcc, 0x94, 0xcc, 0x81, 0x06,
+    0xce, 0xa5, 0xcc, 0x94, 0xcd, 0x82, 0x04, 0xce, 0xa9, 0xcc, 0x93, 0x04,
+    0xce, 0xa9, 0xcc, 0x94, 0x06, 0xce, 0xa9, 0xcc, 0x93, 0xcc, 0x80, 0x06,
+    0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce, 0xa9, 0xcc, 0x93, 0xcc,
+    0x81, 0x06, 0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x81, 0x06, 0xce, 0xa9, 0xcc,
+    0x93, 0xcd, 0x82, 0x06, 0xce, 0xa9, 0xcc, 0x94, 0xcd, 0x82, 0x04, 0xce,
+    0xa9, 0xcc, 0x93, 0x04, 0xce, 0xa9, 0xcc, 0x94, 0x06, 0xce, 0xa9, 0xcc,
+    0x93, 0xcc, 0x80, 0x06, 0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x80, 0x06, 0xce,
+    0xa9, 0xcc, 0x93, 0xcc, 0x81, 0x06, 0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x81,
+    0x06, 0xce, 0xa9, 0xcc, 0x93, 0xcd, 0x82, 0x06, 0xce, 0xa9, 0xcc, 0x94,
+    0xcd, 0x82, 0x04, 0xce, 0x91, 0xcc, 0x80, 0x04, 0xce, 0x91, 0xcc, 0x81,
+    0x04, 0xce, 0x95, 0xcc, 0x80, 0x04, 0xce, 0x95, 0xcc, 0x81, 0x04, 0xce,
+    0x97, 0xcc, 0x80, 0x04, 0xce, 0x97, 0xcc, 0x81, 0x04, 0xce, 0x99, 0xcc,
+    0x80, 0x04, 0xce, 0x99, 0xcc, 0x81, 0x04, 0xce, 0x9f, 0xcc, 0x80, 0x04,
+    0xce, 0x9f, 0xcc, 0x81, 0x04, 0xce, 0xa5, 0xcc, 0x80, 0x04, 0xce, 0xa5,
+    0xcc, 0x81, 0x04, 0xce, 0xa9, 0xcc, 0x80, 0x04, 0xce, 0xa9, 0xcc, 0x81,
+    0x06, 0xce, 0x91, 0xcc, 0x93, 0xcd, 0x85, 0x06, 0xce, 0x91, 0xcc, 0x94,
+    0xcd, 0x85, 0x08, 0xce, 0x91, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85, 0x08,
+    0xce, 0x91, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85, 0x08, 0xce, 0x91, 0xcc,
+    0x93, 0xcc, 0x81, 0xcd, 0x85, 0x08, 0xce, 0x91, 0xcc, 0x94, 0xcc, 0x81,
+    0xcd, 0x85, 0x08, 0xce, 0x91, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0x08,
+    0xce, 0x91, 0xcc, 0x94, 0xcd, 0x82, 0xcd, 0x85, 0x06, 0xce, 0x91, 0xcc,
+    0x93, 0xcd, 0x85, 0x06, 0xce, 0x91, 0xcc, 0x94, 0xcd, 0x85, 0x08, 0xce,
+    0x91, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85, 0x08, 0xce, 0x91, 0xcc, 0x94,
+    0xcc, 0x80, 0xcd, 0x85, 0x08, 0xce, 0x91, 0xcc, 0x93, 0xcc, 0x81, 0xcd,
+    0x85, 0x08, 0xce, 0x91, 0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85, 0x08, 0xce,
+    0x91, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0x08, 0xce, 0x91, 0xcc, 0x94,
+    0xcd, 0x82, 0xcd, 0x85, 0x06, 0xce, 0x97, 0xcc, 0x93, 0xcd, 0x85, 0x06,
+    0xce, 0x97, 0xcc, 0x94, 0xcd, 0x85, 0x08, 0xce, 0x97, 0xcc, 0x93, 0xcc,
+    0x80, 0xcd, 0x85, 0x08, 0xce, 0x97, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85,
+    0x08, 0xce, 0x97, 0xcc, 0x93, 0xcc, 0x81, 0xcd, 0x85, 0x08, 0xce, 0x97,
+    0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85, 0x08, 0xce, 0x97, 0xcc, 0x93, 0xcd,
+    0x82, 0xcd, 0x85, 0x08, 0xce, 0x97, 0xcc, 0x94, 0xcd, 0x82, 0xcd, 0x85,
+    0x06, 0xce, 0x97, 0xcc, 0x93, 0xcd, 0x85, 0x06, 0xce, 0x97, 0xcc, 0x94,
+    0xcd, 0x85, 0x08, 0xce, 0x97, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85, 0x08,
+    0xce, 0x97, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85, 0x08, 0xce, 0x97, 0xcc,
+    0x93, 0xcc, 0x81, 0xcd, 0x85, 0x08, 0xce, 0x97, 0xcc, 0x94, 0xcc, 0x81,
+    0xcd, 0x85, 0x08, 0xce, 0x97, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0x08,
+    0xce, 0x97, 0xcc, 0x94, 0xcd, 0x82, 0xcd, 0x85, 0x06, 0xce, 0xa9, 0xcc,
+    0x93, 0xcd, 0x85, 0x06, 0xce, 0xa9, 0xcc, 0x94, 0xcd, 0x85, 0x08, 0xce,
+    0xa9, 0xcc, 0x93, 0xcc, 0x80, 0xcd, 0x85, 0x08, 0xce, 0xa9, 0xcc, 0x94,
+    0xcc, 0x80, 0xcd, 0x85, 0x08, 0xce, 0xa9, 0xcc, 0x93, 0xcc, 0x81, 0xcd,
+    0x85, 0x08, 0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85, 0x08, 0xce,
+    0xa9, 0xcc, 0x93, 0xcd, 0x82, 0xcd, 0x85, 0x08, 0xce, 0xa9, 0xcc, 0x94,
+    0xcd, 0x82, 0xcd, 0x85, 0x06, 0xce, 0xa9, 0xcc, 0x93, 0xcd, 0x85, 0x06,
+    0xce, 0xa9, 0xcc, 0x94, 0xcd, 0x85, 0x08, 0xce, 0xa9, 0xcc, 0x93, 0xcc,
+    0x80, 0xcd, 0x85, 0x08, 0xce, 0xa9, 0xcc, 0x94, 0xcc, 0x80, 0xcd, 0x85,
+    0x08, 0xce, 0xa9, 0xcc, 0x93, 0xcc, 0x81, 0xcd, 0x85, 0x08, 0xce, 0xa9,
+    0xcc, 0x94, 0xcc, 0x81, 0xcd, 0x85, 0x08, 0xce, 0xa9, 0xcc, 0x93, 0xcd,
+    0x82, 0xcd, 0x85, 0x08, 0xce, 0xa9, 0xcc, 0x94, 0xcd, 0x82, 0xcd, 0x85,
+    0x04, 0xce, 0x91, 0xcc, 0x86, 0x04, 0xce, 0x91, 0xcc, 0x84, 0x06, 0xce,
+    0xb1, 0xcc, 0x80, 0xcd, 0x85, 0x04, 0xce, 0x91, 0xcd, 0x85, 0x06, 0xce,
+    0xb1, 0xcc, 0x81, 0xcd, 0x85, 0x04, 0xce, 0xb1, 0xcd, 0x82, 0x06, 0xce,
+    0xb1, 0xcd, 0x82, 0xcd, 0x85, 0x04, 0xce, 0x91, 0xcc, 0x86, 0x04, 0xce,
+    0x91, 0xcc, 0x84, 0x04, 0xce, 0x91, 0xcc, 0x80, 0x04, 0xce, 0x91, 0xcc,
+    0x81, 0x04, 0xce, 0x91, 0xcd, 0x85, 0x03, 0x20, 0xcc, 0x93, 0x02, 0xce,
+    0x99, 0x03, 0x20, 0xcc, 0x93, 0x03, 0x20, 0xcd, 0x82, 0x05, 0x20, 0xcc,
+    0x88, 0xcd, 0x82, 0x06, 0xce, 0xb7, 0xcc, 0x80, 0xcd, 0x85, 0x04, 0xce,
+    0x97, 0xcd, 0x85, 0x06, 0xce, 0xb7, 0xcc, 0x81, 0xcd, 0x85, 0x04, 0xce,
+    0xb7, 0xcd, 0x82, 0x06, 0xce, 0xb7, 0xcd, 0x82, 0xcd, 0x85, 0x04, 0xce,
+    0x95, 0xcc, 0x80, 0x04, 0xce, 0x95, 0xcc, 0x81, 0x04, 0xce, 0x97, 0xcc,
+    0x80, 0x04, 0xce, 0x97, 0xcc, 0x81, 0x04, 0xce, 0x97, 0xcd, 0x85, 0x05,
+    0x20, 0xcc, 0x93, 0xcc, 0x80, 0x05, 0x20, 0xcc, 0x93, 0xcc, 0x81, 0x05,
+    0x20, 0xcc, 0x93, 0xcd, 0x82, 0x04, 0xce, 0x99, 0xcc, 0x86, 0x04, 0xce,
+    0x99, 0xcc, 0x84, 0x06, 0xce, 0xb9, 0xcc, 0x88, 0xcc, 0x80, 0x06, 0xce,
+    0xb9, 0xcc, 0x88, 0xcc, 0x81, 0x04, 0xce, 0xb9, 0xcd, 0x82, 0x06, 0xce,
+    0xb9, 0xcc, 0x88, 0xcd, 0x82, 0x04, 0xce, 0x99, 0xcc, 0x86, 0x04, 0xce,
+    0x99, 0xcc, 0x84, 0x04, 0xce, 0x99, 0xcc, 0x80, 0x04, 0xce, 0x99, 0xcc,
+    0x81, 0x05, 0x20, 0xcc, 0x94, 0xcc, 0x80, 0x05, 0x20, 0xcc, 0x94, 0xcc,
+    0x81, 0x05, 0x20, 0xcc, 0x94, 0xcd, 0x82, 0x04, 0xce, 0xa5, 0xcc, 0x86,
+    0x04, 0xce, 0xa5, 0xcc, 0x84, 0x06, 0xcf, 0x85, 0xcc, 0x88, 0xcc, 0x80,
+    0x06, 0xcf, 0x85, 0xcc, 0x88, 0xcc, 0x81, 0x04, 0xcf, 0x81, 0xcc, 0x93,
+    0x04, 0xce, 0xa1, 0xcc, 0x94, 0x04, 0xcf, 0x85, 0xcd, 0x82, 0x06, 0xcf,
+    0x85, 0xcc, 0x88, 0xcd, 0x82, 0x04, 0xce, 0xa5, 0xcc, 0x86, 0x04, 0xce,
+    0xa5, 0xcc, 0x84, 0x04, 0xce, 0xa5, 0xcc, 0x80, 0x04, 0xce, 0xa5, 0xcc,
+    0x81, 0x04, 0xce, 0xa1, 0xcc, 0x94, 0x05, 0x20, 0xcc, 0x88, 0xcc, 0x80,
+    0x05, 0x20, 0xcc, 0x88, 0xcc, 0x81, 0x01, 0x60, 0x06, 0xcf, 0x89, 0xcc,
+    0x80, 0xcd, 0x85, 0x04, 0xce, 0xa9, 0xcd, 0x85, 0x06, 0xcf, 0x89, 0xcc,
+    0x81, 0xcd, 0x85, 0x04, 0xcf, 0x89, 0xcd, 0x82, 0x06, 0xcf, 0x89, 0xcd,
+    0x82, 0xcd, 0x85, 0x04, 0xce, 0x9f, 0xcc, 0x80, 0x04, 0xce, 0x9f, 0xcc,
+    0x81, 0x04, 0xce, 0xa9, 0xcc, 0x80, 0x04, 0xce, 0xa9, 0xcc, 0x81, 0x04,
+    0xce, 0xa9, 0xcd, 0x85, 0x03, 0x20, 0xcc, 0x81, 0x03, 0x20, 0xcc, 0x94,
+    0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20,
+    0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x03, 0xe2,
+    0x80, 0x90, 0x03, 0x20, 0xcc, 0xb3, 0x01, 0x2e, 0x02, 0x2e, 0x2e, 0x03,
+    0x2e, 0x2e, 0x2e, 0x01, 0x20, 0x06, 0xe2, 0x80, 0xb2, 0xe2, 0x80, 0xb2,
+    0x09, 0xe2, 0x80, 0xb2, 0xe2, 0x80, 0xb2, 0xe2, 0x80, 0xb2, 0x06, 0xe2,
+    0x80, 0xb5, 0xe2, 0x80, 0xb5, 0x09, 0xe2, 0x80, 0xb5, 0xe2, 0x80, 0xb5,
+    0xe2, 0x80, 0xb5, 0x02, 0x21, 0x21, 0x03, 0x20, 0xcc, 0x85, 0x02, 0x3f,
+    0x3f, 0x02, 0x3f, 0x21, 0x02, 0x21, 0x3f, 0x0c, 0xe2, 0x80, 0xb2, 0xe2,
+    0x80, 0xb2, 0xe2, 0x80, 0xb2, 0xe2, 0x80, 0xb2, 0x01, 0x20, 0x01, 0x30,
+    0x01, 0x69, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38,
+    0x01, 0x39, 0x01, 0x2b, 0x03, 0xe2, 0x88, 0x92, 0x01, 0x3d, 0x01, 0x28,
+    0x01, 0x29, 0x01, 0x6e, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33,
+    0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39,
+    0x01, 0x2b, 0x03, 0xe2, 0x88, 0x92, 0x01, 0x3d, 0x01, 0x28, 0x01, 0x29,
+    0x01, 0x61, 0x01, 0x65, 0x01, 0x6f, 0x01, 0x78, 0x02, 0xc9, 0x99, 0x01,
+    0x68, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x70, 0x01,
+    0x73, 0x01, 0x74, 0x02, 0x52, 0x73, 0x03, 0x61, 0x2f, 0x63, 0x03, 0x61,
+    0x2f, 0x73, 0x01, 0x43, 0x03, 0xc2, 0xb0, 0x43, 0x03, 0x63, 0x2f, 0x6f,
+    0x03, 0x63, 0x2f, 0x75, 0x02, 0xc6, 0x90, 0x03, 0xc2, 0xb0, 0x46, 0x01,
+    0x67, 0x01, 0x48, 0x01, 0x48, 0x01, 0x48, 0x01, 0x68, 0x02, 0xc4, 0xa7,
+    0x01, 0x49, 0x01, 0x49, 0x01, 0x4c, 0x01, 0x6c, 0x01, 0x4e, 0x02, 0x4e,
+    0x6f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x52, 0x01, 0x52, 0x02,
+    0x53, 0x4d, 0x03, 0x54, 0x45, 0x4c, 0x02, 0x54, 0x4d, 0x01, 0x5a, 0x02,
+    0xce, 0xa9, 0x01, 0x5a, 0x01, 0x4b, 0x03, 0x41, 0xcc, 0x8a, 0x01, 0x42,
+    0x01, 0x43, 0x01, 0x65, 0x01, 0x45, 0x01, 0x46, 0x01, 0x4d, 0x01, 0x6f,
+    0x02, 0xd7, 0x90, 0x02, 0xd7, 0x91, 0x02, 0xd7, 0x92, 0x02, 0xd7, 0x93,
+    0x01, 0x69, 0x03, 0x46, 0x41, 0x58, 0x02, 0xcf, 0x80, 0x02, 0xce, 0xb3,
+    0x02, 0xce, 0x93, 0x02, 0xce, 0xa0, 0x03, 0xe2, 0x88, 0x91, 0x01, 0x44,
+    0x01, 0x64, 0x01, 0x65, 0x01, 0x69, 0x01, 0x6a, 0x03, 0xe2, 0x84, 0xb2,
+    0x05, 0x31, 0xe2, 0x81, 0x84, 0x37, 0x05, 0x31, 0xe2, 0x81, 0x84, 0x39,
+    0x06, 0x31, 0xe2, 0x81, 0x84, 0x31, 0x30, 0x05, 0x31, 0xe2, 0x81, 0x84,
+    0x33, 0x05, 0x32, 0xe2, 0x81, 0x84, 0x33, 0x05, 0x31, 0xe2, 0x81, 0x84,
+    0x35, 0x05, 0x32, 0xe2, 0x81, 0x84, 0x35, 0x05, 0x33, 0xe2, 0x81, 0x84,
+    0x35, 0x05, 0x34, 0xe2, 0x81, 0x84, 0x35, 0x05, 0x31, 0xe2, 0x81, 0x84,
+    0x36, 0x05, 0x35, 0xe2, 0x81, 0x84, 0x36, 0x05, 0x31, 0xe2, 0x81, 0x84,
+    0x38, 0x05, 0x33, 0xe2, 0x81, 0x84, 0x38, 0x05, 0x35, 0xe2, 0x81, 0x84,
+    0x38, 0x05, 0x37, 0xe2, 0x81, 0x84, 0x38, 0x04, 0x31, 0xe2, 0x81, 0x84,
+    0x01, 0x49, 0x02, 0x49, 0x49, 0x03, 0x49, 0x49, 0x49, 0x02, 0x49, 0x56,
+    0x01, 0x56, 0x02, 0x56, 0x49, 0x03, 0x56, 0x49, 0x49, 0x04, 0x56, 0x49,
+    0x49, 0x49, 0x02, 0x49, 0x58, 0x01, 0x58, 0x02, 0x58, 0x49, 0x03, 0x58,
+    0x49, 0x49, 0x01, 0x4c, 0x01, 0x43, 0x01, 0x44, 0x01, 0x4d, 0x01, 0x49,
+    0x02, 0x49, 0x49, 0x03, 0x49, 0x49, 0x49, 0x02, 0x49, 0x56, 0x01, 0x56,
+    0x02, 0x56, 0x49, 0x03, 0x56, 0x49, 0x49, 0x04, 0x56, 0x49, 0x49, 0x49,
+    0x02, 0x49, 0x58, 0x01, 0x58, 0x02, 0x58, 0x49, 0x03, 0x58, 0x49, 0x49,
+    0x01, 0x4c, 0x01, 0x43, 0x01, 0x44, 0x01, 0x4d, 0x03, 0xe2, 0x86, 0x83,
+    0x05, 0x30, 0xe2, 0x81, 0x84, 0x33, 0x05, 0xe2, 0x86, 0x90, 0xcc, 0xb8,
+    0x05, 0xe2, 0x86, 0x92, 0xcc, 0xb8, 0x05, 0xe2, 0x86, 0x94, 0xcc, 0xb8,
+    0x05, 0xe2, 0x87, 0x90, 0xcc, 0xb8, 0x05, 0xe2, 0x87, 0x94, 0xcc, 0xb8,
+    0x05, 0xe2, 0x87, 0x92, 0xcc, 0xb8, 0x05, 0xe2, 0x88, 0x83, 0xcc, 0xb8,
+    0x05, 0xe2, 0x88, 0x88, 0xcc, 0xb8, 0x05, 0xe2, 0x88, 0x8b, 0xcc, 0xb8,
+    0x05, 0xe2, 0x88, 0xa3, 0xcc, 0xb8, 0x05, 0xe2, 0x88, 0xa5, 0xcc, 0xb8,
+    0x06, 0xe2, 0x88, 0xab, 0xe2, 0x88, 0xab, 0x09, 0xe2, 0x88, 0xab, 0xe2,
+    0x88, 0xab, 0xe2, 0x88, 0xab, 0x06, 0xe2, 0x88, 0xae, 0xe2, 0x88, 0xae,
+    0x09, 0xe2, 0x88, 0xae, 0xe2, 0x88, 0xae, 0xe2, 0x88, 0xae, 0x05, 0xe2,
+    0x88, 0xbc, 0xcc, 0xb8, 0x05, 0xe2, 0x89, 0x83, 0xcc, 0xb8, 0x05, 0xe2,
+    0x89, 0x85, 0xcc, 0xb8, 0x05, 0xe2, 0x89, 0x88, 0xcc, 0xb8, 0x03, 0x3d,
+    0xcc, 0xb8, 0x05, 0xe2, 0x89, 0xa1, 0xcc, 0xb8, 0x05, 0xe2, 0x89, 0x8d,
+    0xcc, 0xb8, 0x03, 0x3c, 0xcc, 0xb8, 0x03, 0x3e, 0xcc, 0xb8, 0x05, 0xe2,
+    0x89, 0xa4, 0xcc, 0xb8, 0x05, 0xe2, 0x89, 0xa5, 0xcc, 0xb8, 0x05, 0xe2,
+    0x89, 0xb2, 0xcc, 0xb8, 0x05, 0xe2, 0x89, 0xb3, 0xcc, 0xb8, 0x05, 0xe2,
+    0x89, 0xb6, 0xcc, 0xb8, 0x05, 0xe2, 0x89, 0xb7, 0xcc, 0xb8, 0x05, 0xe2,
+    0x89, 0xba, 0xcc, 0xb8, 0x05, 0xe2, 0x89, 0xbb, 0xcc, 0xb8, 0x05, 0xe2,
+    0x8a, 0x82, 0xcc, 0xb8, 0x05, 0xe2, 0x8a, 0x83, 0xcc, 0xb8, 0x05, 0xe2,
+    0x8a, 0x86, 0xcc, 0xb8, 0x05, 0xe2, 0x8a, 0x87, 0xcc, 0xb8, 0x05, 0xe2,
+    0x8a, 0xa2, 0xcc, 0xb8, 0x05, 0xe2, 0x8a, 0xa8, 0xcc, 0xb8, 0x05, 0xe2,
+    0x8a, 0xa9, 0xcc, 0xb8, 0x05, 0xe2, 0x8a, 0xab, 0xcc, 0xb8, 0x05, 0xe2,
+    0x89, 0xbc, 0xcc, 0xb8, 0x05, 0xe2, 0x89, 0xbd, 0xcc, 0xb8, 0x05, 0xe2,
+    0x8a, 0x91, 0xcc, 0xb8, 0x05, 0xe2, 0x8a, 0x92, 0xcc, 0xb8, 0x05, 0xe2,
+    0x8a, 0xb2, 0xcc, 0xb8, 0x05, 0xe2, 0x8a, 0xb3, 0xcc, 0xb8, 0x05, 0xe2,
+    0x8a, 0xb4, 0xcc, 0xb8, 0x05, 0xe2, 0x8a, 0xb5, 0xcc, 0xb8, 0x03, 0xe3,
+    0x80, 0x88, 0x03, 0xe3, 0x80, 0x89, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33,
+    0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39,
+    0x02, 0x31, 0x30, 0x02, 0x31, 0x31, 0x02, 0x31, 0x32, 0x02, 0x31, 0x33,
+    0x02, 0x31, 0x34, 0x02, 0x31, 0x35, 0x02, 0x31, 0x36, 0x02, 0x31, 0x37,
+    0x02, 0x31, 0x38, 0x02, 0x31, 0x39, 0x02, 0x32, 0x30, 0x03, 0x28, 0x31,
+    0x29, 0x03, 0x28, 0x32, 0x29, 0x03, 0x28, 0x33, 0x29, 0x03, 0x28, 0x34,
+    0x29, 0x03, 0x28, 0x35, 0x29, 0x03, 0x28, 0x36, 0x29, 0x03, 0x28, 0x37,
+    0x29, 0x03, 0x28, 0x38, 0x29, 0x03, 0x28, 0x39, 0x29, 0x04, 0x28, 0x31,
+    0x30, 0x29, 0x04, 0x28, 0x31, 0x31, 0x29, 0x04, 0x28, 0x31, 0x32, 0x29,
+    0x04, 0x28, 0x31, 0x33, 0x29, 0x04, 0x28, 0x31, 0x34, 0x29, 0x04, 0x28,
+    0x31, 0x35, 0x29, 0x04, 0x28, 0x31, 0x36, 0x29, 0x04, 0x28, 0x31, 0x37,
+    0x29, 0x04, 0x28, 0x31, 0x38, 0x29, 0x04, 0x28, 0x31, 0x39, 0x29, 0x04,
+    0x28, 0x32, 0x30, 0x29, 0x02, 0x31, 0x2e, 0x02, 0x32, 0x2e, 0x02, 0x33,
+    0x2e, 0x02, 0x34, 0x2e, 0x02, 0x35, 0x2e, 0x02, 0x36, 0x2e, 0x02, 0x37,
+    0x2e, 0x02, 0x38, 0x2e, 0x02, 0x39, 0x2e, 0x03, 0x31, 0x30, 0x2e, 0x03,
+    0x31, 0x31, 0x2e, 0x03, 0x31, 0x32, 0x2e, 0x03, 0x31, 0x33, 0x2e, 0x03,
+    0x31, 0x34, 0x2e, 0x03, 0x31, 0x35, 0x2e, 0x03, 0x31, 0x36, 0x2e, 0x03,
+    0x31, 0x37, 0x2e, 0x03, 0x31, 0x38, 0x2e, 0x03, 0x31, 0x39, 0x2e, 0x03,
+    0x32, 0x30, 0x2e, 0x03, 0x28, 0x61, 0x29, 0x03, 0x28, 0x62, 0x29, 0x03,
+    0x28, 0x63, 0x29, 0x03, 0x28, 0x64, 0x29, 0x03, 0x28, 0x65, 0x29, 0x03,
+    0x28, 0x66, 0x29, 0x03, 0x28, 0x67, 0x29, 0x03, 0x28, 0x68, 0x29, 0x03,
+    0x28, 0x69, 0x29, 0x03, 0x28, 0x6a, 0x29, 0x03, 0x28, 0x6b, 0x29, 0x03,
+    0x28, 0x6c, 0x29, 0x03, 0x28, 0x6d, 0x29, 0x03, 0x28, 0x6e, 0x29, 0x03,
+    0x28, 0x6f, 0x29, 0x03, 0x28, 0x70, 0x29, 0x03, 0x28, 0x71, 0x29, 0x03,
+    0x28, 0x72, 0x29, 0x03, 0x28, 0x73, 0x29, 0x03, 0x28, 0x74, 0x29, 0x03,
+    0x28, 0x75, 0x29, 0x03, 0x28, 0x76, 0x29, 0x03, 0x28, 0x77, 0x29, 0x03,
+    0x28, 0x78, 0x29, 0x03, 0x28, 0x79, 0x29, 0x03, 0x28, 0x7a, 0x29, 0x01,
+    0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01,
+    0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01,
+    0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01,
+    0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01,
+    0x59, 0x01, 0x5a, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01,
+    0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01,
+    0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01,
+    0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01,
+    0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x30, 0x0c, 0xe2, 0x88,
+    0xab, 0xe2, 0x88, 0xab, 0xe2, 0x88, 0xab, 0xe2, 0x88, 0xab, 0x03, 0x3a,
+    0x3a, 0x3d, 0x02, 0x3d, 0x3d, 0x03, 0x3d, 0x3d, 0x3d, 0x05, 0xe2, 0xab,
+    0x9d, 0xcc, 0xb8, 0x03, 0xe2, 0xb0, 0x80, 0x03, 0xe2, 0xb0, 0x81, 0x03,
+    0xe2, 0xb0, 0x82, 0x03, 0xe2, 0xb0, 0x83, 0x03, 0xe2, 0xb0, 0x84, 0x03,
+    0xe2, 0xb0, 0x85, 0x03, 0xe2, 0xb0, 0x86, 0x03, 0xe2, 0xb0, 0x87, 0x03,
+    0xe2, 0xb0, 0x88, 0x03, 0xe2, 0xb0, 0x89, 0x03, 0xe2, 0xb0, 0x8a, 0x03,
+    0xe2, 0xb0, 0x8b, 0x03, 0xe2, 0xb0, 0x8c, 0x03, 0xe2, 0xb0, 0x8d, 0x03,
+    0xe2, 0xb0, 0x8e, 0x03, 0xe2, 0xb0, 0x8f, 0x03, 0xe2, 0xb0, 0x90, 0x03,
+    0xe2, 0xb0, 0x91, 0x03, 0xe2, 0xb0, 0x92, 0x03, 0xe2, 0xb0, 0x93, 0x03,
+    0xe2, 0xb0, 0x94, 0x03, 0xe2, 0xb0, 0x95, 0x03, 0xe2, 0xb0, 0x96, 0x03,
+    0xe2, 0xb0, 0x97, 0x03, 0xe2, 0xb0, 0x98, 0x03, 0xe2, 0xb0, 0x99, 0x03,
+    0xe2, 0xb0, 0x9a, 0x03, 0xe2, 0xb0, 0x9b, 0x03, 0xe2, 0xb0, 0x9c, 0x03,
+    0xe2, 0xb0, 0x9d, 0x03, 0xe2, 0xb0, 0x9e, 0x03, 0xe2, 0xb0, 0x9f, 0x03,
+    0xe2, 0xb0, 0xa0, 0x03, 0xe2, 0xb0, 0xa1, 0x03, 0xe2, 0xb0, 0xa2, 0x03,
+    0xe2, 0xb0, 0xa3, 0x03, 0xe2, 0xb0, 0xa4, 0x03, 0xe2, 0xb0, 0xa5, 0x03,
+    0xe2, 0xb0, 0xa6, 0x03, 0xe2, 0xb0, 0xa7, 0x03, 0xe2, 0xb0, 0xa8, 0x03,
+    0xe2, 0xb0, 0xa9, 0x03, 0xe2, 0xb0, 0xaa, 0x03, 0xe2, 0xb0, 0xab, 0x03,
+    0xe2, 0xb0, 0xac, 0x03, 0xe2, 0xb0, 0xad, 0x03, 0xe2, 0xb0, 0xae, 0x03,
+    0xe2, 0xb0, 0xaf, 0x03, 0xe2, 0xb1, 0xa0, 0x02, 0xc8, 0xba, 0x02, 0xc8,
+    0xbe, 0x03, 0xe2, 0xb1, 0xa7, 0x03, 0xe2, 0xb1, 0xa9, 0x03, 0xe2, 0xb1,
+    0xab, 0x03, 0xe2, 0xb1, 0xb2, 0x03, 0xe2, 0xb1, 0xb5, 0x01, 0x6a, 0x01,
+    0x56, 0x03, 0xe2, 0xb2, 0x80, 0x03, 0xe2, 0xb2, 0x82, 0x03, 0xe2, 0xb2,
+    0x84, 0x03, 0xe2, 0xb2, 0x86, 0x03, 0xe2, 0xb2, 0x88, 0x03, 0xe2, 0xb2,
+    0x8a, 0x03, 0xe2, 0xb2, 0x8c, 0x03, 0xe2, 0xb2, 0x8e, 0x03, 0xe2, 0xb2,
+    0x90, 0x03, 0xe2, 0xb2, 0x92, 0x03, 0xe2, 0xb2, 0x94, 0x03, 0xe2, 0xb2,
+    0x96, 0x03, 0xe2, 0xb2, 0x98, 0x03, 0xe2, 0xb2, 0x9a, 0x03, 0xe2, 0xb2,
+    0x9c, 0x03, 0xe2, 0xb2, 0x9e, 0x03, 0xe2, 0xb2, 0xa0, 0x03, 0xe2, 0xb2,
+    0xa2, 0x03, 0xe2, 0xb2, 0xa4, 0x03, 0xe2, 0xb2, 0xa6, 0x03, 0xe2, 0xb2,
+    0xa8, 0x03, 0xe2, 0xb2, 0xaa, 0x03, 0xe2, 0xb2, 0xac, 0x03, 0xe2, 0xb2,
+    0xae, 0x03, 0xe2, 0xb2, 0xb0, 0x03, 0xe2, 0xb2, 0xb2, 0x03, 0xe2, 0xb2,
+    0xb4, 0x03, 0xe2, 0xb2, 0xb6, 0x03, 0xe2, 0xb2, 0xb8, 0x03, 0xe2, 0xb2,
+    0xba, 0x03, 0xe2, 0xb2, 0xbc, 0x03, 0xe2, 0xb2, 0xbe, 0x03, 0xe2, 0xb3,
+    0x80, 0x03, 0xe2, 0xb3, 0x82, 0x03, 0xe2, 0xb3, 0x84, 0x03, 0xe2, 0xb3,
+    0x86, 0x03, 0xe2, 0xb3, 0x88, 0x03, 0xe2, 0xb3, 0x8a, 0x03, 0xe2, 0xb3,
+    0x8c, 0x03, 0xe2, 0xb3, 0x8e, 0x03, 0xe2, 0xb3, 0x90, 0x03, 0xe2, 0xb3,
+    0x92, 0x03, 0xe2, 0xb3, 0x94, 0x03, 0xe2, 0xb3, 0x96, 0x03, 0xe2, 0xb3,
+    0x98, 0x03, 0xe2, 0xb3, 0x9a, 0x03, 0xe2, 0xb3, 0x9c, 0x03, 0xe2, 0xb3,
+    0x9e, 0x03, 0xe2, 0xb3, 0xa0, 0x03, 0xe2, 0xb3, 0xa2, 0x03, 0xe2, 0xb3,
+    0xab, 0x03, 0xe2, 0xb3, 0xad, 0x03, 0xe2, 0xb3, 0xb2, 0x03, 0xe1, 0x82,
+    0xa0, 0x03, 0xe1, 0x82, 0xa1, 0x03, 0xe1, 0x82, 0xa2, 0x03, 0xe1, 0x82,
+    0xa3, 0x03, 0xe1, 0x82, 0xa4, 0x03, 0xe1, 0x82, 0xa5, 0x03, 0xe1, 0x82,
+    0xa6, 0x03, 0xe1, 0x82, 0xa7, 0x03, 0xe1, 0x82, 0xa8, 0x03, 0xe1, 0x82,
+    0xa9, 0x03, 0xe1, 0x82, 0xaa, 0x03, 0xe1, 0x82, 0xab, 0x03, 0xe1, 0x82,
+    0xac, 0x03, 0xe1, 0x82, 0xad, 0x03, 0xe1, 0x82, 0xae, 0x03, 0xe1, 0x82,
+    0xaf, 0x03, 0xe1, 0x82, 0xb0, 0x03, 0xe1, 0x82, 0xb1, 0x03, 0xe1, 0x82,
+    0xb2, 0x03, 0xe1, 0x82, 0xb3, 0x03, 0xe1, 0x82, 0xb4, 0x03, 0xe1, 0x82,
+    0xb5, 0x03, 0xe1, 0x82, 0xb6, 0x03, 0xe1, 0x82, 0xb7, 0x03, 0xe1, 0x82,
+    0xb8, 0x03, 0xe1, 0x82, 0xb9, 0x03, 0xe1, 0x82, 0xba, 0x03, 0xe1, 0x82,
+    0xbb, 0x03, 0xe1, 0x82, 0xbc, 0x03, 0xe1, 0x82, 0xbd, 0x03, 0xe1, 0x82,
+    0xbe, 0x03, 0xe1, 0x82, 0xbf, 0x03, 0xe1, 0x83, 0x80, 0x03, 0xe1, 0x83,
+    0x81, 0x03, 0xe1, 0x83, 0x82, 0x03, 0xe1, 0x83, 0x83, 0x03, 0xe1, 0x83,
+    0x84, 0x03, 0xe1, 0x83, 0x85, 0x03, 0xe1, 0x83, 0x87, 0x03, 0xe1, 0x83,
+    0x8d, 0x03, 0xe2, 0xb5, 0xa1, 0x03, 0xe6, 0xaf, 0x8d, 0x03, 0xe9, 0xbe,
+    0x9f, 0x03, 0xe4, 0xb8, 0x80, 0x03, 0xe4, 0xb8, 0xa8, 0x03, 0xe4, 0xb8,
+    0xb6, 0x03, 0xe4, 0xb8, 0xbf, 0x03, 0xe4, 0xb9, 0x99, 0x03, 0xe4, 0xba,
+    0x85, 0x03, 0xe4, 0xba, 0x8c, 0x03, 0xe4, 0xba, 0xa0, 0x03, 0xe4, 0xba,
+    0xba, 0x03, 0xe5, 0x84, 0xbf, 0x03, 0xe5, 0x85, 0xa5, 0x03, 0xe5, 0x85,
+    0xab, 0x03, 0xe5, 0x86, 0x82, 0x03, 0xe5, 0x86, 0x96, 0x03, 0xe5, 0x86,
+    0xab, 0x03, 0xe5, 0x87, 0xa0, 0x03, 0xe5, 0x87, 0xb5, 0x03, 0xe5, 0x88,
+    0x80, 0x03, 0xe5, 0x8a, 0x9b, 0x03, 0xe5, 0x8b, 0xb9, 0x03, 0xe5, 0x8c,
+    0x95, 0x03, 0xe5, 0x8c, 0x9a, 0x03, 0xe5, 0x8c, 0xb8, 0x03, 0xe5, 0x8d,
+    0x81, 0x03, 0xe5, 0x8d, 0x9c, 0x03, 0xe5, 0x8d, 0xa9, 0x03, 0xe5, 0x8e,
+    0x82, 0x03, 0xe5, 0x8e, 0xb6, 0x03, 0xe5, 0x8f, 0x88, 0x03, 0xe5, 0x8f,
+    0xa3, 0x03, 0xe5, 0x9b, 0x97, 0x03, 0xe5, 0x9c, 0x9f, 0x03, 0xe5, 0xa3,
+    0xab, 0x03, 0xe5, 0xa4, 0x82, 0x03, 0xe5, 0xa4, 0x8a, 0x03, 0xe5, 0xa4,
+    0x95, 0x03, 0xe5, 0xa4, 0xa7, 0x03, 0xe5, 0xa5, 0xb3, 0x03, 0xe5, 0xad,
+    0x90, 0x03, 0xe5, 0xae, 0x80, 0x03, 0xe5, 0xaf, 0xb8, 0x03, 0xe5, 0xb0,
+    0x8f, 0x03, 0xe5, 0xb0, 0xa2, 0x03, 0xe5, 0xb0, 0xb8, 0x03, 0xe5, 0xb1,
+    0xae, 0x03, 0xe5, 0xb1, 0xb1, 0x03, 0xe5, 0xb7, 0x9b, 0x03, 0xe5, 0xb7,
+    0xa5, 0x03, 0xe5, 0xb7, 0xb1, 0x03, 0xe5, 0xb7, 0xbe, 0x03, 0xe5, 0xb9,
+    0xb2, 0x03, 0xe5, 0xb9, 0xba, 0x03, 0xe5, 0xb9, 0xbf, 0x03, 0xe5, 0xbb,
+    0xb4, 0x03, 0xe5, 0xbb, 0xbe, 0x03, 0xe5, 0xbc, 0x8b, 0x03, 0xe5, 0xbc,
+    0x93, 0x03, 0xe5, 0xbd, 0x90, 0x03, 0xe5, 0xbd, 0xa1, 0x03, 0xe5, 0xbd,
+    0xb3, 0x03, 0xe5, 0xbf, 0x83, 0x03, 0xe6, 0x88, 0x88, 0x03, 0xe6, 0x88,
+    0xb6, 0x03, 0xe6, 0x89, 0x8b, 0x03, 0xe6, 0x94, 0xaf, 0x03, 0xe6, 0x94,
+    0xb4, 0x03, 0xe6, 0x96, 0x87, 0x03, 0xe6, 0x96, 0x97, 0x03, 0xe6, 0x96,
+    0xa4, 0x03, 0xe6, 0x96, 0xb9, 0x03, 0xe6, 0x97, 0xa0, 0x03, 0xe6, 0x97,
+    0xa5, 0x03, 0xe6, 0x9b, 0xb0, 0x03, 0xe6, 0x9c, 0x88, 0x03, 0xe6, 0x9c,
+    0xa8, 0x03, 0xe6, 0xac, 0xa0, 0x03, 0xe6, 0xad, 0xa2, 0x03, 0xe6, 0xad,
+    0xb9, 0x03, 0xe6, 0xae, 0xb3, 0x03, 0xe6, 0xaf, 0x8b, 0x03, 0xe6, 0xaf,
+    0x94, 0x03, 0xe6, 0xaf, 0x9b, 0x03, 0xe6, 0xb0, 0x8f, 0x03, 0xe6, 0xb0,
+    0x94, 0x03, 0xe6, 0xb0, 0xb4, 0x03, 0xe7, 0x81, 0xab, 0x03, 0xe7, 0x88,
+    0xaa, 0x03, 0xe7, 0x88, 0xb6, 0x03, 0xe7, 0x88, 0xbb, 0x03, 0xe7, 0x88,
+    0xbf, 0x03, 0xe7, 0x89, 0x87, 0x03, 0xe7, 0x89, 0x99, 0x03, 0xe7, 0x89,
+    0x9b, 0x03, 0xe7, 0x8a, 0xac, 0x03, 0xe7, 0x8e, 0x84, 0x03, 0xe7, 0x8e,
+    0x89, 0x03, 0xe7, 0x93, 0x9c, 0x03, 0xe7, 0x93, 0xa6, 0x03, 0xe7, 0x94,
+    0x98, 0x03, 0xe7, 0x94, 0x9f, 0x03, 0xe7, 0x94, 0xa8, 0x03, 0xe7, 0x94,
+    0xb0, 0x03, 0xe7, 0x96, 0x8b, 0x03, 0xe7, 0x96, 0x92, 0x03, 0xe7, 0x99,
+    0xb6, 0x03, 0xe7, 0x99, 0xbd, 0x03, 0xe7, 0x9a, 0xae, 0x03, 0xe7, 0x9a,
+    0xbf, 0x03, 0xe7, 0x9b, 0xae, 0x03, 0xe7, 0x9f, 0x9b, 0x03, 0xe7, 0x9f,
+    0xa2, 0x03, 0xe7, 0x9f, 0xb3, 0x03, 0xe7, 0xa4, 0xba, 0x03, 0xe7, 0xa6,
+    0xb8, 0x03, 0xe7, 0xa6, 0xbe, 0x03, 0xe7, 0xa9, 0xb4, 0x03, 0xe7, 0xab,
+    0x8b, 0x03, 0xe7, 0xab, 0xb9, 0x03, 0xe7, 0xb1, 0xb3, 0x03, 0xe7, 0xb3,
+    0xb8, 0x03, 0xe7, 0xbc, 0xb6, 0x03, 0xe7, 0xbd, 0x91, 0x03, 0xe7, 0xbe,
+    0x8a, 0x03, 0xe7, 0xbe, 0xbd, 0x03, 0xe8, 0x80, 0x81, 0x03, 0xe8, 0x80,
+    0x8c, 0x03, 0xe8, 0x80, 0x92, 0x03, 0xe8, 0x80, 0xb3, 0x03, 0xe8, 0x81,
+    0xbf, 0x03, 0xe8, 0x82, 0x89, 0x03, 0xe8, 0x87, 0xa3, 0x03, 0xe8, 0x87,
+    0xaa, 0x03, 0xe8, 0x87, 0xb3, 0x03, 0xe8, 0x87, 0xbc, 0x03, 0xe8, 0x88,
+    0x8c, 0x03, 0xe8, 0x88, 0x9b, 0x03, 0xe8, 0x88, 0x9f, 0x03, 0xe8, 0x89,
+    0xae, 0x03, 0xe8, 0x89, 0xb2, 0x03, 0xe8, 0x89, 0xb8, 0x03, 0xe8, 0x99,
+    0x8d, 0x03, 0xe8, 0x99, 0xab, 0x03, 0xe8, 0xa1, 0x80, 0x03, 0xe8, 0xa1,
+    0x8c, 0x03, 0xe8, 0xa1, 0xa3, 0x03, 0xe8, 0xa5, 0xbe, 0x03, 0xe8, 0xa6,
+    0x8b, 0x03, 0xe8, 0xa7, 0x92, 0x03, 0xe8, 0xa8, 0x80, 0x03, 0xe8, 0xb0,
+    0xb7, 0x03, 0xe8, 0xb1, 0x86, 0x03, 0xe8, 0xb1, 0x95, 0x03, 0xe8, 0xb1,
+    0xb8, 0x03, 0xe8, 0xb2, 0x9d, 0x03, 0xe8, 0xb5, 0xa4, 0x03, 0xe8, 0xb5,
+    0xb0, 0x03, 0xe8, 0xb6, 0xb3, 0x03, 0xe8, 0xba, 0xab, 0x03, 0xe8, 0xbb,
+    0x8a, 0x03, 0xe8, 0xbe, 0x9b, 0x03, 0xe8, 0xbe, 0xb0, 0x03, 0xe8, 0xbe,
+    0xb5, 0x03, 0xe9, 0x82, 0x91, 0x03, 0xe9, 0x85, 0x89, 0x03, 0xe9, 0x87,
+    0x86, 0x03, 0xe9, 0x87, 0x8c, 0x03, 0xe9, 0x87, 0x91, 0x03, 0xe9, 0x95,
+    0xb7, 0x03, 0xe9, 0x96, 0x80, 0x03, 0xe9, 0x98, 0x9c, 0x03, 0xe9, 0x9a,
+    0xb6, 0x03, 0xe9, 0x9a, 0xb9, 0x03, 0xe9, 0x9b, 0xa8, 0x03, 0xe9, 0x9d,
+    0x91, 0x03, 0xe9, 0x9d, 0x9e, 0x03, 0xe9, 0x9d, 0xa2, 0x03, 0xe9, 0x9d,
+    0xa9, 0x03, 0xe9, 0x9f, 0x8b, 0x03, 0xe9, 0x9f, 0xad, 0x03, 0xe9, 0x9f,
+    0xb3, 0x03, 0xe9, 0xa0, 0x81, 0x03, 0xe9, 0xa2, 0xa8, 0x03, 0xe9, 0xa3,
+    0x9b, 0x03, 0xe9, 0xa3, 0x9f, 0x03, 0xe9, 0xa6, 0x96, 0x03, 0xe9, 0xa6,
+    0x99, 0x03, 0xe9, 0xa6, 0xac, 0x03, 0xe9, 0xaa, 0xa8, 0x03, 0xe9, 0xab,
+    0x98, 0x03, 0xe9, 0xab, 0x9f, 0x03, 0xe9, 0xac, 0xa5, 0x03, 0xe9, 0xac,
+    0xaf, 0x03, 0xe9, 0xac, 0xb2, 0x03, 0xe9, 0xac, 0xbc, 0x03, 0xe9, 0xad,
+    0x9a, 0x03, 0xe9, 0xb3, 0xa5, 0x03, 0xe9, 0xb9, 0xb5, 0x03, 0xe9, 0xb9,
+    0xbf, 0x03, 0xe9, 0xba, 0xa5, 0x03, 0xe9, 0xba, 0xbb, 0x03, 0xe9, 0xbb,
+    0x83, 0x03, 0xe9, 0xbb, 0x8d, 0x03, 0xe9, 0xbb, 0x91, 0x03, 0xe9, 0xbb,
+    0xb9, 0x03, 0xe9, 0xbb, 0xbd, 0x03, 0xe9, 0xbc, 0x8e, 0x03, 0xe9, 0xbc,
+    0x93, 0x03, 0xe9, 0xbc, 0xa0, 0x03, 0xe9, 0xbc, 0xbb, 0x03, 0xe9, 0xbd,
+    0x8a, 0x03, 0xe9, 0xbd, 0x92, 0x03, 0xe9, 0xbe, 0x8d, 0x03, 0xe9, 0xbe,
+    0x9c, 0x03, 0xe9, 0xbe, 0xa0, 0x01, 0x20, 0x03, 0xe3, 0x80, 0x92, 0x03,
+    0xe5, 0x8d, 0x81, 0x03, 0xe5, 0x8d, 0x84, 0x03, 0xe5, 0x8d, 0x85, 0x06,
+    0xe3, 0x81, 0x8b, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0x8d, 0xe3, 0x82,
+    0x99, 0x06, 0xe3, 0x81, 0x8f, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0x91,
+    0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0x93, 0xe3, 0x82, 0x99, 0x06, 0xe3,
+    0x81, 0x95, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0x97, 0xe3, 0x82, 0x99,
+    0x06, 0xe3, 0x81, 0x99, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0x9b, 0xe3,
+    0x82, 0x99, 0x06, 0xe3, 0x81, 0x9d, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81,
+    0x9f, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0xa1, 0xe3, 0x82, 0x99, 0x06,
+    0xe3, 0x81, 0xa4, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0xa6, 0xe3, 0x82,
+    0x99, 0x06, 0xe3, 0x81, 0xa8, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0xaf,
+    0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0xaf, 0xe3, 0x82, 0x9a, 0x06, 0xe3,
+    0x81, 0xb2, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0xb2, 0xe3, 0x82, 0x9a,
+    0x06, 0xe3, 0x81, 0xb5, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81, 0xb5, 0xe3,
+    0x82, 0x9a, 0x06, 0xe3, 0x81, 0xb8, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x81,
+    0xb8, 0xe3, 0x82, 0x9a, 0x06, 0xe3, 0x81, 0xbb, 0xe3, 0x82, 0x99, 0x06,
+    0xe3, 0x81, 0xbb, 0xe3, 0x82, 0x9a, 0x06, 0xe3, 0x81, 0x86, 0xe3, 0x82,
+    0x99, 0x04, 0x20, 0xe3, 0x82, 0x99, 0x04, 0x20, 0xe3, 0x82, 0x9a, 0x06,
+    0xe3, 0x82, 0x9d, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x82, 0x88, 0xe3, 0x82,
+    0x8a, 0x06, 0xe3, 0x82, 0xab, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x82, 0xad,
+    0xe3, 0x82, 0x99, 0x06, 0xe3, 0x82, 0xaf, 0xe3, 0x82, 0x99, 0x06, 0xe3,
+    0x82, 0xb1, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x82, 0xb3, 0xe3, 0x82, 0x99,
+    0x06, 0xe3, 0x82, 0xb5, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x82, 0xb7, 0xe3,
+    0x82, 0x99, 0x06, 0xe3, 0x82, 0xb9, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x82,
+    0xbb, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x82, 0xbd, 0xe3, 0x82, 0x99, 0x06,
+    0xe3, 0x82, 0xbf, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x83, 0x81, 0xe3, 0x82,
+    0x99, 0x06, 0xe3, 0x83, 0x84, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x83, 0x86,
+    0xe3, 0x82, 0x99, 0x06, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0x99, 0x06, 0xe3,
+    0x83, 0x8f, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x83, 0x8f, 0xe3, 0x82, 0x9a,
+    0x06, 0xe3, 0x83, 0x92, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x83, 0x92, 0xe3,
+    0x82, 0x9a, 0x06, 0xe3, 0x83, 0x95, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x83,
+    0x95, 0xe3, 0x82, 0x9a, 0x06, 0xe3, 0x83, 0x98, 0xe3, 0x82, 0x99, 0x06,
+    0xe3, 0x83, 0x98, 0xe3, 0x82, 0x9a, 0x06, 0xe3, 0x83, 0x9b, 0xe3, 0x82,
+    0x99, 0x06, 0xe3, 0x83, 0x9b, 0xe3, 0x82, 0x9a, 0x06, 0xe3, 0x82, 0xa6,
+    0xe3, 0x82, 0x99, 0x06, 0xe3, 0x83, 0xaf, 0xe3, 0x82, 0x99, 0x06, 0xe3,
+    0x83, 0xb0, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x83, 0xb1, 0xe3, 0x82, 0x99,
+    0x06, 0xe3, 0x83, 0xb2, 0xe3, 0x82, 0x99, 0x06, 0xe3, 0x83, 0xbd, 0xe3,
+    0x82, 0x99, 0x06, 0xe3, 0x82, 0xb3, 0xe3, 0x83, 0x88, 0x03, 0xe1, 0x84,
+    0x80, 0x03, 0xe1, 0x84, 0x81, 0x03, 0xe1, 0x86, 0xaa, 0x03, 0xe1, 0x84,
+    0x82, 0x03, 0xe1, 0x86, 0xac, 0x03, 0xe1, 0x86, 0xad, 0x03, 0xe1, 0x84,
+    0x83, 0x03, 0xe1, 0x84, 0x84, 0x03, 0xe1, 0x84, 0x85, 0x03, 0xe1, 0x86,
+    0xb0, 0x03, 0xe1, 0x86, 0xb1, 0x03, 0xe1, 0x86, 0xb2, 0x03, 0xe1, 0x86,
+    0xb3, 0x03, 0xe1, 0x86, 0xb4, 0x03, 0xe1, 0x86, 0xb5, 0x03, 0xe1, 0x84,
+    0x9a, 0x03, 0xe1, 0x84, 0x86, 0x03, 0xe1, 0x84, 0x87, 0x03, 0xe1, 0x84,
+    0x88, 0x03, 0xe1, 0x84, 0xa1, 0x03, 0xe1, 0x84, 0x89, 0x03, 0xe1, 0x84,
+    0x8a, 0x03, 0xe1, 0x84, 0x8b, 0x03, 0xe1, 0x84, 0x8c, 0x03, 0xe1, 0x84,
+    0x8d, 0x03, 0xe1, 0x84, 0x8e, 0x03, 0xe1, 0x84, 0x8f, 0x03, 0xe1, 0x84,
+    0x90, 0x03, 0xe1, 0x84, 0x91, 0x03, 0xe1, 0x84, 0x92, 0x03, 0xe1, 0x85,
+    0xa1, 0x03, 0xe1, 0x85, 0xa2, 0x03, 0xe1, 0x85, 0xa3, 0x03, 0xe1, 0x85,
+    0xa4, 0x03, 0xe1, 0x85, 0xa5, 0x03, 0xe1, 0x85, 0xa6, 0x03, 0xe1, 0x85,
+    0xa7, 0x03, 0xe1, 0x85, 0xa8, 0x03, 0xe1, 0x85, 0xa9, 0x03, 0xe1, 0x85,
+    0xaa, 0x03, 0xe1, 0x85, 0xab, 0x03, 0xe1, 0x85, 0xac, 0x03, 0xe1, 0x85,
+    0xad, 0x03, 0xe1, 0x85, 0xae, 0x03, 0xe1, 0x85, 0xaf, 0x03, 0xe1, 0x85,
+    0xb0, 0x03, 0xe1, 0x85, 0xb1, 0x03, 0xe1, 0x85, 0xb2, 0x03, 0xe1, 0x85,
+    0xb3, 0x03, 0xe1, 0x85, 0xb4, 0x03, 0xe1, 0x85, 0xb5, 0x03, 0xe1, 0x85,
+    0xa0, 0x03, 0xe1, 0x84, 0x94, 0x03, 0xe1, 0x84, 0x95, 0x03, 0xe1, 0x87,
+    0x87, 0x03, 0xe1, 0x87, 0x88, 0x03, 0xe1, 0x87, 0x8c, 0x03, 0xe1, 0x87,
+    0x8e, 0x03, 0xe1, 0x87, 0x93, 0x03, 0xe1, 0x87, 0x97, 0x03, 0xe1, 0x87,
+    0x99, 0x03, 0xe1, 0x84, 0x9c, 0x03, 0xe1, 0x87, 0x9d, 0x03, 0xe1, 0x87,
+    0x9f, 0x03, 0xe1, 0x84, 0x9d, 0x03, 0xe1, 0x84, 0x9e, 0x03, 0xe1, 0x84,
+    0xa0, 0x03, 0xe1, 0x84, 0xa2, 0x03, 0xe1, 0x84, 0xa3, 0x03, 0xe1, 0x84,
+    0xa7, 0x03, 0xe1, 0x84, 0xa9, 0x03, 0xe1, 0x84, 0xab, 0x03, 0xe1, 0x84,
+    0xac, 0x03, 0xe1, 0x84, 0xad, 0x03, 0xe1, 0x84, 0xae, 0x03, 0xe1, 0x84,
+    0xaf, 0x03, 0xe1, 0x84, 0xb2, 0x03, 0xe1, 0x84, 0xb6, 0x03, 0xe1, 0x85,
+    0x80, 0x03, 0xe1, 0x85, 0x87, 0x03, 0xe1, 0x85, 0x8c, 0x03, 0xe1, 0x87,
+    0xb1, 0x03, 0xe1, 0x87, 0xb2, 0x03, 0xe1, 0x85, 0x97, 0x03, 0xe1, 0x85,
+    0x98, 0x03, 0xe1, 0x85, 0x99, 0x03, 0xe1, 0x86, 0x84, 0x03, 0xe1, 0x86,
+    0x85, 0x03, 0xe1, 0x86, 0x88, 0x03, 0xe1, 0x86, 0x91, 0x03, 0xe1, 0x86,
+    0x92, 0x03, 0xe1, 0x86, 0x94, 0x03, 0xe1, 0x86, 0x9e, 0x03, 0xe1, 0x86,
+    0xa1, 0x03, 0xe4, 0xb8, 0x80, 0x03, 0xe4, 0xba, 0x8c, 0x03, 0xe4, 0xb8,
+    0x89, 0x03, 0xe5, 0x9b, 0x9b, 0x03, 0xe4, 0xb8, 0x8a, 0x03, 0xe4, 0xb8,
+    0xad, 0x03, 0xe4, 0xb8, 0x8b, 0x03, 0xe7, 0x94, 0xb2, 0x03, 0xe4, 0xb9,
+    0x99, 0x03, 0xe4, 0xb8, 0x99, 0x03, 0xe4, 0xb8, 0x81, 0x03, 0xe5, 0xa4,
+    0xa9, 0x03, 0xe5, 0x9c, 0xb0, 0x03, 0xe4, 0xba, 0xba, 0x05, 0x28, 0xe1,
+    0x84, 0x80, 0x29, 0x05, 0x28, 0xe1, 0x84, 0x82, 0x29, 0x05, 0x28, 0xe1,
+    0x84, 0x83, 0x29, 0x05, 0x28, 0xe1, 0x84, 0x85, 0x29, 0x05, 0x28, 0xe1,
+    0x84, 0x86, 0x29, 0x05, 0x28, 0xe1, 0x84, 0x87, 0x29, 0x05, 0x28, 0xe1,
+    0x84, 0x89, 0x29, 0x05, 0x28, 0xe1, 0x84, 0x8b, 0x29, 0x05, 0x28, 0xe1,
+    0x84, 0x8c, 0x29, 0x05, 0x28, 0xe1, 0x84, 0x8e, 0x29, 0x05, 0x28, 0xe1,
+    0x84, 0x8f, 0x29, 0x05, 0x28, 0xe1, 0x84, 0x90, 0x29, 0x05, 0x28, 0xe1,
+    0x84, 0x91, 0x29, 0x05, 0x28, 0xe1, 0x84, 0x92, 0x29, 0x08, 0x28, 0xe1,
+    0x84, 0x80, 0xe1, 0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1, 0x84, 0x82, 0xe1,
+    0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1, 0x84, 0x83, 0xe1, 0x85, 0xa1, 0x29,
+    0x08, 0x28, 0xe1, 0x84, 0x85, 0xe1, 0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1,
+    0x84, 0x86, 0xe1, 0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1, 0x84, 0x87, 0xe1,
+    0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1, 0x84, 0x89, 0xe1, 0x85, 0xa1, 0x29,
+    0x08, 0x28, 0xe1, 0x84, 0x8b, 0xe1, 0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1,
+    0x84, 0x8c, 0xe1, 0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1, 0x84, 0x8e, 0xe1,
+    0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1, 0x84, 0x8f, 0xe1, 0x85, 0xa1, 0x29,
+    0x08, 0x28, 0xe1, 0x84, 0x90, 0xe1, 0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1,
+    0x84, 0x91, 0xe1, 0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1, 0x84, 0x92, 0xe1,
+    0x85, 0xa1, 0x29, 0x08, 0x28, 0xe1, 0x84, 0x8c, 0xe1, 0x85, 0xae, 0x29,
+    0x11, 0x28, 0xe1, 0x84, 0x8b, 0xe1, 0x85, 0xa9, 0xe1, 0x84, 0x8c, 0xe1,
+    0x85, 0xa5, 0xe1, 0x86, 0xab, 0x29, 0x0e, 0x28, 0xe1, 0x84, 0x8b, 0xe1,
+    0x85, 0xa9, 0xe1, 0x84, 0x92, 0xe1, 0x85, 0xae, 0x29, 0x05, 0x28, 0xe4,
+    0xb8, 0x80, 0x29, 0x05, 0x28, 0xe4, 0xba, 0x8c, 0x29, 0x05, 0x28, 0xe4,
+    0xb8, 0x89, 0x29, 0x05, 0x28, 0xe5, 0x9b, 0x9b, 0x29, 0x05, 0x28, 0xe4,
+    0xba, 0x94, 0x29, 0x05, 0x28, 0xe5, 0x85, 0xad, 0x29, 0x05, 0x28, 0xe4,
+    0xb8, 0x83, 0x29, 0x05, 0x28, 0xe5, 0x85, 0xab, 0x29, 0x05, 0x28, 0xe4,
+    0xb9, 0x9d, 0x29, 0x05, 0x28, 0xe5, 0x8d, 0x81, 0x29, 0x05, 0x28, 0xe6,
+    0x9c, 0x88, 0x29, 0x05, 0x28, 0xe7, 0x81, 0xab, 0x29, 0x05, 0x28, 0xe6,
+    0xb0, 0xb4, 0x29, 0x05, 0x28, 0xe6, 0x9c, 0xa8, 0x29, 0x05, 0x28, 0xe9,
+    0x87, 0x91, 0x29, 0x05, 0x28, 0xe5, 0x9c, 0x9f, 0x29, 0x05, 0x28, 0xe6,
+    0x97, 0xa5, 0x29, 0x05, 0x28, 0xe6, 0xa0, 0xaa, 0x29, 0x05, 0x28, 0xe6,
+    0x9c, 0x89, 0x29, 0x05, 0x28, 0xe7, 0xa4, 0xbe, 0x29, 0x05, 0x28, 0xe5,
+    0x90, 0x8d, 0x29, 0x05, 0x28, 0xe7, 0x89, 0xb9, 0x29, 0x05, 0x28, 0xe8,
+    0xb2, 0xa1, 0x29, 0x05, 0x28, 0xe7, 0xa5, 0x9d, 0x29, 0x05, 0x28, 0xe5,
+    0x8a, 0xb4, 0x29, 0x05, 0x28, 0xe4, 0xbb, 0xa3, 0x29, 0x05, 0x28, 0xe5,
+    0x91, 0xbc, 0x29, 0x05, 0x28, 0xe5, 0xad, 0xa6, 0x29, 0x05, 0x28, 0xe7,
+    0x9b, 0xa3, 0x29, 0x05, 0x28, 0xe4, 0xbc, 0x81, 0x29, 0x05, 0x28, 0xe8,
+    0xb3, 0x87, 0x29, 0x05, 0x28, 0xe5, 0x8d, 0x94, 0x29, 0x05, 0x28, 0xe7,
+    0xa5, 0xad, 0x29, 0x05, 0x28, 0xe4, 0xbc, 0x91, 0x29, 0x05, 0x28, 0xe8,
+    0x87, 0xaa, 0x29, 0x05, 0x28, 0xe8, 0x87, 0xb3, 0x29, 0x03, 0xe5, 0x95,
+    0x8f, 0x03, 0xe5, 0xb9, 0xbc, 0x03, 0xe6, 0x96, 0x87, 0x03, 0xe7, 0xae,
+    0x8f, 0x03, 0x50, 0x54, 0x45, 0x02, 0x32, 0x31, 0x02, 0x32, 0x32, 0x02,
+    0x32, 0x33, 0x02, 0x32, 0x34, 0x02, 0x32, 0x35, 0x02, 0x32, 0x36, 0x02,
+    0x32, 0x37, 0x02, 0x32, 0x38, 0x02, 0x32, 0x39, 0x02, 0x33, 0x30, 0x02,
+    0x33, 0x31, 0x02, 0x33, 0x32, 0x02, 0x33, 0x33, 0x02, 0x33, 0x34, 0x02,
+    0x33, 0x35, 0x03, 0xe1, 0x84, 0x80, 0x03, 0xe1, 0x84, 0x82, 0x03, 0xe1,
+    0x84, 0x83, 0x03, 0xe1, 0x84, 0x85, 0x03, 0xe1, 0x84, 0x86, 0x03, 0xe1,
+    0x84, 0x87, 0x03, 0xe1, 0x84, 0x89, 0x03, 0xe1, 0x84, 0x8b, 0x03, 0xe1,
+    0x84, 0x8c, 0x03, 0xe1, 0x84, 0x8e, 0x03, 0xe1, 0x84, 0x8f, 0x03, 0xe1,
+    0x84, 0x90, 0x03, 0xe1, 0x84, 0x91, 0x03, 0xe1, 0x84, 0x92, 0x06, 0xe1,
+    0x84, 0x80, 0xe1, 0x85, 0xa1, 0x06, 0xe1, 0x84, 0x82, 0xe1, 0x85, 0xa1,
+    0x06, 0xe1, 0x84, 0x83, 0xe1, 0x85, 0xa1, 0x06, 0xe1, 0x84, 0x85, 0xe1,
+    0x85, 0xa1, 0x06, 0xe1, 0x84, 0x86, 0xe1, 0x85, 0xa1, 0x06, 0xe1, 0x84,
+    0x87, 0xe1, 0x85, 0xa1, 0x06, 0xe1, 0x84, 0x89, 0xe1, 0x85, 0xa1, 0x06,
+    0xe1, 0x84, 0x8b, 0xe1, 0x85, 0xa1, 0x06, 0xe1, 0x84, 0x8c, 0xe1, 0x85,
+    0xa1, 0x06, 0xe1, 0x84, 0x8e, 0xe1, 0x85, 0xa1, 0x06, 0xe1, 0x84, 0x8f,
+    0xe1, 0x85, 0xa1, 0x06, 0xe1, 0x84, 0x90, 0xe1, 0x85, 0xa1, 0x06, 0xe1,
+    0x84, 0x91, 0xe1, 0x85, 0xa1, 0x06, 0xe1, 0x84, 0x92, 0xe1, 0x85, 0xa1,
+    0x0f, 0xe1, 0x84, 0x8e, 0xe1, 0x85, 0xa1, 0xe1, 0x86, 0xb7, 0xe1, 0x84,
+    0x80, 0xe1, 0x85, 0xa9, 0x0c, 0xe1, 0x84, 0x8c, 0xe1, 0x85, 0xae, 0xe1,
+    0x84, 0x8b, 0xe1, 0x85, 0xb4, 0x06, 0xe1, 0x84, 0x8b, 0xe1, 0x85, 0xae,
+    0x03, 0xe4, 0xb8, 0x80, 0x03, 0xe4, 0xba, 0x8c, 0x03, 0xe4, 0xb8, 0x89,
+    0x03, 0xe5, 0x9b, 0x9b, 0x03, 0xe4, 0xba, 0x94, 0x03, 0xe5, 0x85, 0xad,
+    0x03, 0xe4, 0xb8, 0x83, 0x03, 0xe5, 0x85, 0xab, 0x03, 0xe4, 0xb9, 0x9d,
+    0x03, 0xe5, 0x8d, 0x81, 0x03, 0xe6, 0x9c, 0x88, 0x03, 0xe7, 0x81, 0xab,
+    0x03, 0xe6, 0xb0, 0xb4, 0x03, 0xe6, 0x9c, 0xa8, 0x03, 0xe9, 0x87, 0x91,
+    0x03, 0xe5, 0x9c, 0x9f, 0x03, 0xe6, 0x97, 0xa5, 0x03, 0xe6, 0xa0, 0xaa,
+    0x03, 0xe6, 0x9c, 0x89, 0x03, 0xe7, 0xa4, 0xbe, 0x03, 0xe5, 0x90, 0x8d,
+    0x03, 0xe7, 0x89, 0xb9, 0x03, 0xe8, 0xb2, 0xa1, 0x03, 0xe7, 0xa5, 0x9d,
+    0x03, 0xe5, 0x8a, 0xb4, 0x03, 0xe7, 0xa7, 0x98, 0x03, 0xe7, 0x94, 0xb7,
+    0x03, 0xe5, 0xa5, 0xb3, 0x03, 0xe9, 0x81, 0xa9, 0x03, 0xe5, 0x84, 0xaa,
+    0x03, 0xe5, 0x8d, 0xb0, 0x03, 0xe6, 0xb3, 0xa8, 0x03, 0xe9, 0xa0, 0x85,
+    0x03, 0xe4, 0xbc, 0x91, 0x03, 0xe5, 0x86, 0x99, 0x03, 0xe6, 0xad, 0xa3,
+    0x03, 0xe4, 0xb8, 0x8a, 0x03, 0xe4, 0xb8, 0xad, 0x03, 0xe4, 0xb8, 0x8b,
+    0x03, 0xe5, 0xb7, 0xa6, 0x03, 0xe5, 0x8f, 0xb3, 0x03, 0xe5, 0x8c, 0xbb,
+    0x03, 0xe5, 0xae, 0x97, 0x03, 0xe5, 0xad, 0xa6, 0x03, 0xe7, 0x9b, 0xa3,
+    0x03, 0xe4, 0xbc, 0x81, 0x03, 0xe8, 0xb3, 0x87, 0x03, 0xe5, 0x8d, 0x94,
+    0x03, 0xe5, 0xa4, 0x9c, 0x02, 0x33, 0x36, 0x02, 0x33, 0x37, 0x02, 0x33,
+    0x38, 0x02, 0x33, 0x39, 0x02, 0x34, 0x30, 0x02, 0x34, 0x31, 0x02, 0x34,
+    0x32, 0x02, 0x34, 0x33, 0x02, 0x34, 0x34, 0x02, 0x34, 0x35, 0x02, 0x34,
+    0x36, 0x02, 0x34, 0x37, 0x02, 0x34, 0x38, 0x02, 0x34, 0x39, 0x02, 0x35,
+    0x30, 0x04, 0x31, 0xe6, 0x9c, 0x88, 0x04, 0x32, 0xe6, 0x9c, 0x88, 0x04,
+    0x33, 0xe6, 0x9c, 0x88, 0x04, 0x34, 0xe6, 0x9c, 0x88, 0x04, 0x35, 0xe6,
+    0x9c, 0x88, 0x04, 0x36, 0xe6, 0x9c, 0x88, 0x04, 0x37, 0xe6, 0x9c, 0x88,
+    0x04, 0x38, 0xe6, 0x9c, 0x88, 0x04, 0x39, 0xe6, 0x9c, 0x88, 0x05, 0x31,
+    0x30, 0xe6, 0x9c, 0x88, 0x05, 0x31, 0x31, 0xe6, 0x9c, 0x88, 0x05, 0x31,
+    0x32, 0xe6, 0x9c, 0x88, 0x02, 0x48, 0x67, 0x03, 0x65, 0x72, 0x67, 0x02,
+    0x65, 0x56, 0x03, 0x4c, 0x54, 0x44, 0x03, 0xe3, 0x82, 0xa2, 0x03, 0xe3,
+    0x82, 0xa4, 0x03, 0xe3, 0x82, 0xa6, 0x03, 0xe3, 0x82, 0xa8, 0x03, 0xe3,
+    0x82, 0xaa, 0x03, 0xe3, 0x82, 0xab, 0x03, 0xe3, 0x82, 0xad, 0x03, 0xe3,
+    0x82, 0xaf, 0x03, 0xe3, 0x82, 0xb1, 0x03, 0xe3, 0x82, 0xb3, 0x03, 0xe3,
+    0x82, 0xb5, 0x03, 0xe3, 0x82, 0xb7, 0x03, 0xe3, 0x82, 0xb9, 0x03, 0xe3,
+    0x82, 0xbb, 0x03, 0xe3, 0x82, 0xbd, 0x03, 0xe3, 0x82, 0xbf, 0x03, 0xe3,
+    0x83, 0x81, 0x03, 0xe3, 0x83, 0x84, 0x03, 0xe3, 0x83, 0x86, 0x03, 0xe3,
+    0x83, 0x88, 0x03, 0xe3, 0x83, 0x8a, 0x03, 0xe3, 0x83, 0x8b, 0x03, 0xe3,
+    0x83, 0x8c, 0x03, 0xe3, 0x83, 0x8d, 0x03, 0xe3, 0x83, 0x8e, 0x03, 0xe3,
+    0x83, 0x8f, 0x03, 0xe3, 0x83, 0x92, 0x03, 0xe3, 0x83, 0x95, 0x03, 0xe3,
+    0x83, 0x98, 0x03, 0xe3, 0x83, 0x9b, 0x03, 0xe3, 0x83, 0x9e, 0x03, 0xe3,
+    0x83, 0x9f, 0x03, 0xe3, 0x83, 0xa0, 0x03, 0xe3, 0x83, 0xa1, 0x03, 0xe3,
+    0x83, 0xa2, 0x03, 0xe3, 0x83, 0xa4, 0x03, 0xe3, 0x83, 0xa6, 0x03, 0xe3,
+    0x83, 0xa8, 0x03, 0xe3, 0x83, 0xa9, 0x03, 0xe3, 0x83, 0xaa, 0x03, 0xe3,
+    0x83, 0xab, 0x03, 0xe3, 0x83, 0xac, 0x03, 0xe3, 0x83, 0xad, 0x03, 0xe3,
+    0x83, 0xaf, 0x03, 0xe3, 0x83, 0xb0, 0x03, 0xe3, 0x83, 0xb1, 0x03, 0xe3,
+    0x83, 0xb2, 0x06, 0xe4, 0xbb, 0xa4, 0xe5, 0x92, 0x8c, 0x0f, 0xe3, 0x82,
+    0xa2, 0xe3, 0x83, 0x8f, 0xe3, 0x82, 0x9a, 0xe3, 0x83, 0xbc, 0xe3, 0x83,
+    0x88, 0x0c, 0xe3, 0x82, 0xa2, 0xe3, 0x83, 0xab, 0xe3, 0x83, 0x95, 0xe3,
+    0x82, 0xa1, 0x0f, 0xe3, 0x82, 0xa2, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x98,
+    0xe3, 0x82, 0x9a, 0xe3, 0x82, 0xa2, 0x09, 0xe3, 0x82, 0xa2, 0xe3, 0x83,
+    0xbc, 0xe3, 0x83, 0xab, 0x0f, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0x8b, 0xe3,
+    0x83, 0xb3, 0xe3, 0x82, 0xaf, 0xe3, 0x82, 0x99, 0x09, 0xe3, 0x82, 0xa4,
+    0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x81, 0x09, 0xe3, 0x82, 0xa6, 0xe3, 0x82,
+    0xa9, 0xe3, 0x83, 0xb3, 0x12, 0xe3, 0x82, 0xa8, 0xe3, 0x82, 0xb9, 0xe3,
+    0x82, 0xaf, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0x99, 0x0c,
+    0xe3, 0x82, 0xa8, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xab, 0xe3, 0x83, 0xbc,
+    0x09, 0xe3, 0x82, 0xaa, 0xe3, 0x83, 0xb3, 0xe3, 0x82, 0xb9, 0x09, 0xe3,
+    0x82, 0xaa, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xa0, 0x09, 0xe3, 0x82, 0xab,
+    0xe3, 0x82, 0xa4, 0xe3, 0x83, 0xaa, 0x0c, 0xe3, 0x82, 0xab, 0xe3, 0x83,
+    0xa9, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x88, 0x0c, 0xe3, 0x82, 0xab, 0xe3,
+    0x83, 0xad, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0xbc, 0x0c, 0xe3, 0x82, 0xab,
+    0xe3, 0x82, 0x99, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xb3, 0x0c, 0xe3, 0x82,
+    0xab, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x9e, 0x0c, 0xe3,
+    0x82, 0xad, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xab, 0xe3, 0x82, 0x99, 0x0c,
+    0xe3, 0x82, 0xad, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x8b, 0xe3, 0x83, 0xbc,
+    0x0c, 0xe3, 0x82, 0xad, 0xe3, 0x83, 0xa5, 0xe3, 0x83, 0xaa, 0xe3, 0x83,
+    0xbc, 0x12, 0xe3, 0x82, 0xad, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xab, 0xe3,
+    0x82, 0xbf, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xbc, 0x06, 0xe3, 0x82, 0xad,
+    0xe3, 0x83, 0xad, 0x12, 0xe3, 0x82, 0xad, 0xe3, 0x83, 0xad, 0xe3, 0x82,
+    0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xa9, 0xe3, 0x83, 0xa0, 0x12, 0xe3,
+    0x82, 0xad, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xa1, 0xe3, 0x83, 0xbc, 0xe3,
+    0x83, 0x88, 0xe3, 0x83, 0xab, 0x0f, 0xe3, 0x82, 0xad, 0xe3, 0x83, 0xad,
+    0xe3, 0x83, 0xaf, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x88, 0x0c, 0xe3, 0x82,
+    0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xa9, 0xe3, 0x83, 0xa0, 0x12, 0xe3,
+    0x82, 0xaf, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xa9, 0xe3, 0x83, 0xa0, 0xe3,
+    0x83, 0x88, 0xe3, 0x83, 0xb3, 0x12, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xab,
+    0xe3, 0x82, 0xbb, 0xe3, 0x82, 0x99, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0xad,
+    0x0c, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xbc, 0xe3, 0x83,
+    0x8d, 0x09, 0xe3, 0x82, 0xb1, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xb9, 0x09,
+    0xe3, 0x82, 0xb3, 0xe3, 0x83, 0xab, 0xe3, 0x83, 0x8a, 0x0c, 0xe3, 0x82,
+    0xb3, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x9b, 0xe3, 0x82, 0x9a, 0x0c, 0xe3,
+    0x82, 0xb5, 0xe3, 0x82, 0xa4, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xab, 0x0f,
+    0xe3, 0x82, 0xb5, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x81, 0xe3, 0x83, 0xbc,
+    0xe3, 0x83, 0xa0, 0x0f, 0xe3, 0x82, 0xb7, 0xe3, 0x83, 0xaa, 0xe3, 0x83,
+    0xb3, 0xe3, 0x82, 0xaf, 0xe3, 0x82, 0x99, 0x09, 0xe3, 0x82, 0xbb, 0xe3,
+    0x83, 0xb3, 0xe3, 0x83, 0x81, 0x09, 0xe3, 0x82, 0xbb, 0xe3, 0x83, 0xb3,
+    0xe3, 0x83, 0x88, 0x0c, 0xe3, 0x82, 0xbf, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+    0xbc, 0xe3, 0x82, 0xb9, 0x09, 0xe3, 0x83, 0x86, 0xe3, 0x82, 0x99, 0xe3,
+    0x82, 0xb7, 0x09, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xab,
+    0x06, 0xe3, 0x83, 0x88, 0xe3, 0x83, 0xb3, 0x06, 0xe3, 0x83, 0x8a, 0xe3,
+    0x83, 0x8e, 0x09, 0xe3, 0x83, 0x8e, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x88,
+    0x09, 0xe3, 0x83, 0x8f, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0x84, 0x12, 0xe3,
+    0x83, 0x8f, 0xe3, 0x82, 0x9a, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xbb, 0xe3,
+    0x83, 0xb3, 0xe3, 0x83, 0x88, 0x0c, 0xe3, 0x83, 0x8f, 0xe3, 0x82, 0x9a,
+    0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x84, 0x0f, 0xe3, 0x83, 0x8f, 0xe3, 0x82,
+    0x99, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xac, 0xe3, 0x83, 0xab, 0x12, 0xe3,
+    0x83, 0x92, 0xe3, 0x82, 0x9a, 0xe3, 0x82, 0xa2, 0xe3, 0x82, 0xb9, 0xe3,
+    0x83, 0x88, 0xe3, 0x83, 0xab, 0x0c, 0xe3, 0x83, 0x92, 0xe3, 0x82, 0x9a,
+    0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xab, 0x09, 0xe3, 0x83, 0x92, 0xe3, 0x82,
+    0x9a, 0xe3, 0x82, 0xb3, 0x09, 0xe3, 0x83, 0x92, 0xe3, 0x82, 0x99, 0xe3,
+    0x83, 0xab, 0x12, 0xe3, 0x83, 0x95, 0xe3, 0x82, 0xa1, 0xe3, 0x83, 0xa9,
+    0xe3, 0x83, 0x83, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0x99, 0x0c, 0xe3, 0x83,
+    0x95, 0xe3, 0x82, 0xa3, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x88, 0x12, 0xe3,
+    0x83, 0x95, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x83, 0xe3, 0x82, 0xb7, 0xe3,
+    0x82, 0xa7, 0xe3, 0x83, 0xab, 0x09, 0xe3, 0x83, 0x95, 0xe3, 0x83, 0xa9,
+    0xe3, 0x83, 0xb3, 0x0f, 0xe3, 0x83, 0x98, 0xe3, 0x82, 0xaf, 0xe3, 0x82,
+    0xbf, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xab, 0x09, 0xe3, 0x83, 0x98, 0xe3,
+    0x82, 0x9a, 0xe3, 0x82, 0xbd, 0x0c, 0xe3, 0x83, 0x98, 0xe3, 0x82, 0x9a,
+    0xe3, 0x83, 0x8b, 0xe3, 0x83, 0x92, 0x09, 0xe3, 0x83, 0x98, 0xe3, 0x83,
+    0xab, 0xe3, 0x83, 0x84, 0x0c, 0xe3, 0x83, 0x98, 0xe3, 0x82, 0x9a, 0xe3,
+    0x83, 0xb3, 0xe3, 0x82, 0xb9, 0x0f, 0xe3, 0x83, 0x98, 0xe3, 0x82, 0x9a,
+    0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xb7, 0xe3, 0x82, 0x99, 0x0c, 0xe3, 0x83,
+    0x98, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xbc, 0xe3, 0x82, 0xbf, 0x0f, 0xe3,
+    0x83, 0x9b, 0xe3, 0x82, 0x9a, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0xb3, 0xe3,
+    0x83, 0x88, 0x0c, 0xe3, 0x83, 0x9b, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xab,
+    0xe3, 0x83, 0x88, 0x06, 0xe3, 0x83, 0x9b, 0xe3, 0x83, 0xb3, 0x0f, 0xe3,
+    0x83, 0x9b, 0xe3, 0x82, 0x9a, 0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x88, 0xe3,
+    0x82, 0x99, 0x09, 0xe3, 0x83, 0x9b, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xab,
+    0x09, 0xe3, 0x83, 0x9b, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xb3, 0x0c, 0xe3,
+    0x83, 0x9e, 0xe3, 0x82, 0xa4, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xad, 0x09,
+    0xe3, 0x83, 0x9e, 0xe3, 0x82, 0xa4, 0xe3, 0x83, 0xab, 0x09, 0xe3, 0x83,
+    0x9e, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x8f, 0x09, 0xe3, 0x83, 0x9e, 0xe3,
+    0x83, 0xab, 0xe3, 0x82, 0xaf, 0x0f, 0xe3, 0x83, 0x9e, 0xe3, 0x83, 0xb3,
+    0xe3, 0x82, 0xb7, 0xe3, 0x83, 0xa7, 0xe3, 0x83, 0xb3, 0x0c, 0xe3, 0x83,
+    0x9f, 0xe3, 0x82, 0xaf, 0xe3, 0x83, 0xad, 0xe3, 0x83, 0xb3, 0x06, 0xe3,
+    0x83, 0x9f, 0xe3, 0x83, 0xaa, 0x12, 0xe3, 0x83, 0x9f, 0xe3, 0x83, 0xaa,
+    0xe3, 0x83, 0x8f, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0xab,
+    0x09, 0xe3, 0x83, 0xa1, 0xe3, 0x82, 0xab, 0xe3, 0x82, 0x99, 0x0f, 0xe3,
+    0x83, 0xa1, 0xe3, 0x82, 0xab, 0xe3, 0x82, 0x99, 0xe3, 0x83, 0x88, 0xe3,
+    0x83, 0xb3, 0x0c, 0xe3, 0x83, 0xa1, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x88,
+    0xe3, 0x83, 0xab, 0x0c, 0xe3, 0x83, 0xa4, 0xe3, 0x83, 0xbc, 0xe3, 0x83,
+    0x88, 0xe3, 0x82, 0x99, 0x09, 0xe3, 0x83, 0xa4, 0xe3, 0x83, 0xbc, 0xe3,
+    0x83, 0xab, 0x09, 0xe3, 0x83, 0xa6, 0xe3, 0x82, 0xa2, 0xe3, 0x83, 0xb3,
+    0x0c, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0x83, 0xe3, 0x83, 0x88, 0xe3, 0x83,
+    0xab, 0x06, 0xe3, 0x83, 0xaa, 0xe3, 0x83, 0xa9, 0x0c, 0xe3, 0x83, 0xab,
+    0xe3, 0x83, 0x92, 0xe3, 0x82, 0x9a, 0xe3, 0x83, 0xbc, 0x0f, 0xe3, 0x83,
+    0xab, 0xe3, 0x83, 0xbc, 0xe3, 0x83, 0x95, 0xe3, 0x82, 0x99, 0xe3, 0x83,
+    0xab, 0x06, 0xe3, 0x83, 0xac, 0xe3, 0x83, 0xa0, 0x12, 0xe3, 0x83, 0xac,
+    0xe3, 0x83, 0xb3, 0xe3, 0x83, 0x88, 0xe3, 0x82, 0xb1, 0xe3, 0x82, 0x99,
+    0xe3, 0x83, 0xb3, 0x09, 0xe3, 0x83, 0xaf, 0xe3, 0x83, 0x83, 0xe3, 0x83,
+    0x88, 0x04, 0x30, 0xe7, 0x82, 0xb9, 0x04, 0x31, 0xe7, 0x82, 0xb9, 0x04,
+    0x32, 0xe7, 0x82, 0xb9, 0x04, 0x33, 0xe7, 0x82, 0xb9, 0x04, 0x34, 0xe7,
+    0x82, 0xb9, 0x04, 0x35, 0xe7, 0x82, 0xb9, 0x04, 0x36, 0xe7, 0x82, 0xb9,
+    0x04, 0x37, 0xe7, 0x82, 0xb9, 0x04, 0x38, 0xe7, 0x82, 0xb9, 0x04, 0x39,
+    0xe7, 0x82, 0xb9, 0x05, 0x31, 0x30, 0xe7, 0x82, 0xb9, 0x05, 0x31, 0x31,
+    0xe7, 0x82, 0xb9, 0x05, 0x31, 0x32, 0xe7, 0x82, 0xb9, 0x05, 0x31, 0x33,
+    0xe7, 0x82, 0xb9, 0x05, 0x31, 0x34, 0xe7, 0x82, 0xb9, 0x05, 0x31, 0x35,
+    0xe7, 0x82, 0xb9, 0x05, 0x31, 0x36, 0xe7, 0x82, 0xb9, 0x05, 0x31, 0x37,
+    0xe7, 0x82, 0xb9, 0x05, 0x31, 0x38, 0xe7, 0x82, 0xb9, 0x05, 0x31, 0x39,
+    0xe7, 0x82, 0xb9, 0x05, 0x32, 0x30, 0xe7, 0x82, 0xb9, 0x05, 0x32, 0x31,
+    0xe7, 0x82, 0xb9, 0x05, 0x32, 0x32, 0xe7, 0x82, 0xb9, 0x05, 0x32, 0x33,
+    0xe7, 0x82, 0xb9, 0x05, 0x32, 0x34, 0xe7, 0x82, 0xb9, 0x03, 0x68, 0x50,
+    0x61, 0x02, 0x64, 0x61, 0x02, 0x41, 0x55, 0x03, 0x62, 0x61, 0x72, 0x02,
+    0x6f, 0x56, 0x02, 0x70, 0x63, 0x02, 0x64, 0x6d, 0x03, 0x64, 0x6d, 0x32,
+    0x03, 0x64, 0x6d, 0x33, 0x02, 0x49, 0x55, 0x06, 0xe5, 0xb9, 0xb3, 0xe6,
+    0x88, 0x90, 0x06, 0xe6, 0x98, 0xad, 0xe5, 0x92, 0x8c, 0x06, 0xe5, 0xa4,
+    0xa7, 0xe6, 0xad, 0xa3, 0x06, 0xe6, 0x98, 0x8e, 0xe6, 0xb2, 0xbb, 0x0c,
+    0xe6, 0xa0, 0xaa, 0xe5, 0xbc, 0x8f, 0xe4, 0xbc, 0x9a, 0xe7, 0xa4, 0xbe,
+    0x02, 0x70, 0x41, 0x02, 0x6e, 0x41, 0x03, 0xce, 0xbc, 0x41, 0x02, 0x6d,
+    0x41, 0x02, 0x6b, 0x41, 0x02, 0x4b, 0x42, 0x02, 0x4d, 0x42, 0x02, 0x47,
+    0x42, 0x03, 0x63, 0x61, 0x6c, 0x04, 0x6b, 0x63, 0x61, 0x6c, 0x02, 0x70,
+    0x46, 0x02, 0x6e, 0x46, 0x03, 0xce, 0xbc, 0x46, 0x03, 0xce, 0xbc, 0x67,
+    0x02, 0x6d, 0x67, 0x02, 0x6b, 0x67, 0x02, 0x48, 0x7a, 0x03, 0x6b, 0x48,
+    0x7a, 0x03, 0x4d, 0x48, 0x7a, 0x03, 0x47, 0x48, 0x7a, 0x03, 0x54, 0x48,
+    0x7a, 0x03, 0xce, 0xbc, 0x6c, 0x02, 0x6d, 0x6c, 0x02, 0x64, 0x6c, 0x02,
+    0x6b, 0x6c, 0x02, 0x66, 0x6d, 0x02, 0x6e, 0x6d, 0x03, 0xce, 0xbc, 0x6d,
+    0x02, 0x6d, 0x6d, 0x02, 0x63, 0x6d, 0x02, 0x6b, 0x6d, 0x03, 0x6d, 0x6d,
+    0x32, 0x03, 0x63, 0x6d, 0x32, 0x02, 0x6d, 0x32, 0x03, 0x6b, 0x6d, 0x32,
+    0x03, 0x6d, 0x6d, 0x33, 0x03, 0x63, 0x6d, 0x33, 0x02, 0x6d, 0x33, 0x03,
+    0x6b, 0x6d, 0x33, 0x05, 0x6d, 0xe2, 0x88, 0x95, 0x73, 0x06, 0x6d, 0xe2,
+    0x88, 0x95, 0x73, 0x32, 0x02, 0x50, 0x61, 0x03, 0x6b, 0x50, 0x61, 0x03,
+    0x4d, 0x50, 0x61, 0x03, 0x47, 0x50, 0x61, 0x03, 0x72, 0x61, 0x64, 0x07,
+    0x72, 0x61, 0x64, 0xe2, 0x88, 0x95, 0x73, 0x08, 0x72, 0x61, 0x64, 0xe2,
+    0x88, 0x95, 0x73, 0x32, 0x02, 0x70, 0x73, 0x02, 0x6e, 0x73, 0x03, 0xce,
+    0xbc, 0x73, 0x02, 0x6d, 0x73, 0x02, 0x70, 0x56, 0x02, 0x6e, 0x56, 0x03,
+    0xce, 0xbc, 0x56, 0x02, 0x6d, 0x56, 0x02, 0x6b, 0x56, 0x02, 0x4d, 0x56,
+    0x02, 0x70, 0x57, 0x02, 0x6e, 0x57, 0x03, 0xce, 0xbc, 0x57, 0x02, 0x6d,
+    0x57, 0x02, 0x6b, 0x57, 0x02, 0x4d, 0x57, 0x03, 0x6b, 0xce, 0xa9, 0x03,
+    0x4d, 0xce, 0xa9, 0x04, 0x61, 0x2e, 0x6d, 0x2e, 0x02, 0x42, 0x71, 0x02,
+    0x63, 0x63, 0x02, 0x63, 0x64, 0x06, 0x43, 0xe2, 0x88, 0x95, 0x6b, 0x67,
+    0x03, 0x43, 0x6f, 0x2e, 0x02, 0x64, 0x42, 0x02, 0x47, 0x79, 0x02, 0x68,
+    0x61, 0x02, 0x48, 0x50, 0x02, 0x69, 0x6e, 0x02, 0x4b, 0x4b, 0x02, 0x4b,
+    0x4d, 0x02, 0x6b, 0x74, 0x02, 0x6c, 0x6d, 0x02, 0x6c, 0x6e, 0x03, 0x6c,
+    0x6f, 0x67, 0x02, 0x6c, 0x78, 0x02, 0x6d, 0x62, 0x03, 0x6d, 0x69, 0x6c,
+    0x03, 0x6d, 0x6f, 0x6c, 0x02, 0x50, 0x48, 0x04, 0x70, 0x2e, 0x6d, 0x2e,
+    0x03, 0x50, 0x50, 0x4d, 0x02, 0x50, 0x52, 0x02, 0x73, 0x72, 0x02, 0x53,
+    0x76, 0x02, 0x57, 0x62, 0x05, 0x56, 0xe2, 0x88, 0x95, 0x6d, 0x05, 0x41,
+    0xe2, 0x88, 0x95, 0x6d, 0x04, 0x31, 0xe6, 0x97, 0xa5, 0x04, 0x32, 0xe6,
+    0x97, 0xa5, 0x04, 0x33, 0xe6, 0x97, 0xa5, 0x04, 0x34, 0xe6, 0x97, 0xa5,
+    0x04, 0x35, 0xe6, 0x97, 0xa5, 0x04, 0x36, 0xe6, 0x97, 0xa5, 0x04, 0x37,
+    0xe6, 0x97, 0xa5, 0x04, 0x38, 0xe6, 0x97, 0xa5, 0x04, 0x39, 0xe6, 0x97,
+    0xa5, 0x05, 0x31, 0x30, 0xe6, 0x97, 0xa5, 0x05, 0x31, 0x31, 0xe6, 0x97,
+    0xa5, 0x05, 0x31, 0x32, 0xe6, 0x97, 0xa5, 0x05, 0x31, 0x33, 0xe6, 0x97,
+    0xa5, 0x05, 0x31, 0x34, 0xe6, 0x97, 0xa5, 0x05, 0x31, 0x35, 0xe6, 0x97,
+    0xa5, 0x05, 0x31, 0x36, 0xe6, 0x97, 0xa5, 0x05, 0x31, 0x37, 0xe6, 0x97,
+    0xa5, 0x05, 0x31, 0x38, 0xe6, 0x97, 0xa5, 0x05, 0x31, 0x39, 0xe6, 0x97,
+    0xa5, 0x05, 0x32, 0x30, 0xe6, 0x97, 0xa5, 0x05, 0x32, 0x31, 0xe6, 0x97,
+    0xa5, 0x05, 0x32, 0x32, 0xe6, 0x97, 0xa5, 0x05, 0x32, 0x33, 0xe6, 0x97,
+    0xa5, 0x05, 0x32, 0x34, 0xe6, 0x97, 0xa5, 0x05, 0x32, 0x35, 0xe6, 0x97,
+    0xa5, 0x05, 0x32, 0x36, 0xe6, 0x97, 0xa5, 0x05, 0x32, 0x37, 0xe6, 0x97,
+    0xa5, 0x05, 0x32, 0x38, 0xe6, 0x97, 0xa5, 0x05, 0x32, 0x39, 0xe6, 0x97,
+    0xa5, 0x05, 0x33, 0x30, 0xe6, 0x97, 0xa5, 0x05, 0x33, 0x31, 0xe6, 0x97,
+    0xa5, 0x03, 0x67, 0x61, 0x6c, 0x03, 0xea, 0x99, 0x80, 0x03, 0xea, 0x99,
+    0x82, 0x03, 0xea, 0x99, 0x84, 0x03, 0xea, 0x99, 0x86, 0x03, 0xea, 0x99,
+    0x88, 0x03, 0xea, 0x99, 0x8a, 0x03, 0xea, 0x99, 0x8c, 0x03, 0xea, 0x99,
+    0x8e, 0x03, 0xea, 0x99, 0x90, 0x03, 0xea, 0x99, 0x92, 0x03, 0xea, 0x99,
+    0x94, 0x03, 0xea, 0x99, 0x96, 0x03, 0xea, 0x99, 0x98, 0x03, 0xea, 0x99,
+    0x9a, 0x03, 0xea, 0x99, 0x9c, 0x03, 0xea, 0x99, 0x9e, 0x03, 0xea, 0x99,
+    0xa0, 0x03, 0xea, 0x99, 0xa2, 0x03, 0xea, 0x99, 0xa4, 0x03, 0xea, 0x99,
+    0xa6, 0x03, 0xea, 0x99, 0xa8, 0x03, 0xea, 0x99, 0xaa, 0x03, 0xea, 0x99,
+    0xac, 0x03, 0xea, 0x9a, 0x80, 0x03, 0xea, 0x9a, 0x82, 0x03, 0xea, 0x9a,
+    0x84, 0x03, 0xea, 0x9a, 0x86, 0x03, 0xea, 0x9a, 0x88, 0x03, 0xea, 0x9a,
+    0x8a, 0x03, 0xea, 0x9a, 0x8c, 0x03, 0xea, 0x9a, 0x8e, 0x03, 0xea, 0x9a,
+    0x90, 0x03, 0xea, 0x9a, 0x92, 0x03, 0xea, 0x9a, 0x94, 0x03, 0xea, 0x9a,
+    0x96, 0x03, 0xea, 0x9a, 0x98, 0x03, 0xea, 0x9a, 0x9a, 0x02, 0xd1, 0x8a,
+    0x02, 0xd1, 0x8c, 0x03, 0xea, 0x9c, 0xa2, 0x03, 0xea, 0x9c, 0xa4, 0x03,
+    0xea, 0x9c, 0xa6, 0x03, 0xea, 0x9c, 0xa8, 0x03, 0xea, 0x9c, 0xaa, 0x03,
+    0xea, 0x9c, 0xac, 0x03, 0xea, 0x9c, 0xae, 0x03, 0xea, 0x9c, 0xb2, 0x03,
+    0xea, 0x9c, 0xb4, 0x03, 0xea, 0x9c, 0xb6, 0x03, 0xea, 0x9c, 0xb8, 0x03,
+    0xea, 0x9c, 0xba, 0x03, 0xea, 0x9c, 0xbc, 0x03, 0xea, 0x9c, 0xbe, 0x03,
+    0xea, 0x9d, 0x80, 0x03, 0xea, 0x9d, 0x82, 0x03, 0xea, 0x9d, 0x84, 0x03,
+    0xea, 0x9d, 0x86, 0x03, 0xea, 0x9d, 0x88, 0x03, 0xea, 0x9d, 0x8a, 0x03,
+    0xea, 0x9d, 0x8c, 0x03, 0xea, 0x9d, 0x8e, 0x03, 0xea, 0x9d, 0x90, 0x03,
+    0xea, 0x9d, 0x92, 0x03, 0xea, 0x9d, 0x94, 0x03, 0xea, 0x9d, 0x96, 0x03,
+    0xea, 0x9d, 0x98, 0x03, 0xea, 0x9d, 0x9a, 0x03, 0xea, 0x9d, 0x9c, 0x03,
+    0xea, 0x9d, 0x9e, 0x03, 0xea, 0x9d, 0xa0, 0x03, 0xea, 0x9d, 0xa2, 0x03,
+    0xea, 0x9d, 0xa4, 0x03, 0xea, 0x9d, 0xa6, 0x03, 0xea, 0x9d, 0xa8, 0x03,
+    0xea, 0x9d, 0xaa, 0x03, 0xea, 0x9d, 0xac, 0x03, 0xea, 0x9d, 0xae, 0x03,
+    0xea, 0x9d, 0xaf, 0x03, 0xea, 0x9d, 0xb9, 0x03, 0xea, 0x9d, 0xbb, 0x03,
+    0xea, 0x9d, 0xbe, 0x03, 0xea, 0x9e, 0x80, 0x03, 0xea, 0x9e, 0x82, 0x03,
+    0xea, 0x9e, 0x84, 0x03, 0xea, 0x9e, 0x86, 0x03, 0xea, 0x9e, 0x8b, 0x03,
+    0xea, 0x9e, 0x90, 0x03, 0xea, 0x9e, 0x92, 0x03, 0xea, 0x9f, 0x84, 0x03,
+    0xea, 0x9e, 0x96, 0x03, 0xea, 0x9e, 0x98, 0x03, 0xea, 0x9e, 0x9a, 0x03,
+    0xea, 0x9e, 0x9c, 0x03, 0xea, 0x9e, 0x9e, 0x03, 0xea, 0x9e, 0xa0, 0x03,
+    0xea, 0x9e, 0xa2, 0x03, 0xea, 0x9e, 0xa4, 0x03, 0xea, 0x9e, 0xa6, 0x03,
+    0xea, 0x9e, 0xa8, 0x03, 0xea, 0x9e, 0xb4, 0x03, 0xea, 0x9e, 0xb6, 0x03,
+    0xea, 0x9e, 0xb8, 0x03, 0xea, 0x9e, 0xba, 0x03, 0xea, 0x9e, 0xbc, 0x03,
+    0xea, 0x9e, 0xbe, 0x03, 0xea, 0x9f, 0x80, 0x03, 0xea, 0x9f, 0x82, 0x03,
+    0xea, 0x9f, 0x87, 0x03, 0xea, 0x9f, 0x89, 0x03, 0xea, 0x9f, 0x90, 0x03,
+    0xea, 0x9f, 0x96, 0x03, 0xea, 0x9f, 0x98, 0x01, 0x43, 0x01, 0x46, 0x01,
+    0x51, 0x03, 0xea, 0x9f, 0xb5, 0x02, 0xc4, 0xa6, 0x02, 0xc5, 0x93, 0x03,
+    0xea, 0x9e, 0xb3, 0x03, 0xea, 0x9c, 0xa7, 0x03, 0xea, 0xac, 0xb7, 0x02,
+    0xc9, 0xab, 0x03, 0xea, 0xad, 0x92, 0x02, 0xca, 0x8d, 0x03, 0xe1, 0x8e,
+    0xa0, 0x03, 0xe1, 0x8e, 0xa1, 0x03, 0xe1, 0x8e, 0xa2, 0x03, 0xe1, 0x8e,
+    0xa3, 0x03, 0xe1, 0x8e, 0xa4, 0x03, 0xe1, 0x8e, 0xa5, 0x03, 0xe1, 0x8e,
+    0xa6, 0x03, 0xe1, 0x8e, 0xa7, 0x03, 0xe1, 0x8e, 0xa8, 0x03, 0xe1, 0x8e,
+    0xa9, 0x03, 0xe1, 0x8e, 0xaa, 0x03, 0xe1, 0x8e, 0xab, 0x03, 0xe1, 0x8e,
+    0xac, 0x03, 0xe1, 0x8e, 0xad, 0x03, 0xe1, 0x8e, 0xae, 0x03, 0xe1, 0x8e,
+    0xaf, 0x03, 0xe1, 0x8e, 0xb0, 0x03, 0xe1, 0x8e, 0xb1, 0x03, 0xe1, 0x8e,
+    0xb2, 0x03, 0xe1, 0x8e, 0xb3, 0x03, 0xe1, 0x8e, 0xb4, 0x03, 0xe1, 0x8e,
+    0xb5, 0x03, 0xe1, 0x8e, 0xb6, 0x03, 0xe1, 0x8e, 0xb7, 0x03, 0xe1, 0x8e,
+    0xb8, 0x03, 0xe1, 0x8e, 0xb9, 0x03, 0xe1, 0x8e, 0xba, 0x03, 0xe1, 0x8e,
+    0xbb, 0x03, 0xe1, 0x8e, 0xbc, 0x03, 0xe1, 0x8e, 0xbd, 0x03, 0xe1, 0x8e,
+    0xbe, 0x03, 0xe1, 0x8e, 0xbf, 0x03, 0xe1, 0x8f, 0x80, 0x03, 0xe1, 0x8f,
+    0x81, 0x03, 0xe1, 0x8f, 0x82, 0x03, 0xe1, 0x8f, 0x83, 0x03, 0xe1, 0x8f,
+    0x84, 0x03, 0xe1, 0x8f, 0x85, 0x03, 0xe1, 0x8f, 0x86, 0x03, 0xe1, 0x8f,
+    0x87, 0x03, 0xe1, 0x8f, 0x88, 0x03, 0xe1, 0x8f, 0x89, 0x03, 0xe1, 0x8f,
+    0x8a, 0x03, 0xe1, 0x8f, 0x8b, 0x03, 0xe1, 0x8f, 0x8c, 0x03, 0xe1, 0x8f,
+    0x8d, 0x03, 0xe1, 0x8f, 0x8e, 0x03, 0xe1, 0x8f, 0x8f, 0x03, 0xe1, 0x8f,
+    0x90, 0x03, 0xe1, 0x8f, 0x91, 0x03, 0xe1, 0x8f, 0x92, 0x03, 0xe1, 0x8f,
+    0x93, 0x03, 0xe1, 0x8f, 0x94, 0x03, 0xe1, 0x8f, 0x95, 0x03, 0xe1, 0x8f,
+    0x96, 0x03, 0xe1, 0x8f, 0x97, 0x03, 0xe1, 0x8f, 0x98, 0x03, 0xe1, 0x8f,
+    0x99, 0x03, 0xe1, 0x8f, 0x9a, 0x03, 0xe1, 0x8f, 0x9b, 0x03, 0xe1, 0x8f,
+    0x9c, 0x03, 0xe1, 0x8f, 0x9d, 0x03, 0xe1, 0x8f, 0x9e, 0x03, 0xe1, 0x8f,
+    0x9f, 0x03, 0xe1, 0x8f, 0xa0, 0x03, 0xe1, 0x8f, 0xa1, 0x03, 0xe1, 0x8f,
+    0xa2, 0x03, 0xe1, 0x8f, 0xa3, 0x03, 0xe1, 0x8f, 0xa4, 0x03, 0xe1, 0x8f,
+    0xa5, 0x03, 0xe1, 0x8f, 0xa6, 0x03, 0xe1, 0x8f, 0xa7, 0x03, 0xe1, 0x8f,
+    0xa8, 0x03, 0xe1, 0x8f, 0xa9, 0x03, 0xe1, 0x8f, 0xaa, 0x03, 0xe1, 0x8f,
+    0xab, 0x03, 0xe1, 0x8f, 0xac, 0x03, 0xe1, 0x8f, 0xad, 0x03, 0xe1, 0x8f,
+    0xae, 0x03, 0xe1, 0x8f, 0xaf, 0x03, 0xe8, 0xb1, 0x88, 0x03, 0xe6, 0x9b,
+    0xb4, 0x03, 0xe8, 0xbb, 0x8a, 0x03, 0xe8, 0xb3, 0x88, 0x03, 0xe6, 0xbb,
+    0x91, 0x03, 0xe4, 0xb8, 0xb2, 0x03, 0xe5, 0x8f, 0xa5, 0x03, 0xe9, 0xbe,
+    0x9c, 0x03, 0xe9, 0xbe, 0x9c, 0x03, 0xe5, 0xa5, 0x91, 0x03, 0xe9, 0x87,
+    0x91, 0x03, 0xe5, 0x96, 0x87, 0x03, 0xe5, 0xa5, 0x88, 0x03, 0xe6, 0x87,
+    0xb6, 0x03, 0xe7, 0x99, 0xa9, 0x03, 0xe7, 0xbe, 0x85, 0x03, 0xe8, 0x98,
+    0xbf, 0x03, 0xe8, 0x9e, 0xba, 0x03, 0xe8, 0xa3, 0xb8, 0x03, 0xe9, 0x82,
+    0x8f, 0x03, 0xe6, 0xa8, 0x82, 0x03, 0xe6, 0xb4, 0x9b, 0x03, 0xe7, 0x83,
+    0x99, 0x03, 0xe7, 0x8f, 0x9e, 0x03, 0xe8, 0x90, 0xbd, 0x03, 0xe9, 0x85,
+    0xaa, 0x03, 0xe9, 0xa7, 0xb1, 0x03, 0xe4, 0xba, 0x82, 0x03, 0xe5, 0x8d,
+    0xb5, 0x03, 0xe6, 0xac, 0x84, 0x03, 0xe7, 0x88, 0x9b, 0x03, 0xe8, 0x98,
+    0xad, 0x03, 0xe9, 0xb8, 0x9e, 0x03, 0xe5, 0xb5, 0x90, 0x03, 0xe6, 0xbf,
+    0xab, 0x03, 0xe8, 0x97, 0x8d, 0x03, 0xe8, 0xa5, 0xa4, 0x03, 0xe6, 0x8b,
+    0x89, 0x03, 0xe8, 0x87, 0x98, 0x03, 0xe8, 0xa0, 0x9f, 0x03, 0xe5, 0xbb,
+    0x8a, 0x03, 0xe6, 0x9c, 0x97, 0x03, 0xe6, 0xb5, 0xaa, 0x03, 0xe7, 0x8b,
+    0xbc, 0x03, 0xe9, 0x83, 0x8e, 0x03, 0xe4, 0xbe, 0x86, 0x03, 0xe5, 0x86,
+    0xb7, 0x03, 0xe5, 0x8b, 0x9e, 0x03, 0xe6, 0x93, 0x84, 0x03, 0xe6, 0xab,
+    0x93, 0x03, 0xe7, 0x88, 0x90, 0x03, 0xe7, 0x9b, 0xa7, 0x03, 0xe8, 0x80,
+    0x81, 0x03, 0xe8, 0x98, 0x86, 0x03, 0xe8, 0x99, 0x9c, 0x03, 0xe8, 0xb7,
+    0xaf, 0x03, 0xe9, 0x9c, 0xb2, 0x03, 0xe9, 0xad, 0xaf, 0x03, 0xe9, 0xb7,
+    0xba, 0x03, 0xe7, 0xa2, 0x8c, 0x03, 0xe7, 0xa5, 0xbf, 0x03, 0xe7, 0xb6,
+    0xa0, 0x03, 0xe8, 0x8f, 0x89, 0x03, 0xe9, 0x8c, 0x84, 0x03, 0xe9, 0xb9,
+    0xbf, 0x03, 0xe8, 0xab, 0x96, 0x03, 0xe5, 0xa3, 0x9f, 0x03, 0xe5, 0xbc,
+    0x84, 0x03, 0xe7, 0xb1, 0xa0, 0x03, 0xe8, 0x81, 0xbe, 0x03, 0xe7, 0x89,
+    0xa2, 0x03, 0xe7, 0xa3, 0x8a, 0x03, 0xe8, 0xb3, 0x82, 0x03, 0xe9, 0x9b,
+    0xb7, 0x03, 0xe5, 0xa3, 0x98, 0x03, 0xe5, 0xb1, 0xa2, 0x03, 0xe6, 0xa8,
+    0x93, 0x03, 0xe6, 0xb7, 0x9a, 0x03, 0xe6, 0xbc, 0x8f, 0x03, 0xe7, 0xb4,
+    0xaf, 0x03, 0xe7, 0xb8, 0xb7, 0x03, 0xe9, 0x99, 0x8b, 0x03, 0xe5, 0x8b,
+    0x92, 0x03, 0xe8, 0x82, 0x8b, 0x03, 0xe5, 0x87, 0x9c, 0x03, 0xe5, 0x87,
+    0x8c, 0x03, 0xe7, 0xa8, 0x9c, 0x03, 0xe7, 0xb6, 0xbe, 0x03, 0xe8, 0x8f,
+    0xb1, 0x03, 0xe9, 0x99, 0xb5, 0x03, 0xe8, 0xae, 0x80, 0x03, 0xe6, 0x8b,
+    0x8f, 0x03, 0xe6, 0xa8, 0x82, 0x03, 0xe8, 0xab, 0xbe, 0x03, 0xe4, 0xb8,
+    0xb9, 0x03, 0xe5, 0xaf, 0xa7, 0x03, 0xe6, 0x80, 0x92, 0x03, 0xe7, 0x8e,
+    0x87, 0x03, 0xe7, 0x95, 0xb0, 0x03, 0xe5, 0x8c, 0x97, 0x03, 0xe7, 0xa3,
+    0xbb, 0x03, 0xe4, 0xbe, 0xbf, 0x03, 0xe5, 0xbe, 0xa9, 0x03, 0xe4, 0xb8,
+    0x8d, 0x03, 0xe6, 0xb3, 0x8c, 0x03, 0xe6, 0x95, 0xb8, 0x03, 0xe7, 0xb4,
+    0xa2, 0x03, 0xe5, 0x8f, 0x83, 0x03, 0xe5, 0xa1, 0x9e, 0x03, 0xe7, 0x9c,
+    0x81, 0x03, 0xe8, 0x91, 0x89, 0x03, 0xe8, 0xaa, 0xaa, 0x03, 0xe6, 0xae,
+    0xba, 0x03, 0xe8, 0xbe, 0xb0, 0x03, 0xe6, 0xb2, 0x88, 0x03, 0xe6, 0x8b,
+    0xbe, 0x03, 0xe8, 0x8b, 0xa5, 0x03, 0xe6, 0x8e, 0xa0, 0x03, 0xe7, 0x95,
+    0xa5, 0x03, 0xe4, 0xba, 0xae, 0x03, 0xe5, 0x85, 0xa9, 0x03, 0xe5, 0x87,
+    0x89, 0x03, 0xe6, 0xa2, 0x81, 0x03, 0xe7, 0xb3, 0xa7, 0x03, 0xe8, 0x89,
+    0xaf, 0x03, 0xe8, 0xab, 0x92, 0x03, 0xe9, 0x87, 0x8f, 0x03, 0xe5, 0x8b,
+    0xb5, 0x03, 0xe5, 0x91, 0x82, 0x03, 0xe5, 0xa5, 0xb3, 0x03, 0xe5, 0xbb,
+    0xac, 0x03, 0xe6, 0x97, 0x85, 0x03, 0xe6, 0xbf, 0xbe, 0x03, 0xe7, 0xa4,
+    0xaa, 0x03, 0xe9, 0x96, 0xad, 0x03, 0xe9, 0xa9, 0xaa, 0x03, 0xe9, 0xba,
+    0x97, 0x03, 0xe9, 0xbb, 0x8e, 0x03, 0xe5, 0x8a, 0x9b, 0x03, 0xe6, 0x9b,
+    0x86, 0x03, 0xe6, 0xad, 0xb7, 0x03, 0xe8, 0xbd, 0xa2, 0x03, 0xe5, 0xb9,
+    0xb4, 0x03, 0xe6, 0x86, 0x90, 0x03, 0xe6, 0x88, 0x80, 0x03, 0xe6, 0x92,
+    0x9a, 0x03, 0xe6, 0xbc, 0xa3, 0x03, 0xe7, 0x85, 0x89, 0x03, 0xe7, 0x92,
+    0x89, 0x03, 0xe7, 0xa7, 0x8a, 0x03, 0xe7, 0xb7, 0xb4, 0x03, 0xe8, 0x81,
+    0xaf, 0x03, 0xe8, 0xbc, 0xa6, 0x03, 0xe8, 0x93, 0xae, 0x03, 0xe9, 0x80,
+    0xa3, 0x03, 0xe9, 0x8d, 0x8a, 0x03, 0xe5, 0x88, 0x97, 0x03, 0xe5, 0x8a,
+    0xa3, 0x03, 0xe5, 0x92, 0xbd, 0x03, 0xe7, 0x83, 0x88, 0x03, 0xe8, 0xa3,
+    0x82, 0x03, 0xe8, 0xaa, 0xaa, 0x03, 0xe5, 0xbb, 0x89, 0x03, 0xe5, 0xbf,
+    0xb5, 0x03, 0xe6, 0x8d, 0xbb, 0x03, 0xe6, 0xae, 0xae, 0x03, 0xe7, 0xb0,
+    0xbe, 0x03, 0xe7, 0x8d, 0xb5, 0x03, 0xe4, 0xbb, 0xa4, 0x03, 0xe5, 0x9b,
+    0xb9, 0x03, 0xe5, 0xaf, 0xa7, 0x03, 0xe5, 0xb6, 0xba, 0x03, 0xe6, 0x80,
+    0x9c, 0x03, 0xe7, 0x8e, 0xb2, 0x03, 0xe7, 0x91, 0xa9, 0x03, 0xe7, 0xbe,
+    0x9a, 0x03, 0xe8, 0x81, 0x86, 0x03, 0xe9, 0x88, 0xb4, 0x03, 0xe9, 0x9b,
+    0xb6, 0x03, 0xe9, 0x9d, 0x88, 0x03, 0xe9, 0xa0, 0x98, 0x03, 0xe4, 0xbe,
+    0x8b, 0x03, 0xe7, 0xa6, 0xae, 0x03, 0xe9, 0x86, 0xb4, 0x03, 0xe9, 0x9a,
+    0xb8, 0x03, 0xe6, 0x83, 0xa1, 0x03, 0xe4, 0xba, 0x86, 0x03, 0xe5, 0x83,
+    0x9a, 0x03, 0xe5, 0xaf, 0xae, 0x03, 0xe5, 0xb0, 0xbf, 0x03, 0xe6, 0x96,
+    0x99, 0x03, 0xe6, 0xa8, 0x82, 0x03, 0xe7, 0x87, 0x8e, 0x03, 0xe7, 0x99,
+    0x82, 0x03, 0xe8, 0x93, 0xbc, 0x03, 0xe9, 0x81, 0xbc, 0x03, 0xe9, 0xbe,
+    0x8d, 0x03, 0xe6, 0x9a, 0x88, 0x03, 0xe9, 0x98, 0xae, 0x03, 0xe5, 0x8a,
+    0x89, 0x03, 0xe6, 0x9d, 0xbb, 0x03, 0xe6, 0x9f, 0xb3, 0x03, 0xe6, 0xb5,
+    0x81, 0x03, 0xe6, 0xba, 0x9c, 0x03, 0xe7, 0x90, 0x89, 0x03, 0xe7, 0x95,
+    0x99, 0x03, 0xe7, 0xa1, 0xab, 0x03, 0xe7, 0xb4, 0x90, 0x03, 0xe9, 0xa1,
+    0x9e, 0x03, 0xe5, 0x85, 0xad, 0x03, 0xe6, 0x88, 0xae, 0x03, 0xe9, 0x99,
+    0xb8, 0x03, 0xe5, 0x80, 0xab, 0x03, 0xe5, 0xb4, 0x99, 0x03, 0xe6, 0xb7,
+    0xaa, 0x03, 0xe8, 0xbc, 0xaa, 0x03, 0xe5, 0xbe, 0x8b, 0x03, 0xe6, 0x85,
+    0x84, 0x03, 0xe6, 0xa0, 0x97, 0x03, 0xe7, 0x8e, 0x87, 0x03, 0xe9, 0x9a,
+    0x86, 0x03, 0xe5, 0x88, 0xa9, 0x03, 0xe5, 0x90, 0x8f, 0x03, 0xe5, 0xb1,
+    0xa5, 0x03, 0xe6, 0x98, 0x93, 0x03, 0xe6, 0x9d, 0x8e, 0x03, 0xe6, 0xa2,
+    0xa8, 0x03, 0xe6, 0xb3, 0xa5, 0x03, 0xe7, 0x90, 0x86, 0x03, 0xe7, 0x97,
+    0xa2, 0x03, 0xe7, 0xbd, 0xb9, 0x03, 0xe8, 0xa3, 0x8f, 0x03, 0xe8, 0xa3,
+    0xa1, 0x03, 0xe9, 0x87, 0x8c, 0x03, 0xe9, 0x9b, 0xa2, 0x03, 0xe5, 0x8c,
+    0xbf, 0x03, 0xe6, 0xba, 0xba, 0x03, 0xe5, 0x90, 0x9d, 0x03, 0xe7, 0x87,
+    0x90, 0x03, 0xe7, 0x92, 0x98, 0x03, 0xe8, 0x97, 0xba, 0x03, 0xe9, 0x9a,
+    0xa3, 0x03, 0xe9, 0xb1, 0x97, 0x03, 0xe9, 0xba, 0x9f, 0x03, 0xe6, 0x9e,
+    0x97, 0x03, 0xe6, 0xb7, 0x8b, 0x03, 0xe8, 0x87, 0xa8, 0x03, 0xe7, 0xab,
+    0x8b, 0x03, 0xe7, 0xac, 0xa0, 0x03, 0xe7, 0xb2, 0x92, 0x03, 0xe7, 0x8b,
+    0x80, 0x03, 0xe7, 0x82, 0x99, 0x03, 0xe8, 0xad, 0x98, 0x03, 0xe4, 0xbb,
+    0x80, 0x03, 0xe8, 0x8c, 0xb6, 0x03, 0xe5, 0x88, 0xba, 0x03, 0xe5, 0x88,
+    0x87, 0x03, 0xe5, 0xba, 0xa6, 0x03, 0xe6, 0x8b, 0x93, 0x03, 0xe7, 0xb3,
+    0x96, 0x03, 0xe5, 0xae, 0x85, 0x03, 0xe6, 0xb4, 0x9e, 0x03, 0xe6, 0x9a,
+    0xb4, 0x03, 0xe8, 0xbc, 0xbb, 0x03, 0xe8, 0xa1, 0x8c, 0x03, 0xe9, 0x99,
+    0x8d, 0x03, 0xe8, 0xa6, 0x8b, 0x03, 0xe5, 0xbb, 0x93, 0x03, 0xe5, 0x85,
+    0x80, 0x03, 0xe5, 0x97, 0x80, 0x03, 0xe5, 0xa1, 0x9a, 0x03, 0xe6, 0x99,
+    0xb4, 0x03, 0xe5, 0x87, 0x9e, 0x03, 0xe7, 0x8c, 0xaa, 0x03, 0xe7, 0x9b,
+    0x8a, 0x03, 0xe7, 0xa4, 0xbc, 0x03, 0xe7, 0xa5, 0x9e, 0x03, 0xe7, 0xa5,
+    0xa5, 0x03, 0xe7, 0xa6, 0x8f, 0x03, 0xe9, 0x9d, 0x96, 0x03, 0xe7, 0xb2,
+    0xbe, 0x03, 0xe7, 0xbe, 0xbd, 0x03, 0xe8, 0x98, 0x92, 0x03, 0xe8, 0xab,
+    0xb8, 0x03, 0xe9, 0x80, 0xb8, 0x03, 0xe9, 0x83, 0xbd, 0x03, 0xe9, 0xa3,
+    0xaf, 0x03, 0xe9, 0xa3, 0xbc, 0x03, 0xe9, 0xa4, 0xa8, 0x03, 0xe9, 0xb6,
+    0xb4, 0x03, 0xe9, 0x83, 0x9e, 0x03, 0xe9, 0x9a, 0xb7, 0x03, 0xe4, 0xbe,
+    0xae, 0x03, 0xe5, 0x83, 0xa7, 0x03, 0xe5, 0x85, 0x8d, 0x03, 0xe5, 0x8b,
+    0x89, 0x03, 0xe5, 0x8b, 0xa4, 0x03, 0xe5, 0x8d, 0x91, 0x03, 0xe5, 0x96,
+    0x9d, 0x03, 0xe5, 0x98, 0x86, 0x03, 0xe5, 0x99, 0xa8, 0x03, 0xe5, 0xa1,
+    0x80, 0x03, 0xe5, 0xa2, 0xa8, 0x03, 0xe5, 0xb1, 0xa4, 0x03, 0xe5, 0xb1,
+    0xae, 0x03, 0xe6, 0x82, 0x94, 0x03, 0xe6, 0x85, 0xa8, 0x03, 0xe6, 0x86,
+    0x8e, 0x03, 0xe6, 0x87, 0xb2, 0x03, 0xe6, 0x95, 0x8f, 0x03, 0xe6, 0x97,
+    0xa2, 0x03, 0xe6, 0x9a, 0x91, 0x03, 0xe6, 0xa2, 0x85, 0x03, 0xe6, 0xb5,
+    0xb7, 0x03, 0xe6, 0xb8, 0x9a, 0x03, 0xe6, 0xbc, 0xa2, 0x03, 0xe7, 0x85,
+    0xae, 0x03, 0xe7, 0x88, 0xab, 0x03, 0xe7, 0x90, 0xa2, 0x03, 0xe7, 0xa2,
+    0x91, 0x03, 0xe7, 0xa4, 0xbe, 0x03, 0xe7, 0xa5, 0x89, 0x03, 0xe7, 0xa5,
+    0x88, 0x03, 0xe7, 0xa5, 0x90, 0x03, 0xe7, 0xa5, 0x96, 0x03, 0xe7, 0xa5,
+    0x9d, 0x03, 0xe7, 0xa6, 0x8d, 0x03, 0xe7, 0xa6, 0x8e, 0x03, 0xe7, 0xa9,
+    0x80, 0x03, 0xe7, 0xaa, 0x81, 0x03, 0xe7, 0xaf, 0x80, 0x03, 0xe7, 0xb7,
+    0xb4, 0x03, 0xe7, 0xb8, 0x89, 0x03, 0xe7, 0xb9, 0x81, 0x03, 0xe7, 0xbd,
+    0xb2, 0x03, 0xe8, 0x80, 0x85, 0x03, 0xe8, 0x87, 0xad, 0x03, 0xe8, 0x89,
+    0xb9, 0x03, 0xe8, 0x89, 0xb9, 0x03, 0xe8, 0x91, 0x97, 0x03, 0xe8, 0xa4,
+    0x90, 0x03, 0xe8, 0xa6, 0x96, 0x03, 0xe8, 0xac, 0x81, 0x03, 0xe8, 0xac,
+    0xb9, 0x03, 0xe8, 0xb3, 0x93, 0x03, 0xe8, 0xb4, 0x88, 0x03, 0xe8, 0xbe,
+    0xb6, 0x03, 0xe9, 0x80, 0xb8, 0x03, 0xe9, 0x9b, 0xa3, 0x03, 0xe9, 0x9f,
+    0xbf, 0x03, 0xe9, 0xa0, 0xbb, 0x03, 0xe6, 0x81, 0xb5, 0x04, 0xf0, 0xa4,
+    0x8b, 0xae, 0x03, 0xe8, 0x88, 0x98, 0x03, 0xe4, 0xb8, 0xa6, 0x03, 0xe5,
+    0x86, 0xb5, 0x03, 0xe5, 0x85, 0xa8, 0x03, 0xe4, 0xbe, 0x80, 0x03, 0xe5,
+    0x85, 0x85, 0x03, 0xe5, 0x86, 0x80, 0x03, 0xe5, 0x8b, 0x87, 0x03, 0xe5,
+    0x8b, 0xba, 0x03, 0xe5, 0x96, 0x9d, 0x03, 0xe5, 0x95, 0x95, 0x03, 0xe5,
+    0x96, 0x99, 0x03, 0xe5, 0x97, 0xa2, 0x03, 0xe5, 0xa1, 0x9a, 0x03, 0xe5,
+    0xa2, 0xb3, 0x03, 0xe5, 0xa5, 0x84, 0x03, 0xe5, 0xa5, 0x94, 0x03, 0xe5,
+    0xa9, 0xa2, 0x03, 0xe5, 0xac, 0xa8, 0x03, 0xe5, 0xbb, 0x92, 0x03, 0xe5,
+    0xbb, 0x99, 0x03, 0xe5, 0xbd, 0xa9, 0x03, 0xe5, 0xbe, 0xad, 0x03, 0xe6,
+    0x83, 0x98, 0x03, 0xe6, 0x85, 0x8e, 0x03, 0xe6, 0x84, 0x88, 0x03, 0xe6,
+    0x86, 0x8e, 0x03, 0xe6, 0x85, 0xa0, 0x03, 0xe6, 0x87, 0xb2, 0x03, 0xe6,
+    0x88, 0xb4, 0x03, 0xe6, 0x8f, 0x84, 0x03, 0xe6, 0x90, 0x9c, 0x03, 0xe6,
+    0x91, 0x92, 0x03, 0xe6, 0x95, 0x96, 0x03, 0xe6, 0x99, 0xb4, 0x03, 0xe6,
+    0x9c, 0x97, 0x03, 0xe6, 0x9c, 0x9b, 0x03, 0xe6, 0x9d, 0x96, 0x03, 0xe6,
+    0xad, 0xb9, 0x03, 0xe6, 0xae, 0xba, 0x03, 0xe6, 0xb5, 0x81, 0x03, 0xe6,
+    0xbb, 0x9b, 0x03, 0xe6, 0xbb, 0x8b, 0x03, 0xe6, 0xbc, 0xa2, 0x03, 0xe7,
+    0x80, 0x9e, 0x03, 0xe7, 0x85, 0xae, 0x03, 0xe7, 0x9e, 0xa7, 0x03, 0xe7,
+    0x88, 0xb5, 0x03, 0xe7, 0x8a, 0xaf, 0x03, 0xe7, 0x8c, 0xaa, 0x03, 0xe7,
+    0x91, 0xb1, 0x03, 0xe7, 0x94, 0x86, 0x03, 0xe7, 0x94, 0xbb, 0x03, 0xe7,
+    0x98, 0x9d, 0x03, 0xe7, 0x98, 0x9f, 0x03, 0xe7, 0x9b, 0x8a, 0x03, 0xe7,
+    0x9b, 0x9b, 0x03, 0xe7, 0x9b, 0xb4, 0x03, 0xe7, 0x9d, 0x8a, 0x03, 0xe7,
+    0x9d, 0x80, 0x03, 0xe7, 0xa3, 0x8c, 0x03, 0xe7, 0xaa, 0xb1, 0x03, 0xe7,
+    0xaf, 0x80, 0x03, 0xe7, 0xb1, 0xbb, 0x03, 0xe7, 0xb5, 0x9b, 0x03, 0xe7,
+    0xb7, 0xb4, 0x03, 0xe7, 0xbc, 0xbe, 0x03, 0xe8, 0x80, 0x85, 0x03, 0xe8,
+    0x8d, 0x92, 0x03, 0xe8, 0x8f, 0xaf, 0x03, 0xe8, 0x9d, 0xb9, 0x03, 0xe8,
+    0xa5, 0x81, 0x03, 0xe8, 0xa6, 0x86, 0x03, 0xe8, 0xa6, 0x96, 0x03, 0xe8,
+    0xaa, 0xbf, 0x03, 0xe8, 0xab, 0xb8, 0x03, 0xe8, 0xab, 0x8b, 0x03, 0xe8,
+    0xac, 0x81, 0x03, 0xe8, 0xab, 0xbe, 0x03, 0xe8, 0xab, 0xad, 0x03, 0xe8,
+    0xac, 0xb9, 0x03, 0xe8, 0xae, 0x8a, 0x03, 0xe8, 0xb4, 0x88, 0x03, 0xe8,
+    0xbc, 0xb8, 0x03, 0xe9, 0x81, 0xb2, 0x03, 0xe9, 0x86, 0x99, 0x03, 0xe9,
+    0x89, 0xb6, 0x03, 0xe9, 0x99, 0xbc, 0x03, 0xe9, 0x9b, 0xa3, 0x03, 0xe9,
+    0x9d, 0x96, 0x03, 0xe9, 0x9f, 0x9b, 0x03, 0xe9, 0x9f, 0xbf, 0x03, 0xe9,
+    0xa0, 0x8b, 0x03, 0xe9, 0xa0, 0xbb, 0x03, 0xe9, 0xac, 0x92, 0x03, 0xe9,
+    0xbe, 0x9c, 0x04, 0xf0, 0xa2, 0xa1, 0x8a, 0x04, 0xf0, 0xa2, 0xa1, 0x84,
+    0x04, 0xf0, 0xa3, 0x8f, 0x95, 0x03, 0xe3, 0xae, 0x9d, 0x03, 0xe4, 0x80,
+    0x98, 0x03, 0xe4, 0x80, 0xb9, 0x04, 0xf0, 0xa5, 0x89, 0x89, 0x04, 0xf0,
+    0xa5, 0xb3, 0x90, 0x04, 0xf0, 0xa7, 0xbb, 0x93, 0x03, 0xe9, 0xbd, 0x83,
+    0x03, 0xe9, 0xbe, 0x8e, 0x02, 0x66, 0x66, 0x02, 0x66, 0x69, 0x02, 0x66,
+    0x6c, 0x03, 0x66, 0x66, 0x69, 0x03, 0x66, 0x66, 0x6c, 0x02, 0x73, 0x74,
+    0x02, 0x73, 0x74, 0x04, 0xd5, 0xb4, 0xd5, 0xb6, 0x04, 0xd5, 0xb4, 0xd5,
+    0xa5, 0x04, 0xd5, 0xb4, 0xd5, 0xab, 0x04, 0xd5, 0xbe, 0xd5, 0xb6, 0x04,
+    0xd5, 0xb4, 0xd5, 0xad, 0x04, 0xd7, 0x99, 0xd6, 0xb4, 0x04, 0xd7, 0xb2,
+    0xd6, 0xb7, 0x02, 0xd7, 0xa2, 0x02, 0xd7, 0x90, 0x02, 0xd7, 0x93, 0x02,
+    0xd7, 0x94, 0x02, 0xd7, 0x9b, 0x02, 0xd7, 0x9c, 0x02, 0xd7, 0x9d, 0x02,
+    0xd7, 0xa8, 0x02, 0xd7, 0xaa, 0x01, 0x2b, 0x04, 0xd7, 0xa9, 0xd7, 0x81,
+    0x04, 0xd7, 0xa9, 0xd7, 0x82, 0x06, 0xd7, 0xa9, 0xd6, 0xbc, 0xd7, 0x81,
+    0x06, 0xd7, 0xa9, 0xd6, 0xbc, 0xd7, 0x82, 0x04, 0xd7, 0x90, 0xd6, 0xb7,
+    0x04, 0xd7, 0x90, 0xd6, 0xb8, 0x04, 0xd7, 0x90, 0xd6, 0xbc, 0x04, 0xd7,
+    0x91, 0xd6, 0xbc, 0x04, 0xd7, 0x92, 0xd6, 0xbc, 0x04, 0xd7, 0x93, 0xd6,
+    0xbc, 0x04, 0xd7, 0x94, 0xd6, 0xbc, 0x04, 0xd7, 0x95, 0xd6, 0xbc, 0x04,
+    0xd7, 0x96, 0xd6, 0xbc, 0x04, 0xd7, 0x98, 0xd6, 0xbc, 0x04, 0xd7, 0x99,
+    0xd6, 0xbc, 0x04, 0xd7, 0x9a, 0xd6, 0xbc, 0x04, 0xd7, 0x9b, 0xd6, 0xbc,
+    0x04, 0xd7, 0x9c, 0xd6, 0xbc, 0x04, 0xd7, 0x9e, 0xd6, 0xbc, 0x04, 0xd7,
+    0xa0, 0xd6, 0xbc, 0x04, 0xd7, 0xa1, 0xd6, 0xbc, 0x04, 0xd7, 0xa3, 0xd6,
+    0xbc, 0x04, 0xd7, 0xa4, 0xd6, 0xbc, 0x04, 0xd7, 0xa6, 0xd6, 0xbc, 0x04,
+    0xd7, 0xa7, 0xd6, 0xbc, 0x04, 0xd7, 0xa8, 0xd6, 0xbc, 0x04, 0xd7, 0xa9,
+    0xd6, 0xbc, 0x04, 0xd7, 0xaa, 0xd6, 0xbc, 0x04, 0xd7, 0x95, 0xd6, 0xb9,
+    0x04, 0xd7, 0x91, 0xd6, 0xbf, 0x04, 0xd7, 0x9b, 0xd6, 0xbf, 0x04, 0xd7,
+    0xa4, 0xd6, 0xbf, 0x04, 0xd7, 0x90, 0xd7, 0x9c, 0x02, 0xd9, 0xb1, 0x02,
+    0xd9, 0xb1, 0x02, 0xd9, 0xbb, 0x02, 0xd9, 0xbb, 0x02, 0xd9, 0xbb, 0x02,
+    0xd9, 0xbb, 0x02, 0xd9, 0xbe, 0x02, 0xd9, 0xbe, 0x02, 0xd9, 0xbe, 0x02,
+    0xd9, 0xbe, 0x02, 0xda, 0x80, 0x02, 0xda, 0x80, 0x02, 0xda, 0x80, 0x02,
+    0xda, 0x80, 0x02, 0xd9, 0xba, 0x02, 0xd9, 0xba, 0x02, 0xd9, 0xba, 0x02,
+    0xd9, 0xba, 0x02, 0xd9, 0xbf, 0x02, 0xd9, 0xbf, 0x02, 0xd9, 0xbf, 0x02,
+    0xd9, 0xbf, 0x02, 0xd9, 0xb9, 0x02, 0xd9, 0xb9, 0x02, 0xd9, 0xb9, 0x02,
+    0xd9, 0xb9, 0x02, 0xda, 0xa4, 0x02, 0xda, 0xa4, 0x02, 0xda, 0xa4, 0x02,
+    0xda, 0xa4, 0x02, 0xda, 0xa6, 0x02, 0xda, 0xa6, 0x02, 0xda, 0xa6, 0x02,
+    0xda, 0xa6, 0x02, 0xda, 0x84, 0x02, 0xda, 0x84, 0x02, 0xda, 0x84, 0x02,
+    0xda, 0x84, 0x02, 0xda, 0x83, 0x02, 0xda, 0x83, 0x02, 0xda, 0x83, 0x02,
+    0xda, 0x83, 0x02, 0xda, 0x86, 0x02, 0xda, 0x86, 0x02, 0xda, 0x86, 0x02,
+    0xda, 0x86, 0x02, 0xda, 0x87, 0x02, 0xda, 0x87, 0x02, 0xda, 0x87, 0x02,
+    0xda, 0x87, 0x02, 0xda, 0x8d, 0x02, 0xda, 0x8d, 0x02, 0xda, 0x8c, 0x02,
+    0xda, 0x8c, 0x02, 0xda, 0x8e, 0x02, 0xda, 0x8e, 0x02, 0xda, 0x88, 0x02,
+    0xda, 0x88, 0x02, 0xda, 0x98, 0x02, 0xda, 0x98, 0x02, 0xda, 0x91, 0x02,
+    0xda, 0x91, 0x02, 0xda, 0xa9, 0x02, 0xda, 0xa9, 0x02, 0xda, 0xa9, 0x02,
+    0xda, 0xa9, 0x02, 0xda, 0xaf, 0x02, 0xda, 0xaf, 0x02, 0xda, 0xaf, 0x02,
+    0xda, 0xaf, 0x02, 0xda, 0xb3, 0x02, 0xda, 0xb3, 0x02, 0xda, 0xb3, 0x02,
+    0xda, 0xb3, 0x02, 0xda, 0xb1, 0x02, 0xda, 0xb1, 0x02, 0xda, 0xb1, 0x02,
+    0xda, 0xb1, 0x02, 0xda, 0xba, 0x02, 0xda, 0xba, 0x02, 0xda, 0xbb, 0x02,
+    0xda, 0xbb, 0x02, 0xda, 0xbb, 0x02, 0xda, 0xbb, 0x04, 0xdb, 0x95, 0xd9,
+    0x94, 0x04, 0xdb, 0x95, 0xd9, 0x94, 0x02, 0xdb, 0x81, 0x02, 0xdb, 0x81,
+    0x02, 0xdb, 0x81, 0x02, 0xdb, 0x81, 0x02, 0xda, 0xbe, 0x02, 0xda, 0xbe,
+    0x02, 0xda, 0xbe, 0x02, 0xda, 0xbe, 0x02, 0xdb, 0x92, 0x02, 0xdb, 0x92,
+    0x04, 0xdb, 0x92, 0xd9, 0x94, 0x04, 0xdb, 0x92, 0xd9, 0x94, 0x02, 0xda,
+    0xad, 0x02, 0xda, 0xad, 0x02, 0xda, 0xad, 0x02, 0xda, 0xad, 0x02, 0xdb,
+    0x87, 0x02, 0xdb, 0x87, 0x02, 0xdb, 0x86, 0x02, 0xdb, 0x86, 0x02, 0xdb,
+    0x88, 0x02, 0xdb, 0x88, 0x04, 0xdb, 0x87, 0xd9, 0xb4, 0x02, 0xdb, 0x8b,
+    0x02, 0xdb, 0x8b, 0x02, 0xdb, 0x85, 0x02, 0xdb, 0x85, 0x02, 0xdb, 0x89,
+    0x02, 0xdb, 0x89, 0x02, 0xdb, 0x90, 0x02, 0xdb, 0x90, 0x02, 0xdb, 0x90,
+    0x02, 0xdb, 0x90, 0x02, 0xd9, 0x89, 0x02, 0xd9, 0x89, 0x06, 0xd9, 0x8a,
+    0xd9, 0x94, 0xd8, 0xa7, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd8, 0xa7, 0x06,
+    0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x95, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xdb,
+    0x95, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x88, 0x06, 0xd9, 0x8a, 0xd9,
+    0x94, 0xd9, 0x88, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x87, 0x06, 0xd9,
+    0x8a, 0xd9, 0x94, 0xdb, 0x87, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x86,
+    0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x86, 0x06, 0xd9, 0x8a, 0xd9, 0x94,
+    0xdb, 0x88, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x88, 0x06, 0xd9, 0x8a,
+    0xd9, 0x94, 0xdb, 0x90, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x90, 0x06,
+    0xd9, 0x8a, 0xd9, 0x94, 0xdb, 0x90, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9,
+    0x89, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x89, 0x06, 0xd9, 0x8a, 0xd9,
+    0x94, 0xd9, 0x89, 0x02, 0xdb, 0x8c, 0x02, 0xdb, 0x8c, 0x02, 0xdb, 0x8c,
+    0x02, 0xdb, 0x8c, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd8, 0xac, 0x06, 0xd9,
+    0x8a, 0xd9, 0x94, 0xd8, 0xad, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x85,
+    0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x89, 0x06, 0xd9, 0x8a, 0xd9, 0x94,
+    0xd9, 0x8a, 0x04, 0xd8, 0xa8, 0xd8, 0xac, 0x04, 0xd8, 0xa8, 0xd8, 0xad,
+    0x04, 0xd8, 0xa8, 0xd8, 0xae, 0x04, 0xd8, 0xa8, 0xd9, 0x85, 0x04, 0xd8,
+    0xa8, 0xd9, 0x89, 0x04, 0xd8, 0xa8, 0xd9, 0x8a, 0x04, 0xd8, 0xaa, 0xd8,
+    0xac, 0x04, 0xd8, 0xaa, 0xd8, 0xad, 0x04, 0xd8, 0xaa, 0xd8, 0xae, 0x04,
+    0xd8, 0xaa, 0xd9, 0x85, 0x04, 0xd8, 0xaa, 0xd9, 0x89, 0x04, 0xd8, 0xaa,
+    0xd9, 0x8a, 0x04, 0xd8, 0xab, 0xd8, 0xac, 0x04, 0xd8, 0xab, 0xd9, 0x85,
+    0x04, 0xd8, 0xab, 0xd9, 0x89, 0x04, 0xd8, 0xab, 0xd9, 0x8a, 0x04, 0xd8,
+    0xac, 0xd8, 0xad, 0x04, 0xd8, 0xac, 0xd9, 0x85, 0x04, 0xd8, 0xad, 0xd8,
+    0xac, 0x04, 0xd8, 0xad, 0xd9, 0x85, 0x04, 0xd8, 0xae, 0xd8, 0xac, 0x04,
+    0xd8, 0xae, 0xd8, 0xad, 0x04, 0xd8, 0xae, 0xd9, 0x85, 0x04, 0xd8, 0xb3,
+    0xd8, 0xac, 0x04, 0xd8, 0xb3, 0xd8, 0xad, 0x04, 0xd8, 0xb3, 0xd8, 0xae,
+    0x04, 0xd8, 0xb3, 0xd9, 0x85, 0x04, 0xd8, 0xb5, 0xd8, 0xad, 0x04, 0xd8,
+    0xb5, 0xd9, 0x85, 0x04, 0xd8, 0xb6, 0xd8, 0xac, 0x04, 0xd8, 0xb6, 0xd8,
+    0xad, 0x04, 0xd8, 0xb6, 0xd8, 0xae, 0x04, 0xd8, 0xb6, 0xd9, 0x85, 0x04,
+    0xd8, 0xb7, 0xd8, 0xad, 0x04, 0xd8, 0xb7, 0xd9, 0x85, 0x04, 0xd8, 0xb8,
+    0xd9, 0x85, 0x04, 0xd8, 0xb9, 0xd8, 0xac, 0x04, 0xd8, 0xb9, 0xd9, 0x85,
+    0x04, 0xd8, 0xba, 0xd8, 0xac, 0x04, 0xd8, 0xba, 0xd9, 0x85, 0x04, 0xd9,
+    0x81, 0xd8, 0xac, 0x04, 0xd9, 0x81, 0xd8, 0xad, 0x04, 0xd9, 0x81, 0xd8,
+    0xae, 0x04, 0xd9, 0x81, 0xd9, 0x85, 0x04, 0xd9, 0x81, 0xd9, 0x89, 0x04,
+    0xd9, 0x81, 0xd9, 0x8a, 0x04, 0xd9, 0x82, 0xd8, 0xad, 0x04, 0xd9, 0x82,
+    0xd9, 0x85, 0x04, 0xd9, 0x82, 0xd9, 0x89, 0x04, 0xd9, 0x82, 0xd9, 0x8a,
+    0x04, 0xd9, 0x83, 0xd8, 0xa7, 0x04, 0xd9, 0x83, 0xd8, 0xac, 0x04, 0xd9,
+    0x83, 0xd8, 0xad, 0x04, 0xd9, 0x83, 0xd8, 0xae, 0x04, 0xd9, 0x83, 0xd9,
+    0x84, 0x04, 0xd9, 0x83, 0xd9, 0x85, 0x04, 0xd9, 0x83, 0xd9, 0x89, 0x04,
+    0xd9, 0x83, 0xd9, 0x8a, 0x04, 0xd9, 0x84, 0xd8, 0xac, 0x04, 0xd9, 0x84,
+    0xd8, 0xad, 0x04, 0xd9, 0x84, 0xd8, 0xae, 0x04, 0xd9, 0x84, 0xd9, 0x85,
+    0x04, 0xd9, 0x84, 0xd9, 0x89, 0x04, 0xd9, 0x84, 0xd9, 0x8a, 0x04, 0xd9,
+    0x85, 0xd8, 0xac, 0x04, 0xd9, 0x85, 0xd8, 0xad, 0x04, 0xd9, 0x85, 0xd8,
+    0xae, 0x04, 0xd9, 0x85, 0xd9, 0x85, 0x04, 0xd9, 0x85, 0xd9, 0x89, 0x04,
+    0xd9, 0x85, 0xd9, 0x8a, 0x04, 0xd9, 0x86, 0xd8, 0xac, 0x04, 0xd9, 0x86,
+    0xd8, 0xad, 0x04, 0xd9, 0x86, 0xd8, 0xae, 0x04, 0xd9, 0x86, 0xd9, 0x85,
+    0x04, 0xd9, 0x86, 0xd9, 0x89, 0x04, 0xd9, 0x86, 0xd9, 0x8a, 0x04, 0xd9,
+    0x87, 0xd8, 0xac, 0x04, 0xd9, 0x87, 0xd9, 0x85, 0x04, 0xd9, 0x87, 0xd9,
+    0x89, 0x04, 0xd9, 0x87, 0xd9, 0x8a, 0x04, 0xd9, 0x8a, 0xd8, 0xac, 0x04,
+    0xd9, 0x8a, 0xd8, 0xad, 0x04, 0xd9, 0x8a, 0xd8, 0xae, 0x04, 0xd9, 0x8a,
+    0xd9, 0x85, 0x04, 0xd9, 0x8a, 0xd9, 0x89, 0x04, 0xd9, 0x8a, 0xd9, 0x8a,
+    0x04, 0xd8, 0xb0, 0xd9, 0xb0, 0x04, 0xd8, 0xb1, 0xd9, 0xb0, 0x04, 0xd9,
+    0x89, 0xd9, 0xb0, 0x05, 0x20, 0xd9, 0x8c, 0xd9, 0x91, 0x05, 0x20, 0xd9,
+    0x8d, 0xd9, 0x91, 0x05, 0x20, 0xd9, 0x8e, 0xd9, 0x91, 0x05, 0x20, 0xd9,
+    0x8f, 0xd9, 0x91, 0x05, 0x20, 0xd9, 0x90, 0xd9, 0x91, 0x05, 0x20, 0xd9,
+    0x91, 0xd9, 0xb0, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd8, 0xb1, 0x06, 0xd9,
+    0x8a, 0xd9, 0x94, 0xd8, 0xb2, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x85,
+    0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x86, 0x06, 0xd9, 0x8a, 0xd9, 0x94,
+    0xd9, 0x89, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x8a, 0x04, 0xd8, 0xa8,
+    0xd8, 0xb1, 0x04, 0xd8, 0xa8, 0xd8, 0xb2, 0x04, 0xd8, 0xa8, 0xd9, 0x85,
+    0x04, 0xd8, 0xa8, 0xd9, 0x86, 0x04, 0xd8, 0xa8, 0xd9, 0x89, 0x04, 0xd8,
+    0xa8, 0xd9, 0x8a, 0x04, 0xd8, 0xaa, 0xd8, 0xb1, 0x04, 0xd8, 0xaa, 0xd8,
+    0xb2, 0x04, 0xd8, 0xaa, 0xd9, 0x85, 0x04, 0xd8, 0xaa, 0xd9, 0x86, 0x04,
+    0xd8, 0xaa, 0xd9, 0x89, 0x04, 0xd8, 0xaa, 0xd9, 0x8a, 0x04, 0xd8, 0xab,
+    0xd8, 0xb1, 0x04, 0xd8, 0xab, 0xd8, 0xb2, 0x04, 0xd8, 0xab, 0xd9, 0x85,
+    0x04, 0xd8, 0xab, 0xd9, 0x86, 0x04, 0xd8, 0xab, 0xd9, 0x89, 0x04, 0xd8,
+    0xab, 0xd9, 0x8a, 0x04, 0xd9, 0x81, 0xd9, 0x89, 0x04, 0xd9, 0x81, 0xd9,
+    0x8a, 0x04, 0xd9, 0x82, 0xd9, 0x89, 0x04, 0xd9, 0x82, 0xd9, 0x8a, 0x04,
+    0xd9, 0x83, 0xd8, 0xa7, 0x04, 0xd9, 0x83, 0xd9, 0x84, 0x04, 0xd9, 0x83,
+    0xd9, 0x85, 0x04, 0xd9, 0x83, 0xd9, 0x89, 0x04, 0xd9, 0x83, 0xd9, 0x8a,
+    0x04, 0xd9, 0x84, 0xd9, 0x85, 0x04, 0xd9, 0x84, 0xd9, 0x89, 0x04, 0xd9,
+    0x84, 0xd9, 0x8a, 0x04, 0xd9, 0x85, 0xd8, 0xa7, 0x04, 0xd9, 0x85, 0xd9,
+    0x85, 0x04, 0xd9, 0x86, 0xd8, 0xb1, 0x04, 0xd9, 0x86, 0xd8, 0xb2, 0x04,
+    0xd9, 0x86, 0xd9, 0x85, 0x04, 0xd9, 0x86, 0xd9, 0x86, 0x04, 0xd9, 0x86,
+    0xd9, 0x89, 0x04, 0xd9, 0x86, 0xd9, 0x8a, 0x04, 0xd9, 0x89, 0xd9, 0xb0,
+    0x04, 0xd9, 0x8a, 0xd8, 0xb1, 0x04, 0xd9, 0x8a, 0xd8, 0xb2, 0x04, 0xd9,
+    0x8a, 0xd9, 0x85, 0x04, 0xd9, 0x8a, 0xd9, 0x86, 0x04, 0xd9, 0x8a, 0xd9,
+    0x89, 0x04, 0xd9, 0x8a, 0xd9, 0x8a, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd8,
+    0xac, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd8, 0xad, 0x06, 0xd9, 0x8a, 0xd9,
+    0x94, 0xd8, 0xae, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x85, 0x06, 0xd9,
+    0x8a, 0xd9, 0x94, 0xd9, 0x87, 0x04, 0xd8, 0xa8, 0xd8, 0xac, 0x04, 0xd8,
+    0xa8, 0xd8, 0xad, 0x04, 0xd8, 0xa8, 0xd8, 0xae, 0x04, 0xd8, 0xa8, 0xd9,
+    0x85, 0x04, 0xd8, 0xa8, 0xd9, 0x87, 0x04, 0xd8, 0xaa, 0xd8, 0xac, 0x04,
+    0xd8, 0xaa, 0xd8, 0xad, 0x04, 0xd8, 0xaa, 0xd8, 0xae, 0x04, 0xd8, 0xaa,
+    0xd9, 0x85, 0x04, 0xd8, 0xaa, 0xd9, 0x87, 0x04, 0xd8, 0xab, 0xd9, 0x85,
+    0x04, 0xd8, 0xac, 0xd8, 0xad, 0x04, 0xd8, 0xac, 0xd9, 0x85, 0x04, 0xd8,
+    0xad, 0xd8, 0xac, 0x04, 0xd8, 0xad, 0xd9, 0x85, 0x04, 0xd8, 0xae, 0xd8,
+    0xac, 0x04, 0xd8, 0xae, 0xd9, 0x85, 0x04, 0xd8, 0xb3, 0xd8, 0xac, 0x04,
+    0xd8, 0xb3, 0xd8, 0xad, 0x04, 0xd8, 0xb3, 0xd8, 0xae, 0x04, 0xd8, 0xb3,
+    0xd9, 0x85, 0x04, 0xd8, 0xb5, 0xd8, 0xad, 0x04, 0xd8, 0xb5, 0xd8, 0xae,
+    0x04, 0xd8, 0xb5, 0xd9, 0x85, 0x04, 0xd8, 0xb6, 0xd8, 0xac, 0x04, 0xd8,
+    0xb6, 0xd8, 0xad, 0x04, 0xd8, 0xb6, 0xd8, 0xae, 0x04, 0xd8, 0xb6, 0xd9,
+    0x85, 0x04, 0xd8, 0xb7, 0xd8, 0xad, 0x04, 0xd8, 0xb8, 0xd9, 0x85, 0x04,
+    0xd8, 0xb9, 0xd8, 0xac, 0x04, 0xd8, 0xb9, 0xd9, 0x85, 0x04, 0xd8, 0xba,
+    0xd8, 0xac, 0x04, 0xd8, 0xba, 0xd9, 0x85, 0x04, 0xd9, 0x81, 0xd8, 0xac,
+    0x04, 0xd9, 0x81, 0xd8, 0xad, 0x04, 0xd9, 0x81, 0xd8, 0xae, 0x04, 0xd9,
+    0x81, 0xd9, 0x85, 0x04, 0xd9, 0x82, 0xd8, 0xad, 0x04, 0xd9, 0x82, 0xd9,
+    0x85, 0x04, 0xd9, 0x83, 0xd8, 0xac, 0x04, 0xd9, 0x83, 0xd8, 0xad, 0x04,
+    0xd9, 0x83, 0xd8, 0xae, 0x04, 0xd9, 0x83, 0xd9, 0x84, 0x04, 0xd9, 0x83,
+    0xd9, 0x85, 0x04, 0xd9, 0x84, 0xd8, 0xac, 0x04, 0xd9, 0x84, 0xd8, 0xad,
+    0x04, 0xd9, 0x84, 0xd8, 0xae, 0x04, 0xd9, 0x84, 0xd9, 0x85, 0x04, 0xd9,
+    0x84, 0xd9, 0x87, 0x04, 0xd9, 0x85, 0xd8, 0xac, 0x04, 0xd9, 0x85, 0xd8,
+    0xad, 0x04, 0xd9, 0x85, 0xd8, 0xae, 0x04, 0xd9, 0x85, 0xd9, 0x85, 0x04,
+    0xd9, 0x86, 0xd8, 0xac, 0x04, 0xd9, 0x86, 0xd8, 0xad, 0x04, 0xd9, 0x86,
+    0xd8, 0xae, 0x04, 0xd9, 0x86, 0xd9, 0x85, 0x04, 0xd9, 0x86, 0xd9, 0x87,
+    0x04, 0xd9, 0x87, 0xd8, 0xac, 0x04, 0xd9, 0x87, 0xd9, 0x85, 0x04, 0xd9,
+    0x87, 0xd9, 0xb0, 0x04, 0xd9, 0x8a, 0xd8, 0xac, 0x04, 0xd9, 0x8a, 0xd8,
+    0xad, 0x04, 0xd9, 0x8a, 0xd8, 0xae, 0x04, 0xd9, 0x8a, 0xd9, 0x85, 0x04,
+    0xd9, 0x8a, 0xd9, 0x87, 0x06, 0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x85, 0x06,
+    0xd9, 0x8a, 0xd9, 0x94, 0xd9, 0x87, 0x04, 0xd8, 0xa8, 0xd9, 0x85, 0x04,
+    0xd8, 0xa8, 0xd9, 0x87, 0x04, 0xd8, 0xaa, 0xd9, 0x85, 0x04, 0xd8, 0xaa,
+    0xd9, 0x87, 0x04, 0xd8, 0xab, 0xd9, 0x85, 0x04, 0xd8, 0xab, 0xd9, 0x87,
+    0x04, 0xd8, 0xb3, 0xd9, 0x85, 0x04, 0xd8, 0xb3, 0xd9, 0x87, 0x04, 0xd8,
+    0xb4, 0xd9, 0x85, 0x04, 0xd8, 0xb4, 0xd9, 0x87, 0x04, 0xd9, 0x83, 0xd9,
+    0x84, 0x04, 0xd9, 0x83, 0xd9, 0x85, 0x04, 0xd9, 0x84, 0xd9, 0x85, 0x04,
+    0xd9, 0x86, 0xd9, 0x85, 0x04, 0xd9, 0x86, 0xd9, 0x87, 0x04, 0xd9, 0x8a,
+    0xd9, 0x85, 0x04, 0xd9, 0x8a, 0xd9, 0x87, 0x06, 0xd9, 0x80, 0xd9, 0x8e,
+    0xd9, 0x91, 0x06, 0xd9, 0x80, 0xd9, 0x8f, 0xd9, 0x91, 0x06, 0xd9, 0x80,
+    0xd9, 0x90, 0xd9, 0x91, 0x04, 0xd8, 0xb7, 0xd9, 0x89, 0x04, 0xd8, 0xb7,
+    0xd9, 0x8a, 0x04, 0xd8, 0xb9, 0xd9, 0x89, 0x04, 0xd8, 0xb9, 0xd9, 0x8a,
+    0x04, 0xd8, 0xba, 0xd9, 0x89, 0x04, 0xd8, 0xba, 0xd9, 0x8a, 0x04, 0xd8,
+    0xb3, 0xd9, 0x89, 0x04, 0xd8, 0xb3, 0xd9, 0x8a, 0x04, 0xd8, 0xb4, 0xd9,
+    0x89, 0x04, 0xd8, 0xb4, 0xd9, 0x8a, 0x04, 0xd8, 0xad, 0xd9, 0x89, 0x04,
+    0xd8, 0xad, 0xd9, 0x8a, 0x04, 0xd8, 0xac, 0xd9, 0x89, 0x04, 0xd8, 0xac,
+    0xd9, 0x8a, 0x04, 0xd8, 0xae, 0xd9, 0x89, 0x04, 0xd8, 0xae, 0xd9, 0x8a,
+    0x04, 0xd8, 0xb5, 0xd9, 0x89, 0x04, 0xd8, 0xb5, 0xd9, 0x8a, 0x04, 0xd8,
+    0xb6, 0xd9, 0x89, 0x04, 0xd8, 0xb6, 0xd9, 0x8a, 0x04, 0xd8, 0xb4, 0xd8,
+    0xac, 0x04, 0xd8, 0xb4, 0xd8, 0xad, 0x04, 0xd8, 0xb4, 0xd8, 0xae, 0x04,
+    0xd8, 0xb4, 0xd9, 0x85, 0x04, 0xd8, 0xb4, 0xd8, 0xb1, 0x04, 0xd8, 0xb3,
+    0xd8, 0xb1, 0x04, 0xd8, 0xb5, 0xd8, 0xb1, 0x04, 0xd8, 0xb6, 0xd8, 0xb1,
+    0x04, 0xd8, 0xb7, 0xd9, 0x89, 0x04, 0xd8, 0xb7, 0xd9, 0x8a, 0x04, 0xd8,
+    0xb9, 0xd9, 0x89, 0x04, 0xd8, 0xb9, 0xd9, 0x8a, 0x04, 0xd8, 0xba, 0xd9,
+    0x89, 0x04, 0xd8, 0xba, 0xd9, 0x8a, 0x04, 0xd8, 0xb3, 0xd9, 0x89, 0x04,
+    0xd8, 0xb3, 0xd9, 0x8a, 0x04, 0xd8, 0xb4, 0xd9, 0x89, 0x04, 0xd8, 0xb4,
+    0xd9, 0x8a, 0x04, 0xd8, 0xad, 0xd9, 0x89, 0x04, 0xd8, 0xad, 0xd9, 0x8a,
+    0x04, 0xd8, 0xac, 0xd9, 0x89, 0x04, 0xd8, 0xac, 0xd9, 0x8a, 0x04, 0xd8,
+    0xae, 0xd9, 0x89, 0x04, 0xd8, 0xae, 0xd9, 0x8a, 0x04, 0xd8, 0xb5, 0xd9,
+    0x89, 0x04, 0xd8, 0xb5, 0xd9, 0x8a, 0x04, 0xd8, 0xb6, 0xd9, 0x89, 0x04,
+    0xd8, 0xb6, 0xd9, 0x8a, 0x04, 0xd8, 0xb4, 0xd8, 0xac, 0x04, 0xd8, 0xb4,
+    0xd8, 0xad, 0x04, 0xd8, 0xb4, 0xd8, 0xae, 0x04, 0xd8, 0xb4, 0xd9, 0x85,
+    0x04, 0xd8, 0xb4, 0xd8, 0xb1, 0x04, 0xd8, 0xb3, 0xd8, 0xb1, 0x04, 0xd8,
+    0xb5, 0xd8, 0xb1, 0x04, 0xd8, 0xb6, 0xd8, 0xb1, 0x04, 0xd8, 0xb4, 0xd8,
+    0xac, 0x04, 0xd8, 0xb4, 0xd8, 0xad, 0x04, 0xd8, 0xb4, 0xd8, 0xae, 0x04,
+    0xd8, 0xb4, 0xd9, 0x85, 0x04, 0xd8, 0xb3, 0xd9, 0x87, 0x04, 0xd8, 0xb4,
+    0xd9, 0x87, 0x04, 0xd8, 0xb7, 0xd9, 0x85, 0x04, 0xd8, 0xb3, 0xd8, 0xac,
+    0x04, 0xd8, 0xb3, 0xd8, 0xad, 0x04, 0xd8, 0xb3, 0xd8, 0xae, 0x04, 0xd8,
+    0xb4, 0xd8, 0xac, 0x04, 0xd8, 0xb4, 0xd8, 0xad, 0x04, 0xd8, 0xb4, 0xd8,
+    0xae, 0x04, 0xd8, 0xb7, 0xd9, 0x85, 0x04, 0xd8, 0xb8, 0xd9, 0x85, 0x04,
+    0xd8, 0xa7, 0xd9, 0x8b, 0x04, 0xd8, 0xa7, 0xd9, 0x8b, 0x06, 0xd8, 0xaa,
+    0xd8, 0xac, 0xd9, 0x85, 0x06, 0xd8, 0xaa, 0xd8, 0xad, 0xd8, 0xac, 0x06,
+    0xd8, 0xaa, 0xd8, 0xad, 0xd8, 0xac, 0x06, 0xd8, 0xaa, 0xd8, 0xad, 0xd9,
+    0x85, 0x06, 0xd8, 0xaa, 0xd8, 0xae, 0xd9, 0x85, 0x06, 0xd8, 0xaa, 0xd9,
+    0x85, 0xd8, 0xac, 0x06, 0xd8, 0xaa, 0xd9, 0x85, 0xd8, 0xad, 0x06, 0xd8,
+    0xaa, 0xd9, 0x85, 0xd8, 0xae, 0x06, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xad,
+    0x06, 0xd8, 0xac, 0xd9, 0x85, 0xd8, 0xad, 0x06, 0xd8, 0xad, 0xd9, 0x85,
+    0xd9, 0x8a, 0x06, 0xd8, 0xad, 0xd9, 0x85, 0xd9, 0x89, 0x06, 0xd8, 0xb3,
+    0xd8, 0xad, 0xd8, 0xac, 0x06, 0xd8, 0xb3, 0xd8, 0xac, 0xd8, 0xad, 0x06,
+    0xd8, 0xb3, 0xd8, 0xac, 0xd9, 0x89, 0x06, 0xd8, 0xb3, 0xd9, 0x85, 0xd8,
+    0xad, 0x06, 0xd8, 0xb3, 0xd9, 0x85, 0xd8, 0xad, 0x06, 0xd8, 0xb3, 0xd9,
+    0x85, 0xd8, 0xac, 0x06, 0xd8, 0xb3, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd8,
+    0xb3, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd8, 0xb5, 0xd8, 0xad, 0xd8, 0xad,
+    0x06, 0xd8, 0xb5, 0xd8, 0xad, 0xd8, 0xad, 0x06, 0xd8, 0xb5, 0xd9, 0x85,
+    0xd9, 0x85, 0x06, 0xd8, 0xb4, 0xd8, 0xad, 0xd9, 0x85, 0x06, 0xd8, 0xb4,
+    0xd8, 0xad, 0xd9, 0x85, 0x06, 0xd8, 0xb4, 0xd8, 0xac, 0xd9, 0x8a, 0x06,
+    0xd8, 0xb4, 0xd9, 0x85, 0xd8, 0xae, 0x06, 0xd8, 0xb4, 0xd9, 0x85, 0xd8,
+    0xae, 0x06, 0xd8, 0xb4, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd8, 0xb4, 0xd9,
+    0x85, 0xd9, 0x85, 0x06, 0xd8, 0xb6, 0xd8, 0xad, 0xd9, 0x89, 0x06, 0xd8,
+    0xb6, 0xd8, 0xae, 0xd9, 0x85, 0x06, 0xd8, 0xb6, 0xd8, 0xae, 0xd9, 0x85,
+    0x06, 0xd8, 0xb7, 0xd9, 0x85, 0xd8, 0xad, 0x06, 0xd8, 0xb7, 0xd9, 0x85,
+    0xd8, 0xad, 0x06, 0xd8, 0xb7, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd8, 0xb7,
+    0xd9, 0x85, 0xd9, 0x8a, 0x06, 0xd8, 0xb9, 0xd8, 0xac, 0xd9, 0x85, 0x06,
+    0xd8, 0xb9, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd8, 0xb9, 0xd9, 0x85, 0xd9,
+    0x85, 0x06, 0xd8, 0xb9, 0xd9, 0x85, 0xd9, 0x89, 0x06, 0xd8, 0xba, 0xd9,
+    0x85, 0xd9, 0x85, 0x06, 0xd8, 0xba, 0xd9, 0x85, 0xd9, 0x8a, 0x06, 0xd8,
+    0xba, 0xd9, 0x85, 0xd9, 0x89, 0x06, 0xd9, 0x81, 0xd8, 0xae, 0xd9, 0x85,
+    0x06, 0xd9, 0x81, 0xd8, 0xae, 0xd9, 0x85, 0x06, 0xd9, 0x82, 0xd9, 0x85,
+    0xd8, 0xad, 0x06, 0xd9, 0x82, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd9, 0x84,
+    0xd8, 0xad, 0xd9, 0x85, 0x06, 0xd9, 0x84, 0xd8, 0xad, 0xd9, 0x8a, 0x06,
+    0xd9, 0x84, 0xd8, 0xad, 0xd9, 0x89, 0x06, 0xd9, 0x84, 0xd8, 0xac, 0xd8,
+    0xac, 0x06, 0xd9, 0x84, 0xd8, 0xac, 0xd8, 0xac, 0x06, 0xd9, 0x84, 0xd8,
+    0xae, 0xd9, 0x85, 0x06, 0xd9, 0x84, 0xd8, 0xae, 0xd9, 0x85, 0x06, 0xd9,
+    0x84, 0xd9, 0x85, 0xd8, 0xad, 0x06, 0xd9, 0x84, 0xd9, 0x85, 0xd8, 0xad,
+    0x06, 0xd9, 0x85, 0xd8, 0xad, 0xd8, 0xac, 0x06, 0xd9, 0x85, 0xd8, 0xad,
+    0xd9, 0x85, 0x06, 0xd9, 0x85, 0xd8, 0xad, 0xd9, 0x8a, 0x06, 0xd9, 0x85,
+    0xd8, 0xac, 0xd8, 0xad, 0x06, 0xd9, 0x85, 0xd8, 0xac, 0xd9, 0x85, 0x06,
+    0xd9, 0x85, 0xd8, 0xae, 0xd8, 0xac, 0x06, 0xd9, 0x85, 0xd8, 0xae, 0xd9,
+    0x85, 0x06, 0xd9, 0x85, 0xd8, 0xac, 0xd8, 0xae, 0x06, 0xd9, 0x87, 0xd9,
+    0x85, 0xd8, 0xac, 0x06, 0xd9, 0x87, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd9,
+    0x86, 0xd8, 0xad, 0xd9, 0x85, 0x06, 0xd9, 0x86, 0xd8, 0xad, 0xd9, 0x89,
+    0x06, 0xd9, 0x86, 0xd8, 0xac, 0xd9, 0x85, 0x06, 0xd9, 0x86, 0xd8, 0xac,
+    0xd9, 0x85, 0x06, 0xd9, 0x86, 0xd8, 0xac, 0xd9, 0x89, 0x06, 0xd9, 0x86,
+    0xd9, 0x85, 0xd9, 0x8a, 0x06, 0xd9, 0x86, 0xd9, 0x85, 0xd9, 0x89, 0x06,
+    0xd9, 0x8a, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd9, 0x8a, 0xd9, 0x85, 0xd9,
+    0x85, 0x06, 0xd8, 0xa8, 0xd8, 0xae, 0xd9, 0x8a, 0x06, 0xd8, 0xaa, 0xd8,
+    0xac, 0xd9, 0x8a, 0x06, 0xd8, 0xaa, 0xd8, 0xac, 0xd9, 0x89, 0x06, 0xd8,
+    0xaa, 0xd8, 0xae, 0xd9, 0x8a, 0x06, 0xd8, 0xaa, 0xd8, 0xae, 0xd9, 0x89,
+    0x06, 0xd8, 0xaa, 0xd9, 0x85, 0xd9, 0x8a, 0x06, 0xd8, 0xaa, 0xd9, 0x85,
+    0xd9, 0x89, 0x06, 0xd8, 0xac, 0xd9, 0x85, 0xd9, 0x8a, 0x06, 0xd8, 0xac,
+    0xd8, 0xad, 0xd9, 0x89, 0x06, 0xd8, 0xac, 0xd9, 0x85, 0xd9, 0x89, 0x06,
+    0xd8, 0xb3, 0xd8, 0xae, 0xd9, 0x89, 0x06, 0xd8, 0xb5, 0xd8, 0xad, 0xd9,
+    0x8a, 0x06, 0xd8, 0xb4, 0xd8, 0xad, 0xd9, 0x8a, 0x06, 0xd8, 0xb6, 0xd8,
+    0xad, 0xd9, 0x8a, 0x06, 0xd9, 0x84, 0xd8, 0xac, 0xd9, 0x8a, 0x06, 0xd9,
+    0x84, 0xd9, 0x85, 0xd9, 0x8a, 0x06, 0xd9, 0x8a, 0xd8, 0xad, 0xd9, 0x8a,
+    0x06, 0xd9, 0x8a, 0xd8, 0xac, 0xd9, 0x8a, 0x06, 0xd9, 0x8a, 0xd9, 0x85,
+    0xd9, 0x8a, 0x06, 0xd9, 0x85, 0xd9, 0x85, 0xd9, 0x8a, 0x06, 0xd9, 0x82,
+    0xd9, 0x85, 0xd9, 0x8a, 0x06, 0xd9, 0x86, 0xd8, 0xad, 0xd9, 0x8a, 0x06,
+    0xd9, 0x82, 0xd9, 0x85, 0xd8, 0xad, 0x06, 0xd9, 0x84, 0xd8, 0xad, 0xd9,
+    0x85, 0x06, 0xd8, 0xb9, 0xd9, 0x85, 0xd9, 0x8a, 0x06, 0xd9, 0x83, 0xd9,
+    0x85, 0xd9, 0x8a, 0x06, 0xd9, 0x86, 0xd8, 0xac, 0xd8, 0xad, 0x06, 0xd9,
+    0x85, 0xd8, 0xae, 0xd9, 0x8a, 0x06, 0xd9, 0x84, 0xd8, 0xac, 0xd9, 0x85,
+    0x06, 0xd9, 0x83, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd9, 0x84, 0xd8, 0xac,
+    0xd9, 0x85, 0x06, 0xd9, 0x86, 0xd8, 0xac, 0xd8, 0xad, 0x06, 0xd8, 0xac,
+    0xd8, 0xad, 0xd9, 0x8a, 0x06, 0xd8, 0xad, 0xd8, 0xac, 0xd9, 0x8a, 0x06,
+    0xd9, 0x85, 0xd8, 0xac, 0xd9, 0x8a, 0x06, 0xd9, 0x81, 0xd9, 0x85, 0xd9,
+    0x8a, 0x06, 0xd8, 0xa8, 0xd8, 0xad, 0xd9, 0x8a, 0x06, 0xd9, 0x83, 0xd9,
+    0x85, 0xd9, 0x85, 0x06, 0xd8, 0xb9, 0xd8, 0xac, 0xd9, 0x85, 0x06, 0xd8,
+    0xb5, 0xd9, 0x85, 0xd9, 0x85, 0x06, 0xd8, 0xb3, 0xd8, 0xae, 0xd9, 0x8a,
+    0x06, 0xd9, 0x86, 0xd8, 0xac, 0xd9, 0x8a, 0x06, 0xd8, 0xb5, 0xd9, 0x84,
+    0xdb, 0x92, 0x06, 0xd9, 0x82, 0xd9, 0x84, 0xdb, 0x92, 0x08, 0xd8, 0xa7,
+    0xd9, 0x84, 0xd9, 0x84, 0xd9, 0x87, 0x08, 0xd8, 0xa7, 0xd9, 0x83, 0xd8,
+    0xa8, 0xd8, 0xb1, 0x08, 0xd9, 0x85, 0xd8, 0xad, 0xd9, 0x85, 0xd8, 0xaf,
+    0x08, 0xd8, 0xb5, 0xd9, 0x84, 0xd8, 0xb9, 0xd9, 0x85, 0x08, 0xd8, 0xb1,
+    0xd8, 0xb3, 0xd9, 0x88, 0xd9, 0x84, 0x08, 0xd8, 0xb9, 0xd9, 0x84, 0xd9,
+    0x8a, 0xd9, 0x87, 0x08, 0xd9, 0x88, 0xd8, 0xb3, 0xd9, 0x84, 0xd9, 0x85,
+    0x06, 0xd8, 0xb5, 0xd9, 0x84, 0xd9, 0x89, 0x21, 0xd8, 0xb5, 0xd9, 0x84,
+    0xd9, 0x89, 0x20, 0xd8, 0xa7, 0xd9, 0x84, 0xd9, 0x84, 0xd9, 0x87, 0x20,
+    0xd8, 0xb9, 0xd9, 0x84, 0xd9, 0x8a, 0xd9, 0x87, 0x20, 0xd9, 0x88, 0xd8,
+    0xb3, 0xd9, 0x84, 0xd9, 0x85, 0x0f, 0xd8, 0xac, 0xd9, 0x84, 0x20, 0xd8,
+    0xac, 0xd9, 0x84, 0xd8, 0xa7, 0xd9, 0x84, 0xd9, 0x87, 0x08, 0xd8, 0xb1,
+    0xdb, 0x8c, 0xd8, 0xa7, 0xd9, 0x84, 0x01, 0x2c, 0x03, 0xe3, 0x80, 0x81,
+    0x03, 0xe3, 0x80, 0x82, 0x01, 0x3a, 0x01, 0x3b, 0x01, 0x21, 0x01, 0x3f,
+    0x03, 0xe3, 0x80, 0x96, 0x03, 0xe3, 0x80, 0x97, 0x03, 0x2e, 0x2e, 0x2e,
+    0x02, 0x2e, 0x2e, 0x03, 0xe2, 0x80, 0x94, 0x03, 0xe2, 0x80, 0x93, 0x01,
+    0x5f, 0x01, 0x5f, 0x01, 0x28, 0x01, 0x29, 0x01, 0x7b, 0x01, 0x7d, 0x03,
+    0xe3, 0x80, 0x94, 0x03, 0xe3, 0x80, 0x95, 0x03, 0xe3, 0x80, 0x90, 0x03,
+    0xe3, 0x80, 0x91, 0x03, 0xe3, 0x80, 0x8a, 0x03, 0xe3, 0x80, 0x8b, 0x03,
+    0xe3, 0x80, 0x88, 0x03, 0xe3, 0x80, 0x89, 0x03, 0xe3, 0x80, 0x8c, 0x03,
+    0xe3, 0x80, 0x8d, 0x03, 0xe3, 0x80, 0x8e, 0x03, 0xe3, 0x80, 0x8f, 0x01,
+    0x5b, 0x01, 0x5d, 0x03, 0x20, 0xcc, 0x85, 0x03, 0x20, 0xcc, 0x85, 0x03,
+    0x20, 0xcc, 0x85, 0x03, 0x20, 0xcc, 0x85, 0x01, 0x5f, 0x01, 0x5f, 0x01,
+    0x5f, 0x01, 0x2c, 0x03, 0xe3, 0x80, 0x81, 0x01, 0x2e, 0x01, 0x3b, 0x01,
+    0x3a, 0x01, 0x3f, 0x01, 0x21, 0x03, 0xe2, 0x80, 0x94, 0x01, 0x28, 0x01,
+    0x29, 0x01, 0x7b, 0x01, 0x7d, 0x03, 0xe3, 0x80, 0x94, 0x03, 0xe3, 0x80,
+    0x95, 0x01, 0x23, 0x01, 0x26, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2d, 0x01,
+    0x3c, 0x01, 0x3e, 0x01, 0x3d, 0x01, 0x5c, 0x01, 0x24, 0x01, 0x25, 0x01,
+    0x40, 0x03, 0x20, 0xd9, 0x8b, 0x04, 0xd9, 0x80, 0xd9, 0x8b, 0x03, 0x20,
+    0xd9, 0x8c, 0x03, 0x20, 0xd9, 0x8d, 0x03, 0x20, 0xd9, 0x8e, 0x04, 0xd9,
+    0x80, 0xd9, 0x8e, 0x03, 0x20, 0xd9, 0x8f, 0x04, 0xd9, 0x80, 0xd9, 0x8f,
+    0x03, 0x20, 0xd9, 0x90, 0x04, 0xd9, 0x80, 0xd9, 0x90, 0x03, 0x20, 0xd9,
+    0x91, 0x04, 0xd9, 0x80, 0xd9, 0x91, 0x03, 0x20, 0xd9, 0x92, 0x04, 0xd9,
+    0x80, 0xd9, 0x92, 0x02, 0xd8, 0xa1, 0x04, 0xd8, 0xa7, 0xd9, 0x93, 0x04,
+    0xd8, 0xa7, 0xd9, 0x93, 0x04, 0xd8, 0xa7, 0xd9, 0x94, 0x04, 0xd8, 0xa7,
+    0xd9, 0x94, 0x04, 0xd9, 0x88, 0xd9, 0x94, 0x04, 0xd9, 0x88, 0xd9, 0x94,
+    0x04, 0xd8, 0xa7, 0xd9, 0x95, 0x04, 0xd8, 0xa7, 0xd9, 0x95, 0x04, 0xd9,
+    0x8a, 0xd9, 0x94, 0x04, 0xd9, 0x8a, 0xd9, 0x94, 0x04, 0xd9, 0x8a, 0xd9,
+    0x94, 0x04, 0xd9, 0x8a, 0xd9, 0x94, 0x02, 0xd8, 0xa7, 0x02, 0xd8, 0xa7,
+    0x02, 0xd8, 0xa8, 0x02, 0xd8, 0xa8, 0x02, 0xd8, 0xa8, 0x02, 0xd8, 0xa8,
+    0x02, 0xd8, 0xa9, 0x02, 0xd8, 0xa9, 0x02, 0xd8, 0xaa, 0x02, 0xd8, 0xaa,
+    0x02, 0xd8, 0xaa, 0x02, 0xd8, 0xaa, 0x02, 0xd8, 0xab, 0x02, 0xd8, 0xab,
+    0x02, 0xd8, 0xab, 0x02, 0xd8, 0xab, 0x02, 0xd8, 0xac, 0x02, 0xd8, 0xac,
+    0x02, 0xd8, 0xac, 0x02, 0xd8, 0xac, 0x02, 0xd8, 0xad, 0x02, 0xd8, 0xad,
+    0x02, 0xd8, 0xad, 0x02, 0xd8, 0xad, 0x02, 0xd8, 0xae, 0x02, 0xd8, 0xae,
+    0x02, 0xd8, 0xae, 0x02, 0xd8, 0xae, 0x02, 0xd8, 0xaf, 0x02, 0xd8, 0xaf,
+    0x02, 0xd8, 0xb0, 0x02, 0xd8, 0xb0, 0x02, 0xd8, 0xb1, 0x02, 0xd8, 0xb1,
+    0x02, 0xd8, 0xb2, 0x02, 0xd8, 0xb2, 0x02, 0xd8, 0xb3, 0x02, 0xd8, 0xb3,
+    0x02, 0xd8, 0xb3, 0x02, 0xd8, 0xb3, 0x02, 0xd8, 0xb4, 0x02, 0xd8, 0xb4,
+    0x02, 0xd8, 0xb4, 0x02, 0xd8, 0xb4, 0x02, 0xd8, 0xb5, 0x02, 0xd8, 0xb5,
+    0x02, 0xd8, 0xb5, 0x02, 0xd8, 0xb5, 0x02, 0xd8, 0xb6, 0x02, 0xd8, 0xb6,
+    0x02, 0xd8, 0xb6, 0x02, 0xd8, 0xb6, 0x02, 0xd8, 0xb7, 0x02, 0xd8, 0xb7,
+    0x02, 0xd8, 0xb7, 0x02, 0xd8, 0xb7, 0x02, 0xd8, 0xb8, 0x02, 0xd8, 0xb8,
+    0x02, 0xd8, 0xb8, 0x02, 0xd8, 0xb8, 0x02, 0xd8, 0xb9, 0x02, 0xd8, 0xb9,
+    0x02, 0xd8, 0xb9, 0x02, 0xd8, 0xb9, 0x02, 0xd8, 0xba, 0x02, 0xd8, 0xba,
+    0x02, 0xd8, 0xba, 0x02, 0xd8, 0xba, 0x02, 0xd9, 0x81, 0x02, 0xd9, 0x81,
+    0x02, 0xd9, 0x81, 0x02, 0xd9, 0x81, 0x02, 0xd9, 0x82, 0x02, 0xd9, 0x82,
+    0x02, 0xd9, 0x82, 0x02, 0xd9, 0x82, 0x02, 0xd9, 0x83, 0x02, 0xd9, 0x83,
+    0x02, 0xd9, 0x83, 0x02, 0xd9, 0x83, 0x02, 0xd9, 0x84, 0x02, 0xd9, 0x84,
+    0x02, 0xd9, 0x84, 0x02, 0xd9, 0x84, 0x02, 0xd9, 0x85, 0x02, 0xd9, 0x85,
+    0x02, 0xd9, 0x85, 0x02, 0xd9, 0x85, 0x02, 0xd9, 0x86, 0x02, 0xd9, 0x86,
+    0x02, 0xd9, 0x86, 0x02, 0xd9, 0x86, 0x02, 0xd9, 0x87, 0x02, 0xd9, 0x87,
+    0x02, 0xd9, 0x87, 0x02, 0xd9, 0x87, 0x02, 0xd9, 0x88, 0x02, 0xd9, 0x88,
+    0x02, 0xd9, 0x89, 0x02, 0xd9, 0x89, 0x02, 0xd9, 0x8a, 0x02, 0xd9, 0x8a,
+    0x02, 0xd9, 0x8a, 0x02, 0xd9, 0x8a, 0x06, 0xd9, 0x84, 0xd8, 0xa7, 0xd9,
+    0x93, 0x06, 0xd9, 0x84, 0xd8, 0xa7, 0xd9, 0x93, 0x06, 0xd9, 0x84, 0xd8,
+    0xa7, 0xd9, 0x94, 0x06, 0xd9, 0x84, 0xd8, 0xa7, 0xd9, 0x94, 0x06, 0xd9,
+    0x84, 0xd8, 0xa7, 0xd9, 0x95, 0x06, 0xd9, 0x84, 0xd8, 0xa7, 0xd9, 0x95,
+    0x04, 0xd9, 0x84, 0xd8, 0xa7, 0x04, 0xd9, 0x84, 0xd8, 0xa7, 0x01, 0x21,
+    0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27,
+    0x01, 0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2c, 0x01, 0x2d,
+    0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33,
+    0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39,
+    0x01, 0x3a, 0x01, 0x3b, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e, 0x01, 0x3f,
+    0x01, 0x40, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45,
+    0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b,
+    0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51,
+    0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57,
+    0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5d,
+    0x01, 0x5e, 0x01, 0x5f, 0x01, 0x60, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43,
+    0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49,
+    0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f,
+    0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55,
+    0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x7b,
+    0x01, 0x7c, 0x01, 0x7d, 0x01, 0x7e, 0x03, 0xe2, 0xa6, 0x85, 0x03, 0xe2,
+    0xa6, 0x86, 0x03, 0xe3, 0x80, 0x82, 0x03, 0xe3, 0x80, 0x8c, 0x03, 0xe3,
+    0x80, 0x8d, 0x03, 0xe3, 0x80, 0x81, 0x03, 0xe3, 0x83, 0xbb, 0x03, 0xe3,
+    0x83, 0xb2, 0x03, 0xe3, 0x82, 0xa1, 0x03, 0xe3, 0x82, 0xa3, 0x03, 0xe3,
+    0x82, 0xa5, 0x03, 0xe3, 0x82, 0xa7, 0x03, 0xe3, 0x82, 0xa9, 0x03, 0xe3,
+    0x83, 0xa3, 0x03, 0xe3, 0x83, 0xa5, 0x03, 0xe3, 0x83, 0xa7, 0x03, 0xe3,
+    0x83, 0x83, 0x03, 0xe3, 0x83, 0xbc, 0x03, 0xe3, 0x82, 0xa2, 0x03, 0xe3,
+    0x82, 0xa4, 0x03, 0xe3, 0x82, 0xa6, 0x03, 0xe3, 0x82, 0xa8, 0x03, 0xe3,
+    0x82, 0xaa, 0x03, 0xe3, 0x82, 0xab, 0x03, 0xe3, 0x82, 0xad, 0x03, 0xe3,
+    0x82, 0xaf, 0x03, 0xe3, 0x82, 0xb1, 0x03, 0xe3, 0x82, 0xb3, 0x03, 0xe3,
+    0x82, 0xb5, 0x03, 0xe3, 0x82, 0xb7, 0x03, 0xe3, 0x82, 0xb9, 0x03, 0xe3,
+    0x82, 0xbb, 0x03, 0xe3, 0x82, 0xbd, 0x03, 0xe3, 0x82, 0xbf, 0x03, 0xe3,
+    0x83, 0x81, 0x03, 0xe3, 0x83, 0x84, 0x03, 0xe3, 0x83, 0x86, 0x03, 0xe3,
+    0x83, 0x88, 0x03, 0xe3, 0x83, 0x8a, 0x03, 0xe3, 0x83, 0x8b, 0x03, 0xe3,
+    0x83, 0x8c, 0x03, 0xe3, 0x83, 0x8d, 0x03, 0xe3, 0x83, 0x8e, 0x03, 0xe3,
+    0x83, 0x8f, 0x03, 0xe3, 0x83, 0x92, 0x03, 0xe3, 0x83, 0x95, 0x03, 0xe3,
+    0x83, 0x98, 0x03, 0xe3, 0x83, 0x9b, 0x03, 0xe3, 0x83, 0x9e, 0x03, 0xe3,
+    0x83, 0x9f, 0x03, 0xe3, 0x83, 0xa0, 0x03, 0xe3, 0x83, 0xa1, 0x03, 0xe3,
+    0x83, 0xa2, 0x03, 0xe3, 0x83, 0xa4, 0x03, 0xe3, 0x83, 0xa6, 0x03, 0xe3,
+    0x83, 0xa8, 0x03, 0xe3, 0x83, 0xa9, 0x03, 0xe3, 0x83, 0xaa, 0x03, 0xe3,
+    0x83, 0xab, 0x03, 0xe3, 0x83, 0xac, 0x03, 0xe3, 0x83, 0xad, 0x03, 0xe3,
+    0x83, 0xaf, 0x03, 0xe3, 0x83, 0xb3, 0x03, 0xe3, 0x82, 0x99, 0x03, 0xe3,
+    0x82, 0x9a, 0x03, 0xe1, 0x85, 0xa0, 0x03, 0xe1, 0x84, 0x80, 0x03, 0xe1,
+    0x84, 0x81, 0x03, 0xe1, 0x86, 0xaa, 0x03, 0xe1, 0x84, 0x82, 0x03, 0xe1,
+    0x86, 0xac, 0x03, 0xe1, 0x86, 0xad, 0x03, 0xe1, 0x84, 0x83, 0x03, 0xe1,
+    0x84, 0x84, 0x03, 0xe1, 0x84, 0x85, 0x03, 0xe1, 0x86, 0xb0, 0x03, 0xe1,
+    0x86, 0xb1, 0x03, 0xe1, 0x86, 0xb2, 0x03, 0xe1, 0x86, 0xb3, 0x03, 0xe1,
+    0x86, 0xb4, 0x03, 0xe1, 0x86, 0xb5, 0x03, 0xe1, 0x84, 0x9a, 0x03, 0xe1,
+    0x84, 0x86, 0x03, 0xe1, 0x84, 0x87, 0x03, 0xe1, 0x84, 0x88, 0x03, 0xe1,
+    0x84, 0xa1, 0x03, 0xe1, 0x84, 0x89, 0x03, 0xe1, 0x84, 0x8a, 0x03, 0xe1,
+    0x84, 0x8b, 0x03, 0xe1, 0x84, 0x8c, 0x03, 0xe1, 0x84, 0x8d, 0x03, 0xe1,
+    0x84, 0x8e, 0x03, 0xe1, 0x84, 0x8f, 0x03, 0xe1, 0x84, 0x90, 0x03, 0xe1,
+    0x84, 0x91, 0x03, 0xe1, 0x84, 0x92, 0x03, 0xe1, 0x85, 0xa1, 0x03, 0xe1,
+    0x85, 0xa2, 0x03, 0xe1, 0x85, 0xa3, 0x03, 0xe1, 0x85, 0xa4, 0x03, 0xe1,
+    0x85, 0xa5, 0x03, 0xe1, 0x85, 0xa6, 0x03, 0xe1, 0x85, 0xa7, 0x03, 0xe1,
+    0x85, 0xa8, 0x03, 0xe1, 0x85, 0xa9, 0x03, 0xe1, 0x85, 0xaa, 0x03, 0xe1,
+    0x85, 0xab, 0x03, 0xe1, 0x85, 0xac, 0x03, 0xe1, 0x85, 0xad, 0x03, 0xe1,
+    0x85, 0xae, 0x03, 0xe1, 0x85, 0xaf, 0x03, 0xe1, 0x85, 0xb0, 0x03, 0xe1,
+    0x85, 0xb1, 0x03, 0xe1, 0x85, 0xb2, 0x03, 0xe1, 0x85, 0xb3, 0x03, 0xe1,
+    0x85, 0xb4, 0x03, 0xe1, 0x85, 0xb5, 0x02, 0xc2, 0xa2, 0x02, 0xc2, 0xa3,
+    0x02, 0xc2, 0xac, 0x03, 0x20, 0xcc, 0x84, 0x02, 0xc2, 0xa6, 0x02, 0xc2,
+    0xa5, 0x03, 0xe2, 0x82, 0xa9, 0x03, 0xe2, 0x94, 0x82, 0x03, 0xe2, 0x86,
+    0x90, 0x03, 0xe2, 0x86, 0x91, 0x03, 0xe2, 0x86, 0x92, 0x03, 0xe2, 0x86,
+    0x93, 0x03, 0xe2, 0x96, 0xa0, 0x03, 0xe2, 0x97, 0x8b, 0x04, 0xf0, 0x90,
+    0x90, 0x80, 0x04, 0xf0, 0x90, 0x90, 0x81, 0x04, 0xf0, 0x90, 0x90, 0x82,
+    0x04, 0xf0, 0x90, 0x90, 0x83, 0x04, 0xf0, 0x90, 0x90, 0x84, 0x04, 0xf0,
+    0x90, 0x90, 0x85, 0x04, 0xf0, 0x90, 0x90, 0x86, 0x04, 0xf0, 0x90, 0x90,
+    0x87, 0x04, 0xf0, 0x90, 0x90, 0x88, 0x04, 0xf0, 0x90, 0x90, 0x89, 0x04,
+    0xf0, 0x90, 0x90, 0x8a, 0x04, 0xf0, 0x90, 0x90, 0x8b, 0x04, 0xf0, 0x90,
+    0x90, 0x8c, 0x04, 0xf0, 0x90, 0x90, 0x8d, 0x04, 0xf0, 0x90, 0x90, 0x8e,
+    0x04, 0xf0, 0x90, 0x90, 0x8f, 0x04, 0xf0, 0x90, 0x90, 0x90, 0x04, 0xf0,
+    0x90, 0x90, 0x91, 0x04, 0xf0, 0x90, 0x90, 0x92, 0x04, 0xf0, 0x90, 0x90,
+    0x93, 0x04, 0xf0, 0x90, 0x90, 0x94, 0x04, 0xf0, 0x90, 0x90, 0x95, 0x04,
+    0xf0, 0x90, 0x90, 0x96, 0x04, 0xf0, 0x90, 0x90, 0x97, 0x04, 0xf0, 0x90,
+    0x90, 0x98, 0x04, 0xf0, 0x90, 0x90, 0x99, 0x04, 0xf0, 0x90, 0x90, 0x9a,
+    0x04, 0xf0, 0x90, 0x90, 0x9b, 0x04, 0xf0, 0x90, 0x90, 0x9c, 0x04, 0xf0,
+    0x90, 0x90, 0x9d, 0x04, 0xf0, 0x90, 0x90, 0x9e, 0x04, 0xf0, 0x90, 0x90,
+    0x9f, 0x04, 0xf0, 0x90, 0x90, 0xa0, 0x04, 0xf0, 0x90, 0x90, 0xa1, 0x04,
+    0xf0, 0x90, 0x90, 0xa2, 0x04, 0xf0, 0x90, 0x90, 0xa3, 0x04, 0xf0, 0x90,
+    0x90, 0xa4, 0x04, 0xf0, 0x90, 0x90, 0xa5, 0x04, 0xf0, 0x90, 0x90, 0xa6,
+    0x04, 0xf0, 0x90, 0x90, 0xa7, 0x04, 0xf0, 0x90, 0x92, 0xb0, 0x04, 0xf0,
+    0x90, 0x92, 0xb1, 0x04, 0xf0, 0x90, 0x92, 0xb2, 0x04, 0xf0, 0x90, 0x92,
+    0xb3, 0x04, 0xf0, 0x90, 0x92, 0xb4, 0x04, 0xf0, 0x90, 0x92, 0xb5, 0x04,
+    0xf0, 0x90, 0x92, 0xb6, 0x04, 0xf0, 0x90, 0x92, 0xb7, 0x04, 0xf0, 0x90,
+    0x92, 0xb8, 0x04, 0xf0, 0x90, 0x92, 0xb9, 0x04, 0xf0, 0x90, 0x92, 0xba,
+    0x04, 0xf0, 0x90, 0x92, 0xbb, 0x04, 0xf0, 0x90, 0x92, 0xbc, 0x04, 0xf0,
+    0x90, 0x92, 0xbd, 0x04, 0xf0, 0x90, 0x92, 0xbe, 0x04, 0xf0, 0x90, 0x92,
+    0xbf, 0x04, 0xf0, 0x90, 0x93, 0x80, 0x04, 0xf0, 0x90, 0x93, 0x81, 0x04,
+    0xf0, 0x90, 0x93, 0x82, 0x04, 0xf0, 0x90, 0x93, 0x83, 0x04, 0xf0, 0x90,
+    0x93, 0x84, 0x04, 0xf0, 0x90, 0x93, 0x85, 0x04, 0xf0, 0x90, 0x93, 0x86,
+    0x04, 0xf0, 0x90, 0x93, 0x87, 0x04, 0xf0, 0x90, 0x93, 0x88, 0x04, 0xf0,
+    0x90, 0x93, 0x89, 0x04, 0xf0, 0x90, 0x93, 0x8a, 0x04, 0xf0, 0x90, 0x93,
+    0x8b, 0x04, 0xf0, 0x90, 0x93, 0x8c, 0x04, 0xf0, 0x90, 0x93, 0x8d, 0x04,
+    0xf0, 0x90, 0x93, 0x8e, 0x04, 0xf0, 0x90, 0x93, 0x8f, 0x04, 0xf0, 0x90,
+    0x93, 0x90, 0x04, 0xf0, 0x90, 0x93, 0x91, 0x04, 0xf0, 0x90, 0x93, 0x92,
+    0x04, 0xf0, 0x90, 0x93, 0x93, 0x04, 0xf0, 0x90, 0x95, 0xb0, 0x04, 0xf0,
+    0x90, 0x95, 0xb1, 0x04, 0xf0, 0x90, 0x95, 0xb2, 0x04, 0xf0, 0x90, 0x95,
+    0xb3, 0x04, 0xf0, 0x90, 0x95, 0xb4, 0x04, 0xf0, 0x90, 0x95, 0xb5, 0x04,
+    0xf0, 0x90, 0x95, 0xb6, 0x04, 0xf0, 0x90, 0x95, 0xb7, 0x04, 0xf0, 0x90,
+    0x95, 0xb8, 0x04, 0xf0, 0x90, 0x95, 0xb9, 0x04, 0xf0, 0x90, 0x95, 0xba,
+    0x04, 0xf0, 0x90, 0x95, 0xbc, 0x04, 0xf0, 0x90, 0x95, 0xbd, 0x04, 0xf0,
+    0x90, 0x95, 0xbe, 0x04, 0xf0, 0x90, 0x95, 0xbf, 0x04, 0xf0, 0x90, 0x96,
+    0x80, 0x04, 0xf0, 0x90, 0x96, 0x81, 0x04, 0xf0, 0x90, 0x96, 0x82, 0x04,
+    0xf0, 0x90, 0x96, 0x83, 0x04, 0xf0, 0x90, 0x96, 0x84, 0x04, 0xf0, 0x90,
+    0x96, 0x85, 0x04, 0xf0, 0x90, 0x96, 0x86, 0x04, 0xf0, 0x90, 0x96, 0x87,
+    0x04, 0xf0, 0x90, 0x96, 0x88, 0x04, 0xf0, 0x90, 0x96, 0x89, 0x04, 0xf0,
+    0x90, 0x96, 0x8a, 0x04, 0xf0, 0x90, 0x96, 0x8c, 0x04, 0xf0, 0x90, 0x96,
+    0x8d, 0x04, 0xf0, 0x90, 0x96, 0x8e, 0x04, 0xf0, 0x90, 0x96, 0x8f, 0x04,
+    0xf0, 0x90, 0x96, 0x90, 0x04, 0xf0, 0x90, 0x96, 0x91, 0x04, 0xf0, 0x90,
+    0x96, 0x92, 0x04, 0xf0, 0x90, 0x96, 0x94, 0x04, 0xf0, 0x90, 0x96, 0x95,
+    0x02, 0xcb, 0x90, 0x02, 0xcb, 0x91, 0x02, 0xc3, 0xa6, 0x02, 0xca, 0x99,
+    0x02, 0xc9, 0x93, 0x02, 0xca, 0xa3, 0x03, 0xea, 0xad, 0xa6, 0x02, 0xca,
+    0xa5, 0x02, 0xca, 0xa4, 0x02, 0xc9, 0x96, 0x02, 0xc9, 0x97, 0x03, 0xe1,
+    0xb6, 0x91, 0x02, 0xc9, 0x98, 0x02, 0xc9, 0x9e, 0x02, 0xca, 0xa9, 0x02,
+    0xc9, 0xa4, 0x02, 0xc9, 0xa2, 0x02, 0xc9, 0xa0, 0x02, 0xca, 0x9b, 0x02,
+    0xc4, 0xa7, 0x02, 0xca, 0x9c, 0x02, 0xc9, 0xa7, 0x02, 0xca, 0x84, 0x02,
+    0xca, 0xaa, 0x02, 0xca, 0xab, 0x02, 0xc9, 0xac, 0x04, 0xf0, 0x9d, 0xbc,
+    0x84, 0x03, 0xea, 0x9e, 0x8e, 0x02, 0xc9, 0xae, 0x04, 0xf0, 0x9d, 0xbc,
+    0x85, 0x02, 0xca, 0x8e, 0x04, 0xf0, 0x9d, 0xbc, 0x86, 0x02, 0xc3, 0xb8,
+    0x02, 0xc9, 0xb6, 0x02, 0xc9, 0xb7, 0x01, 0x71, 0x02, 0xc9, 0xba, 0x04,
+    0xf0, 0x9d, 0xbc, 0x88, 0x02, 0xc9, 0xbd, 0x02, 0xc9, 0xbe, 0x02, 0xca,
+    0x80, 0x02, 0xca, 0xa8, 0x02, 0xca, 0xa6, 0x03, 0xea, 0xad, 0xa7, 0x02,
+    0xca, 0xa7, 0x02, 0xca, 0x88, 0x03, 0xe2, 0xb1, 0xb1, 0x02, 0xca, 0x8f,
+    0x02, 0xca, 0xa1, 0x02, 0xca, 0xa2, 0x02, 0xca, 0x98, 0x02, 0xc7, 0x80,
+    0x02, 0xc7, 0x81, 0x02, 0xc7, 0x82, 0x04, 0xf0, 0x9d, 0xbc, 0x8a, 0x04,
+    0xf0, 0x9d, 0xbc, 0x9e, 0x04, 0xf0, 0x90, 0xb2, 0x80, 0x04, 0xf0, 0x90,
+    0xb2, 0x81, 0x04, 0xf0, 0x90, 0xb2, 0x82, 0x04, 0xf0, 0x90, 0xb2, 0x83,
+    0x04, 0xf0, 0x90, 0xb2, 0x84, 0x04, 0xf0, 0x90, 0xb2, 0x85, 0x04, 0xf0,
+    0x90, 0xb2, 0x86, 0x04, 0xf0, 0x90, 0xb2, 0x87, 0x04, 0xf0, 0x90, 0xb2,
+    0x88, 0x04, 0xf0, 0x90, 0xb2, 0x89, 0x04, 0xf0, 0x90, 0xb2, 0x8a, 0x04,
+    0xf0, 0x90, 0xb2, 0x8b, 0x04, 0xf0, 0x90, 0xb2, 0x8c, 0x04, 0xf0, 0x90,
+    0xb2, 0x8d, 0x04, 0xf0, 0x90, 0xb2, 0x8e, 0x04, 0xf0, 0x90, 0xb2, 0x8f,
+    0x04, 0xf0, 0x90, 0xb2, 0x90, 0x04, 0xf0, 0x90, 0xb2, 0x91, 0x04, 0xf0,
+    0x90, 0xb2, 0x92, 0x04, 0xf0, 0x90, 0xb2, 0x93, 0x04, 0xf0, 0x90, 0xb2,
+    0x94, 0x04, 0xf0, 0x90, 0xb2, 0x95, 0x04, 0xf0, 0x90, 0xb2, 0x96, 0x04,
+    0xf0, 0x90, 0xb2, 0x97, 0x04, 0xf0, 0x90, 0xb2, 0x98, 0x04, 0xf0, 0x90,
+    0xb2, 0x99, 0x04, 0xf0, 0x90, 0xb2, 0x9a, 0x04, 0xf0, 0x90, 0xb2, 0x9b,
+    0x04, 0xf0, 0x90, 0xb2, 0x9c, 0x04, 0xf0, 0x90, 0xb2, 0x9d, 0x04, 0xf0,
+    0x90, 0xb2, 0x9e, 0x04, 0xf0, 0x90, 0xb2, 0x9f, 0x04, 0xf0, 0x90, 0xb2,
+    0xa0, 0x04, 0xf0, 0x90, 0xb2, 0xa1, 0x04, 0xf0, 0x90, 0xb2, 0xa2, 0x04,
+    0xf0, 0x90, 0xb2, 0xa3, 0x04, 0xf0, 0x90, 0xb2, 0xa4, 0x04, 0xf0, 0x90,
+    0xb2, 0xa5, 0x04, 0xf0, 0x90, 0xb2, 0xa6, 0x04, 0xf0, 0x90, 0xb2, 0xa7,
+    0x04, 0xf0, 0x90, 0xb2, 0xa8, 0x04, 0xf0, 0x90, 0xb2, 0xa9, 0x04, 0xf0,
+    0x90, 0xb2, 0xaa, 0x04, 0xf0, 0x90, 0xb2, 0xab, 0x04, 0xf0, 0x90, 0xb2,
+    0xac, 0x04, 0xf0, 0x90, 0xb2, 0xad, 0x04, 0xf0, 0x90, 0xb2, 0xae, 0x04,
+    0xf0, 0x90, 0xb2, 0xaf, 0x04, 0xf0, 0x90, 0xb2, 0xb0, 0x04, 0xf0, 0x90,
+    0xb2, 0xb1, 0x04, 0xf0, 0x90, 0xb2, 0xb2, 0x08, 0xf0, 0x91, 0x82, 0x99,
+    0xf0, 0x91, 0x82, 0xba, 0x08, 0xf0, 0x91, 0x82, 0x9b, 0xf0, 0x91, 0x82,
+    0xba, 0x08, 0xf0, 0x91, 0x82, 0xa5, 0xf0, 0x91, 0x82, 0xba, 0x08, 0xf0,
+    0x91, 0x84, 0xb1, 0xf0, 0x91, 0x84, 0xa7, 0x08, 0xf0, 0x91, 0x84, 0xb2,
+    0xf0, 0x91, 0x84, 0xa7, 0x08, 0xf0, 0x91, 0x8d, 0x87, 0xf0, 0x91, 0x8c,
+    0xbe, 0x08, 0xf0, 0x91, 0x8d, 0x87, 0xf0, 0x91, 0x8d, 0x97, 0x08, 0xf0,
+    0x91, 0x92, 0xb9, 0xf0, 0x91, 0x92, 0xba, 0x08, 0xf0, 0x91, 0x92, 0xb9,
+    0xf0, 0x91, 0x92, 0xb0, 0x08, 0xf0, 0x91, 0x92, 0xb9, 0xf0, 0x91, 0x92,
+    0xbd, 0x08, 0xf0, 0x91, 0x96, 0xb8, 0xf0, 0x91, 0x96, 0xaf, 0x08, 0xf0,
+    0x91, 0x96, 0xb9, 0xf0, 0x91, 0x96, 0xaf, 0x04, 0xf0, 0x91, 0xa2, 0xa0,
+    0x04, 0xf0, 0x91, 0xa2, 0xa1, 0x04, 0xf0, 0x91, 0xa2, 0xa2, 0x04, 0xf0,
+    0x91, 0xa2, 0xa3, 0x04, 0xf0, 0x91, 0xa2, 0xa4, 0x04, 0xf0, 0x91, 0xa2,
+    0xa5, 0x04, 0xf0, 0x91, 0xa2, 0xa6, 0x04, 0xf0, 0x91, 0xa2, 0xa7, 0x04,
+    0xf0, 0x91, 0xa2, 0xa8, 0x04, 0xf0, 0x91, 0xa2, 0xa9, 0x04, 0xf0, 0x91,
+    0xa2, 0xaa, 0x04, 0xf0, 0x91, 0xa2, 0xab, 0x04, 0xf0, 0x91, 0xa2, 0xac,
+    0x04, 0xf0, 0x91, 0xa2, 0xad, 0x04, 0xf0, 0x91, 0xa2, 0xae, 0x04, 0xf0,
+    0x91, 0xa2, 0xaf, 0x04, 0xf0, 0x91, 0xa2, 0xb0, 0x04, 0xf0, 0x91, 0xa2,
+    0xb1, 0x04, 0xf0, 0x91, 0xa2, 0xb2, 0x04, 0xf0, 0x91, 0xa2, 0xb3, 0x04,
+    0xf0, 0x91, 0xa2, 0xb4, 0x04, 0xf0, 0x91, 0xa2, 0xb5, 0x04, 0xf0, 0x91,
+    0xa2, 0xb6, 0x04, 0xf0, 0x91, 0xa2, 0xb7, 0x04, 0xf0, 0x91, 0xa2, 0xb8,
+    0x04, 0xf0, 0x91, 0xa2, 0xb9, 0x04, 0xf0, 0x91, 0xa2, 0xba, 0x04, 0xf0,
+    0x91, 0xa2, 0xbb, 0x04, 0xf0, 0x91, 0xa2, 0xbc, 0x04, 0xf0, 0x91, 0xa2,
+    0xbd, 0x04, 0xf0, 0x91, 0xa2, 0xbe, 0x04, 0xf0, 0x91, 0xa2, 0xbf, 0x08,
+    0xf0, 0x91, 0xa4, 0xb5, 0xf0, 0x91, 0xa4, 0xb0, 0x04, 0xf0, 0x96, 0xb9,
+    0x80, 0x04, 0xf0, 0x96, 0xb9, 0x81, 0x04, 0xf0, 0x96, 0xb9, 0x82, 0x04,
+    0xf0, 0x96, 0xb9, 0x83, 0x04, 0xf0, 0x96, 0xb9, 0x84, 0x04, 0xf0, 0x96,
+    0xb9, 0x85, 0x04, 0xf0, 0x96, 0xb9, 0x86, 0x04, 0xf0, 0x96, 0xb9, 0x87,
+    0x04, 0xf0, 0x96, 0xb9, 0x88, 0x04, 0xf0, 0x96, 0xb9, 0x89, 0x04, 0xf0,
+    0x96, 0xb9, 0x8a, 0x04, 0xf0, 0x96, 0xb9, 0x8b, 0x04, 0xf0, 0x96, 0xb9,
+    0x8c, 0x04, 0xf0, 0x96, 0xb9, 0x8d, 0x04, 0xf0, 0x96, 0xb9, 0x8e, 0x04,
+    0xf0, 0x96, 0xb9, 0x8f, 0x04, 0xf0, 0x96, 0xb9, 0x90, 0x04, 0xf0, 0x96,
+    0xb9, 0x91, 0x04, 0xf0, 0x96, 0xb9, 0x92, 0x04, 0xf0, 0x96, 0xb9, 0x93,
+    0x04, 0xf0, 0x96, 0xb9, 0x94, 0x04, 0xf0, 0x96, 0xb9, 0x95, 0x04, 0xf0,
+    0x96, 0xb9, 0x96, 0x04, 0xf0, 0x96, 0xb9, 0x97, 0x04, 0xf0, 0x96, 0xb9,
+    0x98, 0x04, 0xf0, 0x96, 0xb9, 0x99, 0x04, 0xf0, 0x96, 0xb9, 0x9a, 0x04,
+    0xf0, 0x96, 0xb9, 0x9b, 0x04, 0xf0, 0x96, 0xb9, 0x9c, 0x04, 0xf0, 0x96,
+    0xb9, 0x9d, 0x04, 0xf0, 0x96, 0xb9, 0x9e, 0x04, 0xf0, 0x96, 0xb9, 0x9f,
+    0x08, 0xf0, 0x9d, 0x85, 0x97, 0xf0, 0x9d, 0x85, 0xa5, 0x08, 0xf0, 0x9d,
+    0x85, 0x98, 0xf0, 0x9d, 0x85, 0xa5, 0x0c, 0xf0, 0x9d, 0x85, 0x98, 0xf0,
+    0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xae, 0x0c, 0xf0, 0x9d, 0x85, 0x98,
+    0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xaf, 0x0c, 0xf0, 0x9d, 0x85,
+    0x98, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xb0, 0x0c, 0xf0, 0x9d,
+    0x85, 0x98, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xb1, 0x0c, 0xf0,
+    0x9d, 0x85, 0x98, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xb2, 0x08,
+    0xf0, 0x9d, 0x86, 0xb9, 0xf0, 0x9d, 0x85, 0xa5, 0x08, 0xf0, 0x9d, 0x86,
+    0xba, 0xf0, 0x9d, 0x85, 0xa5, 0x0c, 0xf0, 0x9d, 0x86, 0xb9, 0xf0, 0x9d,
+    0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xae, 0x0c, 0xf0, 0x9d, 0x86, 0xba, 0xf0,
+    0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xae, 0x0c, 0xf0, 0x9d, 0x86, 0xb9,
+    0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xaf, 0x0c, 0xf0, 0x9d, 0x86,
+    0xba, 0xf0, 0x9d, 0x85, 0xa5, 0xf0, 0x9d, 0x85, 0xaf, 0x01, 0x41, 0x01,
+    0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01,
+    0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01,
+    0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01,
+    0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01,
+    0x5a, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01,
+    0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01,
+    0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01,
+    0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01,
+    0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01,
+    0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01,
+    0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01,
+    0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01,
+    0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x61, 0x01,
+    0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01,
+    0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01,
+    0x6f, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01,
+    0x75, 0x01, 0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7a, 0x01,
+    0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01,
+    0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01,
+    0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01,
+    0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01,
+    0x59, 0x01, 0x5a, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01,
+    0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01,
+    0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x70, 0x01,
+    0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01,
+    0x77, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x41, 0x01, 0x43, 0x01,
+    0x44, 0x01, 0x47, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4e, 0x01, 0x4f, 0x01,
+    0x50, 0x01, 0x51, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01,
+    0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x61, 0x01, 0x62, 0x01,
+    0x63, 0x01, 0x64, 0x01, 0x66, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01,
+    0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x70, 0x01, 0x71, 0x01,
+    0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01,
+    0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01,
+    0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01,
+    0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01,
+    0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01,
+    0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x61, 0x01,
+    0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01,
+    0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01,
+    0x6e, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01,
+    0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01,
+    0x7a, 0x01, 0x41, 0x01, 0x42, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01,
+    0x47, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01,
+    0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01,
+    0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x61, 0x01, 0x62, 0x01,
+    0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68, 0x01,
+    0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01,
+    0x6f, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01,
+    0x75, 0x01, 0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7a, 0x01,
+    0x41, 0x01, 0x42, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01,
+    0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4f, 0x01,
+    0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01,
+    0x59, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01,
+    0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01,
+    0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01,
+    0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01,
+    0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01,
+    0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01,
+    0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01,
+    0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01,
+    0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x61, 0x01,
+    0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01,
+    0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01,
+    0x6e, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01,
+    0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01,
+    0x7a, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01,
+    0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01,
+    0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01,
+    0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01,
+    0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01,
+    0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01,
+    0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01,
+    0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01,
+    0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x41, 0x01,
+    0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01,
+    0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01,
+    0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01,
+    0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01,
+    0x5a, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01,
+    0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01,
+    0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01,
+    0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01,
+    0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01,
+    0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01,
+    0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01,
+    0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01,
+    0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x61, 0x01,
+    0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01,
+    0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01,
+    0x6e, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01,
+    0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01,
+    0x7a, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01,
+    0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01,
+    0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01,
+    0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01,
+    0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01,
+    0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01,
+    0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01,
+    0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01,
+    0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x41, 0x01,
+    0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01,
+    0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01,
+    0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01,
+    0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01,
+    0x5a, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01,
+    0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01,
+    0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01,
+    0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01,
+    0x78, 0x01, 0x79, 0x01, 0x7a, 0x02, 0xc4, 0xb1, 0x02, 0xc8, 0xb7, 0x02,
+    0xce, 0x91, 0x02, 0xce, 0x92, 0x02, 0xce, 0x93, 0x02, 0xce, 0x94, 0x02,
+    0xce, 0x95, 0x02, 0xce, 0x96, 0x02, 0xce, 0x97, 0x02, 0xce, 0x98, 0x02,
+    0xce, 0x99, 0x02, 0xce, 0x9a, 0x02, 0xce, 0x9b, 0x02, 0xce, 0x9c, 0x02,
+    0xce, 0x9d, 0x02, 0xce, 0x9e, 0x02, 0xce, 0x9f, 0x02, 0xce, 0xa0, 0x02,
+    0xce, 0xa1, 0x02, 0xce, 0x98, 0x02, 0xce, 0xa3, 0x02, 0xce, 0xa4, 0x02,
+    0xce, 0xa5, 0x02, 0xce, 0xa6, 0x02, 0xce, 0xa7, 0x02, 0xce, 0xa8, 0x02,
+    0xce, 0xa9, 0x03, 0xe2, 0x88, 0x87, 0x02, 0xce, 0xb1, 0x02, 0xce, 0xb2,
+    0x02, 0xce, 0xb3, 0x02, 0xce, 0xb4, 0x02, 0xce, 0xb5, 0x02, 0xce, 0xb6,
+    0x02, 0xce, 0xb7, 0x02, 0xce, 0xb8, 0x02, 0xce, 0xb9, 0x02, 0xce, 0xba,
+    0x02, 0xce, 0xbb, 0x02, 0xce, 0xbc, 0x02, 0xce, 0xbd, 0x02, 0xce, 0xbe,
+    0x02, 0xce, 0xbf, 0x02, 0xcf, 0x80, 0x02, 0xcf, 0x81, 0x02, 0xcf, 0x82,
+    0x02, 0xcf, 0x83, 0x02, 0xcf, 0x84, 0x02, 0xcf, 0x85, 0x02, 0xcf, 0x86,
+    0x02, 0xcf, 0x87, 0x02, 0xcf, 0x88, 0x02, 0xcf, 0x89, 0x03, 0xe2, 0x88,
+    0x82, 0x02, 0xce, 0xb5, 0x02, 0xce, 0xb8, 0x02, 0xce, 0xba, 0x02, 0xcf,
+    0x86, 0x02, 0xcf, 0x81, 0x02, 0xcf, 0x80, 0x02, 0xce, 0x91, 0x02, 0xce,
+    0x92, 0x02, 0xce, 0x93, 0x02, 0xce, 0x94, 0x02, 0xce, 0x95, 0x02, 0xce,
+    0x96, 0x02, 0xce, 0x97, 0x02, 0xce, 0x98, 0x02, 0xce, 0x99, 0x02, 0xce,
+    0x9a, 0x02, 0xce, 0x9b, 0x02, 0xce, 0x9c, 0x02, 0xce, 0x9d, 0x02, 0xce,
+    0x9e, 0x02, 0xce, 0x9f, 0x02, 0xce, 0xa0, 0x02, 0xce, 0xa1, 0x02, 0xce,
+    0x98, 0x02, 0xce, 0xa3, 0x02, 0xce, 0xa4, 0x02, 0xce, 0xa5, 0x02, 0xce,
+    0xa6, 0x02, 0xce, 0xa7, 0x02, 0xce, 0xa8, 0x02, 0xce, 0xa9, 0x03, 0xe2,
+    0x88, 0x87, 0x02, 0xce, 0xb1, 0x02, 0xce, 0xb2, 0x02, 0xce, 0xb3, 0x02,
+    0xce, 0xb4, 0x02, 0xce, 0xb5, 0x02, 0xce, 0xb6, 0x02, 0xce, 0xb7, 0x02,
+    0xce, 0xb8, 0x02, 0xce, 0xb9, 0x02, 0xce, 0xba, 0x02, 0xce, 0xbb, 0x02,
+    0xce, 0xbc, 0x02, 0xce, 0xbd, 0x02, 0xce, 0xbe, 0x02, 0xce, 0xbf, 0x02,
+    0xcf, 0x80, 0x02, 0xcf, 0x81, 0x02, 0xcf, 0x82, 0x02, 0xcf, 0x83, 0x02,
+    0xcf, 0x84, 0x02, 0xcf, 0x85, 0x02, 0xcf, 0x86, 0x02, 0xcf, 0x87, 0x02,
+    0xcf, 0x88, 0x02, 0xcf, 0x89, 0x03, 0xe2, 0x88, 0x82, 0x02, 0xce, 0xb5,
+    0x02, 0xce, 0xb8, 0x02, 0xce, 0xba, 0x02, 0xcf, 0x86, 0x02, 0xcf, 0x81,
+    0x02, 0xcf, 0x80, 0x02, 0xce, 0x91, 0x02, 0xce, 0x92, 0x02, 0xce, 0x93,
+    0x02, 0xce, 0x94, 0x02, 0xce, 0x95, 0x02, 0xce, 0x96, 0x02, 0xce, 0x97,
+    0x02, 0xce, 0x98, 0x02, 0xce, 0x99, 0x02, 0xce, 0x9a, 0x02, 0xce, 0x9b,
+    0x02, 0xce, 0x9c, 0x02, 0xce, 0x9d, 0x02, 0xce, 0x9e, 0x02, 0xce, 0x9f,
+    0x02, 0xce, 0xa0, 0x02, 0xce, 0xa1, 0x02, 0xce, 0x98, 0x02, 0xce, 0xa3,
+    0x02, 0xce, 0xa4, 0x02, 0xce, 0xa5, 0x02, 0xce, 0xa6, 0x02, 0xce, 0xa7,
+    0x02, 0xce, 0xa8, 0x02, 0xce, 0xa9, 0x03, 0xe2, 0x88, 0x87, 0x02, 0xce,
+    0xb1, 0x02, 0xce, 0xb2, 0x02, 0xce, 0xb3, 0x02, 0xce, 0xb4, 0x02, 0xce,
+    0xb5, 0x02, 0xce, 0xb6, 0x02, 0xce, 0xb7, 0x02, 0xce, 0xb8, 0x02, 0xce,
+    0xb9, 0x02, 0xce, 0xba, 0x02, 0xce, 0xbb, 0x02, 0xce, 0xbc, 0x02, 0xce,
+    0xbd, 0x02, 0xce, 0xbe, 0x02, 0xce, 0xbf, 0x02, 0xcf, 0x80, 0x02, 0xcf,
+    0x81, 0x02, 0xcf, 0x82, 0x02, 0xcf, 0x83, 0x02, 0xcf, 0x84, 0x02, 0xcf,
+    0x85, 0x02, 0xcf, 0x86, 0x02, 0xcf, 0x87, 0x02, 0xcf, 0x88, 0x02, 0xcf,
+    0x89, 0x03, 0xe2, 0x88, 0x82, 0x02, 0xce, 0xb5, 0x02, 0xce, 0xb8, 0x02,
+    0xce, 0xba, 0x02, 0xcf, 0x86, 0x02, 0xcf, 0x81, 0x02, 0xcf, 0x80, 0x02,
+    0xce, 0x91, 0x02, 0xce, 0x92, 0x02, 0xce, 0x93, 0x02, 0xce, 0x94, 0x02,
+    0xce, 0x95, 0x02, 0xce, 0x96, 0x02, 0xce, 0x97, 0x02, 0xce, 0x98, 0x02,
+    0xce, 0x99, 0x02, 0xce, 0x9a, 0x02, 0xce, 0x9b, 0x02, 0xce, 0x9c, 0x02,
+    0xce, 0x9d, 0x02, 0xce, 0x9e, 0x02, 0xce, 0x9f, 0x02, 0xce, 0xa0, 0x02,
+    0xce, 0xa1, 0x02, 0xce, 0x98, 0x02, 0xce, 0xa3, 0x02, 0xce, 0xa4, 0x02,
+    0xce, 0xa5, 0x02, 0xce, 0xa6, 0x02, 0xce, 0xa7, 0x02, 0xce, 0xa8, 0x02,
+    0xce, 0xa9, 0x03, 0xe2, 0x88, 0x87, 0x02, 0xce, 0xb1, 0x02, 0xce, 0xb2,
+    0x02, 0xce, 0xb3, 0x02, 0xce, 0xb4, 0x02, 0xce, 0xb5, 0x02, 0xce, 0xb6,
+    0x02, 0xce, 0xb7, 0x02, 0xce, 0xb8, 0x02, 0xce, 0xb9, 0x02, 0xce, 0xba,
+    0x02, 0xce, 0xbb, 0x02, 0xce, 0xbc, 0x02, 0xce, 0xbd, 0x02, 0xce, 0xbe,
+    0x02, 0xce, 0xbf, 0x02, 0xcf, 0x80, 0x02, 0xcf, 0x81, 0x02, 0xcf, 0x82,
+    0x02, 0xcf, 0x83, 0x02, 0xcf, 0x84, 0x02, 0xcf, 0x85, 0x02, 0xcf, 0x86,
+    0x02, 0xcf, 0x87, 0x02, 0xcf, 0x88, 0x02, 0xcf, 0x89, 0x03, 0xe2, 0x88,
+    0x82, 0x02, 0xce, 0xb5, 0x02, 0xce, 0xb8, 0x02, 0xce, 0xba, 0x02, 0xcf,
+    0x86, 0x02, 0xcf, 0x81, 0x02, 0xcf, 0x80, 0x02, 0xce, 0x91, 0x02, 0xce,
+    0x92, 0x02, 0xce, 0x93, 0x02, 0xce, 0x94, 0x02, 0xce, 0x95, 0x02, 0xce,
+    0x96, 0x02, 0xce, 0x97, 0x02, 0xce, 0x98, 0x02, 0xce, 0x99, 0x02, 0xce,
+    0x9a, 0x02, 0xce, 0x9b, 0x02, 0xce, 0x9c, 0x02, 0xce, 0x9d, 0x02, 0xce,
+    0x9e, 0x02, 0xce, 0x9f, 0x02, 0xce, 0xa0, 0x02, 0xce, 0xa1, 0x02, 0xce,
+    0x98, 0x02, 0xce, 0xa3, 0x02, 0xce, 0xa4, 0x02, 0xce, 0xa5, 0x02, 0xce,
+    0xa6, 0x02, 0xce, 0xa7, 0x02, 0xce, 0xa8, 0x02, 0xce, 0xa9, 0x03, 0xe2,
+    0x88, 0x87, 0x02, 0xce, 0xb1, 0x02, 0xce, 0xb2, 0x02, 0xce, 0xb3, 0x02,
+    0xce, 0xb4, 0x02, 0xce, 0xb5, 0x02, 0xce, 0xb6, 0x02, 0xce, 0xb7, 0x02,
+    0xce, 0xb8, 0x02, 0xce, 0xb9, 0x02, 0xce, 0xba, 0x02, 0xce, 0xbb, 0x02,
+    0xce, 0xbc, 0x02, 0xce, 0xbd, 0x02, 0xce, 0xbe, 0x02, 0xce, 0xbf, 0x02,
+    0xcf, 0x80, 0x02, 0xcf, 0x81, 0x02, 0xcf, 0x82, 0x02, 0xcf, 0x83, 0x02,
+    0xcf, 0x84, 0x02, 0xcf, 0x85, 0x02, 0xcf, 0x86, 0x02, 0xcf, 0x87, 0x02,
+    0xcf, 0x88, 0x02, 0xcf, 0x89, 0x03, 0xe2, 0x88, 0x82, 0x02, 0xce, 0xb5,
+    0x02, 0xce, 0xb8, 0x02, 0xce, 0xba, 0x02, 0xcf, 0x86, 0x02, 0xcf, 0x81,
+    0x02, 0xcf, 0x80, 0x02, 0xcf, 0x9c, 0x02, 0xcf, 0x9d, 0x01, 0x30, 0x01,
+    0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01,
+    0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01,
+    0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01,
+    0x39, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01,
+    0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x30, 0x01,
+    0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01,
+    0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01,
+    0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01,
+    0x39, 0x04, 0xf0, 0x9e, 0xa4, 0x80, 0x04, 0xf0, 0x9e, 0xa4, 0x81, 0x04,
+    0xf0, 0x9e, 0xa4, 0x82, 0x04, 0xf0, 0x9e, 0xa4, 0x83, 0x04, 0xf0, 0x9e,
+    0xa4, 0x84, 0x04, 0xf0, 0x9e, 0xa4, 0x85, 0x04, 0xf0, 0x9e, 0xa4, 0x86,
+    0x04, 0xf0, 0x9e, 0xa4, 0x87, 0x04, 0xf0, 0x9e, 0xa4, 0x88, 0x04, 0xf0,
+    0x9e, 0xa4, 0x89, 0x04, 0xf0, 0x9e, 0xa4, 0x8a, 0x04, 0xf0, 0x9e, 0xa4,
+    0x8b, 0x04, 0xf0, 0x9e, 0xa4, 0x8c, 0x04, 0xf0, 0x9e, 0xa4, 0x8d, 0x04,
+    0xf0, 0x9e, 0xa4, 0x8e, 0x04, 0xf0, 0x9e, 0xa4, 0x8f, 0x04, 0xf0, 0x9e,
+    0xa4, 0x90, 0x04, 0xf0, 0x9e, 0xa4, 0x91, 0x04, 0xf0, 0x9e, 0xa4, 0x92,
+    0x04, 0xf0, 0x9e, 0xa4, 0x93, 0x04, 0xf0, 0x9e, 0xa4, 0x94, 0x04, 0xf0,
+    0x9e, 0xa4, 0x95, 0x04, 0xf0, 0x9e, 0xa4, 0x96, 0x04, 0xf0, 0x9e, 0xa4,
+    0x97, 0x04, 0xf0, 0x9e, 0xa4, 0x98, 0x04, 0xf0, 0x9e, 0xa4, 0x99, 0x04,
+    0xf0, 0x9e, 0xa4, 0x9a, 0x04, 0xf0, 0x9e, 0xa4, 0x9b, 0x04, 0xf0, 0x9e,
+    0xa4, 0x9c, 0x04, 0xf0, 0x9e, 0xa4, 0x9d, 0x04, 0xf0, 0x9e, 0xa4, 0x9e,
+    0x04, 0xf0, 0x9e, 0xa4, 0x9f, 0x04, 0xf0, 0x9e, 0xa4, 0xa0, 0x04, 0xf0,
+    0x9e, 0xa4, 0xa1, 0x02, 0xd8, 0xa7, 0x02, 0xd8, 0xa8, 0x02, 0xd8, 0xac,
+    0x02, 0xd8, 0xaf, 0x02, 0xd9, 0x88, 0x02, 0xd8, 0xb2, 0x02, 0xd8, 0xad,
+    0x02, 0xd8, 0xb7, 0x02, 0xd9, 0x8a, 0x02, 0xd9, 0x83, 0x02, 0xd9, 0x84,
+    0x02, 0xd9, 0x85, 0x02, 0xd9, 0x86, 0x02, 0xd8, 0xb3, 0x02, 0xd8, 0xb9,
+    0x02, 0xd9, 0x81, 0x02, 0xd8, 0xb5, 0x02, 0xd9, 0x82, 0x02, 0xd8, 0xb1,
+    0x02, 0xd8, 0xb4, 0x02, 0xd8, 0xaa, 0x02, 0xd8, 0xab, 0x02, 0xd8, 0xae,
+    0x02, 0xd8, 0xb0, 0x02, 0xd8, 0xb6, 0x02, 0xd8, 0xb8, 0x02, 0xd8, 0xba,
+    0x02, 0xd9, 0xae, 0x02, 0xda, 0xba, 0x02, 0xda, 0xa1, 0x02, 0xd9, 0xaf,
+    0x02, 0xd8, 0xa8, 0x02, 0xd8, 0xac, 0x02, 0xd9, 0x87, 0x02, 0xd8, 0xad,
+    0x02, 0xd9, 0x8a, 0x02, 0xd9, 0x83, 0x02, 0xd9, 0x84, 0x02, 0xd9, 0x85,
+    0x02, 0xd9, 0x86, 0x02, 0xd8, 0xb3, 0x02, 0xd8, 0xb9, 0x02, 0xd9, 0x81,
+    0x02, 0xd8, 0xb5, 0x02, 0xd9, 0x82, 0x02, 0xd8, 0xb4, 0x02, 0xd8, 0xaa,
+    0x02, 0xd8, 0xab, 0x02, 0xd8, 0xae, 0x02, 0xd8, 0xb6, 0x02, 0xd8, 0xba,
+    0x02, 0xd8, 0xac, 0x02, 0xd8, 0xad, 0x02, 0xd9, 0x8a, 0x02, 0xd9, 0x84,
+    0x02, 0xd9, 0x86, 0x02, 0xd8, 0xb3, 0x02, 0xd8, 0xb9, 0x02, 0xd8, 0xb5,
+    0x02, 0xd9, 0x82, 0x02, 0xd8, 0xb4, 0x02, 0xd8, 0xae, 0x02, 0xd8, 0xb6,
+    0x02, 0xd8, 0xba, 0x02, 0xda, 0xba, 0x02, 0xd9, 0xaf, 0x02, 0xd8, 0xa8,
+    0x02, 0xd8, 0xac, 0x02, 0xd9, 0x87, 0x02, 0xd8, 0xad, 0x02, 0xd8, 0xb7,
+    0x02, 0xd9, 0x8a, 0x02, 0xd9, 0x83, 0x02, 0xd9, 0x85, 0x02, 0xd9, 0x86,
+    0x02, 0xd8, 0xb3, 0x02, 0xd8, 0xb9, 0x02, 0xd9, 0x81, 0x02, 0xd8, 0xb5,
+    0x02, 0xd9, 0x82, 0x02, 0xd8, 0xb4, 0x02, 0xd8, 0xaa, 0x02, 0xd8, 0xab,
+    0x02, 0xd8, 0xae, 0x02, 0xd8, 0xb6, 0x02, 0xd8, 0xb8, 0x02, 0xd8, 0xba,
+    0x02, 0xd9, 0xae, 0x02, 0xda, 0xa1, 0x02, 0xd8, 0xa7, 0x02, 0xd8, 0xa8,
+    0x02, 0xd8, 0xac, 0x02, 0xd8, 0xaf, 0x02, 0xd9, 0x87, 0x02, 0xd9, 0x88,
+    0x02, 0xd8, 0xb2, 0x02, 0xd8, 0xad, 0x02, 0xd8, 0xb7, 0x02, 0xd9, 0x8a,
+    0x02, 0xd9, 0x84, 0x02, 0xd9, 0x85, 0x02, 0xd9, 0x86, 0x02, 0xd8, 0xb3,
+    0x02, 0xd8, 0xb9, 0x02, 0xd9, 0x81, 0x02, 0xd8, 0xb5, 0x02, 0xd9, 0x82,
+    0x02, 0xd8, 0xb1, 0x02, 0xd8, 0xb4, 0x02, 0xd8, 0xaa, 0x02, 0xd8, 0xab,
+    0x02, 0xd8, 0xae, 0x02, 0xd8, 0xb0, 0x02, 0xd8, 0xb6, 0x02, 0xd8, 0xb8,
+    0x02, 0xd8, 0xba, 0x02, 0xd8, 0xa8, 0x02, 0xd8, 0xac, 0x02, 0xd8, 0xaf,
+    0x02, 0xd9, 0x88, 0x02, 0xd8, 0xb2, 0x02, 0xd8, 0xad, 0x02, 0xd8, 0xb7,
+    0x02, 0xd9, 0x8a, 0x02, 0xd9, 0x84, 0x02, 0xd9, 0x85, 0x02, 0xd9, 0x86,
+    0x02, 0xd8, 0xb3, 0x02, 0xd8, 0xb9, 0x02, 0xd9, 0x81, 0x02, 0xd8, 0xb5,
+    0x02, 0xd9, 0x82, 0x02, 0xd8, 0xb1, 0x02, 0xd8, 0xb4, 0x02, 0xd8, 0xaa,
+    0x02, 0xd8, 0xab, 0x02, 0xd8, 0xae, 0x02, 0xd8, 0xb0, 0x02, 0xd8, 0xb6,
+    0x02, 0xd8, 0xb8, 0x02, 0xd8, 0xba, 0x02, 0x30, 0x2e, 0x02, 0x30, 0x2c,
+    0x02, 0x31, 0x2c, 0x02, 0x32, 0x2c, 0x02, 0x33, 0x2c, 0x02, 0x34, 0x2c,
+    0x02, 0x35, 0x2c, 0x02, 0x36, 0x2c, 0x02, 0x37, 0x2c, 0x02, 0x38, 0x2c,
+    0x02, 0x39, 0x2c, 0x03, 0x28, 0x41, 0x29, 0x03, 0x28, 0x42, 0x29, 0x03,
+    0x28, 0x43, 0x29, 0x03, 0x28, 0x44, 0x29, 0x03, 0x28, 0x45, 0x29, 0x03,
+    0x28, 0x46, 0x29, 0x03, 0x28, 0x47, 0x29, 0x03, 0x28, 0x48, 0x29, 0x03,
+    0x28, 0x49, 0x29, 0x03, 0x28, 0x4a, 0x29, 0x03, 0x28, 0x4b, 0x29, 0x03,
+    0x28, 0x4c, 0x29, 0x03, 0x28, 0x4d, 0x29, 0x03, 0x28, 0x4e, 0x29, 0x03,
+    0x28, 0x4f, 0x29, 0x03, 0x28, 0x50, 0x29, 0x03, 0x28, 0x51, 0x29, 0x03,
+    0x28, 0x52, 0x29, 0x03, 0x28, 0x53, 0x29, 0x03, 0x28, 0x54, 0x29, 0x03,
+    0x28, 0x55, 0x29, 0x03, 0x28, 0x56, 0x29, 0x03, 0x28, 0x57, 0x29, 0x03,
+    0x28, 0x58, 0x29, 0x03, 0x28, 0x59, 0x29, 0x03, 0x28, 0x5a, 0x29, 0x07,
+    0xe3, 0x80, 0x94, 0x53, 0xe3, 0x80, 0x95, 0x01, 0x43, 0x01, 0x52, 0x02,
+    0x43, 0x44, 0x02, 0x57, 0x5a, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01,
+    0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01,
+    0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01,
+    0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01,
+    0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x02, 0x48, 0x56,
+    0x02, 0x4d, 0x56, 0x02, 0x53, 0x44, 0x02, 0x53, 0x53, 0x03, 0x50, 0x50,
+    0x56, 0x02, 0x57, 0x43, 0x02, 0x4d, 0x43, 0x02, 0x4d, 0x44, 0x02, 0x4d,
+    0x52, 0x02, 0x44, 0x4a, 0x06, 0xe3, 0x81, 0xbb, 0xe3, 0x81, 0x8b, 0x06,
+    0xe3, 0x82, 0xb3, 0xe3, 0x82, 0xb3, 0x03, 0xe3, 0x82, 0xb5, 0x03, 0xe6,
+    0x89, 0x8b, 0x03, 0xe5, 0xad, 0x97, 0x03, 0xe5, 0x8f, 0x8c, 0x06, 0xe3,
+    0x83, 0x86, 0xe3, 0x82, 0x99, 0x03, 0xe4, 0xba, 0x8c, 0x03, 0xe5, 0xa4,
+    0x9a, 0x03, 0xe8, 0xa7, 0xa3, 0x03, 0xe5, 0xa4, 0xa9, 0x03, 0xe4, 0xba,
+    0xa4, 0x03, 0xe6, 0x98, 0xa0, 0x03, 0xe7, 0x84, 0xa1, 0x03, 0xe6, 0x96,
+    0x99, 0x03, 0xe5, 0x89, 0x8d, 0x03, 0xe5, 0xbe, 0x8c, 0x03, 0xe5, 0x86,
+    0x8d, 0x03, 0xe6, 0x96, 0xb0, 0x03, 0xe5, 0x88, 0x9d, 0x03, 0xe7, 0xb5,
+    0x82, 0x03, 0xe7, 0x94, 0x9f, 0x03, 0xe8, 0xb2, 0xa9, 0x03, 0xe5, 0xa3,
+    0xb0, 0x03, 0xe5, 0x90, 0xb9, 0x03, 0xe6, 0xbc, 0x94, 0x03, 0xe6, 0x8a,
+    0x95, 0x03, 0xe6, 0x8d, 0x95, 0x03, 0xe4, 0xb8, 0x80, 0x03, 0xe4, 0xb8,
+    0x89, 0x03, 0xe9, 0x81, 0x8a, 0x03, 0xe5, 0xb7, 0xa6, 0x03, 0xe4, 0xb8,
+    0xad, 0x03, 0xe5, 0x8f, 0xb3, 0x03, 0xe6, 0x8c, 0x87, 0x03, 0xe8, 0xb5,
+    0xb0, 0x03, 0xe6, 0x89, 0x93, 0x03, 0xe7, 0xa6, 0x81, 0x03, 0xe7, 0xa9,
+    0xba, 0x03, 0xe5, 0x90, 0x88, 0x03, 0xe6, 0xba, 0x80, 0x03, 0xe6, 0x9c,
+    0x89, 0x03, 0xe6, 0x9c, 0x88, 0x03, 0xe7, 0x94, 0xb3, 0x03, 0xe5, 0x89,
+    0xb2, 0x03, 0xe5, 0x96, 0xb6, 0x03, 0xe9, 0x85, 0x8d, 0x09, 0xe3, 0x80,
+    0x94, 0xe6, 0x9c, 0xac, 0xe3, 0x80, 0x95, 0x09, 0xe3, 0x80, 0x94, 0xe4,
+    0xb8, 0x89, 0xe3, 0x80, 0x95, 0x09, 0xe3, 0x80, 0x94, 0xe4, 0xba, 0x8c,
+    0xe3, 0x80, 0x95, 0x09, 0xe3, 0x80, 0x94, 0xe5, 0xae, 0x89, 0xe3, 0x80,
+    0x95, 0x09, 0xe3, 0x80, 0x94, 0xe7, 0x82, 0xb9, 0xe3, 0x80, 0x95, 0x09,
+    0xe3, 0x80, 0x94, 0xe6, 0x89, 0x93, 0xe3, 0x80, 0x95, 0x09, 0xe3, 0x80,
+    0x94, 0xe7, 0x9b, 0x97, 0xe3, 0x80, 0x95, 0x09, 0xe3, 0x80, 0x94, 0xe5,
+    0x8b, 0x9d, 0xe3, 0x80, 0x95, 0x09, 0xe3, 0x80, 0x94, 0xe6, 0x95, 0x97,
+    0xe3, 0x80, 0x95, 0x03, 0xe5, 0xbe, 0x97, 0x03, 0xe5, 0x8f, 0xaf, 0x01,
+    0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01,
+    0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x03, 0xe4, 0xb8, 0xbd, 0x03,
+    0xe4, 0xb8, 0xb8, 0x03, 0xe4, 0xb9, 0x81, 0x04, 0xf0, 0xa0, 0x84, 0xa2,
+    0x03, 0xe4, 0xbd, 0xa0, 0x03, 0xe4, 0xbe, 0xae, 0x03, 0xe4, 0xbe, 0xbb,
+    0x03, 0xe5, 0x80, 0x82, 0x03, 0xe5, 0x81, 0xba, 0x03, 0xe5, 0x82, 0x99,
+    0x03, 0xe5, 0x83, 0xa7, 0x03, 0xe5, 0x83, 0x8f, 0x03, 0xe3, 0x92, 0x9e,
+    0x04, 0xf0, 0xa0, 0x98, 0xba, 0x03, 0xe5, 0x85, 0x8d, 0x03, 0xe5, 0x85,
+    0x94, 0x03, 0xe5, 0x85, 0xa4, 0x03, 0xe5, 0x85, 0xb7, 0x04, 0xf0, 0xa0,
+    0x94, 0x9c, 0x03, 0xe3, 0x92, 0xb9, 0x03, 0xe5, 0x85, 0xa7, 0x03, 0xe5,
+    0x86, 0x8d, 0x04, 0xf0, 0xa0, 0x95, 0x8b, 0x03, 0xe5, 0x86, 0x97, 0x03,
+    0xe5, 0x86, 0xa4, 0x03, 0xe4, 0xbb, 0x8c, 0x03, 0xe5, 0x86, 0xac, 0x03,
+    0xe5, 0x86, 0xb5, 0x04, 0xf0, 0xa9, 0x87, 0x9f, 0x03, 0xe5, 0x87, 0xb5,
+    0x03, 0xe5, 0x88, 0x83, 0x03, 0xe3, 0x93, 0x9f, 0x03, 0xe5, 0x88, 0xbb,
+    0x03, 0xe5, 0x89, 0x86, 0x03, 0xe5, 0x89, 0xb2, 0x03, 0xe5, 0x89, 0xb7,
+    0x03, 0xe3, 0x94, 0x95, 0x03, 0xe5, 0x8b, 0x87, 0x03, 0xe5, 0x8b, 0x89,
+    0x03, 0xe5, 0x8b, 0xa4, 0x03, 0xe5, 0x8b, 0xba, 0x03, 0xe5, 0x8c, 0x85,
+    0x03, 0xe5, 0x8c, 0x86, 0x03, 0xe5, 0x8c, 0x97, 0x03, 0xe5, 0x8d, 0x89,
+    0x03, 0xe5, 0x8d, 0x91, 0x03, 0xe5, 0x8d, 0x9a, 0x03, 0xe5, 0x8d, 0xb3,
+    0x03, 0xe5, 0x8d, 0xbd, 0x03, 0xe5, 0x8d, 0xbf, 0x03, 0xe5, 0x8d, 0xbf,
+    0x03, 0xe5, 0x8d, 0xbf, 0x04, 0xf0, 0xa0, 0xa8, 0xac, 0x03, 0xe7, 0x81,
+    0xb0, 0x03, 0xe5, 0x8f, 0x8a, 0x03, 0xe5, 0x8f, 0x9f, 0x04, 0xf0, 0xa0,
+    0xad, 0xa3, 0x03, 0xe5, 0x8f, 0xab, 0x03, 0xe5, 0x8f, 0xb1, 0x03, 0xe5,
+    0x90, 0x86, 0x03, 0xe5, 0x92, 0x9e, 0x03, 0xe5, 0x90, 0xb8, 0x03, 0xe5,
+    0x91, 0x88, 0x03, 0xe5, 0x91, 0xa8, 0x03, 0xe5, 0x92, 0xa2, 0x03, 0xe5,
+    0x93, 0xb6, 0x03, 0xe5, 0x94, 0x90, 0x03, 0xe5, 0x95, 0x93, 0x03, 0xe5,
+    0x95, 0xa3, 0x03, 0xe5, 0x96, 0x84, 0x03, 0xe5, 0x96, 0x84, 0x03, 0xe5,
+    0x96, 0x99, 0x03, 0xe5, 0x96, 0xab, 0x03, 0xe5, 0x96, 0xb3, 0x03, 0xe5,
+    0x97, 0x82, 0x03, 0xe5, 0x9c, 0x96, 0x03, 0xe5, 0x98, 0x86, 0x03, 0xe5,
+    0x9c, 0x97, 0x03, 0xe5, 0x99, 0x91, 0x03, 0xe5, 0x99, 0xb4, 0x03, 0xe5,
+    0x88, 0x87, 0x03, 0xe5, 0xa3, 0xae, 0x03, 0xe5, 0x9f, 0x8e, 0x03, 0xe5,
+    0x9f, 0xb4, 0x03, 0xe5, 0xa0, 0x8d, 0x03, 0xe5, 0x9e, 0x8b, 0x03, 0xe5,
+    0xa0, 0xb2, 0x03, 0xe5, 0xa0, 0xb1, 0x03, 0xe5, 0xa2, 0xac, 0x04, 0xf0,
+    0xa1, 0x93, 0xa4, 0x03, 0xe5, 0xa3, 0xb2, 0x03, 0xe5, 0xa3, 0xb7, 0x03,
+    0xe5, 0xa4, 0x86, 0x03, 0xe5, 0xa4, 0x9a, 0x03, 0xe5, 0xa4, 0xa2, 0x03,
+    0xe5, 0xa5, 0xa2, 0x04, 0xf0, 0xa1, 0x9a, 0xa8, 0x04, 0xf0, 0xa1, 0x9b,
+    0xaa, 0x03, 0xe5, 0xa7, 0xac, 0x03, 0xe5, 0xa8, 0x9b, 0x03, 0xe5, 0xa8,
+    0xa7, 0x03, 0xe5, 0xa7, 0x98, 0x03, 0xe5, 0xa9, 0xa6, 0x03, 0xe3, 0x9b,
+    0xae, 0x03, 0xe3, 0x9b, 0xbc, 0x03, 0xe5, 0xac, 0x88, 0x03, 0xe5, 0xac,
+    0xbe, 0x03, 0xe5, 0xac, 0xbe, 0x04, 0xf0, 0xa1, 0xa7, 0x88, 0x03, 0xe5,
+    0xaf, 0x83, 0x03, 0xe5, 0xaf, 0x98, 0x03, 0xe5, 0xaf, 0xa7, 0x03, 0xe5,
+    0xaf, 0xb3, 0x04, 0xf0, 0xa1, 0xac, 0x98, 0x03, 0xe5, 0xaf, 0xbf, 0x03,
+    0xe5, 0xb0, 0x86, 0x03, 0xe5, 0xbd, 0x93, 0x03, 0xe5, 0xb0, 0xa2, 0x03,
+    0xe3, 0x9e, 0x81, 0x03, 0xe5, 0xb1, 0xa0, 0x03, 0xe5, 0xb1, 0xae, 0x03,
+    0xe5, 0xb3, 0x80, 0x03, 0xe5, 0xb2, 0x8d, 0x04, 0xf0, 0xa1, 0xb7, 0xa4,
+    0x03, 0xe5, 0xb5, 0x83, 0x04, 0xf0, 0xa1, 0xb7, 0xa6, 0x03, 0xe5, 0xb5,
+    0xae, 0x03, 0xe5, 0xb5, 0xab, 0x03, 0xe5, 0xb5, 0xbc, 0x03, 0xe5, 0xb7,
+    0xa1, 0x03, 0xe5, 0xb7, 0xa2, 0x03, 0xe3, 0xa0, 0xaf, 0x03, 0xe5, 0xb7,
+    0xbd, 0x03, 0xe5, 0xb8, 0xa8, 0x03, 0xe5, 0xb8, 0xbd, 0x03, 0xe5, 0xb9,
+    0xa9, 0x03, 0xe3, 0xa1, 0xa2, 0x04, 0xf0, 0xa2, 0x86, 0x83, 0x03, 0xe3,
+    0xa1, 0xbc, 0x03, 0xe5, 0xba, 0xb0, 0x03, 0xe5, 0xba, 0xb3, 0x03, 0xe5,
+    0xba, 0xb6, 0x03, 0xe5, 0xbb, 0x8a, 0x04, 0xf0, 0xaa, 0x8e, 0x92, 0x03,
+    0xe5, 0xbb, 0xbe, 0x04, 0xf0, 0xa2, 0x8c, 0xb1, 0x04, 0xf0, 0xa2, 0x8c,
+    0xb1, 0x03, 0xe8, 0x88, 0x81, 0x03, 0xe5, 0xbc, 0xa2, 0x03, 0xe5, 0xbc,
+    0xa2, 0x03, 0xe3, 0xa3, 0x87, 0x04, 0xf0, 0xa3, 0x8a, 0xb8, 0x04, 0xf0,
+    0xa6, 0x87, 0x9a, 0x03, 0xe5, 0xbd, 0xa2, 0x03, 0xe5, 0xbd, 0xab, 0x03,
+    0xe3, 0xa3, 0xa3, 0x03, 0xe5, 0xbe, 0x9a, 0x03, 0xe5, 0xbf, 0x8d, 0x03,
+    0xe5, 0xbf, 0x97, 0x03, 0xe5, 0xbf, 0xb9, 0x03, 0xe6, 0x82, 0x81, 0x03,
+    0xe3, 0xa4, 0xba, 0x03, 0xe3, 0xa4, 0x9c, 0x03, 0xe6, 0x82, 0x94, 0x04,
+    0xf0, 0xa2, 0x9b, 0x94, 0x03, 0xe6, 0x83, 0x87, 0x03, 0xe6, 0x85, 0x88,
+    0x03, 0xe6, 0x85, 0x8c, 0x03, 0xe6, 0x85, 0x8e, 0x03, 0xe6, 0x85, 0x8c,
+    0x03, 0xe6, 0x85, 0xba, 0x03, 0xe6, 0x86, 0x8e, 0x03, 0xe6, 0x86, 0xb2,
+    0x03, 0xe6, 0x86, 0xa4, 0x03, 0xe6, 0x86, 0xaf, 0x03, 0xe6, 0x87, 0x9e,
+    0x03, 0xe6, 0x87, 0xb2, 0x03, 0xe6, 0x87, 0xb6, 0x03, 0xe6, 0x88, 0x90,
+    0x03, 0xe6, 0x88, 0x9b, 0x03, 0xe6, 0x89, 0x9d, 0x03, 0xe6, 0x8a, 0xb1,
+    0x03, 0xe6, 0x8b, 0x94, 0x03, 0xe6, 0x8d, 0x90, 0x04, 0xf0, 0xa2, 0xac,
+    0x8c, 0x03, 0xe6, 0x8c, 0xbd, 0x03, 0xe6, 0x8b, 0xbc, 0x03, 0xe6, 0x8d,
+    0xa8, 0x03, 0xe6, 0x8e, 0x83, 0x03, 0xe6, 0x8f, 0xa4, 0x04, 0xf0, 0xa2,
+    0xaf, 0xb1, 0x03, 0xe6, 0x90, 0xa2, 0x03, 0xe6, 0x8f, 0x85, 0x03, 0xe6,
+    0x8e, 0xa9, 0x03, 0xe3, 0xa8, 0xae, 0x03, 0xe6, 0x91, 0xa9, 0x03, 0xe6,
+    0x91, 0xbe, 0x03, 0xe6, 0x92, 0x9d, 0x03, 0xe6, 0x91, 0xb7, 0x03, 0xe3,
+    0xa9, 0xac, 0x03, 0xe6, 0x95, 0x8f, 0x03, 0xe6, 0x95, 0xac, 0x04, 0xf0,
+    0xa3, 0x80, 0x8a, 0x03, 0xe6, 0x97, 0xa3, 0x03, 0xe6, 0x9b, 0xb8, 0x03,
+    0xe6, 0x99, 0x89, 0x03, 0xe3, 0xac, 0x99, 0x03, 0xe6, 0x9a, 0x91, 0x03,
+    0xe3, 0xac, 0x88, 0x03, 0xe3, 0xab, 0xa4, 0x03, 0xe5, 0x86, 0x92, 0x03,
+    0xe5, 0x86, 0x95, 0x03, 0xe6, 0x9c, 0x80, 0x03, 0xe6, 0x9a, 0x9c, 0x03,
+    0xe8, 0x82, 0xad, 0x03, 0xe4, 0x8f, 0x99, 0x03, 0xe6, 0x9c, 0x97, 0x03,
+    0xe6, 0x9c, 0x9b, 0x03, 0xe6, 0x9c, 0xa1, 0x03, 0xe6, 0x9d, 0x9e, 0x03,
+    0xe6, 0x9d, 0x93, 0x04, 0xf0, 0xa3, 0x8f, 0x83, 0x03, 0xe3, 0xad, 0x89,
+    0x03, 0xe6, 0x9f, 0xba, 0x03, 0xe6, 0x9e, 0x85, 0x03, 0xe6, 0xa1, 0x92,
+    0x03, 0xe6, 0xa2, 0x85, 0x04, 0xf0, 0xa3, 0x91, 0xad, 0x03, 0xe6, 0xa2,
+    0x8e, 0x03, 0xe6, 0xa0, 0x9f, 0x03, 0xe6, 0xa4, 0x94, 0x03, 0xe3, 0xae,
+    0x9d, 0x03, 0xe6, 0xa5, 0x82, 0x03, 0xe6, 0xa6, 0xa3, 0x03, 0xe6, 0xa7,
+    0xaa, 0x03, 0xe6, 0xaa, 0xa8, 0x04, 0xf0, 0xa3, 0x9a, 0xa3, 0x03, 0xe6,
+    0xab, 0x9b, 0x03, 0xe3, 0xb0, 0x98, 0x03, 0xe6, 0xac, 0xa1, 0x04, 0xf0,
+    0xa3, 0xa2, 0xa7, 0x03, 0xe6, 0xad, 0x94, 0x03, 0xe3, 0xb1, 0x8e, 0x03,
+    0xe6, 0xad, 0xb2, 0x03, 0xe6, 0xae, 0x9f, 0x03, 0xe6, 0xae, 0xba, 0x03,
+    0xe6, 0xae, 0xbb, 0x04, 0xf0, 0xa3, 0xaa, 0x8d, 0x04, 0xf0, 0xa1, 0xb4,
+    0x8b, 0x04, 0xf0, 0xa3, 0xab, 0xba, 0x03, 0xe6, 0xb1, 0x8e, 0x04, 0xf0,
+    0xa3, 0xb2, 0xbc, 0x03, 0xe6, 0xb2, 0xbf, 0x03, 0xe6, 0xb3, 0x8d, 0x03,
+    0xe6, 0xb1, 0xa7, 0x03, 0xe6, 0xb4, 0x96, 0x03, 0xe6, 0xb4, 0xbe, 0x03,
+    0xe6, 0xb5, 0xb7, 0x03, 0xe6, 0xb5, 0x81, 0x03, 0xe6, 0xb5, 0xa9, 0x03,
+    0xe6, 0xb5, 0xb8, 0x03, 0xe6, 0xb6, 0x85, 0x04, 0xf0, 0xa3, 0xb4, 0x9e,
+    0x03, 0xe6, 0xb4, 0xb4, 0x03, 0xe6, 0xb8, 0xaf, 0x03, 0xe6, 0xb9, 0xae,
+    0x03, 0xe3, 0xb4, 0xb3, 0x03, 0xe6, 0xbb, 0x8b, 0x03, 0xe6, 0xbb, 0x87,
+    0x04, 0xf0, 0xa3, 0xbb, 0x91, 0x03, 0xe6, 0xb7, 0xb9, 0x03, 0xe6, 0xbd,
+    0xae, 0x04, 0xf0, 0xa3, 0xbd, 0x9e, 0x04, 0xf0, 0xa3, 0xbe, 0x8e, 0x03,
+    0xe6, 0xbf, 0x86, 0x03, 0xe7, 0x80, 0xb9, 0x03, 0xe7, 0x80, 0x9e, 0x03,
+    0xe7, 0x80, 0x9b, 0x03, 0xe3, 0xb6, 0x96, 0x03, 0xe7, 0x81, 0x8a, 0x03,
+    0xe7, 0x81, 0xbd, 0x03, 0xe7, 0x81, 0xb7, 0x03, 0xe7, 0x82, 0xad, 0x04,
+    0xf0, 0xa0, 0x94, 0xa5, 0x03, 0xe7, 0x85, 0x85, 0x04, 0xf0, 0xa4, 0x89,
+    0xa3, 0x03, 0xe7, 0x86, 0x9c, 0x04, 0xf0, 0xa4, 0x8e, 0xab, 0x03, 0xe7,
+    0x88, 0xa8, 0x03, 0xe7, 0x88, 0xb5, 0x03, 0xe7, 0x89, 0x90, 0x04, 0xf0,
+    0xa4, 0x98, 0x88, 0x03, 0xe7, 0x8a, 0x80, 0x03, 0xe7, 0x8a, 0x95, 0x04,
+    0xf0, 0xa4, 0x9c, 0xb5, 0x04, 0xf0, 0xa4, 0xa0, 0x94, 0x03, 0xe7, 0x8d,
+    0xba, 0x03, 0xe7, 0x8e, 0x8b, 0x03, 0xe3, 0xba, 0xac, 0x03, 0xe7, 0x8e,
+    0xa5, 0x03, 0xe3, 0xba, 0xb8, 0x03, 0xe3, 0xba, 0xb8, 0x03, 0xe7, 0x91,
+    0x87, 0x03, 0xe7, 0x91, 0x9c, 0x03, 0xe7, 0x91, 0xb1, 0x03, 0xe7, 0x92,
+    0x85, 0x03, 0xe7, 0x93, 0x8a, 0x03, 0xe3, 0xbc, 0x9b, 0x03, 0xe7, 0x94,
+    0xa4, 0x04, 0xf0, 0xa4, 0xb0, 0xb6, 0x03, 0xe7, 0x94, 0xbe, 0x04, 0xf0,
+    0xa4, 0xb2, 0x92, 0x03, 0xe7, 0x95, 0xb0, 0x04, 0xf0, 0xa2, 0x86, 0x9f,
+    0x03, 0xe7, 0x98, 0x90, 0x04, 0xf0, 0xa4, 0xbe, 0xa1, 0x04, 0xf0, 0xa4,
+    0xbe, 0xb8, 0x04, 0xf0, 0xa5, 0x81, 0x84, 0x03, 0xe3, 0xbf, 0xbc, 0x03,
+    0xe4, 0x80, 0x88, 0x03, 0xe7, 0x9b, 0xb4, 0x04, 0xf0, 0xa5, 0x83, 0xb3,
+    0x04, 0xf0, 0xa5, 0x83, 0xb2, 0x04, 0xf0, 0xa5, 0x84, 0x99, 0x04, 0xf0,
+    0xa5, 0x84, 0xb3, 0x03, 0xe7, 0x9c, 0x9e, 0x03, 0xe7, 0x9c, 0x9f, 0x03,
+    0xe7, 0x9c, 0x9f, 0x03, 0xe7, 0x9d, 0x8a, 0x03, 0xe4, 0x80, 0xb9, 0x03,
+    0xe7, 0x9e, 0x8b, 0x03, 0xe4, 0x81, 0x86, 0x03, 0xe4, 0x82, 0x96, 0x04,
+    0xf0, 0xa5, 0x90, 0x9d, 0x03, 0xe7, 0xa1, 0x8e, 0x03, 0xe7, 0xa2, 0x8c,
+    0x03, 0xe7, 0xa3, 0x8c, 0x03, 0xe4, 0x83, 0xa3, 0x04, 0xf0, 0xa5, 0x98,
+    0xa6, 0x03, 0xe7, 0xa5, 0x96, 0x04, 0xf0, 0xa5, 0x9a, 0x9a, 0x04, 0xf0,
+    0xa5, 0x9b, 0x85, 0x03, 0xe7, 0xa6, 0x8f, 0x03, 0xe7, 0xa7, 0xab, 0x03,
+    0xe4, 0x84, 0xaf, 0x03, 0xe7, 0xa9, 0x80, 0x03, 0xe7, 0xa9, 0x8a, 0x03,
+    0xe7, 0xa9, 0x8f, 0x04, 0xf0, 0xa5, 0xa5, 0xbc, 0x04, 0xf0, 0xa5, 0xaa,
+    0xa7, 0x04, 0xf0, 0xa5, 0xaa, 0xa7, 0x03, 0xe7, 0xab, 0xae, 0x03, 0xe4,
+    0x88, 0x82, 0x04, 0xf0, 0xa5, 0xae, 0xab, 0x03, 0xe7, 0xaf, 0x86, 0x03,
+    0xe7, 0xaf, 0x89, 0x03, 0xe4, 0x88, 0xa7, 0x04, 0xf0, 0xa5, 0xb2, 0x80,
+    0x03, 0xe7, 0xb3, 0x92, 0x03, 0xe4, 0x8a, 0xa0, 0x03, 0xe7, 0xb3, 0xa8,
+    0x03, 0xe7, 0xb3, 0xa3, 0x03, 0xe7, 0xb4, 0x80, 0x04, 0xf0, 0xa5, 0xbe,
+    0x86, 0x03, 0xe7, 0xb5, 0xa3, 0x03, 0xe4, 0x8c, 0x81, 0x03, 0xe7, 0xb7,
+    0x87, 0x03, 0xe7, 0xb8, 0x82, 0x03, 0xe7, 0xb9, 0x85, 0x03, 0xe4, 0x8c,
+    0xb4, 0x04, 0xf0, 0xa6, 0x88, 0xa8, 0x04, 0xf0, 0xa6, 0x89, 0x87, 0x03,
+    0xe4, 0x8d, 0x99, 0x04, 0xf0, 0xa6, 0x8b, 0x99, 0x03, 0xe7, 0xbd, 0xba,
+    0x04, 0xf0, 0xa6, 0x8c, 0xbe, 0x03, 0xe7, 0xbe, 0x95, 0x03, 0xe7, 0xbf,
+    0xba, 0x03, 0xe8, 0x80, 0x85, 0x04, 0xf0, 0xa6, 0x93, 0x9a, 0x04, 0xf0,
+    0xa6, 0x94, 0xa3, 0x03, 0xe8, 0x81, 0xa0, 0x04, 0xf0, 0xa6, 0x96, 0xa8,
+    0x03, 0xe8, 0x81, 0xb0, 0x04, 0xf0, 0xa3, 0x8d, 0x9f, 0x03, 0xe4, 0x8f,
+    0x95, 0x03, 0xe8, 0x82, 0xb2, 0x03, 0xe8, 0x84, 0x83, 0x03, 0xe4, 0x90,
+    0x8b, 0x03, 0xe8, 0x84, 0xbe, 0x03, 0xe5, 0xaa, 0xb5, 0x04, 0xf0, 0xa6,
+    0x9e, 0xa7, 0x04, 0xf0, 0xa6, 0x9e, 0xb5, 0x04, 0xf0, 0xa3, 0x8e, 0x93,
+    0x04, 0xf0, 0xa3, 0x8e, 0x9c, 0x03, 0xe8, 0x88, 0x81, 0x03, 0xe8, 0x88,
+    0x84, 0x03, 0xe8, 0xbe, 0x9e, 0x03, 0xe4, 0x91, 0xab, 0x03, 0xe8, 0x8a,
+    0x91, 0x03, 0xe8, 0x8a, 0x8b, 0x03, 0xe8, 0x8a, 0x9d, 0x03, 0xe5, 0x8a,
+    0xb3, 0x03, 0xe8, 0x8a, 0xb1, 0x03, 0xe8, 0x8a, 0xb3, 0x03, 0xe8, 0x8a,
+    0xbd, 0x03, 0xe8, 0x8b, 0xa6, 0x04, 0xf0, 0xa6, 0xac, 0xbc, 0x03, 0xe8,
+    0x8b, 0xa5, 0x03, 0xe8, 0x8c, 0x9d, 0x03, 0xe8, 0x8d, 0xa3, 0x03, 0xe8,
+    0x8e, 0xad, 0x03, 0xe8, 0x8c, 0xa3, 0x03, 0xe8, 0x8e, 0xbd, 0x03, 0xe8,
+    0x8f, 0xa7, 0x03, 0xe8, 0x91, 0x97, 0x03, 0xe8, 0x8d, 0x93, 0x03, 0xe8,
+    0x8f, 0x8a, 0x03, 0xe8, 0x8f, 0x8c, 0x03, 0xe8, 0x8f, 0x9c, 0x04, 0xf0,
+    0xa6, 0xb0, 0xb6, 0x04, 0xf0, 0xa6, 0xb5, 0xab, 0x04, 0xf0, 0xa6, 0xb3,
+    0x95, 0x03, 0xe4, 0x94, 0xab, 0x03, 0xe8, 0x93, 0xb1, 0x03, 0xe8, 0x93,
+    0xb3, 0x03, 0xe8, 0x94, 0x96, 0x04, 0xf0, 0xa7, 0x8f, 0x8a, 0x03, 0xe8,
+    0x95, 0xa4, 0x04, 0xf0, 0xa6, 0xbc, 0xac, 0x03, 0xe4, 0x95, 0x9d, 0x03,
+    0xe4, 0x95, 0xa1, 0x04, 0xf0, 0xa6, 0xbe, 0xb1, 0x04, 0xf0, 0xa7, 0x83,
+    0x92, 0x03, 0xe4, 0x95, 0xab, 0x03, 0xe8, 0x99, 0x90, 0x03, 0xe8, 0x99,
+    0x9c, 0x03, 0xe8, 0x99, 0xa7, 0x03, 0xe8, 0x99, 0xa9, 0x03, 0xe8, 0x9a,
+    0xa9, 0x03, 0xe8, 0x9a, 0x88, 0x03, 0xe8, 0x9c, 0x8e, 0x03, 0xe8, 0x9b,
+    0xa2, 0x03, 0xe8, 0x9d, 0xb9, 0x03, 0xe8, 0x9c, 0xa8, 0x03, 0xe8, 0x9d,
+    0xab, 0x03, 0xe8, 0x9e, 0x86, 0x03, 0xe4, 0x97, 0x97, 0x03, 0xe8, 0x9f,
+    0xa1, 0x03, 0xe8, 0xa0, 0x81, 0x03, 0xe4, 0x97, 0xb9, 0x03, 0xe8, 0xa1,
+    0xa0, 0x03, 0xe8, 0xa1, 0xa3, 0x04, 0xf0, 0xa7, 0x99, 0xa7, 0x03, 0xe8,
+    0xa3, 0x97, 0x03, 0xe8, 0xa3, 0x9e, 0x03, 0xe4, 0x98, 0xb5, 0x03, 0xe8,
+    0xa3, 0xba, 0x03, 0xe3, 0x92, 0xbb, 0x04, 0xf0, 0xa7, 0xa2, 0xae, 0x04,
+    0xf0, 0xa7, 0xa5, 0xa6, 0x03, 0xe4, 0x9a, 0xbe, 0x03, 0xe4, 0x9b, 0x87,
+    0x03, 0xe8, 0xaa, 0xa0, 0x03, 0xe8, 0xab, 0xad, 0x03, 0xe8, 0xae, 0x8a,
+    0x03, 0xe8, 0xb1, 0x95, 0x04, 0xf0, 0xa7, 0xb2, 0xa8, 0x03, 0xe8, 0xb2,
+    0xab, 0x03, 0xe8, 0xb3, 0x81, 0x03, 0xe8, 0xb4, 0x9b, 0x03, 0xe8, 0xb5,
+    0xb7, 0x04, 0xf0, 0xa7, 0xbc, 0xaf, 0x04, 0xf0, 0xa0, 0xa0, 0x84, 0x03,
+    0xe8, 0xb7, 0x8b, 0x03, 0xe8, 0xb6, 0xbc, 0x03, 0xe8, 0xb7, 0xb0, 0x04,
+    0xf0, 0xa0, 0xa3, 0x9e, 0x03, 0xe8, 0xbb, 0x94, 0x03, 0xe8, 0xbc, 0xb8,
+    0x04, 0xf0, 0xa8, 0x97, 0x92, 0x04, 0xf0, 0xa8, 0x97, 0xad, 0x03, 0xe9,
+    0x82, 0x94, 0x03, 0xe9, 0x83, 0xb1, 0x03, 0xe9, 0x84, 0x91, 0x04, 0xf0,
+    0xa8, 0x9c, 0xae, 0x03, 0xe9, 0x84, 0x9b, 0x03, 0xe9, 0x88, 0xb8, 0x03,
+    0xe9, 0x8b, 0x97, 0x03, 0xe9, 0x8b, 0x98, 0x03, 0xe9, 0x89, 0xbc, 0x03,
+    0xe9, 0x8f, 0xb9, 0x03, 0xe9, 0x90, 0x95, 0x04, 0xf0, 0xa8, 0xaf, 0xba,
+    0x03, 0xe9, 0x96, 0x8b, 0x03, 0xe4, 0xa6, 0x95, 0x03, 0xe9, 0x96, 0xb7,
+    0x04, 0xf0, 0xa8, 0xb5, 0xb7, 0x03, 0xe4, 0xa7, 0xa6, 0x03, 0xe9, 0x9b,
+    0x83, 0x03, 0xe5, 0xb6, 0xb2, 0x03, 0xe9, 0x9c, 0xa3, 0x04, 0xf0, 0xa9,
+    0x85, 0x85, 0x04, 0xf0, 0xa9, 0x88, 0x9a, 0x03, 0xe4, 0xa9, 0xae, 0x03,
+    0xe4, 0xa9, 0xb6, 0x03, 0xe9, 0x9f, 0xa0, 0x04, 0xf0, 0xa9, 0x90, 0x8a,
+    0x03, 0xe4, 0xaa, 0xb2, 0x04, 0xf0, 0xa9, 0x92, 0x96, 0x03, 0xe9, 0xa0,
+    0x8b, 0x03, 0xe9, 0xa0, 0x8b, 0x03, 0xe9, 0xa0, 0xa9, 0x04, 0xf0, 0xa9,
+    0x96, 0xb6, 0x03, 0xe9, 0xa3, 0xa2, 0x03, 0xe4, 0xac, 0xb3, 0x03, 0xe9,
+    0xa4, 0xa9, 0x03, 0xe9, 0xa6, 0xa7, 0x03, 0xe9, 0xa7, 0x82, 0x03, 0xe9,
+    0xa7, 0xbe, 0x03, 0xe4, 0xaf, 0x8e, 0x04, 0xf0, 0xa9, 0xac, 0xb0, 0x03,
+    0xe9, 0xac, 0x92, 0x03, 0xe9, 0xb1, 0x80, 0x03, 0xe9, 0xb3, 0xbd, 0x03,
+    0xe4, 0xb3, 0x8e, 0x03, 0xe4, 0xb3, 0xad, 0x03, 0xe9, 0xb5, 0xa7, 0x04,
+    0xf0, 0xaa, 0x83, 0x8e, 0x03, 0xe4, 0xb3, 0xb8, 0x04, 0xf0, 0xaa, 0x84,
+    0x85, 0x04, 0xf0, 0xaa, 0x88, 0x8e, 0x04, 0xf0, 0xaa, 0x8a, 0x91, 0x03,
+    0xe9, 0xba, 0xbb, 0x03, 0xe4, 0xb5, 0x96, 0x03, 0xe9, 0xbb, 0xb9, 0x03,
+    0xe9, 0xbb, 0xbe, 0x03, 0xe9, 0xbc, 0x85, 0x03, 0xe9, 0xbc, 0x8f, 0x03,
+    0xe9, 0xbc, 0x96, 0x03, 0xe9, 0xbc, 0xbb, 0x04, 0xf0, 0xaa, 0x98, 0x80
+};
+
+#endif /* DAV_CALENDAR_CASEFOLD_H */
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Generate the i;unicode-casemap fold table used by dav_calendar_match.c.
+
+RFC5051 folds a string by replacing each character with its simple
+titlecase mapping, then applying compatibility decomposition (NFKD). The
+result of folding each code point is computed here from the Unicode
+database built into Python, and written out as UTF-8 so that folding a
+string is a table lookup and a copy.
+
+The generated table is shipped with the source, python is only needed
+to regenerate it for a newer version of Unicode.
+
+The table has two stages. The first is indexed by the code point divided
+by the block size and gives a block number, the second is indexed by the
+block number and the code point within the block and gives the offset of
+the folded form in the data, or zero if the code point folds to itself.
+Identical blocks are shared, so the large unassigned and unchanging
+ranges cost a single block.
+
+Hangul syllables are decomposed algorithmically by the C code and are not
+in the table.
+"""
+
+import sys
+import unicodedata
+
+SHIFT = 7
+BLOCK = 1 << SHIFT
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+
+def fold(cp):
+    ch = chr(cp)
+    title = ch.title()
+    # title() gives the full mapping, the simple mapping is a single code point
+    if len(title) != 1:
+        title = ch
+    return unicodedata.normalize("NFKD", title)
+
+
+def rows(values, per_line, fmt):
+    out = []
+    for i in range(0, len(values), per_line):
+        out.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]))
+    return ",\n".join(out)
+
+
+def main():
+    folds = {}
+    for cp in range(0x110000):
+        if 0xD800 <= cp <= 0xDFFF or HANGUL_FIRST <= cp <= HANGUL_LAST:
+            continue
+        folded = fold(cp)
+        if folded != chr(cp):
+            folds[cp] = folded.encode("utf-8")
+
+    limit = (max(folds) // BLOCK + 1) * BLOCK
+
+    # offset zero means unchanged, so the data starts with a dummy byte
+    data = [0]
+    offsets = {}
+    max_bytes = 9  # a decomposed Hangul syllable is three 3 byte jamo
+    for cp in sorted(folds):
+        encoded = folds[cp]
+        offsets[cp] = len(data)
+        data.append(len(encoded))
+        data.extend(encoded)
+        max_bytes = max(max_bytes, len(encoded))
+
+    if len(data) > 0xFFFF:
+        raise SystemExit("fold data too large for 16 bit offsets")
+
+    blocks = []
+    block_ids = {}
+    index = []
+    for start in range(0, limit, BLOCK):
+        block = tuple(offsets.get(cp, 0) for cp in range(start, start + BLOCK))
+        if block not in block_ids:
+            block_ids[block] = len(blocks)
+            blocks.append(block)
+        index.append(block_ids[block])
+
+    if len(blocks) > 0xFFFF:
+        raise SystemExit("too many fold blocks for 16 bit block numbers")
+
+    out = sys.stdout
+    out.write("/* Generated by dav_calendar_casefold.py from Unicode %s, do not edit. */\n\n"
+              % unicodedata.unidata_version)
+    out.write("#ifndef DAV_CALENDAR_CASEFOLD_H\n#define DAV_CALENDAR_CASEFOLD_H\n\n")
+    out.write("#define DAV_CALENDAR_CASEFOLD_UNICODE \"%s\"\n"
+              % unicodedata.unidata_version)
+    out.write("#define DAV_CALENDAR_CASEFOLD_SHIFT %d\n" % SHIFT)
+    out.write("#define DAV_CALENDAR_CASEFOLD_MASK 0x%x\n" % (BLOCK - 1))
+    out.write("/* code points from here on fold to themselves */\n")
+    out.write("#define DAV_CALENDAR_CASEFOLD_LIMIT 0x%x\n" % limit)
+    out.write("/* longest folded form of a single code point, in bytes */\n")
+    out.write("#define DAV_CALENDAR_CASEFOLD_MAX_BYTES %d\n" % max_bytes)
+    out.write("/* most bytes a folded string can grow by per input byte */\n")
+    out.write("#define DAV_CALENDAR_CASEFOLD_GROWTH %d\n\n" % max(
+        3, max(-(-len(folds[cp]) // len(chr(cp).encode("utf-8"))) for cp in folds)))
+
+    out.write("static const unsigned short dav_calendar_casefold_index[%d] = {\n%s\n};\n\n"
+              % (len(index), rows(index, 12, "%d")))
+    flat = [v for block in blocks for v in block]
+    out.write("static const unsigned short dav_calendar_casefold_blocks[%d] = {\n%s\n};\n\n"
+              % (len(flat), rows(flat, 10, "%d")))
+    out.write("/* the length of each folded form, followed by its UTF-8 */\n")
+    out.write("static const unsigned char dav_calendar_casefold_data[%d] = {\n%s\n};\n\n"
+              % (len(data), rows(data, 12, "0x%02x")))
+    out.write("#endif /* DAV_CALENDAR_CASEFOLD_H */\n")
+
+
+if __name__ == "__main__":
+    main()
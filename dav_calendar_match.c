@@ -0,0 +1,1415 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The matching kernels used to evaluate calendar-query filters.
+ *
+ * These depend on libical alone, and are kept apart from the module so
+ * that the kernel benchmark in bench/ can link them without httpd.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "dav_calendar_match.h"
+#include "dav_calendar_casefold.h"
+
+#define DAV_CALENDAR_HANGUL_FIRST 0xac00
+#define DAV_CALENDAR_HANGUL_LAST 0xd7a3
+
+/* folded text is searched this many octets at a time */
+#define DAV_CALENDAR_UNICODE_CHUNK 4096
+
+/*
+ * Fold a-z to A-Z, leaving every other octet alone, as defined by the
+ * i;ascii-casemap collation.
+ */
+static const unsigned char dav_calendar_ascii_fold[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+/*
+ * Leave every octet alone, for text that has already been folded.
+ */
+static const unsigned char dav_calendar_octet_fold[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+#define DAV_CALENDAR_FOLD(c) dav_calendar_ascii_fold[(unsigned char)(c)]
+
+size_t dav_calendar_casemap_size(const char *match)
+{
+    return sizeof(dav_calendar_casemap) + strlen(match) + 1;
+}
+
+static dav_calendar_casemap *dav_calendar_casemap_init(
+        dav_calendar_casemap *casemap, const unsigned char *folded,
+        size_t len)
+{
+    size_t i;
+
+    casemap->match = folded;
+    casemap->len = len;
+
+    /*
+     * Horspool shift table, indexed by the folded octet found under the
+     * last position of the match. Shifts are capped at 255 to keep the
+     * table small, a shorter shift is always safe.
+     */
+    memset(casemap->skip, len < 255 ? len : 255, sizeof(casemap->skip));
+    for (i = 0; i + 1 < len; i++) {
+        size_t shift = len - 1 - i;
+        casemap->skip[folded[i]] = shift < 255 ? shift : 255;
+    }
+
+    return casemap;
+}
+
+dav_calendar_casemap *dav_calendar_casemap_compile(void *mem,
+        const char *match)
+{
+    dav_calendar_casemap *casemap = mem;
+    unsigned char *folded = (unsigned char *)(casemap + 1);
+    size_t len = strlen(match);
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        folded[i] = DAV_CALENDAR_FOLD(match[i]);
+    }
+    folded[len] = 0;
+
+    return dav_calendar_casemap_init(casemap, folded, len);
+}
+
+static int dav_calendar_casemap_equal(const unsigned char *fold,
+        const unsigned char *text, const unsigned char *match, size_t len)
+{
+    while (len--) {
+        if (fold[*text++] != *match++) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int dav_calendar_casemap_horspool(const dav_calendar_casemap *casemap,
+        const unsigned char *fold, const unsigned char *text, size_t tlen,
+        size_t i)
+{
+    const unsigned char *match = casemap->match;
+    size_t len = casemap->len;
+    unsigned char last = match[len - 1];
+
+    while (i + len <= tlen) {
+        unsigned char c = fold[text[i + len - 1]];
+
+        if (c == last && dav_calendar_casemap_equal(fold, text + i, match,
+                len - 1)) {
+            return 1;
+        }
+
+        i += casemap->skip[c];
+    }
+
+    return 0;
+}
+
+#if defined(__AVX2__) && defined(__GNUC__)
+
+static __m256i dav_calendar_fold_avx2(__m256i v)
+{
+    __m256i lower = _mm256_and_si256(
+            _mm256_cmpgt_epi8(v, _mm256_set1_epi8('a' - 1)),
+            _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), v));
+
+    return _mm256_sub_epi8(v, _mm256_and_si256(lower, _mm256_set1_epi8(0x20)));
+}
+
+/*
+ * Compare the first and last octets of the match against 32 positions
+ * of the text at once, and only compare the whole match at positions
+ * where both agree.
+ */
+static int dav_calendar_casemap_prefilter(const dav_calendar_casemap *casemap,
+        const unsigned char *fold, const unsigned char *text, size_t tlen)
+{
+    const unsigned char *match = casemap->match;
+    size_t len = casemap->len;
+    __m256i first = _mm256_set1_epi8(match[0]);
+    __m256i last = _mm256_set1_epi8(match[len - 1]);
+    size_t i;
+
+    for (i = 0; i + len - 1 + 32 <= tlen; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(text + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(text + i + len - 1));
+        unsigned int mask;
+
+        if (fold == dav_calendar_ascii_fold) {
+            a = dav_calendar_fold_avx2(a);
+            b = dav_calendar_fold_avx2(b);
+        }
+
+        mask = _mm256_movemask_epi8(_mm256_and_si256(
+                _mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+
+        while (mask) {
+            unsigned int bit = __builtin_ctz(mask);
+
+            if (len < 3 || dav_calendar_casemap_equal(fold,
+                    text + i + bit + 1, match + 1, len - 2)) {
+                return 1;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    return dav_calendar_casemap_horspool(casemap, fold, text, tlen, i);
+}
+
+#elif defined(__SSE2__) && defined(__GNUC__)
+
+static __m128i dav_calendar_fold_sse2(__m128i v)
+{
+    __m128i lower = _mm_and_si128(
+            _mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)),
+            _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+
+    return _mm_sub_epi8(v, _mm_and_si128(lower, _mm_set1_epi8(0x20)));
+}
+
+/*
+ * Compare the first and last octets of the match against 16 positions
+ * of the text at once, and only compare the whole match at positions
+ * where both agree.
+ */
+static int dav_calendar_casemap_prefilter(const dav_calendar_casemap *casemap,
+        const unsigned char *fold, const unsigned char *text, size_t tlen)
+{
+    const unsigned char *match = casemap->match;
+    size_t len = casemap->len;
+    __m128i first = _mm_set1_epi8(match[0]);
+    __m128i last = _mm_set1_epi8(match[len - 1]);
+    size_t i;
+
+    for (i = 0; i + len - 1 + 16 <= tlen; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(text + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(text + i + len - 1));
+        unsigned int mask;
+
+        if (fold == dav_calendar_ascii_fold) {
+            a = dav_calendar_fold_sse2(a);
+            b = dav_calendar_fold_sse2(b);
+        }
+
+        mask = _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+
+        while (mask) {
+            unsigned int bit = __builtin_ctz(mask);
+
+            if (len < 3 || dav_calendar_casemap_equal(fold,
+                    text + i + bit + 1, match + 1, len - 2)) {
+                return 1;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    return dav_calendar_casemap_horspool(casemap, fold, text, tlen, i);
+}
+
+#else
+
+static int dav_calendar_casemap_prefilter(const dav_calendar_casemap *casemap,
+        const unsigned char *fold, const unsigned char *text, size_t tlen)
+{
+    return dav_calendar_casemap_horspool(casemap, fold, text, tlen, 0);
+}
+
+#endif
+
+int dav_calendar_text_match_ascii_casecmp(const dav_calendar_casemap *casemap,
+        const char *text)
+{
+    /* https://tools.ietf.org/html/rfc4790#section-9.2 */
+
+    /*
+     * The substring operation returns "match" if the first string is the
+     * empty string, or if there exists a substring of the second string
+     * of length equal to the length of the first string, which would
+     * result in a "match" result from the equality function.
+     *
+     * The match is folded once when the filter is compiled, the text is
+     * folded as it is compared.
+     */
+
+    size_t tlen;
+
+    if (!casemap->len) {
+        return 1;
+    }
+
+    tlen = strlen(text);
+    if (tlen < casemap->len) {
+        return 0;
+    }
+
+    return dav_calendar_casemap_prefilter(casemap, dav_calendar_ascii_fold,
+            (const unsigned char *)text, tlen);
+}
+
+/*
+ * Fold a single UTF-8 character as defined by the i;unicode-casemap
+ * collation, writing at most DAV_CALENDAR_CASEFOLD_MAX_BYTES to out.
+ * Octets that are not part of a valid UTF-8 sequence are copied as is.
+ */
+static size_t dav_calendar_unicode_fold_char(const unsigned char **in,
+        unsigned char *out)
+{
+    const unsigned char *s = *in;
+    unsigned int cp;
+    size_t n, i;
+
+    if (s[0] < 0x80) {
+        *in = s + 1;
+        out[0] = DAV_CALENDAR_FOLD(s[0]);
+        return 1;
+    }
+    else if ((s[0] & 0xe0) == 0xc0 && s[0] >= 0xc2) {
+        cp = s[0] & 0x1f;
+        n = 2;
+    }
+    else if ((s[0] & 0xf0) == 0xe0) {
+        cp = s[0] & 0x0f;
+        n = 3;
+    }
+    else if ((s[0] & 0xf8) == 0xf0 && s[0] <= 0xf4) {
+        cp = s[0] & 0x07;
+        n = 4;
+    }
+    else {
+        goto invalid;
+    }
+
+    for (i = 1; i < n; i++) {
+        if ((s[i] & 0xc0) != 0x80) {
+            goto invalid;
+        }
+        cp = (cp << 6) | (s[i] & 0x3f);
+    }
+
+    /* overlong, surrogate or out of range */
+    if ((n == 3 && cp < 0x800) || (n == 4 && (cp < 0x10000 || cp > 0x10ffff))
+            || (cp >= 0xd800 && cp <= 0xdfff)) {
+        goto invalid;
+    }
+
+    *in = s + n;
+
+    if (cp >= DAV_CALENDAR_HANGUL_FIRST && cp <= DAV_CALENDAR_HANGUL_LAST) {
+        unsigned int index = cp - DAV_CALENDAR_HANGUL_FIRST;
+        unsigned int jamo[3];
+        size_t count = 2, j;
+
+        jamo[0] = 0x1100 + index / 588;
+        jamo[1] = 0x1161 + (index % 588) / 28;
+        if (index % 28) {
+            jamo[count++] = 0x11a7 + index % 28;
+        }
+
+        /* every jamo is three octets */
+        for (j = 0; j < count; j++) {
+            out[j * 3] = 0xe0 | (jamo[j] >> 12);
+            out[j * 3 + 1] = 0x80 | ((jamo[j] >> 6) & 0x3f);
+            out[j * 3 + 2] = 0x80 | (jamo[j] & 0x3f);
+        }
+        return count * 3;
+    }
+
+    if (cp < DAV_CALENDAR_CASEFOLD_LIMIT) {
+        unsigned int offset = dav_calendar_casefold_blocks[
+                (dav_calendar_casefold_index[cp >> DAV_CALENDAR_CASEFOLD_SHIFT]
+                        << DAV_CALENDAR_CASEFOLD_SHIFT)
+                + (cp & DAV_CALENDAR_CASEFOLD_MASK)];
+
+        if (offset) {
+            n = dav_calendar_casefold_data[offset];
+            memcpy(out, dav_calendar_casefold_data + offset + 1, n);
+            return n;
+        }
+    }
+
+    memcpy(out, s, n);
+    return n;
+
+invalid:
+    *in = s + 1;
+    out[0] = s[0];
+    return 1;
+}
+
+size_t dav_calendar_unicode_fold(const char *in, char *out)
+{
+    const unsigned char *s = (const unsigned char *)in;
+    unsigned char *o = (unsigned char *)out;
+
+    while (*s) {
+        o += dav_calendar_unicode_fold_char(&s, o);
+    }
+    *o = 0;
+
+    return o - (unsigned char *)out;
+}
+
+size_t dav_calendar_unicode_fold_size(size_t len)
+{
+    return len * DAV_CALENDAR_CASEFOLD_GROWTH + 1;
+}
+
+size_t dav_calendar_unicode_casemap_size(const char *match)
+{
+    return sizeof(dav_calendar_casemap)
+            + dav_calendar_unicode_fold_size(strlen(match));
+}
+
+dav_calendar_casemap *dav_calendar_unicode_casemap_compile(void *mem,
+        const char *match)
+{
+    dav_calendar_casemap *casemap = mem;
+    unsigned char *folded = (unsigned char *)(casemap + 1);
+    size_t len = dav_calendar_unicode_fold(match, (char *)folded);
+
+    return dav_calendar_casemap_init(casemap, folded, len);
+}
+
+int dav_calendar_text_match_unicode_casemap(
+        const dav_calendar_casemap *casemap, const char *text)
+{
+    /* https://tools.ietf.org/html/rfc5051 */
+
+    /*
+     * Both strings are folded by replacing each character with its
+     * titlecase form followed by compatibility decomposition, and then
+     * compared octet by octet as for i;octet.
+     *
+     * Text that is all ASCII folds exactly as for i;ascii-casemap, and
+     * is searched in place. Otherwise the text is folded a chunk at a
+     * time into a buffer on the stack, keeping the tail of each chunk
+     * so that a match spanning two chunks is still found.
+     */
+
+    unsigned char buf[DAV_CALENDAR_UNICODE_CHUNK];
+    const unsigned char *s;
+    size_t keep, used = 0;
+    unsigned char high = 0;
+    int match;
+
+    if (!casemap->len) {
+        return 1;
+    }
+
+    for (s = (const unsigned char *)text; *s; s++) {
+        high |= *s;
+    }
+    if (!(high & 0x80)) {
+        if ((size_t)(s - (const unsigned char *)text) < casemap->len) {
+            return 0;
+        }
+        return dav_calendar_casemap_prefilter(casemap,
+                dav_calendar_ascii_fold, (const unsigned char *)text,
+                s - (const unsigned char *)text);
+    }
+
+    /* long matches, fold the whole text instead */
+    if (casemap->len * 2 > sizeof(buf)) {
+        unsigned char *folded = malloc(dav_calendar_unicode_fold_size(
+                s - (const unsigned char *)text));
+        size_t len;
+
+        if (!folded) {
+            return 0;
+        }
+        len = dav_calendar_unicode_fold(text, (char *)folded);
+        match = len >= casemap->len && dav_calendar_casemap_prefilter(
+                casemap, dav_calendar_octet_fold, folded, len);
+        free(folded);
+        return match;
+    }
+
+    keep = casemap->len - 1;
+    s = (const unsigned char *)text;
+
+    while (*s) {
+
+        while (*s && used + DAV_CALENDAR_CASEFOLD_MAX_BYTES <= sizeof(buf)) {
+            used += dav_calendar_unicode_fold_char(&s, buf + used);
+        }
+
+        if (used >= casemap->len && dav_calendar_casemap_prefilter(casemap,
+                dav_calendar_octet_fold, buf, used)) {
+            return 1;
+        }
+
+        if (*s) {
+            memmove(buf, buf + used - keep, keep);
+            used = keep;
+        }
+    }
+
+    return 0;
+}
+
+int dav_calendar_text_match_octet(const char *match, const char *text)
+{
+    /* https://tools.ietf.org/html/rfc4790#section-9.3 */
+
+    /*
+     * The ordering algorithm is as follows:
+     *
+     * 1.  If both strings are the empty string, return the result "equal".
+     *
+     * 2.  If the first string is empty and the second is not, return the
+     *     result "less".
+     *
+     * 3.  If the second string is empty and the first is not, return the
+     *     result "greater".
+     *
+     * 4.  If both strings begin with the same octet value, remove the first
+     *     octet from both strings and repeat this algorithm from step 1.
+     *
+     * 5.  If the unsigned value (0 to 255) of the first octet of the first
+     *     string is less than the unsigned value of the first octet of the
+     *     second string, then return "less".
+     * 6.  If this step is reached, return "greater".
+     *
+     * The matching operation returns "match" if the sorting algorithm would
+     * return "equal".  Otherwise, the matching operation returns "no-
+     * match".
+     *
+     * The substring operation returns "match" if the first string is the
+     * empty string, or if there exists a substring of the second string of
+     * length equal to the length of the first string, which would result in
+     * a "match" result from the equality function.  Otherwise, the
+     * substring operation returns "no-match".
+     */
+
+    if (strstr((char *)text, match)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+struct icaltimetype dav_calendar_get_datetime_with_component(
+        icalproperty *prop, icalcomponent *comp)
+{
+    icalcomponent *cp;
+    icalparameter *param;
+
+    struct icaltimetype ret;
+
+    ret = icalvalue_get_datetime(icalproperty_get_value(prop));
+
+    if (icaltime_is_utc(ret)) {
+        return ret;
+    }
+
+    if ((param = icalproperty_get_first_parameter(prop, ICAL_TZID_PARAMETER)) != NULL) {
+        const char *tzid = icalparameter_get_tzid(param);
+        icaltimezone *tz = NULL;
+
+        if (!comp) {
+            comp = icalproperty_get_parent(prop);
+        }
+
+        for (cp = comp; cp; cp = icalcomponent_get_parent(cp)) {
+
+            tz = icalcomponent_get_timezone(cp, tzid);
+            if (tz) {
+                break;
+            }
+        }
+
+        if (!tz) {
+            tz = icaltimezone_get_builtin_timezone_from_tzid(tzid);
+        }
+
+        if (!tz) {
+            tz = icaltimezone_get_builtin_timezone(tzid);
+        }
+
+        if (tz) {
+            ret = icaltime_set_timezone(&ret, tz);
+        }
+    }
+
+    return ret;
+}
+
+int dav_calendar_prop_time_range(icalcomponent *comp, icalproperty *prop,
+        icaltimetype *stt, icaltimetype *ett)
+{
+
+    icaltimetype time;
+    icaltime_span test;
+    icaltime_span span;
+
+    switch (icalproperty_isa(prop)) {
+    case ICAL_DTEND_PROPERTY:
+
+        time = icalcomponent_get_dtend(comp);
+
+        break;
+    case ICAL_DUE_PROPERTY:
+
+        time = icalcomponent_get_due(comp);
+
+        break;
+    case ICAL_DTSTART_PROPERTY:
+
+        time = icalcomponent_get_dtstart(comp);
+
+        break;
+
+    case ICAL_DTSTAMP_PROPERTY:
+        time = icalcomponent_get_dtstamp(comp);
+
+        break;
+    case ICAL_COMPLETED_PROPERTY:
+    case ICAL_CREATED_PROPERTY:
+    case ICAL_LASTMODIFIED_PROPERTY:
+
+        time = dav_calendar_get_datetime_with_component(prop, comp);
+
+        break;
+    default:
+        time = icaltime_null_time();
+    }
+
+    test = icaltime_span_new(time, time, 0);
+    span = icaltime_span_new(*stt, *ett, 0);
+
+    if (icalproperty_recurrence_is_excluded(comp, &time, &time) ||
+            icaltime_span_overlaps(&test, &span)) {
+
+        /* we have a match! */
+        return 1;
+
+    }
+
+    return 0;
+}
+
+/*
+ * Find the nth property of the given kind. The property iterator of the
+ * component is shared with icalproperty_recurrence_is_excluded(), so we
+ * cannot hold it across the expansion of a rule.
+ */
+static icalproperty *dav_calendar_nth_property(icalcomponent *comp,
+        icalproperty_kind kind, int n)
+{
+    icalproperty *prop;
+
+    for (prop = icalcomponent_get_first_property(comp, kind); prop && n--;
+            prop = icalcomponent_get_next_property(comp, kind));
+
+    return prop;
+}
+
+static time_t dav_calendar_instance_timet(icaltimetype t)
+{
+    return icaltime_as_timet_with_zone(t,
+            t.zone ? t.zone : icaltimezone_get_utc_timezone());
+}
+
+int dav_calendar_recurrence_walk(icalcomponent *comp,
+        icaltimetype start, icaltimetype end,
+        dav_calendar_instance_fn fn, void *baton)
+{
+    icaltimetype dtstart, dtend;
+    icaltime_span base, span, limit;
+    time_t duration;
+    icalproperty *prop;
+    int i, ret;
+
+    dtstart = icalcomponent_get_dtstart(comp);
+    if (icaltime_is_null_time(dtstart)) {
+        return 0;
+    }
+
+    /* DTEND, DUE or DTSTART+DURATION */
+    dtend = icalcomponent_get_dtend(comp);
+
+    base = icaltime_span_new(dtstart, dtend, 1);
+    base.start = dav_calendar_instance_timet(dtstart);
+    duration = base.end - base.start;
+
+    limit.start = icaltime_as_timet_with_zone(start,
+            icaltimezone_get_utc_timezone());
+    limit.end = icaltime_as_timet_with_zone(end,
+            icaltimezone_get_utc_timezone());
+    limit.is_busy = 0;
+
+    /* the first instance */
+    if (!icalproperty_recurrence_is_excluded(comp, &dtstart, &dtstart)
+            && icaltime_span_overlaps(&base, &limit)
+            && (ret = fn(comp, &dtstart, &base, baton))) {
+        return ret;
+    }
+
+    for (i = 0; (prop = dav_calendar_nth_property(comp, ICAL_RRULE_PROPERTY,
+            i)); i++) {
+        struct icalrecurrencetype recur = icalproperty_get_rrule(prop);
+        icalrecur_iterator *ritr = icalrecur_iterator_new(recur, dtstart);
+        icaltimetype next;
+
+        if (!ritr) {
+            continue;
+        }
+
+#if defined(ICAL_MAJOR_VERSION) && ICAL_MAJOR_VERSION >= 3
+        /* skip ahead to the window, counted rules must be walked in full */
+        if (!recur.count) {
+            icaltimetype from = start;
+
+            /* an instance starting before the window can end inside it */
+            icaltime_adjust(&from, 0, 0, 0, -(int)duration);
+            icalrecur_iterator_set_start(ritr, from);
+        }
+#endif
+
+        while (!icaltime_is_null_time(next = icalrecur_iterator_next(ritr))) {
+
+            /* instances are in order, nothing more can overlap */
+            if (icaltime_compare(next, end) > 0) {
+                break;
+            }
+
+            /* the first instance was handled above */
+            if (!icaltime_compare(next, dtstart)) {
+                continue;
+            }
+
+            span = base;
+            span.start = dav_calendar_instance_timet(next);
+            span.end = span.start + duration;
+
+            if (!icalproperty_recurrence_is_excluded(comp, &dtstart, &next)
+                    && icaltime_span_overlaps(&span, &limit)
+                    && (ret = fn(comp, &next, &span, baton))) {
+                icalrecur_iterator_free(ritr);
+                return ret;
+            }
+        }
+
+        icalrecur_iterator_free(ritr);
+    }
+
+    for (i = 0; (prop = dav_calendar_nth_property(comp, ICAL_RDATE_PROPERTY,
+            i)); i++) {
+        struct icaldatetimeperiodtype rdate = icalproperty_get_rdate(prop);
+
+        /* only date-time RDATEs, as for icalcomponent_foreach_recurrence() */
+        if (icaltime_is_null_time(rdate.time)) {
+            continue;
+        }
+
+        span = base;
+        span.start = dav_calendar_instance_timet(rdate.time);
+        span.end = span.start + duration;
+
+        if (!icalproperty_recurrence_is_excluded(comp, &dtstart, &rdate.time)
+                && icaltime_span_overlaps(&span, &limit)
+                && (ret = fn(comp, &rdate.time, &span, baton))) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
+static int dav_calendar_overlaps_fn(icalcomponent *comp,
+        icaltimetype *instance, const icaltime_span *span, void *baton)
+{
+    /* we have a match, stop here */
+    return 1;
+}
+
+int dav_calendar_recurrence_overlaps(icalcomponent *comp,
+        icaltimetype start, icaltimetype end)
+{
+    return dav_calendar_recurrence_walk(comp, start, end,
+            dav_calendar_overlaps_fn, NULL);
+}
+
+typedef struct dav_calendar_spans_baton {
+    icaltime_span *spans;
+    int nelts;
+    int max;
+} dav_calendar_spans_baton;
+
+static int dav_calendar_spans_fn(icalcomponent *comp,
+        icaltimetype *instance, const icaltime_span *span, void *baton)
+{
+    dav_calendar_spans_baton *b = baton;
+
+    if (b->nelts == b->max) {
+        /* too many, give up */
+        return 1;
+    }
+    b->spans[b->nelts++] = *span;
+
+    return 0;
+}
+
+static int dav_calendar_span_cmp(const void *a, const void *b)
+{
+    const icaltime_span *sa = a, *sb = b;
+
+    return sa->start < sb->start ? -1 : sa->start > sb->start;
+}
+
+int dav_calendar_recurrence_spans(icalcomponent *comp,
+        icaltimetype start, icaltimetype end, icaltime_span *spans, int max)
+{
+    dav_calendar_spans_baton b;
+
+    b.spans = spans;
+    b.nelts = 0;
+    b.max = max;
+
+    if (dav_calendar_recurrence_walk(comp, start, end,
+            dav_calendar_spans_fn, &b)) {
+        return -1;
+    }
+
+    qsort(spans, b.nelts, sizeof(icaltime_span), dav_calendar_span_cmp);
+
+    return b.nelts;
+}
+
+int dav_calendar_spans_overlap(const icaltime_span *spans, int nelts,
+        icaltimetype start, icaltimetype end)
+{
+    icaltime_span limit;
+    int i;
+
+    limit.start = icaltime_as_timet_with_zone(start,
+            icaltimezone_get_utc_timezone());
+    limit.end = icaltime_as_timet_with_zone(end,
+            icaltimezone_get_utc_timezone());
+    limit.is_busy = 0;
+
+    for (i = 0; i < nelts && spans[i].start <= limit.end; i++) {
+        if (icaltime_span_overlaps((icaltime_span *)&spans[i], &limit)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int dav_calendar_comp_time_range(icalcomponent *comp,
+        icaltimetype *stt, icaltimetype *ett)
+{
+    int match = 0;
+
+    switch (icalcomponent_isa(comp)) {
+
+    case ICAL_VEVENT_COMPONENT: {
+
+        /*
+         * A VEVENT component overlaps a given time range if the condition
+         * for the corresponding component state specified in the table below
+         * is satisfied.  Note that, as specified in [RFC2445], the DTSTART
+         * property is REQUIRED in the VEVENT component.  The conditions
+         * depend on the presence of the DTEND and DURATION properties in the
+         * VEVENT component.  Furthermore, the value of the DTEND property
+         *
+         * MUST be later in time than the value of the DTSTART property.  The
+         * duration of a VEVENT component with no DTEND and DURATION
+         * properties is 1 day (+P1D) when the DTSTART is a DATE value, and 0
+         * seconds when the DTSTART is a DATE-TIME value.
+         *
+         * +---------------------------------------------------------------+
+         * | VEVENT has the DTEND property?                                |
+         * |   +-----------------------------------------------------------+
+         * |   | VEVENT has the DURATION property?                         |
+         * |   |   +-------------------------------------------------------+
+         * |   |   | DURATION property value is greater than 0 seconds?    |
+         * |   |   |   +---------------------------------------------------+
+         * |   |   |   | DTSTART property is a DATE-TIME value?            |
+         * |   |   |   |   +-----------------------------------------------+
+         * |   |   |   |   | Condition to evaluate                         |
+         * +---+---+---+---+-----------------------------------------------+
+         * | Y | N | N | * | (start <  DTEND AND end > DTSTART)            |
+         * +---+---+---+---+-----------------------------------------------+
+         * | N | Y | Y | * | (start <  DTSTART+DURATION AND end > DTSTART) |
+         * |   |   +---+---+-----------------------------------------------+
+         * |   |   | N | * | (start <= DTSTART AND end > DTSTART)          |
+         * +---+---+---+---+-----------------------------------------------+
+         * | N | N | N | Y | (start <= DTSTART AND end > DTSTART)          |
+         * +---+---+---+---+-----------------------------------------------+
+         * | N | N | N | N | (start <  DTSTART+P1D AND end > DTSTART)      |
+         * +---+---+---+---+-----------------------------------------------+
+         */
+
+        match = dav_calendar_recurrence_overlaps(comp, *stt, *ett);
+
+        break;
+    }
+    case ICAL_VTODO_COMPONENT: {
+
+        /*
+         * A VTODO component is said to overlap a given time range if the
+         * condition for the corresponding component state specified in the
+         * table below is satisfied.  The conditions depend on the presence
+         * of the DTSTART, DURATION, DUE, COMPLETED, and CREATED properties
+         * in the VTODO component.  Note that, as specified in [RFC2445], the
+         * DUE value MUST be a DATE-TIME value equal to or after the DTSTART
+         * value if specified.
+         *
+         * +-------------------------------------------------------------------+
+         * | VTODO has the DTSTART property?                                   |
+         * |   +---------------------------------------------------------------+
+         * |   |   VTODO has the DURATION property?                            |
+         * |   |   +-----------------------------------------------------------+
+         * |   |   | VTODO has the DUE property?                               |
+         * |   |   |   +-------------------------------------------------------+
+         * |   |   |   | VTODO has the COMPLETED property?                     |
+         * |   |   |   |   +---------------------------------------------------+
+         * |   |   |   |   | VTODO has the CREATED property?                   |
+         * |   |   |   |   |   +-----------------------------------------------+
+         * |   |   |   |   |   | Condition to evaluate                         |
+         * +---+---+---+---+---+-----------------------------------------------+
+         * | Y | Y | N | * | * | (start  <= DTSTART+DURATION)  AND             |
+         * |   |   |   |   |   | ((end   >  DTSTART)  OR                       |
+         * |   |   |   |   |   |  (end   >= DTSTART+DURATION))                 |
+         * +---+---+---+---+---+-----------------------------------------------+
+         * | Y | N | Y | * | * | ((start <  DUE)      OR  (start <= DTSTART))  |
+         * |   |   |   |   |   | AND                                           |
+         * |   |   |   |   |   | ((end   >  DTSTART)  OR  (end   >= DUE))      |
+         * +---+---+---+---+---+-----------------------------------------------+
+         * | Y | N | N | * | * | (start  <= DTSTART)  AND (end >  DTSTART)     |
+         * +---+---+---+---+---+-----------------------------------------------+
+         * | N | N | Y | * | * | (start  <  DUE)      AND (end >= DUE)         |
+         * +---+---+---+---+---+-----------------------------------------------+
+         * | N | N | N | Y | Y | ((start <= CREATED)  OR  (start <= COMPLETED))|
+         * |   |   |   |   |   | AND                                           |
+         * |   |   |   |   |   | ((end   >= CREATED)  OR  (end   >= COMPLETED))|
+         * +---+---+---+---+---+-----------------------------------------------+
+         * | N | N | N | Y | N | (start  <= COMPLETED) AND (end  >= COMPLETED) |
+         * +---+---+---+---+---+-----------------------------------------------+
+         * | N | N | N | N | Y | (end    >  CREATED)                           |
+         * +---+---+---+---+---+-----------------------------------------------+
+         * | N | N | N | N | N | TRUE                                          |
+         * +---+---+---+---+---+-----------------------------------------------+
+         */
+
+        match = dav_calendar_recurrence_overlaps(comp, *stt, *ett);
+
+        break;
+    }
+    case ICAL_VJOURNAL_COMPONENT: {
+
+        /*
+         * A VJOURNAL component overlaps a given time range if the condition
+         * for the corresponding component state specified in the table below
+         * is satisfied.  The conditions depend on the presence of the
+         * DTSTART property in the VJOURNAL component and on whether the
+         * DTSTART is a DATE-TIME or DATE value.  The effective "duration" of
+         * a VJOURNAL component is 1 day (+P1D) when the DTSTART is a DATE
+         * value, and 0 seconds when the DTSTART is a DATE-TIME value.
+         *
+         * +----------------------------------------------------+
+         * | VJOURNAL has the DTSTART property?                 |
+         * |   +------------------------------------------------+
+         * |   | DTSTART property is a DATE-TIME value?         |
+         * |   |   +--------------------------------------------+
+         * |   |   | Condition to evaluate                      |
+         * +---+---+--------------------------------------------+
+         * | Y | Y | (start <= DTSTART)     AND (end > DTSTART) |
+         * +---+---+--------------------------------------------+
+         * | Y | N | (start <  DTSTART+P1D) AND (end > DTSTART) |
+         * +---+---+--------------------------------------------+
+         * | N | * | FALSE                                      |
+         * +---+---+--------------------------------------------+
+         */
+        icaltime_span span = icalcomponent_get_span(comp);
+        icaltime_span limit = icaltime_span_new(*stt, *ett, 1);
+
+        if (icaltime_span_overlaps(&span, &limit)) {
+
+            /* we have a match! */
+            match = 1;
+
+        }
+
+        break;
+    }
+    case ICAL_VFREEBUSY_COMPONENT: {
+
+        /*
+         * A VFREEBUSY component overlaps a given time range if the condition
+         * for the corresponding component state specified in the table below
+         * is satisfied.  The conditions depend on the presence in the
+         * VFREEBUSY component of the DTSTART and DTEND properties, and any
+         * FREEBUSY properties in the absence of DTSTART and DTEND.  Any
+         * DURATION property is ignored, as it has a special meaning when
+         * used in a VFREEBUSY component.
+         *
+         * When only FREEBUSY properties are used, each period in each
+         * FREEBUSY property is compared against the time range, irrespective
+         * of the type of free busy information (free, busy, busy-tentative,
+         * busy-unavailable) represented by the property.
+         *
+         *
+         * +------------------------------------------------------+
+         * | VFREEBUSY has both the DTSTART and DTEND properties? |
+         * |   +--------------------------------------------------+
+         * |   | VFREEBUSY has the FREEBUSY property?             |
+         * |   |   +----------------------------------------------+
+         * |   |   | Condition to evaluate                        |
+         * +---+---+----------------------------------------------+
+         * | Y | * | (start <= DTEND) AND (end > DTSTART)         |
+         * +---+---+----------------------------------------------+
+         * | N | Y | (start <  freebusy-period-end) AND           |
+         * |   |   | (end   >  freebusy-period-start)             |
+         * +---+---+----------------------------------------------+
+         * | N | N | FALSE                                        |
+         * +---+---+----------------------------------------------+
+         */
+        icaltime_span span = icalcomponent_get_span(comp);
+        icaltime_span limit = icaltime_span_new(*stt, *ett, 1);
+
+        if (icaltime_span_overlaps(&span, &limit)) {
+
+            /* we have a match! */
+            match = 1;
+
+        }
+
+        break;
+    }
+    case ICAL_VALARM_COMPONENT: {
+
+        /*
+         * A VALARM component is said to overlap a given time range if the
+         * following condition holds:
+         *
+         *    (start <= trigger-time) AND (end > trigger-time)
+         *
+         * A VALARM component can be defined such that it triggers repeatedly.
+         * Such a VALARM component is said to overlap a given time range if at
+         * least one of its triggers overlaps the time range.
+         */
+        icalproperty *prop;
+        struct icaltriggertype tr;
+        struct icaldurationtype duration = icaldurationtype_null_duration();
+        int repeat = 1;
+
+        if ((prop = icalcomponent_get_first_property(comp,
+                ICAL_TRIGGER_PROPERTY))) {
+
+            tr = icalproperty_get_trigger(prop);;
+
+            if (!icaltime_is_null_time(tr.time)) {
+
+                /* simple time value - direct comparison */
+
+                icaltime_span span = icaltime_span_new(tr.time, tr.time, 1);
+                icaltime_span limit = icaltime_span_new(*stt, *ett, 1);
+
+                if (icaltime_span_overlaps(&span, &limit)) {
+
+                    /* we have a match! */
+                    match = 1;
+
+                }
+
+
+            }
+            else {
+
+                /* this is fun - relative to the parent then */
+
+                icaltimetype st = *stt;
+                icaltimetype et = *ett;
+
+                if ((prop = icalcomponent_get_first_property(comp,
+                        ICAL_DURATION_PROPERTY))) {
+                    duration = icalproperty_get_duration(prop);
+                }
+
+                if ((prop = icalcomponent_get_first_property(comp,
+                        ICAL_REPEAT_PROPERTY))) {
+                    repeat = icalproperty_get_repeat(prop) + 1;
+                }
+
+                icaltime_adjust(&st, 0, 0, 0,
+                        icaldurationtype_as_int(duration) * repeat);
+                icaltime_adjust(&et, 0, 0, 0,
+                        icaldurationtype_as_int(duration) * repeat);
+
+                match = dav_calendar_recurrence_overlaps(
+                        icalcomponent_get_parent(comp), st, et);
+
+            }
+
+        }
+
+        break;
+    }
+    default:
+        break;
+    }
+
+    /*
+     * The calendar properties COMPLETED, CREATED, DTEND, DTSTAMP,
+     * DTSTART, DUE, and LAST-MODIFIED overlap a given time range if the
+     * following condition holds:
+     *
+     *     (start <= date-time) AND (end > date-time)
+     *
+     * Note that if DTEND is not present in a VEVENT, but DURATION is, then
+     * the test should instead operate on the 'effective' DTEND, i.e.,
+     * DTSTART+DURATION.  Similarly, if DUE is not present in a VTODO, but
+     * DTSTART and DURATION are, then the test should instead operate on the
+     * 'effective' DUE, i.e., DTSTART+DURATION.
+     *
+     * The semantic of CALDAV:time-range is not defined for any other
+     * calendar components and properties.
+     */
+
+    return match;
+}
+
+/*
+ * Free busy time.
+ *
+ * Busy time is gathered from VEVENT and VFREEBUSY components as periods
+ * tagged with their FBTYPE and clipped to the time range. Periods from
+ * any number of calendars can then be sorted by FBTYPE and start, and
+ * the overlapping periods of each FBTYPE merged in a single pass.
+ */
+
+typedef struct dav_calendar_busy_override {
+    const char *uid;
+    time_t recurrence_id;
+} dav_calendar_busy_override;
+
+typedef struct dav_calendar_busy_baton {
+    dav_calendar_busy *busy;
+    int nelts;
+    int max;
+    time_t start;
+    time_t end;
+    icalparameter_fbtype fbtype;
+    const char *uid;
+    const dav_calendar_busy_override *overrides;
+    int noverrides;
+} dav_calendar_busy_baton;
+
+static void dav_calendar_busy_add(dav_calendar_busy_baton *b, time_t start,
+        time_t end, icalparameter_fbtype fbtype)
+{
+    if (start < b->start) {
+        start = b->start;
+    }
+    if (end > b->end) {
+        end = b->end;
+    }
+
+    /* nothing left, or a moment in time that takes up no time */
+    if (start >= end) {
+        return;
+    }
+
+    if (b->nelts < b->max) {
+        b->busy[b->nelts].start = start;
+        b->busy[b->nelts].end = end;
+        b->busy[b->nelts].fbtype = fbtype;
+    }
+    b->nelts++;
+}
+
+/*
+ * The FBTYPE of a VEVENT, as derived from the TRANSP and STATUS
+ * properties in the table in RFC4791 section 7.10.
+ */
+static icalparameter_fbtype dav_calendar_busy_fbtype(icalcomponent *comp)
+{
+    icalproperty *prop;
+
+    prop = icalcomponent_get_first_property(comp, ICAL_TRANSP_PROPERTY);
+    if (prop && icalproperty_get_transp(prop) != ICAL_TRANSP_OPAQUE
+            && icalproperty_get_transp(prop) != ICAL_TRANSP_OPAQUENOCONFLICT) {
+        return ICAL_FBTYPE_FREE;
+    }
+
+    switch (icalcomponent_get_status(comp)) {
+    case ICAL_STATUS_CANCELLED:
+        return ICAL_FBTYPE_FREE;
+    case ICAL_STATUS_TENTATIVE:
+        return ICAL_FBTYPE_BUSYTENTATIVE;
+    default:
+        return ICAL_FBTYPE_BUSY;
+    }
+}
+
+static int dav_calendar_busy_fn(icalcomponent *comp,
+        icaltimetype *instance, const icaltime_span *span, void *baton)
+{
+    dav_calendar_busy_baton *b = baton;
+    int i;
+
+    /* overridden instances are counted as the override says */
+    if (b->noverrides && b->uid) {
+        time_t recurrence_id = dav_calendar_instance_timet(*instance);
+
+        for (i = 0; i < b->noverrides; i++) {
+            if (b->overrides[i].recurrence_id == recurrence_id
+                    && !strcmp(b->overrides[i].uid, b->uid)) {
+                return 0;
+            }
+        }
+    }
+
+    dav_calendar_busy_add(b, span->start, span->end, b->fbtype);
+
+    return 0;
+}
+
+static void dav_calendar_busy_freebusy(dav_calendar_busy_baton *b,
+        icalcomponent *comp)
+{
+    icalproperty *prop;
+
+    for (prop = icalcomponent_get_first_property(comp, ICAL_FREEBUSY_PROPERTY);
+            prop; prop = icalcomponent_get_next_property(comp,
+                    ICAL_FREEBUSY_PROPERTY)) {
+        struct icalperiodtype period = icalproperty_get_freebusy(prop);
+        icalparameter *param = icalproperty_get_first_parameter(prop,
+                ICAL_FBTYPE_PARAMETER);
+        icalparameter_fbtype fbtype = param ? icalparameter_get_fbtype(param)
+                : ICAL_FBTYPE_BUSY;
+        time_t start;
+
+        if (fbtype == ICAL_FBTYPE_FREE) {
+            continue;
+        }
+
+        start = dav_calendar_instance_timet(period.start);
+
+        dav_calendar_busy_add(b, start, icaltime_is_null_time(period.end)
+                ? start + icaldurationtype_as_int(period.duration)
+                : dav_calendar_instance_timet(period.end), fbtype);
+    }
+}
+
+int dav_calendar_busy_collect(icalcomponent *comp,
+        icaltimetype start, icaltimetype end, dav_calendar_busy *busy, int max)
+{
+    dav_calendar_busy_baton b = { 0 };
+    dav_calendar_busy_override *overrides = NULL;
+    icalcomponent *cp, *calendar = NULL;
+    int n = 0;
+
+    b.busy = busy;
+    b.max = max;
+    b.start = icaltime_as_timet_with_zone(start,
+            icaltimezone_get_utc_timezone());
+    b.end = icaltime_as_timet_with_zone(end,
+            icaltimezone_get_utc_timezone());
+
+    if (icalcomponent_isa(comp) == ICAL_VCALENDAR_COMPONENT) {
+        calendar = comp;
+        comp = icalcomponent_get_first_component(calendar,
+                ICAL_ANY_COMPONENT);
+    }
+
+    /* note the overridden instances, they replace the master's instance */
+    if (calendar) {
+        for (cp = comp; cp; cp = icalcomponent_get_next_component(calendar,
+                ICAL_ANY_COMPONENT)) {
+            if (icalcomponent_isa(cp) == ICAL_VEVENT_COMPONENT
+                    && icalcomponent_get_first_property(cp,
+                            ICAL_RECURRENCEID_PROPERTY)) {
+                n++;
+            }
+        }
+
+        if (n && !(overrides = malloc(n * sizeof(*overrides)))) {
+            return -1;
+        }
+
+        if (n) {
+            for (cp = icalcomponent_get_first_component(calendar,
+                    ICAL_VEVENT_COMPONENT); cp;
+                    cp = icalcomponent_get_next_component(calendar,
+                            ICAL_VEVENT_COMPONENT)) {
+                if (icalcomponent_get_first_property(cp,
+                        ICAL_RECURRENCEID_PROPERTY)) {
+                    overrides[b.noverrides].uid = icalcomponent_get_uid(cp);
+                    overrides[b.noverrides++].recurrence_id =
+                            dav_calendar_instance_timet(
+                                    icalcomponent_get_recurrenceid(cp));
+                }
+            }
+            b.overrides = overrides;
+        }
+
+        comp = icalcomponent_get_first_component(calendar,
+                ICAL_ANY_COMPONENT);
+    }
+
+    for (cp = comp; cp; cp = calendar ? icalcomponent_get_next_component(
+            calendar, ICAL_ANY_COMPONENT) : NULL) {
+
+        switch (icalcomponent_isa(cp)) {
+        case ICAL_VEVENT_COMPONENT:
+
+            b.fbtype = dav_calendar_busy_fbtype(cp);
+            if (b.fbtype == ICAL_FBTYPE_FREE) {
+                break;
+            }
+
+            b.uid = icalcomponent_get_first_property(cp,
+                    ICAL_RECURRENCEID_PROPERTY) || !icalcomponent_get_uid(cp)
+                    ? NULL : icalcomponent_get_uid(cp);
+
+            dav_calendar_recurrence_walk(cp, start, end,
+                    dav_calendar_busy_fn, &b);
+
+            break;
+        case ICAL_VFREEBUSY_COMPONENT:
+
+            dav_calendar_busy_freebusy(&b, cp);
+
+            break;
+        default:
+            break;
+        }
+    }
+
+    free(overrides);
+
+    return b.nelts;
+}
+
+static int dav_calendar_busy_cmp(const void *a, const void *b)
+{
+    const dav_calendar_busy *ba = a, *bb = b;
+
+    if (ba->fbtype != bb->fbtype) {
+        return ba->fbtype < bb->fbtype ? -1 : 1;
+    }
+
+    return ba->start < bb->start ? -1 : ba->start > bb->start;
+}
+
+int dav_calendar_busy_merge(dav_calendar_busy *busy, int nelts)
+{
+    int i, n = 0;
+
+    if (nelts < 2) {
+        return nelts;
+    }
+
+    qsort(busy, nelts, sizeof(dav_calendar_busy), dav_calendar_busy_cmp);
+
+    for (i = 1; i < nelts; i++) {
+        if (busy[i].fbtype == busy[n].fbtype
+                && busy[i].start <= busy[n].end) {
+            if (busy[i].end > busy[n].end) {
+                busy[n].end = busy[i].end;
+            }
+        }
+        else {
+            busy[++n] = busy[i];
+        }
+    }
+
+    return n + 1;
+}
@@ -0,0 +1,184 @@
+/* Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * The matching kernels used to evaluate calendar-query filters.
+ */
+
+#ifndef DAV_CALENDAR_MATCH_H
+#define DAV_CALENDAR_MATCH_H
+
+#include <libical/ical.h>
+
+#include <stddef.h>
+
+/*
+ * A match string compiled for the i;ascii-casemap collation.
+ *
+ * The match is folded to upper case once, and a shift table is kept
+ * for the scalar search.
+ */
+typedef struct dav_calendar_casemap {
+    const unsigned char *match;
+    size_t len;
+    unsigned char skip[256];
+} dav_calendar_casemap;
+
+/*
+ * Return the number of bytes of memory needed to compile the match.
+ */
+size_t dav_calendar_casemap_size(const char *match);
+
+/*
+ * Compile the match into the memory given, which must be at least
+ * dav_calendar_casemap_size() bytes long.
+ */
+dav_calendar_casemap *dav_calendar_casemap_compile(void *mem,
+        const char *match);
+
+/*
+ * Substring match of the compiled match within text, using the
+ * i;ascii-casemap collation. Returns non zero on a match.
+ */
+int dav_calendar_text_match_ascii_casecmp(const dav_calendar_casemap *casemap,
+        const char *text);
+
+/*
+ * Return the number of bytes of memory needed to compile the match for
+ * the i;unicode-casemap collation.
+ */
+size_t dav_calendar_unicode_casemap_size(const char *match);
+
+/*
+ * Compile the match for the i;unicode-casemap collation into the memory
+ * given, which must be at least dav_calendar_unicode_casemap_size()
+ * bytes long.
+ */
+dav_calendar_casemap *dav_calendar_unicode_casemap_compile(void *mem,
+        const char *match);
+
+/*
+ * Substring match of the compiled match within text, using the
+ * i;unicode-casemap collation defined in RFC5051. Returns non zero on
+ * a match.
+ */
+int dav_calendar_text_match_unicode_casemap(
+        const dav_calendar_casemap *casemap, const char *text);
+
+/*
+ * Return the number of bytes needed to hold a string of len bytes once
+ * folded by dav_calendar_unicode_fold(), including the terminator.
+ */
+size_t dav_calendar_unicode_fold_size(size_t len);
+
+/*
+ * Fold the string as defined by the i;unicode-casemap collation, writing
+ * the terminated result to out. Returns the length of the result.
+ */
+size_t dav_calendar_unicode_fold(const char *in, char *out);
+
+/*
+ * Substring match of match within text, using the i;octet collation.
+ * Returns non zero on a match.
+ */
+int dav_calendar_text_match_octet(const char *match, const char *text);
+
+/*
+ * Return the date-time value of the property, with the timezone named
+ * by any TZID parameter looked up in comp, its parents, or the builtin
+ * timezones. If comp is NULL the parent of the property is used.
+ */
+struct icaltimetype dav_calendar_get_datetime_with_component(
+        icalproperty *prop, icalcomponent *comp);
+
+/*
+ * Does the date-time property of comp overlap the time range? Returns
+ * non zero on a match.
+ */
+int dav_calendar_prop_time_range(icalcomponent *comp, icalproperty *prop,
+        icaltimetype *stt, icaltimetype *ett);
+
+/*
+ * Called for each instance of a recurring component, with the start of
+ * the instance and the span it covers. Return non zero to stop.
+ */
+typedef int (*dav_calendar_instance_fn)(icalcomponent *comp,
+        icaltimetype *instance, const icaltime_span *span, void *baton);
+
+/*
+ * Call fn for each instance of the component that overlaps the time
+ * range, in the manner of icalcomponent_foreach_recurrence(), stopping
+ * as soon as fn returns non zero. Returns the value fn returned, or zero.
+ */
+int dav_calendar_recurrence_walk(icalcomponent *comp,
+        icaltimetype start, icaltimetype end,
+        dav_calendar_instance_fn fn, void *baton);
+
+/*
+ * Does any instance of the component overlap the time range? Expansion
+ * stops at the first instance that does.
+ */
+int dav_calendar_recurrence_overlaps(icalcomponent *comp,
+        icaltimetype start, icaltimetype end);
+
+/*
+ * Fill spans with the spans of the instances of the component that
+ * overlap the time range, sorted by start. Returns the number of spans,
+ * or -1 if there are more than max.
+ */
+int dav_calendar_recurrence_spans(icalcomponent *comp,
+        icaltimetype start, icaltimetype end, icaltime_span *spans, int max);
+
+/*
+ * Does any of the spans, as returned by dav_calendar_recurrence_spans()
+ * for an enclosing time range, overlap the time range?
+ */
+int dav_calendar_spans_overlap(const icaltime_span *spans, int nelts,
+        icaltimetype start, icaltimetype end);
+
+/*
+ * Does the component, or any instance of it, overlap the time range as
+ * defined by RFC4791 section 9.9? Returns non zero on a match.
+ */
+int dav_calendar_comp_time_range(icalcomponent *comp,
+        icaltimetype *stt, icaltimetype *ett);
+
+/*
+ * A period of busy time, and its FBTYPE.
+ */
+typedef struct dav_calendar_busy {
+    time_t start;
+    time_t end;
+    icalparameter_fbtype fbtype;
+} dav_calendar_busy;
+
+/*
+ * Gather the busy time of the calendar, or of a single component, within
+ * the time range as defined by RFC4791 section 7.10, clipped to the time
+ * range. Up to max periods are written to busy, the return value is the
+ * number of periods found, which may be more than max, or -1 if memory
+ * could not be allocated.
+ */
+int dav_calendar_busy_collect(icalcomponent *comp,
+        icaltimetype start, icaltimetype end, dav_calendar_busy *busy, int max);
+
+/*
+ * Sort the periods by FBTYPE and start, and merge the overlapping and
+ * adjoining periods of each FBTYPE. Returns the number of periods left.
+ */
+int dav_calendar_busy_merge(dav_calendar_busy *busy, int nelts);
+
+#endif /* DAV_CALENDAR_MATCH_H */
@@ -99,6 +99,14 @@
 #include "apr_sha1.h"
 #include "apr_encode.h"
 #include "apr_tables.h"
+#include "apr_dbm.h"
+#include "apr_hash.h"
+#include "apr_ring.h"
+#include "apr_thread_mutex.h"
+#include "apr_thread_cond.h"
+#include "apr_thread_pool.h"
+#include "apr_global_mutex.h"
+#include "apr_shm.h"
 
 #include "httpd.h"
 #include "http_config.h"
@@ -107,6 +115,10 @@
 #include "http_protocol.h"
 #include "http_request.h"
 #include "util_script.h"
+#include "util_mutex.h"
+#include "ap_provider.h"
+#include "ap_socache.h"
+#include "mod_status.h"
 
 #include <libical/ical.h>
 
@@ -119,6 +131,12 @@
 #undef PACKAGE_VERSION
 #include "config.h"
 
+#include "dav_calendar_match.h"
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
 module AP_MODULE_DECLARE_DATA dav_calendar_module;
 
 typedef struct
@@ -126,11 +144,29 @@ typedef struct
     unsigned int dav_calendar_set :1;
     unsigned int dav_calendar_timezone_set :1;
     unsigned int max_resource_size_set :1;
+    unsigned int index_db_set :1;
+    unsigned int stream_set :1;
+    unsigned int journal_db_set :1;
+    unsigned int feed_cache_set :1;
+    unsigned int feed_cache_max_age_set :1;
+    unsigned int direct_read_set :1;
+    unsigned int max_instances_set :1;
+    unsigned int multiget_batch_set :1;
+    unsigned int server_timing_set :1;
     apr_array_header_t *dav_calendar_homes;
     apr_array_header_t *dav_calendar_provisions;
     const char *dav_calendar_timezone;
+    const char *index_db;
+    const char *journal_db;
+    const char *feed_cache;
+    apr_interval_time_t feed_cache_max_age;
     apr_off_t max_resource_size;
+    int max_instances;
     int dav_calendar;
+    int stream;
+    int direct_read;
+    int multiget_batch;
+    int server_timing;
 
 } dav_calendar_config_rec;
 
@@ -147,14 +183,52 @@ typedef struct {
 
 typedef struct
 {
+    unsigned int cache_size_set :1;
+    unsigned int parse_threads_set :1;
+    unsigned int provision_timeout_set :1;
+    unsigned int metrics_set :1;
     apr_array_header_t *aliases;
+    struct dav_calendar_alias_index *alias_index;
+    apr_size_t cache_size;
+    apr_interval_time_t provision_timeout;
+    int parse_threads;
+    int metrics;
 } dav_calendar_server_rec;
 
+typedef enum {
+    DAV_CALENDAR_PHASE_LOCKDB,
+    DAV_CALENDAR_PHASE_WALK,
+    DAV_CALENDAR_PHASE_READ,
+    DAV_CALENDAR_PHASE_PARSE,
+    DAV_CALENDAR_PHASE_FILTER,
+    DAV_CALENDAR_PHASE_SERIALISE,
+    DAV_CALENDAR_PHASE_SEND,
+    DAV_CALENDAR_PHASE_MAX
+} dav_calendar_phase;
+
+typedef struct
+{
+    struct dav_calendar_filter_plan *plan;
+    struct dav_calendar_prefetch *prefetch;
+    /* a precondition of the report failed while building a response */
+    dav_error *err;
+    /* the outcome of the access checks of each collection, by URI */
+    apr_hash_t *access;
+    /* the metrics counted so far, added to the totals at the end */
+    struct dav_calendar_counts *counts;
+    /* the line buffer of the parse filter, one resource is read at a time */
+    char *line;
+    apr_interval_time_t timing[DAV_CALENDAR_PHASE_MAX];
+    unsigned int timed;
+    int timing_sent;
+} dav_calendar_request_rec;
+
 /* forward-declare the hook structures */
 static const dav_hooks_liveprop dav_hooks_liveprop_calendar;
 
 #define DAV_XML_NAMESPACE "DAV:"
 #define DAV_CALENDAR_XML_NAMESPACE "urn:ietf:params:xml:ns:caldav"
+#define DAV_CALENDAR_PRIVATE_NAMESPACE "http://apache.org/dav/props/calendar/"
 
 #define DEFAULT_TIMEZONE "BEGIN:VCALENDAR\r\nVERSION:2.0\r\n" \
     "PRODID:-//Graham Leggett//" \
@@ -162,13 +236,30 @@ static const dav_hooks_liveprop dav_hooks_liveprop_calendar;
     "//EN\r\nBEGIN:VTIMEZONE\r\nTZID:UTC\r\nEND:VTIMEZONE\r\nEND:VCALENDAR\r\n"
 
 #define DEFAULT_MAX_RESOURCE_SIZE 10*1024*1024
+#define DEFAULT_MAX_INSTANCES 1000
+#define DEFAULT_PROVISION_CACHE_TIMEOUT 3600
+#define DEFAULT_FEED_CACHE_MAX_AGE 86400
+
+#define DAV_CALENDAR_STREAM_HEADER "BEGIN:VCALENDAR\r\nVERSION:2.0\r\n" \
+    "PRODID:-//Graham Leggett//" \
+    PACKAGE_STRING \
+    "//EN\r\n"
+#define DAV_CALENDAR_STREAM_TRAILER "END:VCALENDAR\r\n"
 
 #define DAV_CALENDAR_HANDLER "httpd/calendar-summary"
 
+#define DAV_CALENDAR_CHANGE_FILTER "DAV_CALENDAR_CHANGE"
+static ap_filter_rec_t *dav_calendar_change_filter_handle;
+
+/* RFC5545 says lines SHOULD be 75 octets, not MUST */
+#define DAV_CALENDAR_LINE_MAX HUGE_STRING_LEN
+
 #define DAV_CALENDAR_COLLATION_ASCII_CASEMAP "i;ascii-casemap"
 #define DAV_CALENDAR_COLLATION_OCTET "i;octet"
+#define DAV_CALENDAR_COLLATION_UNICODE_CASEMAP "i;unicode-casemap"
 
 #define DAV_CALENDAR_SKIP "mod_dav_calendar-skip"
+#define DAV_CALENDAR_ALIASED "mod_dav_calendar-aliased"
 
 /* MKCALENDAR method */
 static int iM_MKCALENDAR;
@@ -199,6 +290,298 @@ static void dav_prop_log_errors(dav_prop_ctx *ctx)
     dav_log_err(ctx->r, ctx->err, APLOG_ERR);
 }
 
+/*
+ * The metrics.
+ *
+ * When DavCalendarMetrics is on, the time taken by each operation and a
+ * handful of counters are kept in shared memory, common to all processes
+ * of the server, and reported by mod_status and by the
+ * dav-calendar-metrics handler.
+ *
+ * Times are kept in log-linear histograms: each power of two of
+ * microseconds is split into DAV_CALENDAR_METRICS_SUB equal buckets, so
+ * that the error of a quantile is bounded by a quarter of its value. The
+ * last bucket takes every time too long for the others.
+ *
+ * The 64 bit atomics of APR fall back to a mutex private to the process
+ * on some platforms, so the metrics are updated and read under the
+ * dav_calendar-metrics global mutex instead. The counters are bumped
+ * in the hottest paths, so each request keeps its own counts, and adds
+ * them to the totals once, at the end of the request.
+ */
+
+#define DAV_CALENDAR_METRICS_HANDLER "dav-calendar-metrics"
+#define DAV_CALENDAR_METRICS_MUTEX "dav_calendar-metrics"
+
+#define DAV_CALENDAR_METRICS_SUB 4
+#define DAV_CALENDAR_METRICS_BUCKETS 112
+
+typedef enum {
+    DAV_CALENDAR_OP_QUERY,
+    DAV_CALENDAR_OP_MULTIGET,
+    DAV_CALENDAR_OP_FREEBUSY,
+    DAV_CALENDAR_OP_SYNC,
+    DAV_CALENDAR_OP_GET,
+    DAV_CALENDAR_OP_MKCALENDAR,
+    DAV_CALENDAR_OP_PROVISION,
+    DAV_CALENDAR_OP_MAX
+} dav_calendar_op;
+
+static const char *dav_calendar_op_names[DAV_CALENDAR_OP_MAX] = {
+    "calendar-query",
+    "calendar-multiget",
+    "free-busy-query",
+    "sync-collection",
+    "get",
+    "mkcalendar",
+    "provision"
+};
+
+typedef enum {
+    DAV_CALENDAR_COUNT_SCANNED,
+    DAV_CALENDAR_COUNT_MATCHED,
+    DAV_CALENDAR_COUNT_BYTES_PARSED,
+    DAV_CALENDAR_COUNT_INSTANCES,
+    DAV_CALENDAR_COUNT_MAX
+} dav_calendar_count;
+
+static const char *dav_calendar_count_names[DAV_CALENDAR_COUNT_MAX] = {
+    "resources_scanned",
+    "resources_matched",
+    "bytes_parsed",
+    "instances_expanded"
+};
+
+/* what the parsed calendar cache holds, counted separately */
+typedef enum {
+    DAV_CALENDAR_CACHE_CALENDAR,
+    DAV_CALENDAR_CACHE_COLLECTION,
+    DAV_CALENDAR_CACHE_SPANS,
+    DAV_CALENDAR_CACHE_BUSY,
+    DAV_CALENDAR_CACHE_TYPE,
+    DAV_CALENDAR_CACHE_MAX
+} dav_calendar_cache_kind;
+
+static const char *dav_calendar_cache_kind_names[DAV_CALENDAR_CACHE_MAX] = {
+    "calendar",
+    "collection",
+    "spans",
+    "busy",
+    "type"
+};
+
+typedef enum {
+    DAV_CALENDAR_CACHE_HIT,
+    DAV_CALENDAR_CACHE_MISS,
+    DAV_CALENDAR_CACHE_EVICTION,
+    DAV_CALENDAR_CACHE_COUNT_MAX
+} dav_calendar_cache_count;
+
+static const char *dav_calendar_cache_count_names[DAV_CALENDAR_CACHE_COUNT_MAX] = {
+    "hits",
+    "misses",
+    "evictions"
+};
+
+typedef struct dav_calendar_histogram {
+    apr_uint64_t count;
+    apr_uint64_t total;
+    apr_uint64_t max;
+    apr_uint64_t buckets[DAV_CALENDAR_METRICS_BUCKETS];
+} dav_calendar_histogram;
+
+typedef struct dav_calendar_metrics {
+    dav_calendar_histogram ops[DAV_CALENDAR_OP_MAX];
+    apr_uint64_t counts[DAV_CALENDAR_COUNT_MAX];
+    apr_uint64_t cache[DAV_CALENDAR_CACHE_MAX][DAV_CALENDAR_CACHE_COUNT_MAX];
+} dav_calendar_metrics;
+
+typedef struct dav_calendar_counts {
+    apr_uint64_t counts[DAV_CALENDAR_COUNT_MAX];
+    apr_uint64_t cache[DAV_CALENDAR_CACHE_MAX][DAV_CALENDAR_CACHE_COUNT_MAX];
+} dav_calendar_counts;
+
+static dav_calendar_metrics *dav_calendar_metrics_global;
+static apr_global_mutex_t *dav_calendar_metrics_mutex;
+
+static dav_calendar_request_rec *dav_calendar_get_request_rec(request_rec *r);
+
+static int dav_calendar_metrics_bucket(apr_uint64_t usec)
+{
+    int shift = 0, bucket;
+
+    if (usec < DAV_CALENDAR_METRICS_SUB) {
+        return (int) usec;
+    }
+
+    while ((usec >> shift) >= 2 * DAV_CALENDAR_METRICS_SUB) {
+        shift++;
+    }
+
+    bucket = (shift + 1) * DAV_CALENDAR_METRICS_SUB
+            + (int) ((usec >> shift) - DAV_CALENDAR_METRICS_SUB);
+
+    return bucket < DAV_CALENDAR_METRICS_BUCKETS ? bucket
+            : DAV_CALENDAR_METRICS_BUCKETS - 1;
+}
+
+/*
+ * The largest time that falls in the bucket, one less than the smallest
+ * time that falls in the bucket after it. The last bucket has no bound.
+ */
+static apr_uint64_t dav_calendar_metrics_bound(int bucket)
+{
+    bucket++;
+
+    if (bucket < DAV_CALENDAR_METRICS_SUB) {
+        return bucket - 1;
+    }
+
+    return (((apr_uint64_t) (DAV_CALENDAR_METRICS_SUB
+            + bucket % DAV_CALENDAR_METRICS_SUB))
+            << (bucket / DAV_CALENDAR_METRICS_SUB - 1)) - 1;
+}
+
+static void dav_calendar_metrics_time(dav_calendar_op op, apr_time_t start)
+{
+    dav_calendar_histogram *h;
+    apr_uint64_t usec;
+    apr_time_t now;
+
+    if (!dav_calendar_metrics_global) {
+        return;
+    }
+
+    now = apr_time_now();
+    usec = now > start ? (apr_uint64_t) (now - start) : 0;
+
+    if (apr_global_mutex_lock(dav_calendar_metrics_mutex) != APR_SUCCESS) {
+        return;
+    }
+
+    h = &dav_calendar_metrics_global->ops[op];
+
+    h->count++;
+    h->total += usec;
+    h->buckets[dav_calendar_metrics_bucket(usec)]++;
+    if (usec > h->max) {
+        h->max = usec;
+    }
+
+    apr_global_mutex_unlock(dav_calendar_metrics_mutex);
+}
+
+static apr_status_t dav_calendar_metrics_flush(void *data)
+{
+    dav_calendar_counts *counts = data;
+    int i, j;
+
+    if (dav_calendar_metrics_global
+            && apr_global_mutex_lock(dav_calendar_metrics_mutex)
+            == APR_SUCCESS) {
+        for (i = 0; i < DAV_CALENDAR_COUNT_MAX; i++) {
+            dav_calendar_metrics_global->counts[i] += counts->counts[i];
+        }
+        for (i = 0; i < DAV_CALENDAR_CACHE_MAX; i++) {
+            for (j = 0; j < DAV_CALENDAR_CACHE_COUNT_MAX; j++) {
+                dav_calendar_metrics_global->cache[i][j] += counts->cache[i][j];
+            }
+        }
+        apr_global_mutex_unlock(dav_calendar_metrics_mutex);
+    }
+
+    return APR_SUCCESS;
+}
+
+/*
+ * The counts of the request, or NULL if the metrics are not kept.
+ */
+static dav_calendar_counts *dav_calendar_metrics_counts(request_rec *r)
+{
+    dav_calendar_request_rec *rconf;
+
+    if (!dav_calendar_metrics_global) {
+        return NULL;
+    }
+
+    rconf = dav_calendar_get_request_rec(r);
+    if (!rconf->counts) {
+        while (r->main) {
+            r = r->main;
+        }
+        rconf->counts = apr_pcalloc(r->pool, sizeof(dav_calendar_counts));
+        apr_pool_cleanup_register(r->pool, rconf->counts,
+                dav_calendar_metrics_flush, apr_pool_cleanup_null);
+    }
+
+    return rconf->counts;
+}
+
+static void dav_calendar_metrics_count(request_rec *r,
+        dav_calendar_count count, apr_uint64_t n)
+{
+    dav_calendar_counts *counts = dav_calendar_metrics_counts(r);
+
+    if (counts) {
+        counts->counts[count] += n;
+    }
+}
+
+static void dav_calendar_metrics_cache(request_rec *r,
+        dav_calendar_cache_kind kind, dav_calendar_cache_count count)
+{
+    dav_calendar_counts *counts = dav_calendar_metrics_counts(r);
+
+    if (counts) {
+        counts->cache[kind][count]++;
+    }
+}
+
+/*
+ * A consistent copy of the metrics, or NULL if there are none.
+ */
+static dav_calendar_metrics *dav_calendar_metrics_snapshot(request_rec *r)
+{
+    dav_calendar_metrics *m;
+
+    if (!dav_calendar_metrics_global
+            || apr_global_mutex_lock(dav_calendar_metrics_mutex)
+            != APR_SUCCESS) {
+        return NULL;
+    }
+
+    m = apr_pmemdup(r->pool, dav_calendar_metrics_global,
+            sizeof(dav_calendar_metrics));
+
+    apr_global_mutex_unlock(dav_calendar_metrics_mutex);
+
+    return m;
+}
+
+/*
+ * The time by which the given fraction of the operations had finished,
+ * to the upper bound of the bucket it falls in.
+ */
+static apr_uint64_t dav_calendar_metrics_quantile(const dav_calendar_histogram *h,
+        apr_uint64_t count, double q)
+{
+    apr_uint64_t seen = 0, want = (apr_uint64_t) (count * q);
+    int i;
+
+    if (want < 1) {
+        want = 1;
+    }
+
+    for (i = 0; i < DAV_CALENDAR_METRICS_BUCKETS - 1; i++) {
+        seen += h->buckets[i];
+        if (seen >= want) {
+            return dav_calendar_metrics_bound(i);
+        }
+    }
+
+    return h->max;
+}
+
 
 /*
 ** The namespace URIs that we use. This list and the enumeration must
@@ -207,11 +590,13 @@ static void dav_prop_log_errors(dav_prop_ctx *ctx)
 static const char * const dav_calendar_namespace_uris[] =
 {
     DAV_CALENDAR_XML_NAMESPACE,
+    DAV_XML_NAMESPACE,
 
     NULL        /* sentinel */
 };
 enum {
-    DAV_CALENDAR_URI_DAV            /* the DAV: namespace URI */
+    DAV_CALENDAR_URI_DAV,           /* the CalDAV namespace URI */
+    DAV_CALENDAR_URI_WEBDAV         /* the DAV: namespace URI */
 };
 
 enum {
@@ -231,7 +616,8 @@ enum {
     DAV_CALENDAR_PROPID_supported_calendar_component_set,
 */
     DAV_CALENDAR_PROPID_supported_calendar_data,
-    DAV_CALENDAR_PROPID_supported_collation_set
+    DAV_CALENDAR_PROPID_supported_collation_set,
+    DAV_CALENDAR_PROPID_sync_token
 };
 
 static const dav_liveprop_spec dav_calendar_props[] =
@@ -319,6 +705,12 @@ static const dav_liveprop_spec dav_calendar_props[] =
         DAV_CALENDAR_PROPID_supported_collation_set,
         0
     },
+    {
+        DAV_CALENDAR_URI_WEBDAV,
+        "sync-token",
+        DAV_CALENDAR_PROPID_sync_token,
+        0
+    },
 
     { 0 }        /* sentinel */
 };
@@ -330,6 +722,81 @@ static const dav_liveprop_group dav_calendar_liveprop_group =
     &dav_hooks_liveprop_calendar
 };
 
+typedef struct dav_calendar_index_rec {
+    const char *etag;
+    const char *uid;
+    /* component names, comma separated and comma terminated */
+    const char *kinds;
+    /* earliest start and latest end of all VEVENTs, seconds since epoch */
+    apr_int64_t start;
+    apr_int64_t end;
+    /* end of the last recurrence instance, zero when unbounded */
+    apr_int64_t recur_end;
+    int has_rrule;
+    /* start and end cover every component, usable for time-range */
+    int span_valid;
+} dav_calendar_index_rec;
+
+/*
+ * The compiled form of a calendar-query filter.
+ *
+ * The filter XML is validated and compiled once per REPORT, after which
+ * each resource is matched against the plan without touching the XML.
+ */
+enum {
+    DAV_CALENDAR_COLLATION_ID_ASCII_CASEMAP,
+    DAV_CALENDAR_COLLATION_ID_OCTET,
+    DAV_CALENDAR_COLLATION_ID_UNICODE_CASEMAP
+};
+
+typedef struct dav_calendar_text_plan {
+    const char *match;
+    /* folded match for the casemap collations, compiled once per filter */
+    dav_calendar_casemap *casemap;
+    int collation;
+    int negate;
+} dav_calendar_text_plan;
+
+typedef struct dav_calendar_param_plan {
+    struct dav_calendar_param_plan *next;
+    const char *name;
+    icalparameter_kind kind;
+    /* match on the name, for x-name and iana parameters */
+    int by_name;
+    int is_not_defined;
+    dav_calendar_text_plan *text_match;
+} dav_calendar_param_plan;
+
+typedef struct dav_calendar_prop_plan {
+    struct dav_calendar_prop_plan *next;
+    const char *name;
+    icalproperty_kind kind;
+    /* match on the name, for x-name and iana properties */
+    int by_name;
+    int is_not_defined;
+    icaltimetype *stt;
+    icaltimetype *ett;
+    dav_calendar_text_plan *text_match;
+    dav_calendar_param_plan *param_filters;
+} dav_calendar_prop_plan;
+
+typedef struct dav_calendar_comp_plan {
+    struct dav_calendar_comp_plan *next;
+    const char *name;
+    icalcomponent_kind kind;
+    int is_not_defined;
+    icaltimetype *stt;
+    icaltimetype *ett;
+    dav_calendar_prop_plan *prop_filters;
+    struct dav_calendar_comp_plan *comp_filters;
+} dav_calendar_comp_plan;
+
+typedef struct dav_calendar_filter_plan {
+    dav_calendar_comp_plan *comp_filter;
+    /* parsed CALDAV:timezone, cloned into each calendar */
+    icalcomponent *timezone;
+} dav_calendar_filter_plan;
+
 typedef struct dav_calendar_ctx {
     request_rec *r;
     apr_bucket_brigade *bb;
@@ -339,281 +806,262 @@ typedef struct dav_calendar_ctx {
     const apr_xml_doc *doc;
     const apr_xml_elem *elem;
     apr_sha1_ctx_t *sha1;
+    apr_bucket_brigade *out;
+    apr_hash_t *tzids;
+    apr_array_header_t *uris;
+    apr_array_header_t *etags;
+    const char *collection_etag;
+    /* the resource being read, for caching what we learn about it */
+    const char *uri;
+    const char *etag;
+    const dav_calendar_filter_plan *plan;
+    dav_calendar_index_rec *index;
+    icalcomponent *cache_comp;
+    apr_off_t length;
+    char *line;
+    apr_size_t line_len;
+    int line_state;
+    int calendars;
+    int cacheable;
     int ns;
     int match;
 } dav_calendar_ctx;
 
-static apr_status_t icalparser_cleanup(void *data)
+static dav_calendar_request_rec *dav_calendar_get_request_rec(request_rec *r)
 {
-    icalparser *comp = data;
-    icalparser_free(comp);
-    return APR_SUCCESS;
+    dav_calendar_request_rec *rconf;
+
+    /* subrequests share the state of the main request */
+    while (r->main) {
+        r = r->main;
+    }
+
+    rconf = ap_get_module_config(r->request_config, &dav_calendar_module);
+    if (!rconf) {
+        rconf = apr_pcalloc(r->pool, sizeof(dav_calendar_request_rec));
+        ap_set_module_config(r->request_config, &dav_calendar_module, rconf);
+    }
+
+    return rconf;
 }
 
-static apr_status_t icalcomponent_cleanup(void *data)
+/*
+ * Phase timings.
+ *
+ * When DavCalendarServerTiming is on, the time spent in each phase of a
+ * report or GET is added up for the request, and reported in the
+ * Server-Timing response header and the dav-calendar-timing note. The
+ * phases nest: the walk includes reading the members, reading includes
+ * parsing, while the time spent filtering is not counted as parsing.
+ */
+
+#define DAV_CALENDAR_TIMING_NOTE "dav-calendar-timing"
+
+static const char *dav_calendar_phase_names[DAV_CALENDAR_PHASE_MAX] = {
+    "lockdb",
+    "walk",
+    "read",
+    "parse",
+    "filter",
+    "serialise",
+    "send"
+};
+
+static apr_time_t dav_calendar_timing_start(request_rec *r)
 {
-    icalcomponent *comp = data;
-    icalcomponent_free(comp);
-    return APR_SUCCESS;
+    dav_calendar_config_rec *conf;
+
+    while (r->main) {
+        r = r->main;
+    }
+
+    conf = ap_get_module_config(r->per_dir_config, &dav_calendar_module);
+
+    return conf && conf->server_timing ? apr_time_now() : 0;
 }
 
-static char dav_calendar_ascii_toupper(char c)
+static void dav_calendar_timing_add(request_rec *r, dav_calendar_phase phase,
+        apr_time_t start)
 {
-    /* ascii only, ignore locale */
-    return c < 0 ? c : c | ' ';
+    dav_calendar_request_rec *rconf;
+
+    if (!start) {
+        return;
+    }
+
+    rconf = dav_calendar_get_request_rec(r);
+    rconf->timing[phase] += apr_time_now() - start;
+    rconf->timed |= 1 << phase;
 }
 
-static int dav_calendar_text_match_ascii_casecmp(const char *match,
-        const char *text)
+static const char *dav_calendar_timing_format(request_rec *r,
+        const dav_calendar_request_rec *rconf, int header)
 {
-    /* https://tools.ietf.org/html/rfc4790#section-9.2 */
-
-    while (*text) {
-        const char *smatch = match;
-        const char *stext = text;
+    const char *out = NULL;
+    int i;
 
-        while (*stext
-                && dav_calendar_ascii_toupper(*smatch)
-                        != dav_calendar_ascii_toupper(*stext)) {
-            stext++;
-        }
+    for (i = 0; i < DAV_CALENDAR_PHASE_MAX; i++) {
+        const char *phase;
 
-        while (*stext && *smatch
-                && dav_calendar_ascii_toupper(*smatch)
-                        == dav_calendar_ascii_toupper(*stext)) {
-            stext++;
-            smatch++;
+        if (!(rconf->timed & (1 << i))) {
+            continue;
         }
 
-        if (*smatch == 0) {
-            return 1;
-        }
+        /* milliseconds, as Server-Timing expects */
+        phase = apr_psprintf(r->pool, header ? "%s;dur=%.3f" : "%s=%.3f",
+                dav_calendar_phase_names[i], rconf->timing[i] / 1000.0);
 
-        text++;
+        out = out ? apr_pstrcat(r->pool, out, header ? ", " : " ", phase,
+                NULL) : phase;
     }
 
-    return 0;
+    return out;
 }
 
-static int dav_calendar_text_match_octet(const char *match, const char *text)
+/*
+ * Add the timings so far to the response headers, if they have not yet
+ * been sent.
+ */
+static void dav_calendar_timing_header(request_rec *r)
 {
-    /* https://tools.ietf.org/html/rfc4790#section-9.3 */
-
-    /*
-     * The ordering algorithm is as follows:
-     *
-     * 1.  If both strings are the empty string, return the result "equal".
-     *
-     * 2.  If the first string is empty and the second is not, return the
-     *     result "less".
-     *
-     * 3.  If the second string is empty and the first is not, return the
-     *     result "greater".
-     *
-     * 4.  If both strings begin with the same octet value, remove the first
-     *     octet from both strings and repeat this algorithm from step 1.
-     *
-     * 5.  If the unsigned value (0 to 255) of the first octet of the first
-     *     string is less than the unsigned value of the first octet of the
-     *     second string, then return "less".
-     * 6.  If this step is reached, return "greater".
-     *
-     * The matching operation returns "match" if the sorting algorithm would
-     * return "equal".  Otherwise, the matching operation returns "no-
-     * match".
-     *
-     * The substring operation returns "match" if the first string is the
-     * empty string, or if there exists a substring of the second string of
-     * length equal to the length of the first string, which would result in
-     * a "match" result from the equality function.  Otherwise, the
-     * substring operation returns "no-match".
-     */
+    dav_calendar_request_rec *rconf = dav_calendar_get_request_rec(r);
 
-    if (strstr((char *)text, match)) {
-        return 1;
+    if (!rconf->timed || r->sent_bodyct) {
+        return;
     }
 
-    return 0;
+    apr_table_merge(r->headers_out, "Server-Timing",
+            dav_calendar_timing_format(r, rconf, 1));
+    rconf->timing_sent = 1;
 }
 
-static dav_error *dav_calendar_text_match(dav_calendar_ctx *ctx,
-        const apr_xml_elem *timezone, const apr_xml_elem *text_match,
-        const char *text)
+/*
+ * The request is done, note the timings for the log, and send them to
+ * the client if we could not do so up front.
+ */
+static void dav_calendar_timing_finish(request_rec *r)
 {
-    dav_error *err;
-
-    const apr_xml_attr *collation, *negate_condition;
-
-    const char *match;
-    int negate;
+    dav_calendar_request_rec *rconf = dav_calendar_get_request_rec(r);
 
-    /* we already matched? */
-    if (ctx->match) {
-        return NULL;
+    if (!rconf->timed) {
+        return;
     }
 
-    /*
-     * <!ELEMENT text-match (#PCDATA)>
-     *   PCDATA value: string
-     *
-     * <!ATTLIST text-match collation        CDATA "i;ascii-casemap"
-     *                      negate-condition (yes | no) "no">
-     */
+    apr_table_setn(r->notes, DAV_CALENDAR_TIMING_NOTE,
+            dav_calendar_timing_format(r, rconf, 0));
 
-    match = dav_xml_get_cdata(text_match, ctx->r->pool, 1 /* strip_white */);
+    if (rconf->timing_sent) {
+        return;
+    }
 
-    negate_condition = dav_find_attr_ns(text_match, APR_XML_NS_NONE,
-            "negate-condition");
-    if (!negate_condition || !negate_condition->value
-            || !strcmp(negate_condition->value,
-                    "no")) {
-        negate = 0;
+    /* a streamed response has gone, only a trailer remains */
+    if (!r->sent_bodyct) {
+        apr_table_merge(r->headers_out, "Server-Timing",
+                dav_calendar_timing_format(r, rconf, 1));
     }
-    else if (!strcmp(negate_condition->value,
-            "yes")) {
-        negate = 1;
+    else if (r->trailers_out) {
+        apr_table_merge(r->trailers_out, "Server-Timing",
+                dav_calendar_timing_format(r, rconf, 1));
     }
-    else {
+    rconf->timing_sent = 1;
+}
 
-        /* MUST violation */
-        err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0,
-                APR_SUCCESS,
-                "Negate-condition attribute must contain "
-                "yes or no.");
-        err->tagname = "CALDAV:valid-filter";
+static dav_error *dav_calendar_open_lockdb(request_rec *r, dav_lockdb **lockdb)
+{
+    apr_time_t start = dav_calendar_timing_start(r);
+    dav_error *err;
 
-        return err;
-    }
+    /* ### should open read-only */
+    err = dav_open_lockdb(r, 0, lockdb);
 
-    collation = dav_find_attr_ns(text_match, APR_XML_NS_NONE, "collation");
-    if (collation) {
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_LOCKDB, start);
 
-        if (!collation || !collation->value
-                || !strcmp(collation->value,
-                DAV_CALENDAR_COLLATION_ASCII_CASEMAP)) {
+    return err;
+}
 
-            if (dav_calendar_text_match_ascii_casecmp(match, text)) {
+static dav_error *dav_calendar_walk(request_rec *r,
+        const dav_resource *resource, dav_walk_params *w, int depth,
+        dav_response **multi_status)
+{
+    apr_time_t start = dav_calendar_timing_start(r);
+    dav_error *err;
 
-                if (!negate) {
+    err = (*resource->hooks->walk)(w, depth, multi_status);
 
-                    /* we have a match! */
-                    ctx->match = 1;
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_WALK, start);
 
-                }
+    return err;
+}
 
-            }
-            else {
+static const char *dav_calendar_strong_etag_str(const char *etag)
+{
+    /* weak or missing etags cannot be used to validate cached state */
+    if (!etag || !*etag || !strncmp(etag, "W/", 2)) {
+        return NULL;
+    }
 
-                if (negate) {
+    return etag;
+}
 
-                    /* we have a match! */
-                    ctx->match = 1;
+static const char *dav_calendar_strong_etag(const dav_resource *resource)
+{
+    if (!resource->hooks->getetag) {
+        return NULL;
+    }
 
-                }
+    return dav_calendar_strong_etag_str((*resource->hooks->getetag)(resource));
+}
 
-            }
+static apr_status_t icalparser_cleanup(void *data)
+{
+    icalparser *comp = data;
+    icalparser_free(comp);
+    return APR_SUCCESS;
+}
 
-        }
-        else if (!strcmp(collation->value,
-                DAV_CALENDAR_COLLATION_OCTET)) {
+static apr_status_t icalcomponent_cleanup(void *data)
+{
+    icalcomponent *comp = data;
+    icalcomponent_free(comp);
+    return APR_SUCCESS;
+}
 
-            if (dav_calendar_text_match_octet(match, text)) {
 
-                if (!negate) {
+static int dav_calendar_text_match(const dav_calendar_text_plan *text_match,
+        const char *text)
+{
+    int match;
 
-                    /* we have a match! */
-                    ctx->match = 1;
+    if (!text) {
+        text = "";
+    }
 
-                }
-
-            }
-            else {
-
-                if (negate) {
-
-                    /* we have a match! */
-                    ctx->match = 1;
-
-                }
-
-            }
-
-        }
-        else {
-
-            /* MUST violation */
-            err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0,
-                    APR_SUCCESS,
-                    "Collation attribute must contain "
-                    DAV_CALENDAR_COLLATION_ASCII_CASEMAP " or "
-                    DAV_CALENDAR_COLLATION_OCTET ".");
-            err->tagname = "CALDAV:supported-collation";
-
-            return err;
-        }
+    switch (text_match->collation) {
+    case DAV_CALENDAR_COLLATION_ID_OCTET:
+        match = dav_calendar_text_match_octet(text_match->match, text);
+        break;
+    case DAV_CALENDAR_COLLATION_ID_UNICODE_CASEMAP:
+        match = dav_calendar_text_match_unicode_casemap(text_match->casemap,
+                text);
+        break;
+    case DAV_CALENDAR_COLLATION_ID_ASCII_CASEMAP:
+    default:
+        match = dav_calendar_text_match_ascii_casecmp(text_match->casemap,
+                text);
+        break;
     }
 
-    return NULL;
+    return text_match->negate ? !match : match;
 }
 
-static struct icaltimetype dav_calendar_get_datetime_with_component(
-        icalproperty *prop, icalcomponent *comp)
-{
-    icalcomponent *cp;
-    icalparameter *param;
-
-    struct icaltimetype ret;
-
-    ret = icalvalue_get_datetime(icalproperty_get_value(prop));
-
-    if (icaltime_is_utc(ret)) {
-        return ret;
-    }
-
-    if ((param = icalproperty_get_first_parameter(prop, ICAL_TZID_PARAMETER)) != NULL) {
-        const char *tzid = icalparameter_get_tzid(param);
-        icaltimezone *tz = NULL;
-
-        if (!comp) {
-            comp = icalproperty_get_parent(prop);
-        }
-
-        for (cp = comp; cp; cp = icalcomponent_get_parent(cp)) {
-
-            tz = icalcomponent_get_timezone(cp, tzid);
-            if (tz) {
-                break;
-            }
-        }
-
-        if (!tz) {
-            tz = icaltimezone_get_builtin_timezone_from_tzid(tzid);
-        }
-
-        if (!tz) {
-            tz = icaltimezone_get_builtin_timezone(tzid);
-        }
-
-        if (tz) {
-            ret = icaltime_set_timezone(&ret, tz);
-        }
-    }
-
-    return ret;
-}
 
-static dav_error *dav_calendar_time_range(dav_calendar_ctx *ctx,
+static dav_error *dav_calendar_time_range(apr_pool_t *p,
         const apr_xml_elem *time_range, icaltimetype **stt, icaltimetype **ett)
 {
     dav_error *err;
 
     const apr_xml_attr *start, *end;
 
-    /* we already matched? */
-    if (ctx->match) {
-        return NULL;
-    }
-
     /*
      * <!ELEMENT time-range EMPTY>
      *
@@ -623,7 +1071,7 @@ static dav_error *dav_calendar_time_range(dav_calendar_ctx *ctx,
      * end value: an iCalendar "date with UTC time"
      */
 
-    *stt = apr_palloc(ctx->r->pool, sizeof(icaltimetype));
+    *stt = apr_palloc(p, sizeof(icaltimetype));
 
     start = dav_find_attr_ns(time_range, APR_XML_NS_NONE, "start");
     if (!start) {
@@ -632,14 +1080,14 @@ static dav_error *dav_calendar_time_range(dav_calendar_ctx *ctx,
     else {
         **stt = icaltime_from_string(start->value);
         if (icalerrno != ICAL_NO_ERROR) {
-            err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0,
+            err = dav_new_error(p, HTTP_FORBIDDEN, 0,
                     APR_EGENERAL, icalerror_perror());
             err->tagname = "CALDAV:valid-filter";
             return err;
         }
     }
 
-    *ett = apr_palloc(ctx->r->pool, sizeof(icaltimetype));
+    *ett = apr_palloc(p, sizeof(icaltimetype));
 
     end = dav_find_attr_ns(time_range, APR_XML_NS_NONE, "end");
     if (!end) {
@@ -648,7 +1096,7 @@ static dav_error *dav_calendar_time_range(dav_calendar_ctx *ctx,
     else {
         **ett = icaltime_from_string(end->value);
         if (icalerrno != ICAL_NO_ERROR) {
-            err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0,
+            err = dav_new_error(p, HTTP_FORBIDDEN, 0,
                     APR_EGENERAL, icalerror_perror());
             err->tagname = "CALDAV:valid-filter";
             return err;
@@ -657,7 +1105,7 @@ static dav_error *dav_calendar_time_range(dav_calendar_ctx *ctx,
 
     if (!start && !end) {
         /* MUST violation */
-        err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0,
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0,
                 APR_SUCCESS,
                 "Start and/or end attribute must exist in time-range");
         err->tagname = "CALDAV:valid-filter";
@@ -667,1080 +1115,771 @@ static dav_error *dav_calendar_time_range(dav_calendar_ctx *ctx,
     return NULL;
 }
 
-static dav_error *dav_calendar_prop_time_range(dav_calendar_ctx *ctx,
-        const apr_xml_elem *timezone, icalcomponent *comp, icalproperty *prop,
-        icaltimetype *stt, icaltimetype *ett)
-{
-
-    icaltimetype time;
-    icaltime_span test;
-    icaltime_span span;
-
-    /* we already matched? */
-    if (ctx->match) {
-        return NULL;
-    }
-
-    switch (icalproperty_isa(prop)) {
-    case ICAL_DTEND_PROPERTY:
-
-        time = icalcomponent_get_dtend(comp);
-
-        break;
-    case ICAL_DUE_PROPERTY:
-
-        time = icalcomponent_get_due(comp);
-
-        break;
-    case ICAL_DTSTART_PROPERTY:
 
-        time = icalcomponent_get_dtstart(comp);
+static dav_error *dav_calendar_compile_text_match(apr_pool_t *p,
+        const apr_xml_elem *text_match, dav_calendar_text_plan **pplan)
+{
+    dav_calendar_text_plan *plan;
+    dav_error *err;
 
-        break;
+    const apr_xml_attr *collation, *negate_condition;
 
-    case ICAL_DTSTAMP_PROPERTY:
-        time = icalcomponent_get_dtstamp(comp);
+    /*
+     * <!ELEMENT text-match (#PCDATA)>
+     *   PCDATA value: string
+     *
+     * <!ATTLIST text-match collation        CDATA "i;ascii-casemap"
+     *                      negate-condition (yes | no) "no">
+     */
 
-        break;
-    case ICAL_COMPLETED_PROPERTY:
-    case ICAL_CREATED_PROPERTY:
-    case ICAL_LASTMODIFIED_PROPERTY:
+    plan = apr_pcalloc(p, sizeof(dav_calendar_text_plan));
 
-        time = dav_calendar_get_datetime_with_component(prop, comp);
+    plan->match = dav_xml_get_cdata(text_match, p, 1 /* strip_white */);
 
-        break;
-    default:
-        time = icaltime_null_time();
+    negate_condition = dav_find_attr_ns(text_match, APR_XML_NS_NONE,
+            "negate-condition");
+    if (!negate_condition || !negate_condition->value
+            || !strcmp(negate_condition->value, "no")) {
+        plan->negate = 0;
     }
+    else if (!strcmp(negate_condition->value, "yes")) {
+        plan->negate = 1;
+    }
+    else {
 
-    test = icaltime_span_new(time, time, 0);
-    span = icaltime_span_new(*stt, *ett, 0);
-
-    if (icalproperty_recurrence_is_excluded(comp, &time, &time) ||
-            icaltime_span_overlaps(&test, &span)) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                APR_SUCCESS,
+                "Negate-condition attribute must contain "
+                "yes or no.");
+        err->tagname = "CALDAV:valid-filter";
 
-        /* we have a match! */
-        ctx->match = 1;
+        return err;
+    }
 
+    collation = dav_find_attr_ns(text_match, APR_XML_NS_NONE, "collation");
+    if (!collation || !collation->value
+            || !strcmp(collation->value,
+                    DAV_CALENDAR_COLLATION_ASCII_CASEMAP)) {
+        plan->collation = DAV_CALENDAR_COLLATION_ID_ASCII_CASEMAP;
+        plan->casemap = dav_calendar_casemap_compile(
+                apr_palloc(p, dav_calendar_casemap_size(plan->match)),
+                plan->match);
+    }
+    else if (!strcmp(collation->value, DAV_CALENDAR_COLLATION_OCTET)) {
+        plan->collation = DAV_CALENDAR_COLLATION_ID_OCTET;
+    }
+    else if (!strcmp(collation->value,
+            DAV_CALENDAR_COLLATION_UNICODE_CASEMAP)) {
+        plan->collation = DAV_CALENDAR_COLLATION_ID_UNICODE_CASEMAP;
+        plan->casemap = dav_calendar_unicode_casemap_compile(
+                apr_palloc(p, dav_calendar_unicode_casemap_size(plan->match)),
+                plan->match);
     }
+    else {
 
-    return NULL;
-}
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                APR_SUCCESS,
+                "Collation attribute must contain "
+                DAV_CALENDAR_COLLATION_ASCII_CASEMAP ", "
+                DAV_CALENDAR_COLLATION_OCTET " or "
+                DAV_CALENDAR_COLLATION_UNICODE_CASEMAP ".");
+        err->tagname = "CALDAV:supported-collation";
 
-static void dav_calendar_alarm_callback(icalcomponent *comp,
-        struct icaltime_span *span, void *data)
-{
-    dav_calendar_ctx *ctx = data;
+        return err;
+    }
 
-    /* we have a match! */
-    ctx->match = 1;
+    *pplan = plan;
 
+    return NULL;
 }
 
-static void dav_calendar_event_callback(icalcomponent *comp,
-        struct icaltime_span *span, void *data)
+static dav_error *dav_calendar_compile_param_filter(apr_pool_t *p, int ns,
+        const apr_xml_elem *param_filter, dav_calendar_param_plan **pplan)
 {
-    dav_calendar_ctx *ctx = data;
-
-    /* we have a match! */
-    ctx->match = 1;
+    dav_calendar_param_plan *plan;
+    dav_error *err;
 
-}
+    const apr_xml_elem *elem;
+    const apr_xml_attr *name;
 
-static dav_error *dav_calendar_comp_time_range(dav_calendar_ctx *ctx,
-        const apr_xml_elem *timezone,
-        icalcomponent *comp, icaltimetype *stt, icaltimetype *ett)
-{
+    /*
+     * <!ELEMENT param-filter (is-not-defined | text-match?)>
+     *
+     * <!ATTLIST param-filter name CDATA #REQUIRED>
+     * name value: a property parameter name (e.g., PARTSTAT)
+     */
 
-    /* we already matched? */
-    if (ctx->match) {
-        return NULL;
+    name = dav_find_attr_ns(param_filter, APR_XML_NS_NONE, "name");
+    if (!name || !name->value) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                APR_SUCCESS,
+                "Name attribute must exist in param-filter");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
     }
 
-    switch (icalcomponent_isa(comp)) {
-
-    case ICAL_VEVENT_COMPONENT: {
-
-        /*
-         * A VEVENT component overlaps a given time range if the condition
-         * for the corresponding component state specified in the table below
-         * is satisfied.  Note that, as specified in [RFC2445], the DTSTART
-         * property is REQUIRED in the VEVENT component.  The conditions
-         * depend on the presence of the DTEND and DURATION properties in the
-         * VEVENT component.  Furthermore, the value of the DTEND property
-         *
-         * MUST be later in time than the value of the DTSTART property.  The
-         * duration of a VEVENT component with no DTEND and DURATION
-         * properties is 1 day (+P1D) when the DTSTART is a DATE value, and 0
-         * seconds when the DTSTART is a DATE-TIME value.
-         *
-         * +---------------------------------------------------------------+
-         * | VEVENT has the DTEND property?                                |
-         * |   +-----------------------------------------------------------+
-         * |   | VEVENT has the DURATION property?                         |
-         * |   |   +-------------------------------------------------------+
-         * |   |   | DURATION property value is greater than 0 seconds?    |
-         * |   |   |   +---------------------------------------------------+
-         * |   |   |   | DTSTART property is a DATE-TIME value?            |
-         * |   |   |   |   +-----------------------------------------------+
-         * |   |   |   |   | Condition to evaluate                         |
-         * +---+---+---+---+-----------------------------------------------+
-         * | Y | N | N | * | (start <  DTEND AND end > DTSTART)            |
-         * +---+---+---+---+-----------------------------------------------+
-         * | N | Y | Y | * | (start <  DTSTART+DURATION AND end > DTSTART) |
-         * |   |   +---+---+-----------------------------------------------+
-         * |   |   | N | * | (start <= DTSTART AND end > DTSTART)          |
-         * +---+---+---+---+-----------------------------------------------+
-         * | N | N | N | Y | (start <= DTSTART AND end > DTSTART)          |
-         * +---+---+---+---+-----------------------------------------------+
-         * | N | N | N | N | (start <  DTSTART+P1D AND end > DTSTART)      |
-         * +---+---+---+---+-----------------------------------------------+
-         */
-
-        icalcomponent_foreach_recurrence(comp, *stt, *ett,
-                dav_calendar_event_callback, ctx);
+    plan = apr_pcalloc(p, sizeof(dav_calendar_param_plan));
+    plan->name = name->value;
+    plan->kind = icalparameter_string_to_kind(name->value);
 
+    switch (plan->kind) {
+    case ICAL_NO_PARAMETER:
+    case ICAL_X_PARAMETER:
+    case ICAL_IANA_PARAMETER:
+        plan->kind = ICAL_ANY_PARAMETER;
+        plan->by_name = 1;
         break;
-    }
-    case ICAL_VTODO_COMPONENT: {
-
-        /*
-         * A VTODO component is said to overlap a given time range if the
-         * condition for the corresponding component state specified in the
-         * table below is satisfied.  The conditions depend on the presence
-         * of the DTSTART, DURATION, DUE, COMPLETED, and CREATED properties
-         * in the VTODO component.  Note that, as specified in [RFC2445], the
-         * DUE value MUST be a DATE-TIME value equal to or after the DTSTART
-         * value if specified.
-         *
-         * +-------------------------------------------------------------------+
-         * | VTODO has the DTSTART property?                                   |
-         * |   +---------------------------------------------------------------+
-         * |   |   VTODO has the DURATION property?                            |
-         * |   |   +-----------------------------------------------------------+
-         * |   |   | VTODO has the DUE property?                               |
-         * |   |   |   +-------------------------------------------------------+
-         * |   |   |   | VTODO has the COMPLETED property?                     |
-         * |   |   |   |   +---------------------------------------------------+
-         * |   |   |   |   | VTODO has the CREATED property?                   |
-         * |   |   |   |   |   +-----------------------------------------------+
-         * |   |   |   |   |   | Condition to evaluate                         |
-         * +---+---+---+---+---+-----------------------------------------------+
-         * | Y | Y | N | * | * | (start  <= DTSTART+DURATION)  AND             |
-         * |   |   |   |   |   | ((end   >  DTSTART)  OR                       |
-         * |   |   |   |   |   |  (end   >= DTSTART+DURATION))                 |
-         * +---+---+---+---+---+-----------------------------------------------+
-         * | Y | N | Y | * | * | ((start <  DUE)      OR  (start <= DTSTART))  |
-         * |   |   |   |   |   | AND                                           |
-         * |   |   |   |   |   | ((end   >  DTSTART)  OR  (end   >= DUE))      |
-         * +---+---+---+---+---+-----------------------------------------------+
-         * | Y | N | N | * | * | (start  <= DTSTART)  AND (end >  DTSTART)     |
-         * +---+---+---+---+---+-----------------------------------------------+
-         * | N | N | Y | * | * | (start  <  DUE)      AND (end >= DUE)         |
-         * +---+---+---+---+---+-----------------------------------------------+
-         * | N | N | N | Y | Y | ((start <= CREATED)  OR  (start <= COMPLETED))|
-         * |   |   |   |   |   | AND                                           |
-         * |   |   |   |   |   | ((end   >= CREATED)  OR  (end   >= COMPLETED))|
-         * +---+---+---+---+---+-----------------------------------------------+
-         * | N | N | N | Y | N | (start  <= COMPLETED) AND (end  >= COMPLETED) |
-         * +---+---+---+---+---+-----------------------------------------------+
-         * | N | N | N | N | Y | (end    >  CREATED)                           |
-         * +---+---+---+---+---+-----------------------------------------------+
-         * | N | N | N | N | N | TRUE                                          |
-         * +---+---+---+---+---+-----------------------------------------------+
-         */
-
-        icalcomponent_foreach_recurrence(comp, *stt, *ett,
-                dav_calendar_event_callback, ctx);
-
+    default:
         break;
     }
-    case ICAL_VJOURNAL_COMPONENT: {
 
-        /*
-         * A VJOURNAL component overlaps a given time range if the condition
-         * for the corresponding component state specified in the table below
-         * is satisfied.  The conditions depend on the presence of the
-         * DTSTART property in the VJOURNAL component and on whether the
-         * DTSTART is a DATE-TIME or DATE value.  The effective "duration" of
-         * a VJOURNAL component is 1 day (+P1D) when the DTSTART is a DATE
-         * value, and 0 seconds when the DTSTART is a DATE-TIME value.
-         *
-         * +----------------------------------------------------+
-         * | VJOURNAL has the DTSTART property?                 |
-         * |   +------------------------------------------------+
-         * |   | DTSTART property is a DATE-TIME value?         |
-         * |   |   +--------------------------------------------+
-         * |   |   | Condition to evaluate                      |
-         * +---+---+--------------------------------------------+
-         * | Y | Y | (start <= DTSTART)     AND (end > DTSTART) |
-         * +---+---+--------------------------------------------+
-         * | Y | N | (start <  DTSTART+P1D) AND (end > DTSTART) |
-         * +---+---+--------------------------------------------+
-         * | N | * | FALSE                                      |
-         * +---+---+--------------------------------------------+
-         */
-        icaltime_span span = icalcomponent_get_span(comp);
-        icaltime_span limit = icaltime_span_new(*stt, *ett, 1);
-
-        if (icaltime_span_overlaps(&span, &limit)) {
+    for (elem = param_filter->first_child; elem; elem = elem->next) {
 
-            /* we have a match! */
-            ctx->match = 1;
+        if (elem->ns != ns) {
+            continue;
+        }
 
+        if (!strcmp(elem->name, "is-not-defined")) {
+            plan->is_not_defined = 1;
+        }
+        else if (!strcmp(elem->name, "text-match")) {
+            if (plan->text_match) {
+                /* MUST violation */
+                err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                        APR_SUCCESS,
+                        "Only one text-match may exist in param-filter");
+                err->tagname = "CALDAV:valid-filter";
+                return err;
+            }
+            if ((err = dav_calendar_compile_text_match(p, elem,
+                    &plan->text_match))) {
+                return err;
+            }
         }
 
-        break;
     }
-    case ICAL_VFREEBUSY_COMPONENT: {
-
-        /*
-         * A VFREEBUSY component overlaps a given time range if the condition
-         * for the corresponding component state specified in the table below
-         * is satisfied.  The conditions depend on the presence in the
-         * VFREEBUSY component of the DTSTART and DTEND properties, and any
-         * FREEBUSY properties in the absence of DTSTART and DTEND.  Any
-         * DURATION property is ignored, as it has a special meaning when
-         * used in a VFREEBUSY component.
-         *
-         * When only FREEBUSY properties are used, each period in each
-         * FREEBUSY property is compared against the time range, irrespective
-         * of the type of free busy information (free, busy, busy-tentative,
-         * busy-unavailable) represented by the property.
-         *
-         *
-         * +------------------------------------------------------+
-         * | VFREEBUSY has both the DTSTART and DTEND properties? |
-         * |   +--------------------------------------------------+
-         * |   | VFREEBUSY has the FREEBUSY property?             |
-         * |   |   +----------------------------------------------+
-         * |   |   | Condition to evaluate                        |
-         * +---+---+----------------------------------------------+
-         * | Y | * | (start <= DTEND) AND (end > DTSTART)         |
-         * +---+---+----------------------------------------------+
-         * | N | Y | (start <  freebusy-period-end) AND           |
-         * |   |   | (end   >  freebusy-period-start)             |
-         * +---+---+----------------------------------------------+
-         * | N | N | FALSE                                        |
-         * +---+---+----------------------------------------------+
-         */
-        icaltime_span span = icalcomponent_get_span(comp);
-        icaltime_span limit = icaltime_span_new(*stt, *ett, 1);
-
-        if (icaltime_span_overlaps(&span, &limit)) {
-
-            /* we have a match! */
-            ctx->match = 1;
-
-        }
 
-        break;
+    if (plan->is_not_defined && plan->text_match) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                APR_SUCCESS,
+                "Is-not-defined must be alone in param-filter");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
     }
-    case ICAL_VALARM_COMPONENT: {
 
-        /*
-         * A VALARM component is said to overlap a given time range if the
-         * following condition holds:
-         *
-         *    (start <= trigger-time) AND (end > trigger-time)
-         *
-         * A VALARM component can be defined such that it triggers repeatedly.
-         * Such a VALARM component is said to overlap a given time range if at
-         * least one of its triggers overlaps the time range.
-         */
-        icalproperty *prop;
-        struct icaltriggertype tr;
-        struct icaldurationtype duration = icaldurationtype_null_duration();
-        int repeat = 1;
+    *pplan = plan;
+
+    return NULL;
+}
 
-        if ((prop = icalcomponent_get_first_property(comp,
-                ICAL_TRIGGER_PROPERTY))) {
+static dav_error *dav_calendar_compile_prop_filter(apr_pool_t *p, int ns,
+        const apr_xml_elem *prop_filter, dav_calendar_prop_plan **pplan)
+{
+    dav_calendar_prop_plan *plan;
+    dav_calendar_param_plan **param_next;
+    dav_error *err;
 
-            tr = icalproperty_get_trigger(prop);;
+    const apr_xml_elem *elem;
+    const apr_xml_attr *name;
 
-            if (!icaltime_is_null_time(tr.time)) {
+    /*
+     * <!ELEMENT prop-filter (is-not-defined |
+     *                        ((time-range | text-match)?,
+     *                         param-filter*))>
+     *
+     * <!ATTLIST prop-filter name CDATA #REQUIRED>
+     * name value: a calendar property name (e.g., ATTENDEE)
+     */
 
-                /* simple time value - direct comparison */
+    name = dav_find_attr_ns(prop_filter, APR_XML_NS_NONE, "name");
+    if (!name || !name->value) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                APR_SUCCESS,
+                "Name attribute must exist in prop-filter");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
+    }
 
-                icaltime_span span = icaltime_span_new(tr.time, tr.time, 1);
-                icaltime_span limit = icaltime_span_new(*stt, *ett, 1);
+    plan = apr_pcalloc(p, sizeof(dav_calendar_prop_plan));
+    plan->name = name->value;
+    plan->kind = icalproperty_string_to_kind(name->value);
 
-                if (icaltime_span_overlaps(&span, &limit)) {
+    switch (plan->kind) {
+    case ICAL_NO_PROPERTY:
+    case ICAL_X_PROPERTY:
+    case ICAL_IANA_PROPERTY:
+        plan->kind = ICAL_ANY_PROPERTY;
+        plan->by_name = 1;
+        break;
+    default:
+        break;
+    }
 
-                    /* we have a match! */
-                    ctx->match = 1;
+    param_next = &plan->param_filters;
 
-                }
+    for (elem = prop_filter->first_child; elem; elem = elem->next) {
 
+        if (elem->ns != ns) {
+            continue;
+        }
 
+        if (!strcmp(elem->name, "is-not-defined")) {
+            plan->is_not_defined = 1;
+        }
+        else if (!strcmp(elem->name, "time-range")) {
+            if (plan->stt || plan->text_match) {
+                /* MUST violation */
+                err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                        APR_SUCCESS,
+                        "Only one time-range or text-match may exist "
+                        "in prop-filter");
+                err->tagname = "CALDAV:valid-filter";
+                return err;
             }
-            else {
-
-                /* this is fun - relative to the parent then */
+            if ((err = dav_calendar_time_range(p, elem, &plan->stt,
+                    &plan->ett))) {
+                return err;
+            }
+        }
+        else if (!strcmp(elem->name, "text-match")) {
+            if (plan->stt || plan->text_match) {
+                /* MUST violation */
+                err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                        APR_SUCCESS,
+                        "Only one time-range or text-match may exist "
+                        "in prop-filter");
+                err->tagname = "CALDAV:valid-filter";
+                return err;
+            }
+            if ((err = dav_calendar_compile_text_match(p, elem,
+                    &plan->text_match))) {
+                return err;
+            }
+        }
+        else if (!strcmp(elem->name, "param-filter")) {
+            if ((err = dav_calendar_compile_param_filter(p, ns, elem,
+                    param_next))) {
+                return err;
+            }
+            param_next = &(*param_next)->next;
+        }
 
-                icaltimetype st = *stt;
-                icaltimetype et = *ett;
+    }
 
-                if ((prop = icalcomponent_get_first_property(comp,
-                        ICAL_DURATION_PROPERTY))) {
-                    duration = icalproperty_get_duration(prop);
-                }
+    if (plan->is_not_defined
+            && (plan->stt || plan->text_match || plan->param_filters)) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                APR_SUCCESS,
+                "Is-not-defined must be alone in prop-filter");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
+    }
 
-                if ((prop = icalcomponent_get_first_property(comp,
-                        ICAL_REPEAT_PROPERTY))) {
-                    repeat = icalproperty_get_repeat(prop) + 1;
-                }
+    *pplan = plan;
 
-                icaltime_adjust(&st, 0, 0, 0,
-                        icaldurationtype_as_int(duration) * repeat);
-                icaltime_adjust(&et, 0, 0, 0,
-                        icaldurationtype_as_int(duration) * repeat);
+    return NULL;
+}
 
-                icalcomponent_foreach_recurrence(icalcomponent_get_parent(comp),
-                        st, et, dav_calendar_alarm_callback, ctx);
+static dav_error *dav_calendar_compile_comp_filter(apr_pool_t *p, int ns,
+        const apr_xml_elem *comp_filter, dav_calendar_comp_plan **pplan)
+{
+    dav_calendar_comp_plan *plan;
+    dav_calendar_prop_plan **prop_next;
+    dav_calendar_comp_plan **comp_next;
+    dav_error *err;
 
-            }
+    const apr_xml_elem *elem;
+    const apr_xml_attr *name;
 
-        }
+    /*
+     * <!ELEMENT comp-filter (is-not-defined | (time-range?,
+     *                        prop-filter*, comp-filter*))>
+     *
+     * <!ATTLIST comp-filter name CDATA #REQUIRED>
+     * name value: a calendar object or calendar component
+     *             type (e.g., VEVENT)
+     */
 
-        break;
-    }
-    default:
-        break;
+    name = dav_find_attr_ns(comp_filter, APR_XML_NS_NONE, "name");
+    if (!name || !name->value) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                APR_SUCCESS,
+                "Name attribute must exist in comp-filter");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
     }
 
+    plan = apr_pcalloc(p, sizeof(dav_calendar_comp_plan));
+    plan->name = name->value;
+
     /*
-     * The calendar properties COMPLETED, CREATED, DTEND, DTSTAMP,
-     * DTSTART, DUE, and LAST-MODIFIED overlap a given time range if the
-     * following condition holds:
+     * Bug: https://github.com/libical/libical/issues/433
      *
-     *     (start <= date-time) AND (end > date-time)
-     *
-     * Note that if DTEND is not present in a VEVENT, but DURATION is, then
-     * the test should instead operate on the 'effective' DTEND, i.e.,
-     * DTSTART+DURATION.  Similarly, if DUE is not present in a VTODO, but
-     * DTSTART and DURATION are, then the test should instead operate on the
-     * 'effective' DUE, i.e., DTSTART+DURATION.
-     *
-     * The semantic of CALDAV:time-range is not defined for any other
-     * calendar components and properties.
+     * There is no way to get the component name, and so we cannot
+     * support filtering of experimental components.
      */
+    plan->kind = icalcomponent_string_to_kind((char *) name->value);
 
-    return NULL;
-}
+    prop_next = &plan->prop_filters;
+    comp_next = &plan->comp_filters;
 
-static void dav_calendar_freebusy_callback(icalcomponent *comp,
-        struct icaltime_span *span, void *data)
-{
-    icalcomponent *freebusy = data;
-    icalproperty *prop;
-    icalparameter *param;
-    icaltimezone *utc_zone;
-
-    enum icalproperty_status status;
-    struct icalperiodtype period;
-
-    status = icalcomponent_get_status(comp);
-
-    utc_zone = icaltimezone_get_utc_timezone();
+    for (elem = comp_filter->first_child; elem; elem = elem->next) {
 
-    if (span->is_busy) {
-
-        period.start = icaltime_from_timet_with_zone(span->start, 0, utc_zone);
-        period.end = icaltime_from_timet_with_zone(span->end, 0, utc_zone);
-        period.duration = icaldurationtype_null_duration();
+        if (elem->ns != ns) {
+            continue;
+        }
 
-        prop = icalproperty_new_freebusy(period);
-        param = icalparameter_new_fbtype(ICAL_FBTYPE_BUSY);
-        icalproperty_add_parameter(prop, param);
+        if (!strcmp(elem->name, "is-not-defined")) {
+            plan->is_not_defined = 1;
+        }
+        else if (!strcmp(elem->name, "time-range")) {
+            if (plan->stt) {
+                /* MUST violation */
+                err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                        APR_SUCCESS,
+                        "Only one time-range may exist in comp-filter");
+                err->tagname = "CALDAV:valid-filter";
+                return err;
+            }
+            if ((err = dav_calendar_time_range(p, elem, &plan->stt,
+                    &plan->ett))) {
+                return err;
+            }
+        }
+        else if (!strcmp(elem->name, "prop-filter")) {
+            if ((err = dav_calendar_compile_prop_filter(p, ns, elem,
+                    prop_next))) {
+                return err;
+            }
+            prop_next = &(*prop_next)->next;
+        }
+        else if (!strcmp(elem->name, "comp-filter")) {
+            if ((err = dav_calendar_compile_comp_filter(p, ns, elem,
+                    comp_next))) {
+                return err;
+            }
+            comp_next = &(*comp_next)->next;
+        }
 
-        icalcomponent_add_property(freebusy, prop);
     }
 
-    else if (status == ICAL_STATUS_TENTATIVE) {
-
-        period.start = icaltime_from_timet_with_zone(span->start, 0, utc_zone);
-        period.end = icaltime_from_timet_with_zone(span->end, 0, utc_zone);
-        period.duration = icaldurationtype_null_duration();
-
-        prop = icalproperty_new_freebusy(period);
-        param = icalparameter_new_fbtype(ICAL_FBTYPE_BUSYTENTATIVE);
-        icalproperty_add_parameter(prop, param);
-
-        icalcomponent_add_property(freebusy, prop);
+    if (plan->is_not_defined
+            && (plan->stt || plan->prop_filters || plan->comp_filters)) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0,
+                APR_SUCCESS,
+                "Is-not-defined must be alone in comp-filter");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
     }
 
+    *pplan = plan;
+
+    return NULL;
 }
 
-static dav_error *dav_calendar_freebusy_time_range(dav_calendar_ctx *ctx,
-        icalcomponent *comp, icaltimetype *stt, icaltimetype *ett)
+/*
+ * Compile the filter of a calendar-query into a plan.
+ *
+ * All filter validation happens here, so that a broken filter is
+ * rejected once before any resource is read.
+ */
+static dav_error *dav_calendar_compile_filter(apr_pool_t *p,
+        const apr_xml_doc *doc, int ns, dav_calendar_filter_plan **pplan)
 {
+    dav_calendar_filter_plan *plan;
+    dav_error *err;
 
-    icalcomponent *freebusy, *cp, *next = NULL;
+    const apr_xml_elem *filter = NULL;
+    const apr_xml_elem *comp_filter = NULL;
+    const apr_xml_elem *timezone = NULL;
 
     /*
-     * Only VEVENT components without a TRANSP property or with the TRANSP
-     * property set to OPAQUE, and VFREEBUSY components SHOULD be considered
-     * in generating the free busy time information.
-     *
-     * In the case of VEVENT components, the free or busy time type (FBTYPE)
-     * of the FREEBUSY properties in the returned VFREEBUSY component SHOULD
-     * be derived from the value of the TRANSP and STATUS properties, as
-     * outlined in the table below:
-     *
-     *   +---------------------------++------------------+
-     *   |          VEVENT           ||    VFREEBUSY     |
-     *   +-------------+-------------++------------------+
-     *   | TRANSP      | STATUS      || FBTYPE           |
-     *   +=============+=============++==================+
-     *   |             | CONFIRMED   || BUSY             |
-     *   |             | (default)   ||                  |
-     *   | OPAQUE      +-------------++------------------+
-     *   | (default)   | CANCELLED   || FREE             |
-     *   |             +-------------++------------------+
-     *   |             | TENTATIVE   || BUSY-TENTATIVE   |
-     *   |             +-------------++------------------+
-     *   |             | x-name      || BUSY or          |
-     *   |             |             || x-name           |
-     *   +-------------+-------------++------------------+
-     *   |             | CONFIRMED   ||                  |
-     *   | TRANSPARENT | CANCELLED   || FREE             |
-     *   |             | TENTATIVE   ||                  |
-     *   |             | x-name      ||                  |
-     *   +-------------+-------------++------------------+
-     *
+     * <!ELEMENT calendar-query ((DAV:allprop |
+     *                            DAV:propname |
+     *                            DAV:prop)?, filter, timezone?)>
      */
-    freebusy = icalcomponent_get_first_component(comp,
-            ICAL_VFREEBUSY_COMPONENT);
 
-    if (freebusy) {
-        icalcomponent_remove_component(comp, freebusy);
+    /*
+     * <!ELEMENT filter (comp-filter)>
+     */
+    if ((filter = dav_find_child_ns(doc->root, ns, "filter")) == NULL) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0, APR_SUCCESS,
+                "Filter element must exist beneath calendar-query");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
+    }
+
+    if ((comp_filter = dav_find_child_ns(filter, ns, "comp-filter")) == NULL) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0, APR_SUCCESS,
+                "Comp-filter element must exist beneath filter element");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
     }
-    else {
-        freebusy = icalcomponent_new(ICAL_VFREEBUSY_COMPONENT);
 
-        icalcomponent_add_property(freebusy, icalproperty_new_dtstart(*stt));
-        icalcomponent_add_property(freebusy, icalproperty_new_dtend(*ett));
+    if (dav_find_next_ns(comp_filter, ns, "comp-filter")) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0, APR_SUCCESS,
+                "Only one comp-filter element may exist beneath filter "
+                "element");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
     }
 
-    for (cp = icalcomponent_get_first_component(comp, ICAL_ANY_COMPONENT);
-           cp; cp = next) {
+    plan = apr_pcalloc(p, sizeof(dav_calendar_filter_plan));
 
-        if (icalcomponent_isa(cp) == ICAL_VEVENT_COMPONENT) {
+    if ((err = dav_calendar_compile_comp_filter(p, ns, comp_filter,
+            &plan->comp_filter))) {
+        return err;
+    }
 
-            icalcomponent_foreach_recurrence(comp,
-                    *stt, *ett, dav_calendar_freebusy_callback, freebusy);
+    if (plan->comp_filter->kind != ICAL_VCALENDAR_COMPONENT) {
+        /* MUST violation */
+        err = dav_new_error(p, HTTP_FORBIDDEN, 0, APR_SUCCESS,
+                "Comp-filter beneath filter element must be VCALENDAR");
+        err->tagname = "CALDAV:valid-filter";
+        return err;
+    }
 
-        }
-        else if (icalcomponent_isa(cp) == ICAL_VTIMEZONE_COMPONENT) {
-            continue;
-        }
+    timezone = dav_find_child_ns(doc->root, ns, "timezone");
+    if (timezone) {
 
-        next = icalcomponent_get_next_component(comp, ICAL_ANY_COMPONENT);
+        icalcomponent *tz = icalparser_parse_string(
+                dav_xml_get_cdata(timezone, p, 1 /* strip_white */));
+        if (!tz || icalerrno != ICAL_NO_ERROR) {
+            if (tz) {
+                icalcomponent_free(tz);
+            }
+            err = dav_new_error(p, HTTP_FORBIDDEN, 0, APR_SUCCESS,
+                    icalerror_perror());
+            err->tagname = "CALDAV:valid-filter";
+            return err;
+        }
 
-        icalcomponent_remove_component(comp, cp);
+        plan->timezone = tz;
+        apr_pool_cleanup_register(p, tz, icalcomponent_cleanup,
+                apr_pool_cleanup_null);
     }
 
-    /*
-     * If no calendar object resources are found to satisfy these
-     * conditions, a VFREEBUSY component with no FREEBUSY property MUST be
-     * returned.
-     */
-    if (icalcomponent_count_properties(freebusy, ICAL_FREEBUSY_PROPERTY)) {
-        icalcomponent_add_component(comp, freebusy);
-    }
-    else {
-        icalcomponent_free(freebusy);
-    }
+    *pplan = plan;
 
     return NULL;
 }
 
-static dav_error *dav_calendar_param_filter(dav_calendar_ctx *ctx,
-        const apr_xml_elem *timezone, const apr_xml_elem *param_filter,
-        icalproperty *prop, icalparameter *param, icaltimetype *stt,
-        icaltimetype *ett)
+static const char *dav_calendar_param_name(icalparameter *param)
 {
-    dav_error *err;
+    switch (icalparameter_isa(param)) {
+    case ICAL_X_PARAMETER:
+        return icalparameter_get_xname(param);
+    case ICAL_IANA_PARAMETER:
+        return icalparameter_get_iana_name(param);
+    default:
+        return icalparameter_kind_to_string(icalparameter_isa(param));
+    }
+}
 
-    const apr_xml_elem *is_not_defined = NULL;
-    const apr_xml_elem *text_match = NULL;
-    const apr_xml_elem *elem = NULL;
-    const apr_xml_attr *name;
+static const char *dav_calendar_param_value(apr_pool_t *p,
+        icalparameter *param)
+{
+    const char *value;
+    apr_size_t len;
+
+    switch (icalparameter_isa(param)) {
+    case ICAL_X_PARAMETER:
+        return icalparameter_get_xvalue(param);
+    case ICAL_IANA_PARAMETER:
+        return icalparameter_get_iana_value(param);
+    default:
+        break;
+    }
 
-    /* we already matched? */
-    if (ctx->match) {
+    /* NAME=VALUE, where the value may be quoted */
+    value = icalparameter_as_ical_string(param);
+    if (!value || !(value = strchr(value, '='))) {
         return NULL;
     }
 
-    /*
-     * <!ELEMENT param-filter (is-not-defined | text-match?)>
-     *
-     * <!ATTLIST param-filter name CDATA #REQUIRED>
-     * name value: a property parameter name (e.g., PARTSTAT)
-     */
-
-    /* do children of param match param_filter? */
-
-    int found = 0;
-    while (param) {
+    value++;
+    len = strlen(value);
 
-        const char *prname = NULL;
+    if (len >= 2 && value[0] == '"' && value[len - 1] == '"') {
+        return apr_pstrmemdup(p, value + 1, len - 2);
+    }
 
-        icalparameter_kind kind = icalparameter_isa(param);
+    return apr_pstrdup(p, value);
+}
 
-        if (kind == ICAL_X_PARAMETER) {
-            prname = icalparameter_get_xname(param);
-        }
-        else if (kind == ICAL_IANA_PARAMETER) {
-            prname = icalparameter_get_iana_name(param);
-        }
+static int dav_calendar_match_param_filter(dav_calendar_ctx *ctx,
+        const dav_calendar_param_plan *plan, icalproperty *prop)
+{
+    icalparameter *param;
 
-        elem = param_filter;
+    for (param = icalproperty_get_first_parameter(prop, plan->kind); param;
+            param = icalproperty_get_next_parameter(prop, plan->kind)) {
 
-        while (prname && elem) {
+        if (plan->by_name) {
+            const char *name = dav_calendar_param_name(param);
 
-            name = dav_find_attr_ns(elem, APR_XML_NS_NONE, "name");
-            if (!name) {
-                /* MUST violation */
-                err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0,
-                        APR_SUCCESS,
-                        "Name attribute must exist in param-filter");
-                err->tagname = "CALDAV:valid-filter";
-                return err;
+            if (!name || strcasecmp(name, plan->name)) {
+                continue;
             }
+        }
 
-            /* matched our name? found it */
-            if (name->value && !strcmp(prname, name->value)) {
-                found = 1;
-                break;
-            }
+        /* found, but we didn't want to find, so no match */
+        if (plan->is_not_defined) {
+            return 0;
+        }
 
-            elem = dav_find_next_ns(elem, ctx->ns, "param-filter");
+        if (!plan->text_match || dav_calendar_text_match(plan->text_match,
+                dav_calendar_param_value(ctx->r->pool, param))) {
+            return 1;
         }
+    }
 
-        if (!found) {
-            /* not found, no match yet, unless... */
+    return plan->is_not_defined;
+}
 
-            elem = param_filter;
+static int dav_calendar_match_prop_filter(dav_calendar_ctx *ctx,
+        const dav_calendar_prop_plan *plan, icalcomponent *comp)
+{
+    icalproperty *prop;
 
-            while (elem) {
-                if (dav_find_child_ns(elem, ctx->ns, "is-not-defined")) {
+    for (prop = icalcomponent_get_first_property(comp, plan->kind); prop;
+            prop = icalcomponent_get_next_property(comp, plan->kind)) {
 
-                    /* we have a match! */
-                    ctx->match = 1;
+        const dav_calendar_param_plan *param_filter;
 
-                    break;
-                }
+        if (plan->by_name) {
+            const char *name = icalproperty_get_property_name(prop);
 
-                elem = dav_find_next_ns(elem, ctx->ns, "param-filter");
+            if (!name || strcasecmp(name, plan->name)) {
+                continue;
             }
+        }
 
-        } else {
+        /* found, but we didn't want to find, so no match */
+        if (plan->is_not_defined) {
+            return 0;
+        }
 
-            /* found, look at the next level */
+        if (plan->stt && !dav_calendar_prop_time_range(comp, prop,
+                plan->stt, plan->ett)) {
+            continue;
+        }
 
-            /* explicit is-not-defined? */
-            if ((is_not_defined = dav_find_child_ns(elem, ctx->ns, "is-not-defined"))) {
-                /* found, but we didn't want to find, so no match */
+        if (plan->text_match && !dav_calendar_text_match(plan->text_match,
+                icalproperty_get_value_as_string(prop))) {
+            continue;
+        }
 
+        for (param_filter = plan->param_filters; param_filter;
+                param_filter = param_filter->next) {
+            if (!dav_calendar_match_param_filter(ctx, param_filter, prop)) {
+                break;
             }
+        }
 
-            else {
+        if (!param_filter) {
+            return 1;
+        }
+    }
 
-                text_match = dav_find_child_ns(elem, ctx->ns, "text-match");
-                if (text_match) {
+    return plan->is_not_defined;
+}
 
-                    const char *text =
-                            icalparameter_enum_to_string(icalparameter_get_value(param));
+static int dav_calendar_match_comp_filter(dav_calendar_ctx *ctx,
+        const dav_calendar_comp_plan *plan, icalcomponent *parent);
 
-                    if (!text) {
-                        text = icalparameter_get_xvalue(param);
-                    }
+static int dav_calendar_match_time_range(dav_calendar_ctx *ctx,
+        icalcomponent *comp, icaltimetype *stt, icaltimetype *ett);
 
-                    err = dav_calendar_text_match(ctx, timezone, text_match, text);
-                    if (err) {
-                        return err;
-                    }
+/* does the component pass the tests beneath the comp-filter? */
+static int dav_calendar_match_comp(dav_calendar_ctx *ctx,
+        const dav_calendar_comp_plan *plan, icalcomponent *comp)
+{
+    const dav_calendar_prop_plan *prop_filter;
+    const dav_calendar_comp_plan *comp_filter;
 
-                }
+    if (plan->stt) {
+        int match = 0;
 
-                /* none of the above? we have a match */
-                if (!stt && !ett && !text_match) {
+        if (icalcomponent_isa(comp) == ICAL_VCALENDAR_COMPONENT) {
+            icalcomponent *cp;
 
-                    /* we have a match! */
-                    ctx->match = 1;
+            for (cp = icalcomponent_get_first_component(comp,
+                    ICAL_ANY_COMPONENT); cp && !match;
+                    cp = icalcomponent_get_next_component(comp,
+                            ICAL_ANY_COMPONENT)) {
+                match = dav_calendar_match_time_range(ctx, cp, plan->stt,
+                        plan->ett);
+            }
+        }
+        else {
+            match = dav_calendar_match_time_range(ctx, comp, plan->stt,
+                    plan->ett);
+        }
 
-                }
+        if (!match) {
+            return 0;
+        }
+    }
 
-            }
+    for (prop_filter = plan->prop_filters; prop_filter;
+            prop_filter = prop_filter->next) {
+        if (!dav_calendar_match_prop_filter(ctx, prop_filter, comp)) {
+            return 0;
         }
+    }
 
-        param = icalproperty_get_next_parameter(prop,
-                ICAL_ANY_PARAMETER);
+    for (comp_filter = plan->comp_filters; comp_filter;
+            comp_filter = comp_filter->next) {
+        if (!dav_calendar_match_comp_filter(ctx, comp_filter, comp)) {
+            return 0;
+        }
     }
 
-    return NULL;
+    return 1;
 }
 
-static dav_error *dav_calendar_prop_filter(dav_calendar_ctx *ctx,
-        const apr_xml_elem *timezone, const apr_xml_elem *prop_filter,
-        icalcomponent *comp, icalproperty *prop, icaltimetype *stt,
-        icaltimetype *ett)
+/* does any child of the parent satisfy the comp-filter? */
+static int dav_calendar_match_comp_filter(dav_calendar_ctx *ctx,
+        const dav_calendar_comp_plan *plan, icalcomponent *parent)
 {
-    dav_error *err;
+    icalcomponent *comp;
 
-    const apr_xml_elem *param_filter = NULL;
-    const apr_xml_elem *is_not_defined = NULL;
-    const apr_xml_elem *time_range = NULL;
-    const apr_xml_elem *text_match = NULL;
-    const apr_xml_elem *elem = NULL;
-    const apr_xml_attr *name;
+    for (comp = icalcomponent_get_first_component(parent, plan->kind); comp;
+            comp = icalcomponent_get_next_component(parent, plan->kind)) {
 
-    const char *ppname;
+        /* found, but we didn't want to find, so no match */
+        if (plan->is_not_defined) {
+            return 0;
+        }
 
-    /* we already matched? */
-    if (ctx->match) {
-        return NULL;
+        if (dav_calendar_match_comp(ctx, plan, comp)) {
+            return 1;
+        }
     }
 
-    /*
-     * <!ELEMENT prop-filter (is-not-defined |
-     *                        ((time-range | text-match)?,
-     *                         param-filter*))>
-     *
-     * <!ATTLIST prop-filter name CDATA #REQUIRED>
-     * name value: a calendar property name (e.g., ATTENDEE)
-     */
-
-    /* do children of prop match prop_filter? */
-
-    int found = 0;
-    while (prop) {
+    return plan->is_not_defined;
+}
 
-        ppname = icalproperty_get_property_name(prop);
+/* run the compiled filter against a calendar object */
+static int dav_calendar_match_filter(dav_calendar_ctx *ctx,
+        const dav_calendar_filter_plan *plan, icalcomponent *comp)
+{
+    const dav_calendar_comp_plan *comp_filter = plan->comp_filter;
 
-        elem = prop_filter;
+    if (icalcomponent_isa(comp) != comp_filter->kind) {
+        return comp_filter->is_not_defined;
+    }
 
-        while (elem) {
+    if (comp_filter->is_not_defined) {
+        return 0;
+    }
 
-            name = dav_find_attr_ns(elem, APR_XML_NS_NONE, "name");
-            if (!name) {
-                /* MUST violation */
-                err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0,
-                        APR_SUCCESS,
-                        "Name attribute must exist in prop-filter");
-                err->tagname = "CALDAV:valid-filter";
-                return err;
-            }
+    return dav_calendar_match_comp(ctx, comp_filter, comp);
+}
 
-            /* matched our name? found it */
-            if (ppname && name->value && !strcmp(ppname, name->value)) {
-                found = 1;
-                break;
-            }
+static dav_error *dav_calendar_filter(dav_calendar_ctx *ctx, icalcomponent *comp)
+{
+    dav_error *err;
 
-            elem = dav_find_next_ns(elem, ctx->ns, "prop-filter");
-        }
+    const apr_xml_doc *doc = NULL;
 
-        if (!found) {
-            /* not found, no match yet, unless... */
+    if (!ctx->doc) {
+        return NULL;
+    }
 
-            elem = prop_filter;
+    doc = ctx->doc;
 
-            while (elem) {
-                if (dav_find_child_ns(elem, ctx->ns, "is-not-defined")) {
+    if (dav_validate_root_ns(doc, ctx->ns, "calendar-query")) {
 
-                    /* we have a match! */
-                    ctx->match = 1;
+        int match = ctx->match;
 
-                    break;
-                }
+        /* the report compiles the filter up front, compile it now if not */
+        if (!ctx->plan) {
+            dav_calendar_filter_plan *plan;
 
-                elem = dav_find_next_ns(elem, ctx->ns, "prop-filter");
+            if ((err = dav_calendar_compile_filter(ctx->r->pool, doc, ctx->ns,
+                    &plan))) {
+                return err;
             }
 
-        } else {
+            ctx->plan = plan;
+        }
 
-            /* found, look at the next level */
+        if (ctx->plan->timezone) {
+            icalcomponent_merge_component(comp,
+                    icalcomponent_new_clone(ctx->plan->timezone));
+        }
 
-            /* explicit is-not-defined? */
-            if ((is_not_defined = dav_find_child_ns(elem, ctx->ns, "is-not-defined"))) {
-                /* found, but we didn't want to find, so no match */
+        /* any one calendar in the resource matching is enough */
+        ctx->match = dav_calendar_match_filter(ctx, ctx->plan, comp) || match;
 
-            }
+        return NULL;
+    }
 
-            else {
+    else if (dav_validate_root_ns(doc, ctx->ns, "calendar-multiget")) {
 
-                if ((time_range = dav_find_child_ns(elem, ctx->ns, "time-range"))) {
+        /* no filters on multiget */
+        ctx->match = 1;
 
-                    err = dav_calendar_time_range(ctx, time_range, &stt, &ett);
-                    if (err) {
-                        return err;
-                    }
+        return NULL;
+    }
 
-                }
+    else if (dav_validate_root(doc, "sync-collection")) {
 
-                if ((text_match = dav_find_child_ns(elem, ctx->ns, "text-match"))) {
+        /* no filters on sync-collection, calendar-data is just a prop */
+        ctx->match = 1;
 
-                    const char *text = icalproperty_get_value_as_string(prop);
+        return NULL;
+    }
 
-                    err = dav_calendar_text_match(ctx, timezone, text_match, text);
-                    if (err) {
-                        return err;
-                    }
+    /* MUST violation */
+    err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
+            "Root element not validated");
+    err->tagname = "CALDAV:valid-filter";
+    return err;
+}
 
-                }
+/* filter by <C:prop/> beneath calendar-data */
+static dav_error *dav_calendar_prop(dav_calendar_ctx *ctx,
+        const apr_xml_elem *parent, icalcomponent *icomp)
+{
+    dav_error *err;
 
-                if ((param_filter = dav_find_child_ns(elem, ctx->ns,
-                        "param-filter"))) {
+    icalproperty *cp, *next;
+    const char *pname;
 
-                    err = dav_calendar_param_filter(ctx, timezone, param_filter,
-                            prop, icalproperty_get_first_parameter(prop,
-                                    ICAL_ANY_PARAMETER), stt, ett);
-                    if (err) {
-                        return err;
-                    }
-                }
+    const apr_xml_elem *elem = NULL;
+    const apr_xml_attr *name, *novalue;
 
-                if (stt && ett) {
+    /* anything to filter? */
+    elem = dav_find_child_ns(parent, ctx->ns, "allprop");
+    if (elem) {
+        return NULL;
+    }
 
-                    err = dav_calendar_prop_time_range(ctx, timezone, comp, prop,
-                            stt, ett);
-                    if (err) {
-                        return err;
-                    }
+    elem = dav_find_child_ns(parent, ctx->ns, "prop");
+    if (!elem) {
+        return NULL;
+    }
 
-                }
+    for (cp = icalcomponent_get_first_property(icomp, ICAL_ANY_PROPERTY);
+            cp != NULL; cp = next) {
 
-                /* none of the above? we have a match */
-                if (!stt && !ett && !time_range && !text_match && !param_filter) {
+        next = icalcomponent_get_next_property(icomp, ICAL_ANY_PROPERTY);
 
-                    /* we have a match! */
-                    ctx->match = 1;
-
-                }
-
-            }
-        }
-
-        prop = icalcomponent_get_next_property(comp,
-                ICAL_ANY_PROPERTY);
-    }
-
-    return NULL;
-}
-
-static dav_error *dav_calendar_comp_filter(dav_calendar_ctx *ctx,
-        const apr_xml_elem *timezone, const apr_xml_elem *comp_filter,
-        icalcomponent *comp, icaltimetype *stt, icaltimetype *ett)
-{
-    dav_error *err;
-
-    const apr_xml_elem *prop_filter = NULL;
-    const apr_xml_elem *is_not_defined = NULL;
-    const apr_xml_elem *time_range = NULL;
-    const apr_xml_elem *elem = NULL;
-    const apr_xml_attr *name;
-
-    /* we already matched? */
-    if (ctx->match) {
-        return NULL;
-    }
-
-    /*
-     * <!ELEMENT comp-filter (is-not-defined | (time-range?,
-     *                        prop-filter*, comp-filter*))>
-     *
-     * <!ATTLIST comp-filter name CDATA #REQUIRED>
-     * name value: a calendar object or calendar component
-     *             type (e.g., VEVENT)
-     */
-
-    /* do children of comp match comp_filter? */
-    int found = 0;
-    while (comp) {
-
-        icalcomponent_kind ev = icalcomponent_isa(comp);
-
-        elem = comp_filter;
-
-        while (elem) {
-
-            name = dav_find_attr_ns(elem, APR_XML_NS_NONE, "name");
-            if (!name) {
-                /* MUST violation */
-                err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0,
-                        APR_SUCCESS,
-                        "Name attribute must exist in comp-filter");
-                err->tagname = "CALDAV:valid-filter";
-                return err;
-            }
-
-            /*
-             * Bug: https://github.com/libical/libical/issues/433
-             *
-             * There is no way to get the component name, and so we cannot
-             * support filtering of experimental components.
-             */
-            /* no kind match? leave with no match */
-            if (ev == icalcomponent_string_to_kind((char *) name->value)) {
-                found = 1;
-                break;
-            }
-
-            elem = dav_find_next_ns(elem, ctx->ns, "comp-filter");
-        }
-
-        if (!found) {
-            /* not found, no match yet, unless... */
-
-            elem = comp_filter;
-
-            while (elem) {
-                if (dav_find_child_ns(elem, ctx->ns, "is-not-defined")) {
-
-                    /* we have a match! */
-                    ctx->match = 1;
-
-                    break;
-                }
-
-                elem = dav_find_next_ns(elem, ctx->ns, "comp-filter");
-            }
-
-        } else {
-
-            /* found, look at the next level */
-
-            /* explicit is-not-defined? */
-            if ((is_not_defined = dav_find_child_ns(elem, ctx->ns, "is-not-defined"))) {
-                /* found, but we didn't want to find, so no match */
-
-            }
-
-            else {
-
-                if ((time_range = dav_find_child_ns(elem, ctx->ns, "time-range"))) {
-
-                    err = dav_calendar_time_range(ctx, time_range, &stt, &ett);
-                    if (err) {
-                        return err;
-                    }
-
-                }
-
-                if ((prop_filter = dav_find_child_ns(elem, ctx->ns,
-                        "prop-filter"))) {
-
-                    err = dav_calendar_prop_filter(ctx, timezone, prop_filter,
-                            comp, icalcomponent_get_first_property(comp,
-                                    ICAL_ANY_PROPERTY), stt, ett);
-                    if (err) {
-                        return err;
-                    }
-                }
-
-                if ((comp_filter = dav_find_child_ns(elem, ctx->ns,
-                        "comp-filter"))) {
-
-                    err = dav_calendar_comp_filter(ctx, timezone, comp_filter,
-                            icalcomponent_get_first_component(comp,
-                                    ICAL_ANY_COMPONENT), stt, ett);
-                    if (err) {
-                        return err;
-                    }
-                }
-
-                if (stt && ett && !comp_filter && !prop_filter) {
-
-                    if (icalcomponent_isa(comp) == ICAL_VCALENDAR_COMPONENT) {
-
-                        comp = icalcomponent_get_first_component(comp,
-                                                        ICAL_ANY_COMPONENT);
-                        while (comp) {
-
-                            err = dav_calendar_comp_time_range(ctx, timezone, comp,
-                                    stt, ett);
-                            if (err) {
-                                return err;
-                            }
-
-                            comp = icalcomponent_get_next_component(comp,
-                                    ICAL_ANY_COMPONENT);
-                        }
-                    }
-                    else {
-
-                        err = dav_calendar_comp_time_range(ctx, timezone, comp, stt,
-                                ett);
-                        if (err) {
-                            return err;
-                        }
-
-                    }
-
-                }
-
-                /* none of the above? we have a match */
-                if (!stt && !ett && !time_range && !prop_filter && !comp_filter) {
-
-                    /* we have a match! */
-                    ctx->match = 1;
-
-                }
-            }
-        }
-
-        comp = icalcomponent_get_next_component(comp,
-                ICAL_ANY_COMPONENT);
-    }
-
-    return NULL;
-}
-
-static dav_error *dav_calendar_filter(dav_calendar_ctx *ctx, icalcomponent *comp)
-{
-    dav_error *err;
-
-    const apr_xml_doc *doc = NULL;
-    const apr_xml_elem *filter = NULL;
-    const apr_xml_elem *comp_filter = NULL;
-    const apr_xml_elem *timezone = NULL;
-
-    if (!ctx->doc) {
-        return NULL;
-    }
-
-    doc = ctx->doc;
-
-    /*
-     * <!ELEMENT calendar-query ((DAV:allprop |
-     *                            DAV:propname |
-     *                            DAV:prop)?, filter, timezone?)>
-     */
-    if (dav_validate_root_ns(doc, ctx->ns, "calendar-query")) {
-
-        /*
-         * <!ELEMENT filter (comp-filter)>
-         */
-        if ((filter = dav_find_child_ns(doc->root, ctx->ns, "filter")) == NULL) {
-            /* MUST violation */
-            err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
-                    "Filter element must exist beneath calendar-query");
-            err->tagname = "CALDAV:valid-filter";
-            return err;
-        }
-
-        timezone = dav_find_child_ns(doc->root, ctx->ns, "timezone");
-        if (timezone) {
-
-            icalcomponent *tz = icalparser_parse_string(
-                    dav_xml_get_cdata(timezone, ctx->r->pool,
-                            1 /* strip_white */));
-            if(icalerrno != ICAL_NO_ERROR) {
-                if (tz) {
-                    icalcomponent_free(tz);
-                }
-                err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
-                        icalerror_perror());
-                err->tagname = "CALDAV:valid-filter";
-                return err;
-            }
-
-            icalcomponent_merge_component(comp, tz);
-        }
-
-        if ((comp_filter = dav_find_child_ns(filter, ctx->ns, "comp-filter")) == NULL) {
-            /* MUST violation */
-            err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
-                    "Comp-filter element must exist beneath filter element");
-            err->tagname = "CALDAV:valid-filter";
-            return err;
-        }
-
-        if ((err = dav_calendar_comp_filter(ctx, timezone, comp_filter, comp,
-                NULL, NULL))) {
-            return err;
-        }
-
-        return NULL;
-    }
-
-    else if (dav_validate_root_ns(doc, ctx->ns, "calendar-multiget")) {
-
-        /* no filters on multiget */
-        ctx->match = 1;
-
-        return NULL;
-    }
-
-    else if (dav_validate_root_ns(doc, ctx->ns, "free-busy-query")) {
-
-        icaltimetype *stt;
-        icaltimetype *ett;
-
-        const apr_xml_elem *time_range = NULL;
-
-        if ((time_range = dav_find_child_ns(doc->root, ctx->ns, "time-range"))) {
-
-            err = dav_calendar_time_range(ctx, time_range, &stt, &ett);
-            if (err) {
-                return err;
-            }
-
-        }
-        else {
-            /* MUST violation */
-            err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
-                    "Time-range element must exist beneath free-busy-query element");
-            err->tagname = "CALDAV:valid-filter";
-            return err;
-        }
-
-        if ((err = dav_calendar_freebusy_time_range(ctx, comp, stt, ett))) {
-            return err;
-        }
-
-        return NULL;
-    }
-
-    /* MUST violation */
-    err = dav_new_error(ctx->r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
-            "Root element not validated");
-    err->tagname = "CALDAV:valid-filter";
-    return err;
-}
-
-/* filter by <C:prop/> beneath calendar-data */
-static dav_error *dav_calendar_prop(dav_calendar_ctx *ctx,
-        const apr_xml_elem *parent, icalcomponent *icomp)
-{
-    dav_error *err;
-
-    icalproperty *cp, *next;
-    const char *pname;
-
-    const apr_xml_elem *elem = NULL;
-    const apr_xml_attr *name, *novalue;
-
-    /* anything to filter? */
-    elem = dav_find_child_ns(parent, ctx->ns, "allprop");
-    if (elem) {
-        return NULL;
-    }
-
-    elem = dav_find_child_ns(parent, ctx->ns, "prop");
-    if (!elem) {
-        return NULL;
-    }
-
-    for (cp = icalcomponent_get_first_property(icomp, ICAL_ANY_PROPERTY);
-            cp != NULL; cp = next) {
-
-        next = icalcomponent_get_next_property(icomp, ICAL_ANY_PROPERTY);
-
-        pname = icalproperty_get_property_name(cp);
+        pname = icalproperty_get_property_name(cp);
 
         elem = dav_find_child_ns(parent, ctx->ns, "prop");
         if (elem) {
@@ -1883,1967 +2022,7145 @@ static dav_error *dav_calendar_comp(dav_calendar_ctx *ctx,
     return NULL;
 }
 
-static apr_status_t dav_calendar_brigade_split_folded_line(apr_bucket_brigade *bbOut,
-                                                           apr_bucket_brigade *bbIn,
-                                                           apr_read_type_e block,
-                                                           apr_off_t maxbytes,
-                                                           int *state)
+/*
+ * Expansion and limiting of recurrence sets beneath calendar-data.
+ *
+ * The <C:expand/> element asks for each recurring component to be
+ * replaced by its instances overlapping a time range, with all times in
+ * UTC and no recurrence properties. The <C:limit-recurrence-set/> element
+ * keeps the recurrence rules, but drops the overridden instances that
+ * fall outside the time range, and <C:limit-freebusy-set/> drops the
+ * FREEBUSY periods outside the time range.
+ *
+ * Instances are generated one at a time by the recurrence walk and added
+ * straight to the calendar being returned, and the walk is abandoned as
+ * soon as DavCalendarMaxInstances is exceeded.
+ */
+
+typedef struct dav_calendar_expand_ctx {
+    dav_calendar_ctx *ctx;
+    /* the calendar receiving the instances */
+    icalcomponent *out;
+    /* overridden instances, keyed by UID and RECURRENCE-ID */
+    apr_hash_t *overrides;
+    icaltime_span limit;
+    int instances;
+    int max;
+} dav_calendar_expand_ctx;
+
+static const char *dav_calendar_instance_key(apr_pool_t *p,
+        icalcomponent *comp, icaltimetype t)
 {
-    apr_off_t readbytes = 0;
+    const char *uid = icalcomponent_get_uid(comp);
 
-    while (!APR_BRIGADE_EMPTY(bbIn)) {
-        const char *pos = NULL;
-        const char *str;
-        apr_size_t len;
-        apr_status_t rv;
-        apr_bucket *e;
+    return apr_psprintf(p, "%s %" APR_TIME_T_FMT, uid ? uid : "",
+            (apr_time_t) icaltime_as_timet_with_zone(t,
+                    t.zone ? t.zone : icaltimezone_get_utc_timezone()));
+}
 
-        e = APR_BRIGADE_FIRST(bbIn);
-        rv = apr_bucket_read(e, &str, &len, block);
+static icaltimetype dav_calendar_expand_utc(icaltimetype t)
+{
+    if (t.is_date || icaltime_is_null_time(t)) {
+        return t;
+    }
 
-        if (rv != APR_SUCCESS) {
-            return rv;
-        }
+    return icaltime_convert_to_zone(t, icaltimezone_get_utc_timezone());
+}
 
-        if (*state == 0) {
-            pos = memchr(str, APR_ASCII_CR, len);
-            if (pos) {
-                len = pos - str;
-                apr_bucket_split(e, len);
-                *state = APR_ASCII_CR;
-            }
-            else {
-                pos = memchr(str, APR_ASCII_LF, len);
-                if (pos) {
-                    len = pos - str;
-                    apr_bucket_split(e, len);
-                    *state = APR_ASCII_LF;
-                }
-            }
-        }
+/* set a date or date-time property, moving it by shift seconds */
+static void dav_calendar_expand_time(icalcomponent *comp,
+        icalproperty_kind kind, time_t shift)
+{
+    icalproperty *prop = icalcomponent_get_first_property(comp, kind);
+    icaltimetype t;
 
-        else if (*state == APR_ASCII_CR) {
-            if (len) {
-                if (*str == APR_ASCII_CR) {
-                    apr_bucket_split(e, 1);
-                    apr_bucket_delete(e);
-                    *state = APR_ASCII_LF;
-                    continue;
-                }
-            }
-        }
+    if (!prop) {
+        return;
+    }
 
-        else if (*state == APR_ASCII_LF) {
-            if (len) {
-                if (*str == APR_ASCII_LF) {
-                    apr_bucket_split(e, 1);
-                    apr_bucket_delete(e);
-                    *state = APR_ASCII_BLANK;
-                    continue;
-                }
-            }
-        }
+    t = icalvalue_get_datetime(icalproperty_get_value(prop));
 
-        else if (*state == APR_ASCII_BLANK) {
-            if (len) {
-                if (*str == APR_ASCII_BLANK || *str == APR_ASCII_TAB) {
-                    apr_bucket_split(e, 1);
-                    apr_bucket_delete(e);
-                    *state = 0;
-                    continue;
-                }
-                else {
-                    *state = 0;
-                    return APR_SUCCESS;
-                }
-            }
-        }
+    if (t.is_date) {
+        icaltime_adjust(&t, shift / (24 * 60 * 60), 0, 0, 0);
+        icalproperty_set_value(prop, icalvalue_new_date(t));
+    }
+    else {
+        t = icaltime_from_timet_with_zone(icaltime_as_timet_with_zone(t,
+                t.zone ? t.zone : icaltimezone_get_utc_timezone()) + shift,
+                0, icaltimezone_get_utc_timezone());
+        icalproperty_set_value(prop, icalvalue_new_datetime(t));
+    }
 
-        else {
-            /* invalid state - fail outright */
-            return APR_EINVAL;
-        }
+    icalproperty_remove_parameter_by_kind(prop, ICAL_TZID_PARAMETER);
+}
 
-        readbytes += len;
+static void dav_calendar_expand_strip(icalcomponent *comp,
+        icalproperty_kind kind)
+{
+    icalproperty *prop;
 
-        APR_BUCKET_REMOVE(e);
-        if (APR_BUCKET_IS_METADATA(e) || len > APR_BUCKET_BUFF_SIZE/4) {
-            APR_BRIGADE_INSERT_TAIL(bbOut, e);
-        }
-        else {
-            if (len > 0) {
-                rv = apr_brigade_write(bbOut, NULL, NULL, str, len);
-                if (rv != APR_SUCCESS) {
-                    return rv;
-                }
-            }
-            apr_bucket_destroy(e);
-        }
-        /* We didn't find a CRLF within the maximum line length. */
-        if (readbytes >= maxbytes) {
-            break;
-        }
+    while ((prop = icalcomponent_get_first_property(comp, kind))) {
+        icalcomponent_remove_property(comp, prop);
+        icalproperty_free(prop);
     }
-
-    return APR_SUCCESS;
 }
 
-static int dav_calendar_parse_icalendar_filter(ap_filter_t *f,
-        apr_bucket_brigade *bb)
+/* add an instance to the result, with its times moved by shift seconds */
+static dav_error *dav_calendar_expand_add(dav_calendar_expand_ctx *ectx,
+        icalcomponent *comp, icaltimetype *recurrence_id, time_t shift)
 {
-    dav_calendar_config_rec *conf = ap_get_module_config(f->r->per_dir_config,
-            &dav_calendar_module);
+    icalcomponent *instance;
+
+    if (++ectx->instances > ectx->max) {
+        dav_error *err = dav_new_error(ectx->ctx->r->pool, HTTP_FORBIDDEN, 0,
+                APR_SUCCESS, apr_psprintf(ectx->ctx->r->pool,
+                        "Expansion exceeds DavCalendarMaxInstances (%d)",
+                        ectx->max));
+        err->tagname = "CALDAV:max-instances";
+        return err;
+    }
 
-    dav_calendar_ctx *ctx = f->ctx;
+    instance = icalcomponent_new_clone(comp);
 
-    icalcomponent *comp;
+    dav_calendar_expand_strip(instance, ICAL_RRULE_PROPERTY);
+    dav_calendar_expand_strip(instance, ICAL_RDATE_PROPERTY);
+    dav_calendar_expand_strip(instance, ICAL_EXDATE_PROPERTY);
+    dav_calendar_expand_strip(instance, ICAL_EXRULE_PROPERTY);
 
-    apr_bucket *e;
-    char *buffer;
-    apr_size_t len = 0;
-    apr_status_t rv = APR_SUCCESS;
-    int state = 0;
+    dav_calendar_expand_time(instance, ICAL_DTSTART_PROPERTY, shift);
+    dav_calendar_expand_time(instance, ICAL_DTEND_PROPERTY, shift);
+    dav_calendar_expand_time(instance, ICAL_DUE_PROPERTY, shift);
 
+    if (recurrence_id) {
+        icalcomponent_add_property(instance,
+                icalproperty_new_recurrenceid(
+                        dav_calendar_expand_utc(*recurrence_id)));
+    }
+    else {
+        dav_calendar_expand_time(instance, ICAL_RECURRENCEID_PROPERTY, 0);
+    }
 
-    while (!APR_BRIGADE_EMPTY(bb)) {
+    icalcomponent_add_component(ectx->out, instance);
 
-        e = APR_BRIGADE_FIRST(bb);
+    return NULL;
+}
 
-        /* EOS means we are done. */
-        if (APR_BUCKET_IS_EOS(e)) {
-            break;
-        }
+static int dav_calendar_expand_fn(icalcomponent *comp,
+        icaltimetype *instance, const icaltime_span *span, void *baton)
+{
+    dav_calendar_expand_ctx *ectx = baton;
+    icaltimetype dtstart = icalcomponent_get_dtstart(comp);
+    int recurring = icalcomponent_get_first_property(comp, ICAL_RRULE_PROPERTY)
+            || icalcomponent_get_first_property(comp, ICAL_RDATE_PROPERTY);
 
-        /* grab a line of max HUGE_STRING_LEN - RFC5545 says SHOULD be 75 chars, not MUST */
-        if (APR_SUCCESS
-                == (rv = dav_calendar_brigade_split_folded_line(ctx->bb, bb, 1,
-                        HUGE_STRING_LEN, &state))) {
-            apr_off_t offset = 0;
-            apr_size_t size = 0;
+    /* overridden instances are handled separately */
+    if (apr_hash_get(ectx->overrides,
+            dav_calendar_instance_key(ectx->ctx->r->pool, comp, *instance),
+            APR_HASH_KEY_STRING)) {
+        return 0;
+    }
 
-            apr_brigade_length(ctx->bb, 1, &offset);
+    ectx->ctx->err = dav_calendar_expand_add(ectx, comp,
+            recurring ? instance : NULL,
+            span->start - icaltime_as_timet_with_zone(dtstart,
+                    dtstart.zone ? dtstart.zone
+                            : icaltimezone_get_utc_timezone()));
 
-            if (offset >= HUGE_STRING_LEN) {
-                ctx->err = dav_new_error(f->r->pool, HTTP_INTERNAL_SERVER_ERROR, 0, APR_EGENERAL,
-                        "iCalendar line was too long - not a calendar?");
-            }
+    return ectx->ctx->err != NULL;
+}
 
-            len += offset;
+typedef struct dav_calendar_override {
+    icalcomponent *comp;
+    const char *uid;
+    time_t rid;
+} dav_calendar_override;
 
-            if (len > conf->max_resource_size) {
-                return APR_ENOSPC;
-            }
+static int dav_calendar_override_cmp(const void *a, const void *b)
+{
+    const dav_calendar_override *oa = a, *ob = b;
 
-            buffer = icalmemory_new_buffer(offset + 1);
+    if (oa->rid != ob->rid) {
+        return oa->rid < ob->rid ? -1 : 1;
+    }
 
-            size = offset;
-            if ((rv = apr_brigade_flatten(ctx->bb, buffer, &size)) != APR_SUCCESS) {
-                icalmemory_free_buffer(buffer);
-                return rv;
-            }
-            buffer[size] = 0;
+    return strcmp(oa->uid ? oa->uid : "", ob->uid ? ob->uid : "");
+}
 
-            comp = icalparser_add_line(ctx->parser, buffer);
-            if(icalerrno != ICAL_NO_ERROR) {
-                ctx->err = dav_new_error(f->r->pool, HTTP_INTERNAL_SERVER_ERROR, 0, APR_EGENERAL,
-                        icalerror_perror());
-                return APR_EGENERAL;
-            }
+static dav_error *dav_calendar_expand(dav_calendar_ctx *ctx,
+        const apr_xml_elem *expand, icalcomponent **icomp)
+{
+    dav_calendar_expand_ctx ectx = { 0 };
+    apr_array_header_t *overrides;
+    apr_hash_index_t *hi;
+    icalcomponent *cp;
+    icalproperty *prop;
+    icaltimetype *stt, *ett;
+    dav_error *err;
+    int i;
 
-            /* found a calendar? */
-            if (comp) {
+    if ((err = dav_calendar_time_range(ctx->r->pool, expand, &stt, &ett))) {
+        return err;
+    }
 
-                /* apply search <C:filter/>, ctx->match will contain the result */
-                ctx->err = dav_calendar_filter(ctx, comp);
-                if (ctx->err) {
-                    icalcomponent_free(comp);
-                    return APR_EGENERAL;
-                }
+    if (icalcomponent_isa(*icomp) != ICAL_VCALENDAR_COMPONENT) {
+        return NULL;
+    }
 
-                if (ctx->elem) {
+    ectx.ctx = ctx;
+    ectx.overrides = apr_hash_make(ctx->r->pool);
+    ectx.max = ((dav_calendar_config_rec *) ap_get_module_config(
+            ctx->r->per_dir_config, &dav_calendar_module))->max_instances;
 
-                    /* strip away everything not listed beneath <C:comp/> */
-                    ctx->err = dav_calendar_comp(ctx, ctx->elem,
-                            &comp);
-                    if (ctx->err) {
-                        icalcomponent_free(comp);
-                        return APR_EGENERAL;
-                    }
-                }
+    ectx.out = icalcomponent_new(ICAL_VCALENDAR_COMPONENT);
 
-                if (!ctx->comp) {
-                    ctx->comp = comp;
-                    apr_pool_cleanup_register(f->r->pool, comp, icalcomponent_cleanup,
-                            apr_pool_cleanup_null);
-                }
-                else {
-                    icalcomponent_merge_component(ctx->comp, comp);
-                }
+    for (prop = icalcomponent_get_first_property(*icomp, ICAL_ANY_PROPERTY);
+            prop; prop = icalcomponent_get_next_property(*icomp,
+                    ICAL_ANY_PROPERTY)) {
+        icalcomponent_add_property(ectx.out, icalproperty_new_clone(prop));
+    }
+
+    /* find the overridden instances first */
+    for (cp = icalcomponent_get_first_component(*icomp, ICAL_ANY_COMPONENT);
+            cp; cp = icalcomponent_get_next_component(*icomp,
+                    ICAL_ANY_COMPONENT)) {
+
+        if (icalcomponent_get_first_property(cp, ICAL_RECURRENCEID_PROPERTY)) {
+            apr_hash_set(ectx.overrides, dav_calendar_instance_key(
+                    ctx->r->pool, cp, icalcomponent_get_recurrenceid(cp)),
+                    APR_HASH_KEY_STRING, cp);
+        }
+    }
+
+    for (cp = icalcomponent_get_first_component(*icomp, ICAL_ANY_COMPONENT);
+            cp && !ctx->err; cp = icalcomponent_get_next_component(*icomp,
+                    ICAL_ANY_COMPONENT)) {
+
+        switch (icalcomponent_isa(cp)) {
+        case ICAL_VEVENT_COMPONENT:
+        case ICAL_VTODO_COMPONENT:
+        case ICAL_VJOURNAL_COMPONENT:
+
+            if (icalcomponent_get_first_property(cp,
+                    ICAL_RECURRENCEID_PROPERTY)) {
+                break;
+            }
 
+            /* without a start there is nothing to expand */
+            if (icaltime_is_null_time(icalcomponent_get_dtstart(cp))) {
+                ctx->err = dav_calendar_expand_add(&ectx, cp, NULL, 0);
+                break;
             }
 
-            apr_brigade_cleanup(ctx->bb);
+            dav_calendar_recurrence_walk(cp, *stt, *ett,
+                    dav_calendar_expand_fn, &ectx);
 
+            break;
+        case ICAL_VTIMEZONE_COMPONENT:
+            /* all times are in UTC, timezones are no longer needed */
+            break;
+        default:
+            icalcomponent_add_component(ectx.out, icalcomponent_new_clone(cp));
         }
-        else {
-            return rv;
+    }
+
+    /*
+     * Overridden instances are returned when they overlap the range,
+     * wherever the instance they replace happened to be, in the order
+     * of the instances they replace.
+     */
+    overrides = apr_array_make(ctx->r->pool, apr_hash_count(ectx.overrides),
+            sizeof(dav_calendar_override));
+    for (hi = apr_hash_first(ctx->r->pool, ectx.overrides); hi;
+            hi = apr_hash_next(hi)) {
+        dav_calendar_override *o = apr_array_push(overrides);
+        icaltimetype rid;
+
+        o->comp = apr_hash_this_val(hi);
+        o->uid = icalcomponent_get_uid(o->comp);
+        rid = icalcomponent_get_recurrenceid(o->comp);
+        o->rid = icaltime_as_timet_with_zone(rid,
+                rid.zone ? rid.zone : icaltimezone_get_utc_timezone());
+    }
+    qsort(overrides->elts, overrides->nelts, sizeof(dav_calendar_override),
+            dav_calendar_override_cmp);
+
+    for (i = 0; i < overrides->nelts && !ctx->err; i++) {
+        icalcomponent *override = APR_ARRAY_IDX(overrides, i,
+                dav_calendar_override).comp;
+
+        if (dav_calendar_recurrence_overlaps(override, *stt, *ett)) {
+            ctx->err = dav_calendar_expand_add(&ectx, override, NULL, 0);
         }
+    }
 
+    if (ctx->err) {
+        err = ctx->err;
+        ctx->err = NULL;
+        icalcomponent_free(ectx.out);
+        return err;
     }
 
-    return APR_SUCCESS;
+    icalcomponent_free(*icomp);
+    *icomp = ectx.out;
+
+    dav_calendar_metrics_count(ctx->r, DAV_CALENDAR_COUNT_INSTANCES,
+            ectx.instances);
+
+    return NULL;
 }
 
-static ap_filter_t *dav_calendar_create_parse_icalendar_filter(request_rec *r,
-        dav_calendar_ctx *ctx)
+static dav_error *dav_calendar_limit_recurrence_set(dav_calendar_ctx *ctx,
+        const apr_xml_elem *limit, icalcomponent *icomp)
 {
-    ap_filter_rec_t *rec = apr_pcalloc(r->pool, sizeof(ap_filter_rec_t));
-    ap_filter_t *f = apr_pcalloc(r->pool, sizeof(ap_filter_t));
-    ap_filter_func ff;
+    icalcomponent *cp, *next;
+    icaltimetype *stt, *ett;
+    dav_error *err;
 
-    /* just enough to bootstrap our filter */
-    ff.out_func = dav_calendar_parse_icalendar_filter;
-    rec->filter_func = ff;
-    f->frec = rec;
-    f->r = r;
-    f->ctx = ctx;
+    if ((err = dav_calendar_time_range(ctx->r->pool, limit, &stt, &ett))) {
+        return err;
+    }
 
-    ctx->match = 0;
+    for (cp = icalcomponent_get_first_component(icomp, ICAL_ANY_COMPONENT);
+            cp; cp = next) {
+        icalproperty *prop;
 
-    if (ctx->doc && ctx->doc->namespaces) {
-        ctx->ns = apr_xml_insert_uri(ctx->doc->namespaces,
-                DAV_CALENDAR_XML_NAMESPACE);
-    }
-    ctx->bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
+        next = icalcomponent_get_next_component(icomp, ICAL_ANY_COMPONENT);
 
-    ctx->parser = icalparser_new();
+        prop = icalcomponent_get_first_property(cp, ICAL_RECURRENCEID_PROPERTY);
+        if (prop) {
+            icaltimetype rid = dav_calendar_expand_utc(
+                    icalproperty_get_recurrenceid(prop));
+            icalparameter *range = icalproperty_get_first_parameter(prop,
+                    ICAL_RANGE_PARAMETER);
 
-    apr_pool_cleanup_register(f->r->pool, ctx->parser, icalparser_cleanup,
-            apr_pool_cleanup_null);
+            /* an override of this and future instances reaches to the end */
+            if (range && icalparameter_get_range(range)
+                    == ICAL_RANGE_THISANDFUTURE
+                    && icaltime_compare(rid, *ett) < 0) {
+                continue;
+            }
 
-    return f;
+            /* the instance replaced, or the replacement, overlaps */
+            if ((icaltime_compare(rid, *stt) >= 0
+                    && icaltime_compare(rid, *ett) < 0)
+                    || dav_calendar_recurrence_overlaps(cp, *stt, *ett)) {
+                continue;
+            }
+
+            icalcomponent_remove_component(icomp, cp);
+            icalcomponent_free(cp);
+        }
+    }
+
+    return NULL;
 }
 
-static dav_prop_insert dav_calendar_insert_prop(const dav_resource *resource,
-        int propid, dav_prop_insert what, apr_text_header *phdr)
+static dav_error *dav_calendar_limit_freebusy_set(dav_calendar_ctx *ctx,
+        const apr_xml_elem *limit, icalcomponent *icomp)
 {
-    request_rec *r = resource->hooks->get_request_rec(resource);
-
-    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
-            &dav_calendar_module);
+    icalcomponent *cp;
+    icaltimetype *stt, *ett;
+    icaltime_span range;
+    dav_error *err;
 
-    apr_pool_t *p = resource->pool;
-    const dav_liveprop_spec *info;
-    int global_ns;
+    if ((err = dav_calendar_time_range(ctx->r->pool, limit, &stt, &ett))) {
+        return err;
+    }
 
-    switch (propid) {
-    case DAV_CALENDAR_PROPID_calendar_data:
-        /* property allowed only in a calendar-multiget */
-        if (!r || r->method_number != M_REPORT) {
-            return DAV_PROP_INSERT_NOTDEF;
+    range.start = icaltime_as_timet_with_zone(*stt,
+            icaltimezone_get_utc_timezone());
+    range.end = icaltime_as_timet_with_zone(*ett,
+            icaltimezone_get_utc_timezone());
+    range.is_busy = 0;
+
+    for (cp = icalcomponent_get_first_component(icomp,
+            ICAL_VFREEBUSY_COMPONENT); cp;
+            cp = icalcomponent_get_next_component(icomp,
+                    ICAL_VFREEBUSY_COMPONENT)) {
+        icalproperty *prop, *next;
+
+        for (prop = icalcomponent_get_first_property(cp,
+                ICAL_FREEBUSY_PROPERTY); prop; prop = next) {
+            struct icalperiodtype period = icalproperty_get_freebusy(prop);
+            icaltime_span span;
+
+            next = icalcomponent_get_next_property(cp, ICAL_FREEBUSY_PROPERTY);
+
+            span.start = icaltime_as_timet_with_zone(period.start,
+                    icaltimezone_get_utc_timezone());
+            span.end = icaltime_is_null_time(period.end) ? span.start
+                    + icaldurationtype_as_int(period.duration)
+                    : icaltime_as_timet_with_zone(period.end,
+                            icaltimezone_get_utc_timezone());
+            span.is_busy = 1;
+
+            if (!icaltime_span_overlaps(&span, &range)) {
+                icalcomponent_remove_property(cp, prop);
+                icalproperty_free(prop);
+            }
         }
+    }
 
-        break;
-    case DAV_CALENDAR_PROPID_calendar_home_set:
-        /* property allowed, handled below */
+    return NULL;
+}
 
-        break;
-    case DAV_CALENDAR_PROPID_max_resource_size:
-        /* property allowed, handled below */
+/* apply <C:expand/>, <C:limit-recurrence-set/> and <C:limit-freebusy-set/> */
+static dav_error *dav_calendar_recurrence(dav_calendar_ctx *ctx,
+        const apr_xml_elem *parent, icalcomponent **icomp)
+{
+    const apr_xml_elem *elem;
+    dav_error *err;
 
-        break;
-    case DAV_CALENDAR_PROPID_supported_collation_set:
-        /* property allowed, handled below */
+    if ((elem = dav_find_child_ns(parent, ctx->ns, "expand"))) {
+        if ((err = dav_calendar_expand(ctx, elem, icomp))) {
+            return err;
+        }
+    }
+    else if ((elem = dav_find_child_ns(parent, ctx->ns,
+            "limit-recurrence-set"))) {
+        if ((err = dav_calendar_limit_recurrence_set(ctx, elem, *icomp))) {
+            return err;
+        }
+    }
 
-    default:
-        /* ### what the heck was this property? */
-        return DAV_PROP_INSERT_NOTDEF;
+    if ((elem = dav_find_child_ns(parent, ctx->ns, "limit-freebusy-set"))) {
+        if ((err = dav_calendar_limit_freebusy_set(ctx, elem, *icomp))) {
+            return err;
+        }
     }
 
-    /* assert: value != NULL */
+    return NULL;
+}
 
-    /* get the information and global NS index for the property */
-    global_ns = dav_get_liveprop_info(propid, &dav_calendar_liveprop_group, &info);
+/*
+ * The calendar index.
+ *
+ * The index is a DBM file holding one record per calendar object
+ * resource, keyed by the URI of the resource. Each record summarises
+ * the resource as it was last parsed: the ETag, the UID, the kinds of
+ * component present, and the span of time covered by the VEVENT
+ * components including their recurrences.
+ *
+ * A record is only trusted while the ETag of the resource matches, so
+ * stale records are ignored and replaced the next time the resource is
+ * parsed. The calendar-query report consults the index to rule out
+ * resources before any subrequest is made or any parsing takes place.
+ */
 
-    /* assert: info != NULL && info->name != NULL */
+#define DAV_CALENDAR_INDEX_VERSION "1"
+#define DAV_CALENDAR_INDEX_FIELDS 9
 
-    if (what == DAV_PROP_INSERT_VALUE) {
+/* slack to cover floating times, all day events and timezone offsets */
+#define DAV_CALENDAR_INDEX_SLACK (2 * 24 * 60 * 60)
 
-        switch (propid) {
-        case DAV_CALENDAR_PROPID_calendar_data: {
-            dav_error *err;
-            dav_liveprop_elem *element = dav_get_liveprop_element(resource);
-            dav_calendar_ctx ctx = { 0 };
-            ctx.r = r;
+#define DAV_CALENDAR_INDEX_MUTEX "dav_calendar-index"
 
-            if (element) {
-                ctx.doc = element->doc;
-                ctx.elem = element->elem;
-            }
+static apr_global_mutex_t *dav_calendar_index_mutex;
 
-            /* we have to "deliver" the stream into an output filter */
-            if (!resource->hooks->handle_get) {
-                int status;
+/*
+ * Open the index for a single lookup or store, and close it again
+ * straight away. Lookups open the index read only, which takes a
+ * shared lock, so that reports running side by side do not wait on
+ * one another. Stores take the index mutex first, so that only one
+ * writer across all processes holds the index at a time.
+ */
+static apr_dbm_t *dav_calendar_index_open(request_rec *r, apr_int32_t mode)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+    apr_dbm_t *db;
+    apr_status_t status;
 
-                request_rec *rr = ap_sub_req_method_uri("GET", resource->uri, r,
-                        dav_calendar_create_parse_icalendar_filter(r, &ctx));
+    if (!conf->index_db) {
+        return NULL;
+    }
 
-                ctx.r = rr;
+    if (mode != APR_DBM_READONLY) {
+        if (!dav_calendar_index_mutex) {
+            return NULL;
+        }
+        if ((status = apr_global_mutex_lock(dav_calendar_index_mutex))
+                != APR_SUCCESS) {
+            ap_log_rerror(APLOG_MARK, APLOG_ERR, status, r,
+                    "mod_dav_calendar: Could not lock the calendar index");
+            return NULL;
+        }
+    }
 
-                status = ap_run_sub_req(rr);
-                if (status != OK) {
+    status = apr_dbm_open(&db, conf->index_db, mode, APR_OS_DEFAULT, r->pool);
+    if (status != APR_SUCCESS) {
+        /* a missing index is expected until the first store */
+        ap_log_rerror(APLOG_MARK,
+                mode == APR_DBM_READONLY ? APLOG_DEBUG : APLOG_WARNING,
+                status, r, "mod_dav_calendar: Could not open calendar "
+                "index '%s', index ignored", conf->index_db);
+        if (mode != APR_DBM_READONLY) {
+            apr_global_mutex_unlock(dav_calendar_index_mutex);
+        }
+        return NULL;
+    }
 
-                    err = dav_push_error(r->pool, status, 0,
-                                         "Unable to read calendar.",
-                                         ctx.err);
-                    dav_log_err(r, err, APLOG_ERR);
+    return db;
+}
 
-                    return DAV_PROP_INSERT_NOTDEF;
-                }
+static void dav_calendar_index_close(apr_dbm_t *db, apr_int32_t mode)
+{
+    apr_dbm_close(db);
+    if (mode != APR_DBM_READONLY) {
+        apr_global_mutex_unlock(dav_calendar_index_mutex);
+    }
+}
 
-            }
+static apr_int64_t dav_calendar_index_timet(icaltimetype t)
+{
+    /* floating times are treated as UTC, the slack covers the difference */
+    return icaltime_as_timet_with_zone(t, t.zone);
+}
 
-            /* mod_dav delivers the body */
-            else if ((err = (*resource->hooks->deliver)(resource,
-                    dav_calendar_create_parse_icalendar_filter(r, &ctx))) != NULL) {
+static int dav_calendar_index_event(dav_calendar_index_rec *rec,
+        icalcomponent *comp, int first, int *unbounded)
+{
+    icalproperty *prop;
+    icaltimetype dtstart;
+    icaltime_span span;
+    apr_int64_t duration;
 
-                err = dav_push_error(r->pool, err->status, 0,
-                                     "Unable to read calendar.",
-                                     ctx.err);
-                dav_log_err(r, err, APLOG_ERR);
+    dtstart = icalcomponent_get_dtstart(comp);
+    if (icaltime_is_null_time(dtstart)) {
+        return 0;
+    }
 
-                return DAV_PROP_INSERT_NOTDEF;
-            }
+    span = icalcomponent_get_span(comp);
+    if (!span.start) {
+        return 0;
+    }
+    duration = span.end > span.start ? span.end - span.start : 0;
 
-            /* how did the parsing go? */
-            if (ctx.err || !ctx.comp) {
-                err = dav_push_error(r->pool, err->status, 0,
-                                     "Unable to parse calendar.",
-                                     ctx.err);
-                dav_log_err(r, err, APLOG_ERR);
+    if (first || span.start < rec->start) {
+        rec->start = span.start;
+    }
+    if (first || span.end > rec->end) {
+        rec->end = span.end;
+    }
 
-                return DAV_PROP_INSERT_NOTDEF;
-            }
+    for (prop = icalcomponent_get_first_property(comp, ICAL_RRULE_PROPERTY);
+            prop; prop = icalcomponent_get_next_property(comp,
+                    ICAL_RRULE_PROPERTY)) {
 
-            if (ctx.match && ctx.comp) {
+        struct icalrecurrencetype recur = icalproperty_get_rrule(prop);
+        icaltimetype last = icaltime_null_time();
 
-                apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>",
-                        global_ns, info->name));
+        rec->has_rrule = 1;
 
-                apr_text_append(p, phdr,
-                        apr_pescape_entity(p,
-                                icalcomponent_as_ical_string(ctx.comp), 0));
+        if (!icaltime_is_null_time(recur.until)) {
+            last = recur.until;
+        }
+        else if (recur.count) {
 
-                apr_text_append(p, phdr, apr_psprintf(p, "</lp%d:%s>" DEBUG_CR,
-                        global_ns, info->name));
+            /* bounded by count, find the start of the last instance */
+            icalrecur_iterator *ritr = icalrecur_iterator_new(recur, dtstart);
+            if (ritr) {
+                icaltimetype next;
 
+                while (!icaltime_is_null_time(next =
+                        icalrecur_iterator_next(ritr))) {
+                    last = next;
+                }
+                icalrecur_iterator_free(ritr);
             }
-            else {
+        }
 
-                /* if there is no match, we want the entire resource to vanish from results */
-                apr_pool_userdata_setn(DAV_CALENDAR_SKIP, DAV_CALENDAR_SKIP, NULL,
-                    resource->pool);
+        if (icaltime_is_null_time(last)) {
+            *unbounded = 1;
+        }
+        else if (dav_calendar_index_timet(last) + duration > rec->recur_end) {
+            rec->recur_end = dav_calendar_index_timet(last) + duration;
+        }
+    }
 
-            }
+    for (prop = icalcomponent_get_first_property(comp, ICAL_RDATE_PROPERTY);
+            prop; prop = icalcomponent_get_next_property(comp,
+                    ICAL_RDATE_PROPERTY)) {
 
-            break;
-        }
-        case DAV_CALENDAR_PROPID_calendar_home_set: {
-            int i;
+        struct icaldatetimeperiodtype rdate = icalproperty_get_rdate(prop);
+        apr_int64_t end;
 
-            apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>",
-                    global_ns, info->name));
+        rec->has_rrule = 1;
 
-            for (i = 0; i < conf->dav_calendar_homes->nelts; ++i) {
-                const char *err = NULL, *url;
-                ap_expr_info_t *home = APR_ARRAY_IDX(conf->dav_calendar_homes, i, ap_expr_info_t *);
+        if (!icaltime_is_null_time(rdate.time)) {
+            end = dav_calendar_index_timet(rdate.time) + duration;
+        }
+        else if (!icaltime_is_null_time(rdate.period.end)) {
+            end = dav_calendar_index_timet(rdate.period.end);
+        }
+        else if (!icaltime_is_null_time(rdate.period.start)) {
+            end = dav_calendar_index_timet(rdate.period.start)
+                    + icaldurationtype_as_int(rdate.period.duration);
+        }
+        else {
+            *unbounded = 1;
+            continue;
+        }
 
-                url = ap_expr_str_exec(r, home, &err);
-                if (err) {
-                    ap_log_rerror(APLOG_MARK, APLOG_WARNING, 0, r,
-                                    "Failure while evaluating the calendar-home-set URL expression for '%s', "
-                                    "calendar home value ignored: %s", r->uri, err);
-                }
-                else {
-                    apr_text_append(p, phdr,
-                            apr_psprintf(p, "<D:href>%s</D:href>", url));
-                }
-
-            }
-
-            apr_text_append(p, phdr, apr_psprintf(p, "</lp%d:%s>" DEBUG_CR,
-                    global_ns, info->name));
-
-            break;
+        if (end > rec->recur_end) {
+            rec->recur_end = end;
         }
-        case DAV_CALENDAR_PROPID_max_resource_size: {
+    }
 
-            apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>",
-                    global_ns, info->name));
+    return 1;
+}
 
-            apr_text_append(p, phdr,
-                    apr_psprintf(p, "<D:href>%" APR_OFF_T_FMT "</D:href>",
-                            conf->max_resource_size));
+static dav_calendar_index_rec *dav_calendar_index_build(apr_pool_t *p,
+        icalcomponent *comp)
+{
+    dav_calendar_index_rec *rec;
+    icalcomponent *cp;
+    const char *kinds = ",";
+    int events = 0;
+    int unbounded = 0;
 
-            apr_text_append(p, phdr, apr_psprintf(p, "</lp%d:%s>" DEBUG_CR,
-                    global_ns, info->name));
+    rec = apr_pcalloc(p, sizeof(dav_calendar_index_rec));
+    rec->span_valid = 1;
 
-            break;
-        }
-        case DAV_CALENDAR_PROPID_supported_collation_set: {
+    for (cp = icalcomponent_get_first_component(comp, ICAL_ANY_COMPONENT);
+            cp; cp = icalcomponent_get_next_component(comp,
+                    ICAL_ANY_COMPONENT)) {
 
-            apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>",
-                    global_ns, info->name));
+        icalcomponent_kind kind = icalcomponent_isa(cp);
+        const char *name = icalcomponent_kind_to_string(kind);
 
-            apr_text_append(p, phdr,
-                    apr_psprintf(p,
-                        "<lp%d:supported-collation>"
-                        DAV_CALENDAR_COLLATION_ASCII_CASEMAP
-                        "</lp%d:supported-collation>",
-                        global_ns, global_ns));
-            apr_text_append(p, phdr,
-                    apr_psprintf(p,
-                        "<lp%d:supported-collation>"
-                        DAV_CALENDAR_COLLATION_OCTET
-                        "</lp%d:supported-collation>",
-                        global_ns, global_ns));
+        if (name && !ap_strstr_c(kinds, apr_pstrcat(p, ",", name, ",", NULL))) {
+            kinds = apr_pstrcat(p, kinds, name, ",", NULL);
+        }
 
-            apr_text_append(p, phdr, apr_psprintf(p, "</lp%d:%s>" DEBUG_CR,
-                    global_ns, info->name));
+        if (!rec->uid) {
+            rec->uid = icalcomponent_get_uid(cp);
+        }
 
+        switch (kind) {
+        case ICAL_VTIMEZONE_COMPONENT:
+            break;
+        case ICAL_VEVENT_COMPONENT:
+            if (!dav_calendar_index_event(rec, cp, !events++, &unbounded)) {
+                rec->span_valid = 0;
+            }
             break;
-        }
         default:
+            /* we only summarise the time span of events */
+            rec->span_valid = 0;
             break;
         }
-
     }
-    else if (what == DAV_PROP_INSERT_NAME) {
-        apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s/>" DEBUG_CR, global_ns, info->name));
+
+    if (!events) {
+        rec->span_valid = 0;
     }
-    else {
-        /* assert: what == DAV_PROP_INSERT_SUPPORTED */
-        apr_text_append(p, phdr, "<D:supported-live-property D:name=\"");
-        apr_text_append(p, phdr, info->name);
-        apr_text_append(p, phdr, "\" D:namespace=\"");
-        apr_text_append(p, phdr, dav_calendar_namespace_uris[info->ns]);
-        apr_text_append(p, phdr, "\"/>" DEBUG_CR);
+    if (unbounded) {
+        rec->recur_end = 0;
     }
 
-    /* we inserted what was asked for */
-    return what;
+    rec->uid = rec->uid ? apr_pstrdup(p, rec->uid) : "";
+    rec->kinds = kinds;
+
+    return rec;
 }
 
-static int dav_calendar_is_writable(const dav_resource *resource, int propid)
+static dav_calendar_index_rec *dav_calendar_index_parse(apr_pool_t *p,
+        const char *val, apr_size_t len)
 {
-    const dav_liveprop_spec *info;
+    dav_calendar_index_rec *rec;
+    char *fields[DAV_CALENDAR_INDEX_FIELDS];
+    char *buf = apr_pstrmemdup(p, val, len);
+    int n = 0;
 
-    (void) dav_get_liveprop_info(propid, &dav_calendar_liveprop_group, &info);
-    return info->is_writable;
-}
+    fields[n++] = buf;
+    while (n < DAV_CALENDAR_INDEX_FIELDS && (buf = strchr(buf, '\t'))) {
+        *buf++ = 0;
+        fields[n++] = buf;
+    }
 
-static dav_error *dav_calendar_patch_validate(const dav_resource *resource,
-    const apr_xml_elem *elem, int operation, void **context, int *defer_to_dead)
-{
-    /* We have no writable properties */
-    return NULL;
-}
+    if (n != DAV_CALENDAR_INDEX_FIELDS
+            || strcmp(fields[0], DAV_CALENDAR_INDEX_VERSION)) {
+        return NULL;
+    }
 
-static dav_error *dav_calendar_patch_exec(const dav_resource *resource,
-    const apr_xml_elem *elem, int operation, void *context,
-    dav_liveprop_rollback **rollback_ctx)
-{
-    /* We have no writable properties */
-    return NULL;
-}
+    rec = apr_pcalloc(p, sizeof(dav_calendar_index_rec));
+    rec->etag = fields[1];
+    rec->uid = fields[2];
+    rec->kinds = fields[3];
+    rec->start = apr_atoi64(fields[4]);
+    rec->end = apr_atoi64(fields[5]);
+    rec->has_rrule = atoi(fields[6]);
+    rec->recur_end = apr_atoi64(fields[7]);
+    rec->span_valid = atoi(fields[8]);
 
-static void dav_calendar_patch_commit(const dav_resource *resource, int operation,
-    void *context, dav_liveprop_rollback *rollback_ctx)
-{
-    /* We have no writable properties */
+    return rec;
 }
 
-static dav_error *dav_calendar_patch_rollback(const dav_resource *resource,
-    int operation, void *context, dav_liveprop_rollback *rollback_ctx)
+static dav_calendar_index_rec *dav_calendar_index_fetch(request_rec *r,
+        apr_pool_t *p, const char *uri, const char *etag)
 {
-    /* We have no writable properties */
-    return NULL;
-}
+    dav_calendar_index_rec *rec;
+    apr_dbm_t *db;
+    apr_datum_t key, val = { 0 };
 
-static const dav_hooks_liveprop dav_hooks_liveprop_calendar =
-{
-    dav_calendar_insert_prop,
-    dav_calendar_is_writable,
-    dav_calendar_namespace_uris,
-    dav_calendar_patch_validate,
-    dav_calendar_patch_exec,
-    dav_calendar_patch_commit,
-    dav_calendar_patch_rollback
-};
+    if (!etag || !(db = dav_calendar_index_open(r, APR_DBM_READONLY))) {
+        return NULL;
+    }
 
-static int dav_calendar_find_liveprop(const dav_resource *resource,
-    const char *ns_uri, const char *name, const dav_hooks_liveprop **hooks)
-{
-    return dav_do_find_liveprop(ns_uri, name, &dav_calendar_liveprop_group, hooks);
-}
+    key.dptr = (char *)uri;
+    key.dsize = strlen(uri);
 
-static dav_error *dav_calendar_options_header(request_rec *r,
-        const dav_resource *resource, apr_text_header *phdr)
-{
-    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
-            &dav_calendar_module);
+    if (apr_dbm_fetch(db, key, &val) != APR_SUCCESS || !val.dptr) {
+        dav_calendar_index_close(db, APR_DBM_READONLY);
+        return NULL;
+    }
 
-    if (conf && conf->dav_calendar) {
-        apr_text_append(r->pool, phdr, "calendar-access");
+    rec = dav_calendar_index_parse(p, val.dptr, val.dsize);
+    apr_dbm_freedatum(db, val);
+    dav_calendar_index_close(db, APR_DBM_READONLY);
+
+    /* stale record? */
+    if (!rec || strcmp(rec->etag, etag)) {
+        return NULL;
     }
 
-    return NULL;
+    return rec;
 }
 
-static dav_error *dav_calendar_options_method(request_rec *r,
-        const dav_resource *resource, apr_text_header *phdr)
+static void dav_calendar_index_store(request_rec *r, const char *uri,
+        const char *etag, dav_calendar_index_rec *rec)
 {
-    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
-            &dav_calendar_module);
+    apr_dbm_t *db;
+    apr_datum_t key, val;
+    apr_status_t status;
 
-    if (conf && conf->dav_calendar) {
-        apr_text_append(r->pool, phdr, "MKCALENDAR");
-        apr_text_append(r->pool, phdr, "REPORT");
+    if (!rec || !etag) {
+        return;
     }
 
-    return NULL;
-}
-
-static dav_options_provider options =
-{
-    dav_calendar_options_header,
-    dav_calendar_options_method,
-    NULL
-};
+    /* tabs and line ends would corrupt the record, don't index */
+    if (strpbrk(etag, "\t\r\n") || strpbrk(rec->uid, "\t\r\n")) {
+        return;
+    }
 
-static int dav_calendar_get_resource_type(const dav_resource *resource,
-                                    const char **type, const char **uri)
-{
-    request_rec *r;
+    rec->etag = etag;
 
-    const dav_provider *provider;
-    dav_error *err;
-    dav_lockdb *lockdb;
-    dav_propdb *propdb;
-    int result = DECLINED;
+    key.dptr = (char *)uri;
+    key.dsize = strlen(uri);
 
-    *type = *uri = NULL;
+    val.dptr = apr_psprintf(r->pool, DAV_CALENDAR_INDEX_VERSION
+            "\t%s\t%s\t%s\t%" APR_INT64_T_FMT "\t%" APR_INT64_T_FMT
+            "\t%d\t%" APR_INT64_T_FMT "\t%d",
+            rec->etag, rec->uid, rec->kinds, rec->start, rec->end,
+            rec->has_rrule, rec->recur_end, rec->span_valid);
+    val.dsize = strlen(val.dptr);
 
-    if (resource && resource->hooks && resource->hooks->get_request_rec) {
-        r = resource->hooks->get_request_rec(resource);
-    }
-    else {
-        return result;
+    if (!(db = dav_calendar_index_open(r, APR_DBM_RWCREATE))) {
+        return;
     }
 
-    /* find the dav provider */
-    provider = dav_get_provider(r);
-    if (provider == NULL) {
-        return dav_handle_err(r, dav_new_error(r->pool, HTTP_METHOD_NOT_ALLOWED, 0, 0,
-                apr_psprintf(r->pool,
-                        "DAV not enabled for %s",
-                        ap_escape_html(r->pool, r->uri))), NULL);
+    status = apr_dbm_store(db, key, val);
+    if (status != APR_SUCCESS) {
+        ap_log_rerror(APLOG_MARK, APLOG_DEBUG, status, r,
+                "mod_dav_calendar: Could not store calendar index record "
+                "for %s", uri);
     }
 
-    /* open lock database, to report on supported lock properties */
-    /* ### should open read-only */
-    if ((err = dav_open_lockdb(r, 0, &lockdb)) != NULL) {
-        return dav_handle_err(r, dav_push_error(r->pool, err->status, 0,
-                "The lock database could not be opened, "
-                "cannot retrieve the resource type.",
-                err), NULL);
-    }
+    dav_calendar_index_close(db, APR_DBM_RWCREATE);
+}
 
-    /* open the property database (readonly) for the resource */
-    if ((err = dav_open_propdb(r, lockdb, resource, 1, NULL,
-                               &propdb)) != NULL) {
-        if (lockdb != NULL) {
-            dav_close_lockdb(lockdb);
+static int dav_calendar_index_overlaps(const dav_calendar_index_rec *rec,
+        icaltimetype *stt, icaltimetype *ett)
+{
+    apr_int64_t start = icaltime_as_timet(*stt);
+    apr_int64_t end = icaltime_as_timet(*ett);
+    apr_int64_t last = rec->end;
+
+    if (rec->has_rrule) {
+        if (!rec->recur_end) {
+            /* unbounded recurrence, could match anything after the start */
+            last = APR_INT64_MAX - DAV_CALENDAR_INDEX_SLACK;
+        }
+        else if (rec->recur_end > last) {
+            last = rec->recur_end;
         }
+    }
 
-        return dav_handle_err(r, dav_push_error(r->pool, err->status, 0,
-                "The property database could not be opened, "
-                "cannot retrieve the resource type.",
-                err), NULL);
+    return end > rec->start - DAV_CALENDAR_INDEX_SLACK
+            && start < last + DAV_CALENDAR_INDEX_SLACK;
+}
+
+/*
+ * Can the calendar-query filter be ruled out using the index alone?
+ *
+ * We only handle the common shape of filter, a VCALENDAR comp-filter
+ * containing one or more component comp-filters, each with an optional
+ * time-range. Every one of the component comp-filters must match, so
+ * it is enough for the index to rule out any one of them. Returns non
+ * zero if the resource cannot match.
+ */
+static int dav_calendar_index_reject(request_rec *r,
+        const dav_calendar_filter_plan *plan, const char *uri,
+        const char *etag, apr_pool_t *p)
+{
+    dav_calendar_index_rec *rec;
+    const dav_calendar_comp_plan *comp_filter;
+
+    if (!plan) {
+        return 0;
     }
 
-    if (propdb) {
-        dav_db *db = NULL;
-        const dav_prop_name prop = { "DAV:", "resourcetype" };
-        dav_prop_name name[1] = { { NULL, NULL } };
-
-        if ((err = provider->propdb->open(resource->pool, resource, 1, &db)) != NULL) {
-            result = dav_handle_err(r, dav_push_error(r->pool, err->status, 0,
-                    "Property database could not be opened, "
-                    "cannot retrieve the resource type.",
-                    err), NULL);
-        }
-
-        if (db) {
-            if ((err = provider->propdb->first_name(db, name)) != NULL) {
-                result = dav_handle_err(r, dav_push_error(r->pool, err->status, 0,
-                        "Property could not be retrieved, "
-                        "cannot retrieve the resource type.",
-                        err), NULL);
-            }
-            else {
+    comp_filter = plan->comp_filter;
+    if (comp_filter->is_not_defined || comp_filter->stt
+            || comp_filter->prop_filters || !comp_filter->comp_filters) {
+        return 0;
+    }
 
-                while (name->ns != NULL) {
-                    apr_text_header hdr[1] = { { 0 } };
-                    int f;
+    rec = dav_calendar_index_fetch(r, p, uri, etag);
+    if (!rec) {
+        return 0;
+    }
 
-                    if (name->name && prop.name && strcmp(name->name, prop.name) == 0
-                            && ((name->ns && prop.ns && strcmp(name->ns, prop.ns) == 0)
-                                    || (!name->ns && !prop.ns))) {
+    for (comp_filter = comp_filter->comp_filters; comp_filter;
+            comp_filter = comp_filter->next) {
+        const char *name = icalcomponent_kind_to_string(comp_filter->kind);
+        int present = name && ap_strstr_c(rec->kinds,
+                apr_pstrcat(p, ",", name, ",", NULL));
 
-                        if ((err = provider->propdb->output_value(db, name, NULL, hdr, &f)) != NULL) {
+        if (comp_filter->is_not_defined) {
+            if (present) {
+                return 1;
+            }
+            continue;
+        }
 
-                            result = dav_handle_err(r, dav_push_error(r->pool, err->status, 0,
-                                    "Property value could not be retrieved, "
-                                    "cannot retrieve the resource type.",
-                                    err), NULL);
+        /* component not present in the resource, filter can't match */
+        if (!present) {
+            return 1;
+        }
 
-                            break;
-                        }
+        if (comp_filter->kind != ICAL_VEVENT_COMPONENT || !rec->span_valid
+                || comp_filter->prop_filters || comp_filter->comp_filters
+                || !comp_filter->stt) {
+            continue;
+        }
 
-                        if (strstr((char *)hdr->first->text, ">calendar<")) {
+        if (!dav_calendar_index_overlaps(rec, comp_filter->stt,
+                comp_filter->ett)) {
+            return 1;
+        }
+    }
 
-                            *type = "calendar";
-                            *uri = DAV_CALENDAR_XML_NAMESPACE;
+    return 0;
+}
 
-                            result = OK;
+/*
+ * The change journal.
+ *
+ * The journal is a DBM file recording the changes made to the members
+ * of each calendar collection, in the order they were made. Each
+ * collection has a head record holding the generation of the journal
+ * and the range of sequence numbers present, and one record per change
+ * holding the operation and the URI of the member changed.
+ *
+ * A sync token names a generation and a sequence number, so that the
+ * changes since the token was issued can be read straight from the
+ * journal, without looking at the members that did not change. The
+ * oldest records are dropped once a collection has more than
+ * DAV_CALENDAR_JOURNAL_MAX of them, and tokens older than that are
+ * refused, which sends the client back to a full sync. A collection
+ * created where another used to be starts a new generation, so that
+ * tokens handed out for the old collection are refused too.
+ */
 
-                        }
+#define DAV_CALENDAR_JOURNAL_VERSION "1"
+#define DAV_CALENDAR_JOURNAL_MAX 10000
+#define DAV_CALENDAR_JOURNAL_MUTEX "dav_calendar-journal"
+/* the generation of a collection that has never changed */
+#define DAV_CALENDAR_JOURNAL_INITIAL "0"
 
-                        break;
-                    }
-                    if ((err = provider->propdb->next_name(db, name)) != NULL) {
+#define DAV_CALENDAR_SYNC_TOKEN_PREFIX "http://apache.org/dav/calendar/sync/"
 
-                        result = dav_handle_err(r, dav_push_error(r->pool, err->status, 0,
-                                "Property could not be retrieved, "
-                                "cannot retrieve the resource type.",
-                                err), NULL);
+#define DAV_CALENDAR_JOURNAL_UPDATE 'U'
+#define DAV_CALENDAR_JOURNAL_DELETE 'D'
 
-                        break;
-                    }
+typedef struct dav_calendar_journal_head {
+    const char *generation;
+    apr_int64_t first;
+    apr_int64_t last;
+} dav_calendar_journal_head;
 
-                }
-                provider->propdb->close(db);
-            }
-        }
+static apr_global_mutex_t *dav_calendar_journal_mutex;
 
-        dav_close_propdb(propdb);
-    }
+static const char *dav_calendar_journal_collection(apr_pool_t *p,
+        const char *uri)
+{
+    char *collection = apr_pstrdup(p, uri);
+    apr_size_t len = strlen(collection);
 
-    if (lockdb != NULL) {
-        dav_close_lockdb(lockdb);
+    /* with or without the trailing slash, the collection is the same */
+    while (len > 1 && collection[len - 1] == '/') {
+        collection[--len] = 0;
     }
 
-    return result;
+    return collection;
 }
 
-static dav_resource_type_provider resource_types =
+/*
+ * Is the journal kept? Without the mutex no changes are recorded, and
+ * the journal cannot be trusted.
+ */
+static int dav_calendar_journal_enabled(request_rec *r)
 {
-    dav_calendar_get_resource_type
-};
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
 
-static dav_error * dav_calendar_etag_walker(dav_walk_resource *wres, int calltype)
+    return conf->journal_db && dav_calendar_journal_mutex;
+}
+
+/*
+ * Open the journal. The journal is opened afresh each time, so that we
+ * see what other processes have written. Readers open the journal read
+ * only, which takes a shared lock, so that sync reports running side by
+ * side do not wait on one another. Writers take the journal mutex first,
+ * so that only one writer across all processes holds the journal at a
+ * time.
+ */
+static apr_dbm_t *dav_calendar_journal_open(request_rec *r, apr_int32_t mode)
 {
-    dav_calendar_ctx *cctx = wres->walk_ctx;
-    const char *etag;
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+    apr_dbm_t *db;
+    apr_status_t status;
 
-    /* avoid loops */
-    if (calltype != DAV_CALLTYPE_MEMBER) {
+    if (!dav_calendar_journal_enabled(r)) {
         return NULL;
     }
 
-    etag = (*wres->resource->hooks->getetag)(wres->resource);
+    if (mode != APR_DBM_READONLY
+            && (status = apr_global_mutex_lock(dav_calendar_journal_mutex))
+            != APR_SUCCESS) {
+        ap_log_rerror(APLOG_MARK, APLOG_ERR, status, r,
+                "mod_dav_calendar: Could not lock the calendar journal");
+        return NULL;
+    }
 
-    if (etag) {
-        if (cctx->sha1) {
-            apr_sha1_update(cctx->sha1, etag, strlen(etag));
+    status = apr_dbm_open(&db, conf->journal_db, mode, APR_OS_DEFAULT,
+            r->pool);
+    if (status != APR_SUCCESS) {
+        /* a missing journal is expected until the first change */
+        ap_log_rerror(APLOG_MARK,
+                mode == APR_DBM_READONLY ? APLOG_DEBUG : APLOG_ERR,
+                status, r, "mod_dav_calendar: Could not open calendar "
+                "journal '%s'", conf->journal_db);
+        if (mode != APR_DBM_READONLY) {
+            apr_global_mutex_unlock(dav_calendar_journal_mutex);
         }
-    }
-    else {
-        cctx->sha1 = NULL;
+        return NULL;
     }
 
-    return NULL;
+    return db;
 }
 
-static dav_error * dav_calendar_get_walker(dav_walk_resource *wres, int calltype)
+static void dav_calendar_journal_close(apr_dbm_t *db, apr_int32_t mode)
 {
-    request_rec *r = wres->resource->hooks->get_request_rec(wres->resource);
+    if (db) {
+        apr_dbm_close(db);
+    }
+    if (mode != APR_DBM_READONLY) {
+        apr_global_mutex_unlock(dav_calendar_journal_mutex);
+    }
+}
 
-    dav_calendar_ctx *cctx = wres->walk_ctx;
-    dav_error *err;
+static apr_datum_t dav_calendar_journal_key(apr_pool_t *p,
+        const char *collection, apr_int64_t seq)
+{
+    apr_datum_t key;
 
-    /* avoid loops */
-    if (calltype != DAV_CALLTYPE_MEMBER) {
-        return NULL;
+    if (seq) {
+        key.dptr = apr_psprintf(p, "%s\t%" APR_INT64_T_FMT, collection, seq);
+    }
+    else {
+        key.dptr = (char *)collection;
     }
+    key.dsize = strlen(key.dptr);
 
-    err = cctx->err = NULL;
+    return key;
+}
 
-    /* check for any method preconditions */
-    if (dav_run_method_precondition(cctx->r, NULL, wres->resource, NULL, &err) != DECLINED
-            && err) {
-        dav_log_err(r, err, APLOG_DEBUG);
-        return NULL;
-    }
+/*
+ * Read the head record of the collection. If there is none, a new
+ * generation of the journal is started when create is set, otherwise
+ * the initial generation is returned, and nothing is written. A journal
+ * that does not exist yet is passed as NULL, and has no head records.
+ */
+static apr_status_t dav_calendar_journal_head_get(request_rec *r,
+        apr_dbm_t *db, const char *collection, dav_calendar_journal_head *head,
+        int create)
+{
+    apr_datum_t key, val = { 0 };
+    apr_status_t status;
 
-    /* we have to "deliver" the stream into an output filter */
-    if (!wres->resource->hooks->handle_get) {
-        int status;
+    key = dav_calendar_journal_key(r->pool, collection, 0);
 
-        request_rec *rr = ap_sub_req_method_uri("GET", wres->resource->uri, r,
-                dav_calendar_create_parse_icalendar_filter(r, cctx));
+    if (db && apr_dbm_fetch(db, key, &val) == APR_SUCCESS && val.dptr) {
+        char *rec = apr_pstrmemdup(r->pool, val.dptr, val.dsize);
+        char *last, *version, *first, *seq;
 
-        status = ap_run_sub_req(rr);
-        if (status != OK) {
+        apr_dbm_freedatum(db, val);
 
-            err = dav_push_error(rr->pool, status, 0,
-                    "Unable to read calendar.",
-                    cctx->err);
+        version = apr_strtok(rec, "\t", &last);
+        head->generation = apr_strtok(NULL, "\t", &last);
+        first = apr_strtok(NULL, "\t", &last);
+        seq = apr_strtok(NULL, "\t", &last);
 
+        if (version && !strcmp(version, DAV_CALENDAR_JOURNAL_VERSION)
+                && head->generation && first && seq) {
+            head->first = apr_atoi64(first);
+            head->last = apr_atoi64(seq);
+            return APR_SUCCESS;
         }
-        ap_destroy_sub_req(rr);
-
     }
 
-    /* mod_dav delivers the body */
-    else if ((err = (*wres->resource->hooks->deliver)(wres->resource,
-            dav_calendar_create_parse_icalendar_filter(r, cctx))) != NULL) {
-
-        err = dav_push_error(r->pool, 0, 0,
-                "Unable to read calendar.", err);
+    head->first = 1;
+    head->last = 0;
 
+    /* nothing has changed yet, there is nothing to write */
+    if (!create) {
+        head->generation = DAV_CALENDAR_JOURNAL_INITIAL;
+        return APR_SUCCESS;
     }
 
-    /* how did the parsing go? */
-    if (!cctx->comp) {
-
-        err = dav_push_error(r->pool, 0, 0,
-                "Unable to parse calendar.",
-                cctx->err);
+    /* a new journal, or one we cannot read, starts a new generation */
+    head->generation = apr_psprintf(r->pool, "%" APR_TIME_T_FMT "-%ld",
+            apr_time_now(), r->connection->id);
 
-    }
+    val.dptr = apr_psprintf(r->pool, DAV_CALENDAR_JOURNAL_VERSION
+            "\t%s\t%" APR_INT64_T_FMT "\t%" APR_INT64_T_FMT,
+            head->generation, head->first, head->last);
+    val.dsize = strlen(val.dptr);
 
-    if (err) {
-        dav_log_err(r, err, APLOG_DEBUG);
+    status = apr_dbm_store(db, key, val);
+    if (status != APR_SUCCESS) {
+        ap_log_rerror(APLOG_MARK, APLOG_ERR, status, r,
+                "mod_dav_calendar: Could not store calendar journal "
+                "head for %s", collection);
     }
 
-    return NULL;
+    return status;
 }
 
-/* Use POOL to temporarily construct a dav_response object (from WRES
-   STATUS, and PROPSTATS) and stream it via WRES's ctx->brigade. */
-static void dav_stream_response(dav_walk_resource *wres,
-                                int status,
-                                dav_get_props_result *propstats,
-                                apr_pool_t *pool)
+static const char *dav_calendar_journal_token(apr_pool_t *p,
+        const dav_calendar_journal_head *head)
 {
-    dav_response resp = { 0 };
-    dav_walker_ctx *ctx = wres->walk_ctx;
+    return apr_psprintf(p, DAV_CALENDAR_SYNC_TOKEN_PREFIX "%s/%"
+            APR_INT64_T_FMT, head->generation, head->last);
+}
 
-    resp.href = wres->resource->uri;
-    resp.status = status;
-    if (propstats) {
-        resp.propresult = *propstats;
+/*
+ * Record a change to a member of a calendar collection.
+ */
+static void dav_calendar_journal_append(request_rec *r,
+        const char *collection_uri, const char *href, char op)
+{
+    const char *collection;
+    dav_calendar_journal_head head;
+    apr_datum_t key, val;
+    apr_status_t status;
+    apr_dbm_t *db;
+
+    /* tabs and line ends would corrupt the journal, don't record */
+    if (strpbrk(href, "\t\r\n")) {
+        return;
     }
 
-    dav_send_one_response(&resp, ctx->bb, ctx->r, pool);
-}
+    if (!(db = dav_calendar_journal_open(r, APR_DBM_RWCREATE))) {
+        return;
+    }
 
-static void dav_calendar_cache_badprops(dav_walker_ctx *ctx)
-{
-    const apr_xml_elem *elem;
-    apr_text_header hdr = { 0 };
+    collection = dav_calendar_journal_collection(r->pool, collection_uri);
 
-    /* just return if we built the thing already */
-    if (ctx->propstat_404 != NULL) {
+    if (dav_calendar_journal_head_get(r, db, collection, &head, 1)
+            != APR_SUCCESS) {
+        dav_calendar_journal_close(db, APR_DBM_RWCREATE);
         return;
     }
 
-    apr_text_append(ctx->w.pool, &hdr,
-                    "<D:propstat>" DEBUG_CR
-                    "<D:prop>" DEBUG_CR);
+    head.last++;
 
-    elem = dav_find_child(ctx->doc->root, "prop");
-    for (elem = elem->first_child; elem; elem = elem->next) {
-        apr_text_append(ctx->w.pool, &hdr,
-                        apr_xml_empty_elem(ctx->w.pool, elem));
+    key = dav_calendar_journal_key(r->pool, collection, head.last);
+    val.dptr = apr_psprintf(r->pool, "%c\t%s", op, href);
+    val.dsize = strlen(val.dptr);
+
+    status = apr_dbm_store(db, key, val);
+
+    /* drop the oldest changes */
+    while (status == APR_SUCCESS
+            && head.last - head.first >= DAV_CALENDAR_JOURNAL_MAX) {
+        apr_dbm_delete(db, dav_calendar_journal_key(r->pool, collection,
+                head.first));
+        head.first++;
     }
 
-    apr_text_append(ctx->w.pool, &hdr,
-                    "</D:prop>" DEBUG_CR
-                    "<D:status>HTTP/1.1 404 Not Found</D:status>" DEBUG_CR
-                    "</D:propstat>" DEBUG_CR);
+    if (status == APR_SUCCESS) {
+        key = dav_calendar_journal_key(r->pool, collection, 0);
+        val.dptr = apr_psprintf(r->pool, DAV_CALENDAR_JOURNAL_VERSION
+                "\t%s\t%" APR_INT64_T_FMT "\t%" APR_INT64_T_FMT,
+                head.generation, head.first, head.last);
+        val.dsize = strlen(val.dptr);
 
-    ctx->propstat_404 = hdr.first;
+        status = apr_dbm_store(db, key, val);
+    }
+
+    if (status != APR_SUCCESS) {
+        ap_log_rerror(APLOG_MARK, APLOG_ERR, status, r,
+                "mod_dav_calendar: Could not record change to %s in the "
+                "calendar journal", href);
+    }
+
+    dav_calendar_journal_close(db, APR_DBM_RWCREATE);
 }
 
-static dav_error * dav_calendar_report_walker(dav_walk_resource *wres, int calltype)
+/*
+ * Start a new generation of the journal for the collection, and for
+ * every collection below it if below is set, because a new collection
+ * has been created in its place. Tokens handed out for the collection
+ * that was there before are no longer valid.
+ *
+ * The new generation starts after a notional first change, so that the
+ * tokens handed out before any change was recorded are refused as well.
+ */
+static void dav_calendar_journal_reset(request_rec *r,
+        const char *collection_uri, int below)
 {
-    dav_walker_ctx *ctx = wres->walk_ctx;
-    dav_error *err = NULL;
-    dav_propdb *propdb;
-    dav_get_props_result propstats = { 0 };
-    void *skip;
+    const char *collection;
+    apr_array_header_t *collections;
+    apr_datum_t key, val;
+    apr_status_t status = APR_SUCCESS;
+    apr_size_t len;
+    apr_dbm_t *db;
+    int i;
 
-    /* ignore collections */
-    if (wres->resource->collection) {
-        return NULL;
+    if (!(db = dav_calendar_journal_open(r, APR_DBM_RWCREATE))) {
+        return;
     }
 
-    /* check for any method preconditions */
-    if (dav_run_method_precondition(ctx->r, NULL, wres->resource, ctx->doc, &err) != DECLINED
-            && err) {
-        dav_log_err(ctx->r, err, APLOG_DEBUG);
-        return NULL;
+    collection = dav_calendar_journal_collection(r->pool, collection_uri);
+    len = strlen(collection);
+
+    collections = apr_array_make(r->pool, 1, sizeof(const char *));
+    APR_ARRAY_PUSH(collections, const char *) = collection;
+
+    /* the heads of the collections below, found before any are changed */
+    if (below && apr_dbm_firstkey(db, &key) == APR_SUCCESS) {
+        while (key.dptr) {
+            if (key.dsize > len + 1 && !memchr(key.dptr, '\t', key.dsize)
+                    && !strncmp(key.dptr, collection, len)
+                    && (key.dptr[len] == '/' || collection[len - 1] == '/')) {
+                APR_ARRAY_PUSH(collections, const char *) =
+                        apr_pstrmemdup(r->pool, key.dptr, key.dsize);
+            }
+            if (apr_dbm_nextkey(db, &key) != APR_SUCCESS) {
+                break;
+            }
+        }
     }
 
-    /*
-    ** Note: ctx->doc can only be NULL for DAV_PROPFIND_IS_ALLPROP. Since
-    ** dav_get_allprops() does not need to do namespace translation,
-    ** we're okay.
-    **
-    ** Note: we cast to lose the "const". The propdb won't try to change
-    ** the resource, however, since we are opening readonly.
-    */
-    err = dav_popen_propdb(ctx->scratchpool,
-                           ctx->r, ctx->w.lockdb, wres->resource, 1,
-                           ctx->doc ? ctx->doc->namespaces : NULL, &propdb);
-    if (err != NULL) {
-        /* ### do something with err! */
+    for (i = 0; i < collections->nelts && status == APR_SUCCESS; i++) {
+        dav_calendar_journal_head head;
+        apr_int64_t seq;
 
-        if (ctx->propfind_type == DAV_PROPFIND_IS_PROP) {
-            dav_get_props_result badprops = { 0 };
+        collection = APR_ARRAY_IDX(collections, i, const char *);
 
-            /* some props were expected on this collection/resource */
-            dav_calendar_cache_badprops(ctx);
-            badprops.propstats = ctx->propstat_404;
-            dav_stream_response(wres, 0, &badprops, ctx->scratchpool);
+        if (dav_calendar_journal_head_get(r, db, collection, &head, 0)
+                != APR_SUCCESS) {
+            continue;
         }
-        else {
-            /* no props on this collection/resource */
-            dav_stream_response(wres, HTTP_OK, NULL, ctx->scratchpool);
+
+        /* the changes of the old generation mean nothing now */
+        for (seq = head.first; seq <= head.last; seq++) {
+            apr_dbm_delete(db, dav_calendar_journal_key(r->pool, collection,
+                    seq));
         }
 
-        apr_pool_clear(ctx->scratchpool);
-        return NULL;
-    }
-    /* ### what to do about closing the propdb on server failure? */
+        key = dav_calendar_journal_key(r->pool, collection, 0);
+        val.dptr = apr_psprintf(r->pool, DAV_CALENDAR_JOURNAL_VERSION
+                "\t%" APR_TIME_T_FMT "-%ld\t2\t1", apr_time_now(),
+                r->connection->id);
+        val.dsize = strlen(val.dptr);
 
-    if (ctx->propfind_type == DAV_PROPFIND_IS_PROP) {
-        propstats = dav_get_props(propdb, ctx->doc);
+        status = apr_dbm_store(db, key, val);
     }
-    else {
-        dav_prop_insert what = ctx->propfind_type == DAV_PROPFIND_IS_ALLPROP
-                                 ? DAV_PROP_INSERT_VALUE
-                                 : DAV_PROP_INSERT_NAME;
-        propstats = dav_get_allprops(propdb, what);
+
+    if (status != APR_SUCCESS) {
+        ap_log_rerror(APLOG_MARK, APLOG_ERR, status, r,
+                "mod_dav_calendar: Could not reset the calendar journal "
+                "for %s", collection);
     }
 
-    /* only send a response if we're not skipped */
-    apr_pool_userdata_get(&skip, DAV_CALENDAR_SKIP, wres->resource->pool);
+    dav_calendar_journal_close(db, APR_DBM_RWCREATE);
+}
 
-    if (!skip) {
-        dav_stream_response(wres, 0, &propstats, ctx->scratchpool);
+/*
+ * Return the current sync token of the collection, or NULL if there is
+ * no journal.
+ */
+static const char *dav_calendar_journal_current(request_rec *r,
+        const char *collection_uri)
+{
+    dav_calendar_journal_head head;
+    const char *token = NULL;
+    apr_dbm_t *db;
+
+    if (!dav_calendar_journal_enabled(r)) {
+        return NULL;
     }
 
-    dav_close_propdb(propdb);
+    db = dav_calendar_journal_open(r, APR_DBM_READONLY);
 
-    /* at this point, ctx->scratchpool has been used to stream a
-       single response.  this function fully controls the pool, and
-       thus has the right to clear it for the next iteration of this
-       callback. */
-    apr_pool_clear(ctx->scratchpool);
+    if (dav_calendar_journal_head_get(r, db,
+            dav_calendar_journal_collection(r->pool, collection_uri), &head, 0)
+            == APR_SUCCESS) {
+        token = dav_calendar_journal_token(r->pool, &head);
+    }
 
-    return NULL;
-}
+    dav_calendar_journal_close(db, APR_DBM_READONLY);
 
+    return token;
+}
 
-static dav_error *dav_calendar_query_report(request_rec *r,
-    const dav_resource *resource,
-    const apr_xml_doc *doc, ap_filter_t *output)
+/*
+ * Read the changes made to the collection since the given sync token.
+ *
+ * The members changed are returned in the order of their most recent
+ * change, each with the most recent operation applied to it. An empty
+ * token returns no changes, for the caller to list every member. The
+ * token to hand back to the client is returned in new_token.
+ */
+static dav_error *dav_calendar_journal_changes(request_rec *r,
+        const char *collection_uri, const char *token,
+        apr_array_header_t **hrefs, apr_array_header_t **ops,
+        const char **new_token)
 {
-    dav_error *err;
-    dav_walker_ctx ctx = { { 0 } };
-    dav_response *multi_status;
-    int depth;
-    int ns = 0;
+    dav_calendar_journal_head head;
+    dav_error *err = NULL;
+    const char *collection, *rest;
+    apr_hash_t *latest;
+    apr_int64_t since, seq;
+    apr_dbm_t *db;
+    int i;
 
-    /* ### validate that only one of these three elements is present */
+    *hrefs = apr_array_make(r->pool, 8, sizeof(const char *));
+    *ops = apr_array_make(r->pool, 8, sizeof(char));
 
-    /* default is allprop */
-    ctx.propfind_type = DAV_PROPFIND_IS_ALLPROP;
-    if (dav_find_child(doc->root, "propname") != NULL) {
-        ctx.propfind_type = DAV_PROPFIND_IS_PROPNAME;
-    }
-    else if (dav_find_child(doc->root, "prop") != NULL) {
-        ctx.propfind_type = DAV_PROPFIND_IS_PROP;
+    if (!dav_calendar_journal_enabled(r)) {
+        return dav_new_error(r->pool, HTTP_FORBIDDEN, 0, 0,
+                "Synchronisation is not available for this collection.");
     }
 
-    ns = apr_xml_insert_uri(doc->namespaces, DAV_CALENDAR_XML_NAMESPACE);
+    db = dav_calendar_journal_open(r, APR_DBM_READONLY);
 
-    if (dav_find_child_ns(doc->root, ns, "filter") != NULL) {
-        ctx.propfind_type = DAV_PROPFIND_IS_PROP;
-    }
-    else {
-        /* "calendar-query" element must have filter */
-        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
-                "The \"calendar-query\" element does not contain a "
-                "filter element.");
+    collection = dav_calendar_journal_collection(r->pool, collection_uri);
+
+    if (dav_calendar_journal_head_get(r, db, collection, &head, 0)
+            != APR_SUCCESS) {
+        dav_calendar_journal_close(db, APR_DBM_READONLY);
+        return dav_new_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0, 0,
+                "The calendar journal could not be read.");
     }
 
-    if ((depth = dav_get_depth(r, 0)) < 0) {
-        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
-                "The \"depth\" header was not valid.");
+    *new_token = dav_calendar_journal_token(r->pool, &head);
+
+    /* initial sync, everything is new */
+    if (!token || !*token) {
+        dav_calendar_journal_close(db, APR_DBM_READONLY);
+        return NULL;
     }
 
-    ctx.w.walk_type = DAV_WALKTYPE_NORMAL | DAV_WALKTYPE_AUTH;
-    ctx.w.func = dav_calendar_report_walker;
-    ctx.w.walk_ctx = &ctx;
-    ctx.w.pool = r->pool;
-    ctx.w.root = resource;
+    /* is the token one of ours, from this generation, and still covered? */
+    since = -1;
+    if (!strncmp(token, DAV_CALENDAR_SYNC_TOKEN_PREFIX,
+            strlen(DAV_CALENDAR_SYNC_TOKEN_PREFIX))) {
+        rest = token + strlen(DAV_CALENDAR_SYNC_TOKEN_PREFIX);
+        i = strlen(head.generation);
+        if (!strncmp(rest, head.generation, i) && rest[i] == '/') {
+            char *end;
 
-    ctx.doc = (apr_xml_doc *)doc;
-    ctx.r = r;
-    ctx.bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
-    apr_pool_create(&ctx.scratchpool, r->pool);
-    apr_pool_tag(ctx.scratchpool, "mod_dav-scratch");
+            since = apr_strtoi64(rest + i + 1, &end, 10);
+            if (*end || end == rest + i + 1) {
+                since = -1;
+            }
+        }
 
-    /* ### should open read-only */
-    if ((err = dav_open_lockdb(r, 0, &ctx.w.lockdb)) != NULL) {
-        return dav_push_error(r->pool, err->status, 0,
-                             "The lock database could not be opened, "
-                             "preventing access to the various lock "
-                             "properties for the PROPFIND.",
-                             err);
+        /* handed out before the first change, good while none are dropped */
+        else if (!strcmp(rest, DAV_CALENDAR_JOURNAL_INITIAL "/0")
+                && head.first == 1) {
+            since = 0;
+        }
     }
-    if (ctx.w.lockdb != NULL) {
-        /* if we have a lock database, then we can walk locknull resources */
-        ctx.w.walk_type |= DAV_WALKTYPE_LOCKNULL;
+
+    if (since < head.first - 1 || since > head.last) {
+        dav_calendar_journal_close(db, APR_DBM_READONLY);
+
+        err = dav_new_error(r->pool, HTTP_FORBIDDEN, 0, 0,
+                "The sync token is not valid for this collection.");
+        err->tagname = "valid-sync-token";
+        return err;
     }
 
-    /* send <multistatus> tag, with all doc->namespaces attached.  */
+    latest = apr_hash_make(r->pool);
 
-    /* NOTE: we *cannot* leave out the doc's namespaces from the
-       initial <multistatus> tag.  if a 404 was generated for an HREF,
-       then we need to spit out the doc's namespaces for use by the
-       404. Note that <response> elements will override these ns0,
-       ns1, etc, but NOT within the <response> scope for the
-       badprops. */
-    dav_begin_multistatus(ctx.bb, r, HTTP_MULTI_STATUS,
-                          doc ? doc->namespaces : NULL);
+    for (seq = since + 1; seq <= head.last; seq++) {
+        apr_datum_t val = { 0 };
+        const char *href;
+        char op;
 
-    /* Have the provider walk the resource. */
-    err = (*resource->hooks->walk)(&ctx.w, depth, &multi_status);
+        if (!db || apr_dbm_fetch(db, dav_calendar_journal_key(r->pool, collection,
+                seq), &val) != APR_SUCCESS || !val.dptr || val.dsize < 3) {
+            continue;
+        }
 
-    if (ctx.w.lockdb != NULL) {
-        (*ctx.w.lockdb->hooks->close_lockdb)(ctx.w.lockdb);
-    }
+        op = val.dptr[0];
+        href = apr_pstrmemdup(r->pool, val.dptr + 2, val.dsize - 2);
+        apr_dbm_freedatum(db, val);
 
-    if (err != NULL) {
-        /* If an error occurred during the resource walk, there's
-           basically nothing we can do but abort the connection and
-           log an error.  This is one of the limitations of HTTP; it
-           needs to "know" the entire status of the response before
-           generating it, which is just impossible in these streamy
-           response situations. */
-        err = dav_push_error(r->pool, err->status, 0,
-                             "Provider encountered an error while streaming"
-                             " a multistatus PROPFIND response.", err);
-        dav_log_err(r, err, APLOG_ERR);
-        r->connection->aborted = 1;
-        return NULL;
+        /* a later change to the same member replaces an earlier one */
+        i = (int)(apr_intptr_t)apr_hash_get(latest, href, APR_HASH_KEY_STRING);
+        if (i) {
+            APR_ARRAY_IDX(*hrefs, i - 1, const char *) = NULL;
+        }
+
+        APR_ARRAY_PUSH(*hrefs, const char *) = href;
+        APR_ARRAY_PUSH(*ops, char) = op;
+        apr_hash_set(latest, href, APR_HASH_KEY_STRING,
+                (void *)(apr_intptr_t)(*hrefs)->nelts);
     }
 
-    dav_finish_multistatus(r, ctx.bb);
+    dav_calendar_journal_close(db, APR_DBM_READONLY);
 
-    /* the response has been sent. */
     return NULL;
 }
 
-static dav_error *dav_calendar_multiget_report(request_rec *r,
-    const dav_resource *resource,
-    const apr_xml_doc *doc, ap_filter_t *output)
-{
-    dav_error *err;
-    apr_xml_elem *href_elem;
-    dav_resource *child_resource;
-    dav_walker_ctx ctx = { { 0 } };
-    dav_response *multi_status = NULL;
+/*
+ * The parsed calendar cache.
+ *
+ * Each child process keeps the most recently parsed calendar object
+ * resources in memory, keyed by the URI and strong ETag of the resource.
+ * A resource whose ETag has changed no longer matches its cache entry,
+ * and the stale entry ages out of the cache. Entries are kept in least
+ * recently used order, and are evicted once the configured memory budget
+ * is exceeded.
+ *
+ * Callers receive a clone of the cached calendar, which they are free to
+ * filter and modify.
+ */
 
-    /* ### validate that only one of these three elements is present */
+/* parsed calendars are several times larger than the text they came from */
+#define DAV_CALENDAR_CACHE_FACTOR 4
 
-    if (doc == NULL || dav_find_child(doc->root, "allprop") != NULL) {
-        /* note: no request body implies allprop */
-        ctx.propfind_type = DAV_PROPFIND_IS_ALLPROP;
-    }
-    else if (dav_find_child(doc->root, "propname") != NULL) {
-        ctx.propfind_type = DAV_PROPFIND_IS_PROPNAME;
-    }
-    else if (dav_find_child(doc->root, "prop") != NULL) {
-        ctx.propfind_type = DAV_PROPFIND_IS_PROP;
-    }
-    else {
-        /* "calendar-multiget" element must have one of the above three children */
-        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
-                "The \"calendar-multiget\" element does not contain one of "
-                "the required child elements (the specific command).");
+typedef struct dav_calendar_cache_entry {
+    APR_RING_ENTRY(dav_calendar_cache_entry) link;
+    const char *key;
+    const char *etag;
+    void *value;
+    void (*destroy)(void *value);
+    apr_size_t size;
+    dav_calendar_cache_kind kind;
+} dav_calendar_cache_entry;
+
+typedef struct dav_calendar_cache {
+#if APR_HAS_THREADS
+    apr_thread_mutex_t *mutex;
+#endif
+    apr_hash_t *entries;
+    APR_RING_HEAD(dav_calendar_cache_lru, dav_calendar_cache_entry) lru;
+    apr_size_t size;
+    apr_size_t max_size;
+} dav_calendar_cache;
+
+static dav_calendar_cache *dav_calendar_cache_global;
+
+static void dav_calendar_cache_lock(dav_calendar_cache *cache)
+{
+#if APR_HAS_THREADS
+    if (cache->mutex) {
+        apr_thread_mutex_lock(cache->mutex);
     }
+#endif
+}
 
-    href_elem = dav_find_child(doc->root, "href");
-    if (!href_elem) {
-        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
-                "The \"calendar-multiget\" element does not contain one or "
-                "more href elements.");
+static void dav_calendar_cache_unlock(dav_calendar_cache *cache)
+{
+#if APR_HAS_THREADS
+    if (cache->mutex) {
+        apr_thread_mutex_unlock(cache->mutex);
     }
+#endif
+}
 
-    ctx.w.walk_type = DAV_WALKTYPE_NORMAL | DAV_WALKTYPE_AUTH;
-    ctx.w.func = dav_calendar_report_walker;
-    ctx.w.walk_ctx = &ctx;
-    ctx.w.pool = r->pool;
-    ctx.w.root = NULL;
-
-    ctx.doc = (apr_xml_doc *)doc;
-    ctx.r = r;
-    ctx.bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
-    apr_pool_create(&ctx.scratchpool, r->pool);
-    apr_pool_tag(ctx.scratchpool, "mod_dav-scratch");
-
-    /* ### should open read-only */
-    if ((err = dav_open_lockdb(r, 0, &ctx.w.lockdb)) != NULL) {
-        return dav_push_error(r->pool, err->status, 0,
-                             "The lock database could not be opened, "
-                             "preventing access to the various lock "
-                             "properties for the PROPFIND.",
-                             err);
-    }
-    if (ctx.w.lockdb != NULL) {
-        /* if we have a lock database, then we can walk locknull resources */
-        ctx.w.walk_type |= DAV_WALKTYPE_LOCKNULL;
-    }
+static void dav_calendar_cache_remove(dav_calendar_cache *cache,
+        dav_calendar_cache_entry *entry)
+{
+    APR_RING_REMOVE(entry, link);
+    apr_hash_set(cache->entries, entry->key, APR_HASH_KEY_STRING, NULL);
+    cache->size -= entry->size;
 
-    /* send <multistatus> tag, with all doc->namespaces attached.  */
+    entry->destroy(entry->value);
+    free(entry);
+}
 
-    /* NOTE: we *cannot* leave out the doc's namespaces from the
-       initial <multistatus> tag.  if a 404 was generated for an HREF,
-       then we need to spit out the doc's namespaces for use by the
-       404. Note that <response> elements will override these ns0,
-       ns1, etc, but NOT within the <response> scope for the
-       badprops. */
-    dav_begin_multistatus(ctx.bb, r, HTTP_MULTI_STATUS,
-                          doc ? doc->namespaces : NULL);
+static apr_status_t dav_calendar_cache_cleanup(void *data)
+{
+    dav_calendar_cache *cache = data;
 
-    /* walk each href eleement */
-    for (; href_elem; href_elem = href_elem->next) {
-        dav_lookup_result lookup;
+    while (!APR_RING_EMPTY(&cache->lru, dav_calendar_cache_entry, link)) {
+        dav_calendar_cache_remove(cache,
+                APR_RING_FIRST(&cache->lru));
+    }
 
-        const char *href = dav_xml_get_cdata(href_elem, ctx.scratchpool, 1 /* strip_white */);
+    return APR_SUCCESS;
+}
 
-        err = NULL;
+static dav_calendar_cache *dav_calendar_cache_create(apr_pool_t *p,
+        server_rec *s, apr_size_t max_size)
+{
+    dav_calendar_cache *cache = apr_pcalloc(p, sizeof(dav_calendar_cache));
 
-        /* get a subrequest for the source, so that we can get a dav_resource
-           for that source. */
-        lookup = dav_lookup_uri(href, r, 0 /* must_be_absolute */);
-        if (lookup.rnew == NULL) {
-            err = &lookup.err;
-        }
-        else if (lookup.rnew->status != HTTP_OK) {
-            err = dav_push_error(r->pool, lookup.rnew->status, 0,
-                    "Could not access the resource.",
-                    NULL);
-        }
+#if APR_HAS_THREADS
+    apr_status_t status;
 
-        /* get the resource from each subrequest */
-        else if ((err = dav_get_resource(lookup.rnew, 0 /* label_allowed */,
-                0 /* use_checked_in */, &child_resource)) == NULL) {
-            /* success */
-            ctx.w.root = child_resource;
-        }
+    status = apr_thread_mutex_create(&cache->mutex, APR_THREAD_MUTEX_DEFAULT,
+            p);
+    if (status != APR_SUCCESS) {
+        ap_log_error(APLOG_MARK, APLOG_ERR, status, s,
+                "mod_dav_calendar: Could not create the calendar cache "
+                "mutex, cache disabled");
+        return NULL;
+    }
+#endif
 
-        /* send a response for any errors */
-        if (err != NULL) {
-            dav_response *new_response;
+    cache->entries = apr_hash_make(p);
+    APR_RING_INIT(&cache->lru, dav_calendar_cache_entry, link);
+    cache->max_size = max_size;
 
-            new_response = apr_pcalloc(ctx.scratchpool, sizeof(*new_response));
+    apr_pool_cleanup_register(p, cache, dav_calendar_cache_cleanup,
+            apr_pool_cleanup_null);
 
-            new_response->href = href;
-            new_response->status = err->status;
-            if (err->desc != NULL) {
-                new_response->desc = apr_pstrcat(r->pool,
-                                                new_response->desc,
-                                                " The error was: ",
-                                                err->desc, NULL);
-            }
+    return cache;
+}
 
-            dav_send_one_response(new_response, ctx.bb, r, ctx.scratchpool);
-        }
+static const char *dav_calendar_cache_key(request_rec *r,
+        dav_calendar_cache_kind kind, const char *uri)
+{
+    /* the same URI can mean different things on different virtual hosts */
+    return apr_psprintf(r->pool, "%s %pp %s",
+            dav_calendar_cache_kind_names[kind], r->server, uri);
+}
 
-        /* Have the provider walk each resource. */
-        if ((err = (*resource->hooks->walk)(&ctx.w, 0, &multi_status)) != NULL) {
-            break;
-        }
+/*
+ * Find the entry for the given key and validator, and mark it as most
+ * recently used. Must be called with the cache locked.
+ */
+static dav_calendar_cache_entry *dav_calendar_cache_lookup(request_rec *r,
+        dav_calendar_cache *cache, dav_calendar_cache_kind kind,
+        const char *key, const char *etag)
+{
+    dav_calendar_cache_entry *entry;
 
-        if (lookup.rnew) {
-            ap_destroy_sub_req(lookup.rnew);
-        }
+    entry = apr_hash_get(cache->entries, key, APR_HASH_KEY_STRING);
+    if (entry && !strcmp(entry->etag, etag)) {
 
-    }
+        /* most recently used goes to the back */
+        APR_RING_REMOVE(entry, link);
+        APR_RING_INSERT_TAIL(&cache->lru, entry, dav_calendar_cache_entry,
+                link);
 
-    if (ctx.w.lockdb != NULL) {
-        (*ctx.w.lockdb->hooks->close_lockdb)(ctx.w.lockdb);
+        dav_calendar_metrics_cache(r, kind, DAV_CALENDAR_CACHE_HIT);
     }
-
-    if (err != NULL) {
-        /* If an error occurred during the resource walk, there's
-           basically nothing we can do but abort the connection and
-           log an error.  This is one of the limitations of HTTP; it
-           needs to "know" the entire status of the response before
-           generating it, which is just impossible in these streamy
-           response situations. */
-        err = dav_push_error(r->pool, err->status, 0,
-                             "Provider encountered an error while streaming"
-                             " a multistatus PROPFIND response.", err);
-        dav_log_err(r, err, APLOG_ERR);
-        r->connection->aborted = 1;
-        return NULL;
+    else {
+        entry = NULL;
+        dav_calendar_metrics_cache(r, kind, DAV_CALENDAR_CACHE_MISS);
     }
 
-    dav_finish_multistatus(r, ctx.bb);
+    ap_log_rerror(APLOG_MARK, APLOG_TRACE1, 0, r,
+            "mod_dav_calendar: cache %s for %s (size %" APR_SIZE_T_FMT
+            "/%" APR_SIZE_T_FMT ")", entry ? "hit" : "miss", key,
+            cache->size, cache->max_size);
 
-    /* the response has been sent. */
-    return NULL;
+    return entry;
 }
 
-static dav_error *dav_calendar_free_busy_query_report(request_rec *r,
-    const dav_resource *resource,
-    const apr_xml_doc *doc, ap_filter_t *output)
+/*
+ * Store a value in the cache, replacing any previous value for the key.
+ * The cache takes ownership of the value in all cases, and releases it
+ * with the destroy function when it is evicted.
+ */
+static void dav_calendar_cache_insert(request_rec *r,
+        dav_calendar_cache *cache, dav_calendar_cache_kind kind,
+        const char *key, const char *etag, void *value,
+        void (*destroy)(void *value), apr_size_t size)
 {
-    dav_error *err;
-    dav_walk_params w = { 0 };
-    dav_calendar_ctx cctx = { 0 };
-    dav_response *multi_status;
-    apr_bucket *e;
-    icalcomponent *timezone;
-    const char *ical;
-    apr_size_t ical_len;
-    int depth;
-    int ns = 0;
-    int status;
-
-    /* ### validate that only time-range is present */
+    dav_calendar_cache_entry *entry, *old;
+    apr_size_t klen, elen;
 
-    ns = apr_xml_insert_uri(doc->namespaces, DAV_CALENDAR_XML_NAMESPACE);
+    klen = strlen(key) + 1;
+    elen = strlen(etag) + 1;
+    size += sizeof(dav_calendar_cache_entry) + klen + elen;
 
-    if (!dav_find_child_ns(doc->root, ns, "time-range")) {
-        /* "calendar-query" element must have filter */
-        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
-                "The \"calendar-query\" element does not contain a "
-                "time-range element.");
+    /* too big to ever fit? */
+    if (size > cache->max_size) {
+        destroy(value);
+        return;
     }
 
-    if ((depth = dav_get_depth(r, 0)) < 0) {
-        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
-                "The \"depth\" header was not valid.");
+    entry = malloc(sizeof(dav_calendar_cache_entry) + klen + elen);
+    if (!entry) {
+        destroy(value);
+        return;
     }
 
-    w.walk_type = DAV_WALKTYPE_NORMAL | DAV_WALKTYPE_AUTH;
-    w.func = dav_calendar_get_walker;
-    w.walk_ctx = &cctx;
-    w.pool = r->pool;
-    w.root = resource;
+    entry->key = memcpy((char *)(entry + 1), key, klen);
+    entry->etag = memcpy((char *)(entry + 1) + klen, etag, elen);
+    entry->value = value;
+    entry->destroy = destroy;
+    entry->size = size;
+    entry->kind = kind;
 
-    cctx.doc = (apr_xml_doc *)doc;
-    cctx.r = r;
-    cctx.bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
+    dav_calendar_cache_lock(cache);
 
-    /* ### should open read-only */
-    if ((err = dav_open_lockdb(r, 0, &w.lockdb)) != NULL) {
-        return dav_push_error(r->pool, err->status, 0,
-                             "The lock database could not be opened, "
-                             "preventing access to the various lock "
-                             "properties for the PROPFIND.",
-                             err);
+    /* replace any stale entry */
+    old = apr_hash_get(cache->entries, key, APR_HASH_KEY_STRING);
+    if (old) {
+        dav_calendar_cache_remove(cache, old);
     }
-    if (w.lockdb != NULL) {
-        /* if we have a lock database, then we can walk locknull resources */
-        w.walk_type |= DAV_WALKTYPE_LOCKNULL;
+
+    /* evict least recently used until we fit */
+    while (cache->size + size > cache->max_size
+            && !APR_RING_EMPTY(&cache->lru, dav_calendar_cache_entry, link)) {
+        dav_calendar_metrics_cache(r, APR_RING_FIRST(&cache->lru)->kind,
+                DAV_CALENDAR_CACHE_EVICTION);
+        dav_calendar_cache_remove(cache, APR_RING_FIRST(&cache->lru));
     }
 
-    /* Have the provider walk the resource. */
-    err = (*resource->hooks->walk)(&w, depth, &multi_status);
+    APR_RING_INSERT_TAIL(&cache->lru, entry, dav_calendar_cache_entry, link);
+    apr_hash_set(cache->entries, entry->key, APR_HASH_KEY_STRING, entry);
+    cache->size += size;
 
-    if (w.lockdb != NULL) {
-        (*w.lockdb->hooks->close_lockdb)(w.lockdb);
-    }
+    dav_calendar_cache_unlock(cache);
+}
 
-    if (err != NULL) {
-        return err;
+static void dav_calendar_cache_free_comp(void *value)
+{
+    icalcomponent_free(value);
+}
+
+/*
+ * Return a clone of the cached calendar for the given URI, or NULL if
+ * the calendar is not cached or the cached copy is stale.
+ */
+static icalcomponent *dav_calendar_cache_get(request_rec *r, const char *uri,
+        const char *etag, apr_off_t *length)
+{
+    dav_calendar_cache *cache = dav_calendar_cache_global;
+    dav_calendar_cache_entry *entry;
+    icalcomponent *comp = NULL;
+
+    if (!cache || !etag) {
+        return NULL;
     }
 
-    /* remove timezone component, not wanted for this report */
-    while ((timezone = icalcomponent_get_first_component(cctx.comp,
-            ICAL_VTIMEZONE_COMPONENT))) {
-        if (timezone) {
-            icalcomponent_remove_component(cctx.comp, timezone);
-            icalcomponent_free(timezone);
-        }
+    dav_calendar_cache_lock(cache);
+
+    entry = dav_calendar_cache_lookup(r, cache, DAV_CALENDAR_CACHE_CALENDAR,
+            dav_calendar_cache_key(r, DAV_CALENDAR_CACHE_CALENDAR, uri), etag);
+    if (entry) {
+        comp = icalcomponent_new_clone(entry->value);
+        *length = entry->size / DAV_CALENDAR_CACHE_FACTOR;
     }
 
-    ical = icalcomponent_as_ical_string(cctx.comp);
-    ical_len = strlen(ical);
+    dav_calendar_cache_unlock(cache);
 
-    apr_brigade_cleanup(cctx.bb);
+    return comp;
+}
 
-    ap_set_content_length(r, ical_len);
-    ap_set_content_type(r, "text/calendar");
+/*
+ * Store a parsed calendar in the cache. The cache takes ownership of
+ * the calendar in all cases.
+ */
+static void dav_calendar_cache_put(request_rec *r, const char *uri,
+        const char *etag, icalcomponent *comp, apr_off_t length)
+{
+    dav_calendar_cache *cache = dav_calendar_cache_global;
 
-    e = apr_bucket_pool_create(ical, ical_len, r->pool,
-            r->connection->bucket_alloc);
-    APR_BRIGADE_INSERT_TAIL(cctx.bb, e);
+    if (!cache || !etag) {
+        icalcomponent_free(comp);
+        return;
+    }
 
-    e = apr_bucket_eos_create(r->connection->bucket_alloc);
-    APR_BRIGADE_INSERT_TAIL(cctx.bb, e);
+    dav_calendar_cache_insert(r, cache, DAV_CALENDAR_CACHE_CALENDAR,
+            dav_calendar_cache_key(r, DAV_CALENDAR_CACHE_CALENDAR, uri),
+            etag, comp, dav_calendar_cache_free_comp,
+            (apr_size_t)length * DAV_CALENDAR_CACHE_FACTOR);
+}
 
-    status = ap_pass_brigade(r->output_filters, cctx.bb);
+/*
+ * The collection state.
+ *
+ * The members of a calendar collection, with their ETags and the ETag of
+ * the collection as a whole, are kept in the cache alongside the parsed
+ * calendars, validated by the collection tag. A member added, removed or
+ * replaced through DAV bumps the tag, and so invalidates the state. This
+ * allows a conditional GET of a collection to be answered, and the members
+ * to be read, without walking the collection. Each member is still looked
+ * up and checked as it is read, so the state never stands in for the
+ * ETag of a member, nor for its preconditions.
+ */
+typedef struct dav_calendar_collection_state {
+    const char *etag;
+    int nelts;
+    const char **uris;
+    const char **etags;
+} dav_calendar_collection_state;
 
-    if (status == APR_SUCCESS
-        || r->status != HTTP_OK
-        || r->connection->aborted) {
-        /* all ok */
+static void dav_calendar_state_free(void *value)
+{
+    free(value);
+}
+
+/*
+ * Return a copy of the cached state of the given collection, or NULL if
+ * the state is not cached or the collection has changed.
+ */
+static dav_calendar_collection_state *dav_calendar_state_get(request_rec *r,
+        const char *uri, const char *etag)
+{
+    dav_calendar_cache *cache = dav_calendar_cache_global;
+    dav_calendar_cache_entry *entry;
+    dav_calendar_collection_state *state = NULL;
+
+    if (!cache || !etag) {
+        return NULL;
     }
-    else {
-        /* no way to know what type of error occurred */
-        ap_log_rerror(APLOG_MARK, APLOG_DEBUG, status, r,
-                      "dav_calendar_handler: ap_pass_brigade returned %i",
-                      status);
+
+    dav_calendar_cache_lock(cache);
+
+    entry = dav_calendar_cache_lookup(r, cache, DAV_CALENDAR_CACHE_COLLECTION,
+            dav_calendar_cache_key(r, DAV_CALENDAR_CACHE_COLLECTION, uri),
+            etag);
+    if (entry) {
+        const dav_calendar_collection_state *cached = entry->value;
+        int i;
+
+        state = apr_palloc(r->pool, sizeof(dav_calendar_collection_state));
+        state->etag = apr_pstrdup(r->pool, cached->etag);
+        state->nelts = cached->nelts;
+        state->uris = apr_palloc(r->pool, sizeof(char *) * (cached->nelts + 1));
+        state->etags = apr_palloc(r->pool, sizeof(char *) * (cached->nelts + 1));
+        for (i = 0; i < cached->nelts; i++) {
+            state->uris[i] = apr_pstrdup(r->pool, cached->uris[i]);
+            state->etags[i] = apr_pstrdup(r->pool, cached->etags[i]);
+        }
     }
 
-    /* the response has been sent. */
-    return NULL;
+    dav_calendar_cache_unlock(cache);
+
+    return state;
 }
 
-static int dav_calendar_find_ns(const apr_array_header_t *namespaces, const char *uri)
+/*
+ * Store the state of the given collection in the cache, as a single
+ * block of memory owned by the cache.
+ */
+static void dav_calendar_state_put(request_rec *r, const char *uri,
+        const char *etag, const char *aggregate, apr_array_header_t *uris,
+        apr_array_header_t *etags)
 {
+    dav_calendar_cache *cache = dav_calendar_cache_global;
+    dav_calendar_collection_state *state;
+    apr_size_t size;
+    char *buffer;
     int i;
 
-    for (i = 0; i < namespaces->nelts; ++i) {
-        if (strcmp(APR_XML_GET_URI_ITEM(namespaces, i), uri) == 0) {
-            return i;
-        }
+    if (!cache || !etag || !aggregate) {
+        return;
     }
-    return -1;
-}
 
-static int dav_calendar_deliver_report(request_rec *r,
-        const dav_resource *resource,
-        const apr_xml_doc *doc,
-        ap_filter_t *output, dav_error **err)
-{
-    int ns = dav_calendar_find_ns(doc->namespaces, DAV_CALENDAR_XML_NAMESPACE);
+    size = sizeof(dav_calendar_collection_state)
+            + 2 * sizeof(char *) * (uris->nelts + 1) + strlen(aggregate) + 1;
+    for (i = 0; i < uris->nelts; i++) {
+        size += strlen(APR_ARRAY_IDX(uris, i, const char *)) + 1
+                + strlen(APR_ARRAY_IDX(etags, i, const char *)) + 1;
+    }
 
-    if (doc->root->ns == ns) {
+    state = malloc(size);
+    if (!state) {
+        return;
+    }
 
-        if (strcmp(doc->root->name, "calendar-query") == 0) {
-            *err = dav_calendar_query_report(r, resource, doc, output);
-        }
-        else if (strcmp(doc->root->name, "calendar-multiget") == 0) {
-            *err = dav_calendar_multiget_report(r, resource, doc, output);
-        }
-        else if (strcmp(doc->root->name, "free-busy-query") == 0) {
-            *err = dav_calendar_free_busy_query_report(r, resource, doc, output);
-        }
-        else {
-            /* NOTE: if you add a report, don't forget to add it to the
-             *       dav_svn__reports_list[] array.
-             */
-            *err = dav_new_error(resource->pool, HTTP_NOT_IMPLEMENTED, 0, 0,
-                                 "The requested report is unknown");
-            return HTTP_NOT_IMPLEMENTED;
-        }
-        if (*err) {
-            return (*err)->status;
-        }
-        return DONE;
+    state->nelts = uris->nelts;
+    state->uris = (const char **)(state + 1);
+    state->etags = state->uris + uris->nelts + 1;
+    buffer = (char *)(state->etags + uris->nelts + 1);
+
+    state->etag = buffer;
+    buffer = apr_cpystrn(buffer, aggregate, size) + 1;
+    for (i = 0; i < uris->nelts; i++) {
+        state->uris[i] = buffer;
+        buffer = apr_cpystrn(buffer, APR_ARRAY_IDX(uris, i, const char *),
+                size) + 1;
+        state->etags[i] = buffer;
+        buffer = apr_cpystrn(buffer, APR_ARRAY_IDX(etags, i, const char *),
+                size) + 1;
     }
 
-    return DECLINED;
+    dav_calendar_cache_insert(r, cache, DAV_CALENDAR_CACHE_COLLECTION,
+            dav_calendar_cache_key(r, DAV_CALENDAR_CACHE_COLLECTION, uri),
+            etag, state,
+            dav_calendar_state_free, size);
 }
 
-void dav_calendar_gather_reports(request_rec *r, const dav_resource *resource,
-    apr_array_header_t *reports, dav_error **err)
-{
-    dav_report_elem *report;
+/*
+ * The recurrence spans.
+ *
+ * Matching a recurring event or to-do against a time range means
+ * expanding its rule. The spans of the instances falling within the
+ * calendar years covering the time range are kept in the cache against
+ * the URI and ETag of the resource, so that later queries over any
+ * window within those years, such as a client paging through a month
+ * or week view, are answered without expanding the rule again.
+ */
 
-    report = apr_array_push(reports);
-    report->nmspace = DAV_CALENDAR_XML_NAMESPACE;
-    report->name = "calendar-query";
+/* windows covering more calendar years than this are expanded directly */
+#define DAV_CALENDAR_SPANS_YEARS 2
+/* rules with more instances than this are expanded directly */
+#define DAV_CALENDAR_SPANS_MAX 1024
 
-    report = apr_array_push(reports);
-    report->nmspace = DAV_CALENDAR_XML_NAMESPACE;
-    report->name = "calendar-multiget";
+typedef struct dav_calendar_spans {
+    /* -1 when there were too many instances to keep */
+    int nelts;
+    icaltime_span spans[1];
+} dav_calendar_spans;
 
-    /*
-    report = apr_array_push(reports);
-    report->nmspace = DAV_CALENDAR_XML_NAMESPACE;
-    report->name = "free-busy-query";
-    */
+static void dav_calendar_spans_free(void *value)
+{
+    free(value);
 }
 
-static dav_error *dav_calendar_check_calender(request_rec *r, dav_resource *resource,
-        const dav_provider *provider, apr_array_header_t *mkcols)
+static int dav_calendar_match_time_range(dav_calendar_ctx *ctx,
+        icalcomponent *comp, icaltimetype *stt, icaltimetype *ett)
 {
-    dav_error *err;
-    dav_resource *parent;
+    dav_calendar_cache *cache = dav_calendar_cache_global;
+    dav_calendar_cache_entry *entry;
+    dav_calendar_spans *spans;
+    icalcomponent_kind kind = icalcomponent_isa(comp);
+    icaltimetype start, end;
+    const char *key;
+    int match = -1, nelts;
+
+    if (!cache || !ctx->uri || !ctx->etag
+            || (kind != ICAL_VEVENT_COMPONENT && kind != ICAL_VTODO_COMPONENT)
+            || ett->year - stt->year >= DAV_CALENDAR_SPANS_YEARS
+            || (!icalcomponent_get_first_property(comp, ICAL_RRULE_PROPERTY)
+                    && !icalcomponent_get_first_property(comp,
+                            ICAL_RDATE_PROPERTY))) {
+        return dav_calendar_comp_time_range(comp, stt, ett);
+    }
+
+    /* a resource may hold the master and overrides of several events */
+    key = dav_calendar_cache_key(ctx->r, DAV_CALENDAR_CACHE_SPANS,
+            apr_psprintf(ctx->r->pool, "%s %s %s %d", ctx->uri,
+                    icalcomponent_get_uid(comp),
+                    icaltime_as_ical_string(icalcomponent_get_dtstart(comp)),
+                    stt->year));
+
+    dav_calendar_cache_lock(cache);
+    entry = dav_calendar_cache_lookup(ctx->r, cache, DAV_CALENDAR_CACHE_SPANS,
+            key, ctx->etag);
+    if (entry) {
+        spans = entry->value;
+        if (spans->nelts >= 0) {
+            match = dav_calendar_spans_overlap(spans->spans, spans->nelts,
+                    *stt, *ett);
+        }
+    }
+    dav_calendar_cache_unlock(cache);
 
-    /* a calendar resource must not already exist */
-    if (resource->exists) {
-        return dav_new_error(r->pool, HTTP_CONFLICT, 0, 0,
-                             apr_psprintf(r->pool,
-                             "Calendar collection already exists: %s",
-                             ap_escape_html(r->pool, resource->uri)));
+    if (entry) {
+        return match >= 0 ? match
+                : dav_calendar_comp_time_range(comp, stt, ett);
     }
 
-    /* walk backwards through the parents, until NULL. Parents must
-     * either exist and be collections, or not exist. If the parent is a
-     * non-collection, or is a calendar collection, we fail.
-     *
-     * Keep track of non existing parents - they will be created.
-     */
+    start = icaltime_from_string(apr_psprintf(ctx->r->pool,
+            "%04d0101T000000Z", stt->year));
+    end = icaltime_from_string(apr_psprintf(ctx->r->pool,
+            "%04d0101T000000Z", stt->year + DAV_CALENDAR_SPANS_YEARS));
 
-    if ((err = resource->hooks->get_parent_resource(resource, &parent)) != NULL) {
-        return err;
+    spans = malloc(sizeof(dav_calendar_spans)
+            + sizeof(icaltime_span) * DAV_CALENDAR_SPANS_MAX);
+    if (!spans) {
+        return dav_calendar_comp_time_range(comp, stt, ett);
     }
 
-    while ((parent)) {
+    nelts = dav_calendar_recurrence_spans(comp, start, end, spans->spans,
+            DAV_CALENDAR_SPANS_MAX);
+    if (nelts >= 0) {
+        match = dav_calendar_spans_overlap(spans->spans, nelts, *stt, *ett);
+    }
+    else {
+        match = dav_calendar_comp_time_range(comp, stt, ett);
+    }
 
-        if (!parent->collection) {
-            return dav_new_error(r->pool, HTTP_CONFLICT, 0, 0,
-                               apr_psprintf(r->pool,
-                                            "The parent resource of %s "
-                                            "is not a collection.",
-                                            ap_escape_html(r->pool, r->uri)));
+    /* keep just what we used */
+    spans->nelts = nelts;
+    if (nelts > 0) {
+        dav_calendar_spans *shrunk = realloc(spans,
+                sizeof(dav_calendar_spans) + sizeof(icaltime_span) * nelts);
+        if (shrunk) {
+            spans = shrunk;
         }
+    }
 
-        if (mkcols && !parent->exists) {
-            dav_resource **mkcol = apr_array_push(mkcols);
-            *mkcol = parent;
+    dav_calendar_cache_insert(ctx->r, cache, DAV_CALENDAR_CACHE_SPANS, key,
+            ctx->etag, spans,
+            dav_calendar_spans_free, sizeof(dav_calendar_spans)
+                    + sizeof(icaltime_span) * (nelts > 0 ? nelts : 0));
+
+    return match;
+}
+
+/*
+ * Apply the filters of the request to a freshly parsed calendar, and add
+ * the result to the context. The context takes ownership of the calendar.
+ */
+static apr_status_t dav_calendar_process_calendar(request_rec *r,
+        dav_calendar_ctx *ctx, icalcomponent *comp)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+    apr_time_t start;
+
+    /* summarise the untouched calendar for the index and the cache */
+    if (!ctx->calendars++) {
+        if (conf->index_db) {
+            ctx->index = dav_calendar_index_build(r->pool, comp);
+        }
+        if (ctx->cacheable) {
+            ctx->cache_comp = icalcomponent_new_clone(comp);
+            apr_pool_cleanup_register(r->pool, ctx->cache_comp,
+                    icalcomponent_cleanup, apr_pool_cleanup_null);
+        }
+    }
+    else {
+        /* more than one calendar, too complex to summarise */
+        ctx->index = NULL;
+        if (ctx->cache_comp) {
+            apr_pool_cleanup_run(r->pool, ctx->cache_comp,
+                    icalcomponent_cleanup);
+            ctx->cache_comp = NULL;
         }
+    }
 
-        if (parent->exists) {
-            dav_lockdb *lockdb;
-            dav_propdb *propdb;
+    /* apply search <C:filter/>, ctx->match will contain the result */
+    start = dav_calendar_timing_start(r);
+    ctx->err = dav_calendar_filter(ctx, comp);
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_FILTER, start);
+    if (ctx->err) {
+        icalcomponent_free(comp);
+        return APR_EGENERAL;
+    }
 
-            /* open lock database, to report on supported lock properties */
-            /* ### should open read-only */
-            if ((err = dav_open_lockdb(r, 0, &lockdb)) != NULL) {
-                return dav_push_error(r->pool, err->status, 0,
-                                      "The lock database could not be opened, "
-                                      "preventing the checking of a parent "
-                                      "calendar collection.",
-                                      err);
-            }
+    /* no match, none of it will be sent, so leave it be */
+    if (ctx->elem && ctx->match) {
 
-            /* open the property database (readonly) for the resource */
-            if ((err = dav_open_propdb(r, lockdb, resource, 1, NULL,
-                                       &propdb)) != NULL) {
-                if (lockdb != NULL) {
-                    dav_close_lockdb(lockdb);
-                }
+        /* expand or limit the recurrence sets before anything is stripped */
+        ctx->err = dav_calendar_recurrence(ctx, ctx->elem, &comp);
+        if (ctx->err) {
+            icalcomponent_free(comp);
+            return APR_EGENERAL;
+        }
 
-                return dav_push_error(r->pool, err->status, 0,
-                                      "The property database could not be opened, "
-                                      "preventing the checking of a parent "
-                                      "calendar collection.",
-                                      err);
-            }
+        /* strip away everything not listed beneath <C:comp/> */
+        ctx->err = dav_calendar_comp(ctx, ctx->elem,
+                &comp);
+        if (ctx->err) {
+            icalcomponent_free(comp);
+            return APR_EGENERAL;
+        }
+    }
 
-            if (propdb) {
-                dav_db *db = NULL;
-                const dav_prop_name prop = { "DAV:", "resourcetype" };
-                dav_prop_name name[1] = { { NULL, NULL } };
+    if (!ctx->comp) {
+        ctx->comp = comp;
+        apr_pool_cleanup_register(r->pool, comp, icalcomponent_cleanup,
+                apr_pool_cleanup_null);
+    }
+    else {
+        icalcomponent_merge_component(ctx->comp, comp);
+    }
 
-                if ((err = provider->propdb->open(resource->pool, parent, 1, &db)) != NULL) {
-                    return err;
-                }
+    return APR_SUCCESS;
+}
 
-                if (db) {
-                    if ((err = provider->propdb->first_name(db, name)) != NULL) {
-                        return err;
-                    }
+/*
+ * Hand a complete, unfolded line to the parser.
+ */
+static apr_status_t dav_calendar_parse_line(request_rec *r,
+        dav_calendar_ctx *ctx)
+{
+    icalcomponent *comp;
+    apr_size_t len = ctx->line_len;
 
-                    while (name->ns != NULL) {
-                        apr_text_header hdr[1] = { { 0 } };
-                        int f;
+    ctx->line_len = 0;
 
-                        if (name->name && prop.name && strcmp(name->name, prop.name) == 0
-                                && ((name->ns && prop.ns && strcmp(name->ns, prop.ns) == 0)
-                                        || (!name->ns && !prop.ns))) {
-                            if ((err = provider->propdb->output_value(db, name, NULL, hdr, &f)) != NULL) {
-                                return err;
-                            }
+    /* blank lines carry nothing */
+    if (!len) {
+        return APR_SUCCESS;
+    }
 
-                            if (strstr((char *)hdr->first->text, ">calendar<")) {
+    ctx->line[len] = 0;
 
-                                err = dav_new_error(r->pool, HTTP_CONFLICT, 0, 0,
-                                        apr_psprintf(r->pool,
-                                                "A calendar collection cannot be created "
-                                                "under another calendar collection: %s",
-                                                ap_escape_html(r->pool, r->uri)));
+    /* the parser copies what it needs, the buffer remains ours */
+    comp = icalparser_add_line(ctx->parser, ctx->line);
+    if (icalerrno != ICAL_NO_ERROR) {
+        ctx->err = dav_new_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0,
+                APR_EGENERAL, icalerror_perror());
+        return APR_EGENERAL;
+    }
 
-                            }
+    /* found a calendar? */
+    if (comp) {
+        return dav_calendar_process_calendar(r, ctx, comp);
+    }
 
-                            break;
-                        }
-                        if ((err = provider->propdb->next_name(db, name)) != NULL) {
-                            break;
-                        }
+    return APR_SUCCESS;
+}
 
-                    }
-                    provider->propdb->close(db);
-                }
+/*
+ * Split the data into lines, unfolding continuation lines as we go.
+ *
+ * A line is copied once, into the line buffer of the context, which is
+ * reused from line to line. A line ending is only known to end the line
+ * once the next character is seen not to be a space or tab, so the
+ * state of the line survives from one call to the next.
+ */
+static apr_status_t dav_calendar_split_lines_internal(request_rec *r,
+        dav_calendar_ctx *ctx, const char *str, apr_size_t len)
+{
+    const char *end = str + len;
+    apr_status_t rv;
 
-            }
+    while (str < end) {
+        const char *eol;
+        apr_size_t n;
 
-            dav_close_propdb(propdb);
+        /* a line ending was seen, is this a continuation? */
+        if (ctx->line_state == APR_ASCII_LF) {
+            ctx->line_state = 0;
 
-            if (lockdb != NULL) {
-                dav_close_lockdb(lockdb);
+            if (*str == APR_ASCII_BLANK || *str == APR_ASCII_TAB) {
+                str++;
+                continue;
             }
 
+            if ((rv = dav_calendar_parse_line(r, ctx)) != APR_SUCCESS) {
+                return rv;
+            }
         }
 
-        if ((err = parent->hooks->get_parent_resource(parent, &parent)) != NULL) {
-            return err;
+        eol = memchr(str, APR_ASCII_LF, end - str);
+        n = (eol ? eol : end) - str;
+
+        /* leave room for the terminating NUL */
+        if (ctx->line_len + n >= DAV_CALENDAR_LINE_MAX) {
+            ctx->err = dav_new_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0,
+                    APR_EGENERAL,
+                    "iCalendar line was too long - not a calendar?");
+            return APR_EGENERAL;
+        }
+
+        memcpy(ctx->line + ctx->line_len, str, n);
+        ctx->line_len += n;
+
+        if (!eol) {
+            break;
+        }
+
+        /* the CR of a CRLF is dropped, the LF is never copied */
+        if (ctx->line_len && ctx->line[ctx->line_len - 1] == APR_ASCII_CR) {
+            ctx->line_len--;
         }
+
+        ctx->line_state = APR_ASCII_LF;
+        str = eol + 1;
     }
 
-    return NULL;
+    return APR_SUCCESS;
 }
 
-static dav_error *dav_calendar_make_calendar(request_rec *r, dav_resource *resource, const char *name)
+/*
+ * Split the data into lines, counting the time spent parsing, less the
+ * time spent filtering the calendars found.
+ */
+static apr_status_t dav_calendar_split_lines(request_rec *r,
+        dav_calendar_ctx *ctx, const char *str, apr_size_t len)
 {
-    dav_error *err;
-    const dav_provider *provider;
-    dav_lockdb *lockdb;
-    dav_propdb *propdb;
+    dav_calendar_request_rec *rconf;
+    apr_interval_time_t filter;
+    apr_time_t start = dav_calendar_timing_start(r);
+    apr_status_t rv;
 
-    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
-            &dav_calendar_module);
+    dav_calendar_metrics_count(r, DAV_CALENDAR_COUNT_BYTES_PARSED, len);
 
-    /* find the dav provider */
-    provider = dav_get_provider(r);
-    if (provider == NULL) {
-        return dav_new_error(r->pool, HTTP_METHOD_NOT_ALLOWED, 0, 0,
-                             apr_psprintf(r->pool,
-                             "DAV not enabled for %s",
-                             ap_escape_html(r->pool, r->uri)));
+    if (!start) {
+        return dav_calendar_split_lines_internal(r, ctx, str, len);
     }
 
-    /* resource->collection = 1; */
-    if ((err = resource->hooks->create_collection(resource))) {
-        return dav_push_error(r->pool, err->status, 0,
-                apr_psprintf(r->pool,
-                        "Could not create calendar collection: %s",
-                        ap_escape_html(r->pool, resource->uri)),
-                        err);
-    }
+    rconf = dav_calendar_get_request_rec(r);
+    filter = rconf->timing[DAV_CALENDAR_PHASE_FILTER];
 
-    /* set the resource type to calendar */
+    rv = dav_calendar_split_lines_internal(r, ctx, str, len);
 
-    /* open lock database, to report on supported lock properties */
-    /* ### should open read-only */
-    if ((err = dav_open_lockdb(r, 0, &lockdb)) != NULL) {
-        return dav_push_error(r->pool, err->status, 0,
-                              "The lock database could not be opened, "
-                              "preventing the creation of a "
-                              "calendar collection.",
-                              err);
-    }
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_PARSE,
+            start + rconf->timing[DAV_CALENDAR_PHASE_FILTER] - filter);
 
-    /* open the property database (readonly) for the resource */
-    if ((err = dav_open_propdb(r, lockdb, resource, 1, NULL,
-                               &propdb)) != NULL) {
-        if (lockdb != NULL) {
-            dav_close_lockdb(lockdb);
-        }
+    return rv;
+}
 
-        return dav_push_error(r->pool, err->status, 0,
-                              "The property database could not be opened, "
-                              "preventing the creation of a "
-                              "calendar collection.",
-                              err);
+/*
+ * The data is complete, parse any line still held back.
+ */
+static apr_status_t dav_calendar_parse_icalendar_finish(request_rec *r,
+        dav_calendar_ctx *ctx)
+{
+    if (ctx->line_state == APR_ASCII_LF || ctx->line_len) {
+        ctx->line_state = 0;
+        return dav_calendar_parse_line(r, ctx);
     }
 
-    if (propdb) {
-        dav_db *db = NULL;
+    return APR_SUCCESS;
+}
 
-        if ((err = provider->propdb->open(resource->pool, resource, 0, &db)) != NULL) {
-            err = dav_push_error(r->pool, err->status, 0,
-                                  "Property database could not be opened, "
-                                  "preventing the creation of a "
-                                  "calendar collection.",
-                                  err);
-        }
-        else {
+static int dav_calendar_parse_icalendar_filter(ap_filter_t *f,
+        apr_bucket_brigade *bb)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(f->r->per_dir_config,
+            &dav_calendar_module);
 
-            apr_array_header_t *ns;
-            apr_xml_elem elem[3] = { { 0 } };
-            apr_text text[3] = { { 0 } };
-            dav_prop_name restype[3] = { { DAV_XML_NAMESPACE, "resourcetype" },
-                    { DAV_CALENDAR_XML_NAMESPACE, "calendar-timezone" },
-                    { DAV_XML_NAMESPACE, "displayname" } };
-            dav_namespace_map *map = NULL;
+    dav_calendar_ctx *ctx = f->ctx;
 
-            ns = apr_array_make(resource->pool, 3, sizeof(const char *));
+    apr_bucket *e;
+    apr_status_t rv = APR_SUCCESS;
 
-            *(const char **)apr_array_push(ns) = DAV_XML_NAMESPACE;
-            *(const char **)apr_array_push(ns) = DAV_CALENDAR_XML_NAMESPACE;
+    while (!APR_BRIGADE_EMPTY(bb)) {
+        const char *str;
+        apr_size_t len;
 
-            elem[0].name = restype[0].name;
-            elem[0].ns = 1;
-            elem[0].first_cdata.first = &text[0];
-            text[0].text = "calendar";
+        e = APR_BRIGADE_FIRST(bb);
 
-            elem[1].name = restype[1].name;
-            elem[1].ns = 1;
-            elem[1].first_cdata.first = &text[1];
-            text[1].text = conf->dav_calendar_timezone;
+        /* EOS means we are done. */
+        if (APR_BUCKET_IS_EOS(e)) {
+            rv = dav_calendar_parse_icalendar_finish(f->r, ctx);
+            apr_brigade_cleanup(bb);
+            return rv;
+        }
 
-            if ((err = provider->propdb->map_namespaces(db, ns, &map)) != NULL) {
-                err = dav_push_error(r->pool, err->status, 0,
-                                      "Namespace could not be mapped, "
-                                      "preventing the creation of a "
-                                      "calendar collection.",
-                                      err);
+        if (!APR_BUCKET_IS_METADATA(e)) {
+
+            if ((rv = apr_bucket_read(e, &str, &len, APR_BLOCK_READ))
+                    != APR_SUCCESS) {
+                return rv;
             }
-            else if ((err =  provider->propdb->store(db, &restype[0], &elem[0], map)) != NULL) {
-                err = dav_push_error(r->pool, err->status, 0,
-                                      "Property 'calendar' could not be stored, "
-                                      "preventing the creation of a "
-                                      "calendar collection.",
-                                      err);
+
+            ctx->length += len;
+
+            if (ctx->length > conf->max_resource_size) {
+                return APR_ENOSPC;
             }
-            else if ((err =  provider->propdb->store(db, &restype[1], &elem[1], map)) != NULL) {
-                err = dav_push_error(r->pool, err->status, 0,
-                                      "Property 'calendar-timezone' could not be stored, "
-                                      "preventing the creation of a "
-                                      "calendar collection.",
-                                      err);
+
+            if ((rv = dav_calendar_split_lines(f->r, ctx, str, len))
+                    != APR_SUCCESS) {
+                return rv;
             }
 
-            if (name) {
+        }
 
-                elem[2].name = restype[2].name;
-                elem[2].ns = 0;
-                elem[2].first_cdata.first = &text[2];
-                text[2].text = name;
+        apr_bucket_delete(e);
+    }
 
-                if ((err =  provider->propdb->store(db, &restype[2], &elem[2], map)) != NULL) {
-                    err = dav_push_error(r->pool, err->status, 0,
-                                          "Property 'displayname' could not be stored, "
-                                          "preventing the creation of a "
-                                          "calendar collection.",
-                                          err);
-                }
+    return APR_SUCCESS;
+}
+
+static ap_filter_t *dav_calendar_create_parse_icalendar_filter(request_rec *r,
+        dav_calendar_ctx *ctx)
+{
+    ap_filter_rec_t *rec = apr_pcalloc(r->pool, sizeof(ap_filter_rec_t));
+    ap_filter_t *f = apr_pcalloc(r->pool, sizeof(ap_filter_t));
+    ap_filter_func ff;
+
+    /* just enough to bootstrap our filter */
+    ff.out_func = dav_calendar_parse_icalendar_filter;
+    rec->filter_func = ff;
+    f->frec = rec;
+    f->r = r;
+    f->ctx = ctx;
+
+    ctx->match = 0;
+    ctx->index = NULL;
+    ctx->cache_comp = NULL;
+    ctx->length = 0;
+    ctx->calendars = 0;
+    ctx->cacheable = 0;
+
+    if (ctx->doc && ctx->doc->namespaces) {
+        ctx->ns = apr_xml_insert_uri(ctx->doc->namespaces,
+                DAV_CALENDAR_XML_NAMESPACE);
+    }
+
+    /* one line buffer serves every resource read in the request */
+    if (!ctx->line) {
+        dav_calendar_request_rec *rconf = dav_calendar_get_request_rec(r);
+
+        if (!rconf->line) {
+            request_rec *rr = r;
 
+            while (rr->main) {
+                rr = rr->main;
             }
+            rconf->line = apr_palloc(rr->pool, DAV_CALENDAR_LINE_MAX);
+        }
+        ctx->line = rconf->line;
+    }
+    ctx->line_len = 0;
+    ctx->line_state = 0;
 
-            provider->propdb->close(db);
+    ctx->parser = icalparser_new();
 
+    apr_pool_cleanup_register(f->r->pool, ctx->parser, icalparser_cleanup,
+            apr_pool_cleanup_null);
+
+    return f;
+}
+
+/*
+ * Work out the file or directory behind the given URI. The URI must be
+ * that of the request, or of a member of the directory the request
+ * points at.
+ */
+static const char *dav_calendar_resource_path(request_rec *r, const char *uri)
+{
+    const char *name, *slash;
+    char *path;
+    apr_size_t len;
+
+    if (!r->filename) {
+        return NULL;
+    }
+
+    /* the request is the resource */
+    if (!strcmp(r->uri, uri)) {
+        return r->finfo.filetype != APR_NOFILE ? r->filename : NULL;
+    }
+
+    /* the request is the collection holding the resource */
+    if (r->finfo.filetype != APR_DIR) {
+        return NULL;
+    }
+
+    len = strlen(r->uri);
+    if (strncmp(r->uri, uri, len)) {
+        return NULL;
+    }
+
+    name = uri + len;
+    if (len && r->uri[len - 1] != '/') {
+        if (*name != '/') {
+            return NULL;
         }
+        name++;
+    }
 
-        dav_close_propdb(propdb);
+    /* a collection member may carry a trailing slash */
+    if ((slash = ap_strchr_c(name, '/')) && !slash[1]) {
+        name = apr_pstrmemdup(r->pool, name, slash - name);
+        slash = NULL;
     }
 
-    if (lockdb != NULL) {
-        dav_close_lockdb(lockdb);
+    /* members only, nothing below or above */
+    if (!*name || slash || !strcmp(name, "..") || !strcmp(name, ".")) {
+        return NULL;
     }
 
-    return err;
+    if (apr_filepath_merge(&path, r->filename, name,
+            APR_FILEPATH_SECUREROOT, r->pool)
+            != APR_SUCCESS) {
+        return NULL;
+    }
+
+    return path;
 }
 
-static dav_error *dav_calendar_provision_calendar(request_rec *r, dav_resource *trigger, const char *name)
+/*
+ * Work out the file behind the given URI, if we are allowed to read it
+ * directly.
+ */
+static const char *dav_calendar_direct_path(request_rec *r, const char *uri)
 {
-    dav_error *err;
-    const dav_provider *provider;
-    dav_resource *resource = NULL;
-    apr_array_header_t *mkcols;
-    int i;
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
 
-    /* find the dav provider */
-    provider = dav_get_provider(r);
-    if (provider == NULL) {
-        return dav_new_error(r->pool, HTTP_METHOD_NOT_ALLOWED, 0, 0,
-                             apr_psprintf(r->pool,
-                             "DAV not enabled for %s",
-                             ap_escape_html(r->pool, r->unparsed_uri)));
+    if (!conf->direct_read) {
+        return NULL;
     }
 
-    /* resolve calendar resource */
-    if ((err = provider->repos->get_resource(r, NULL, NULL, 0, &resource))) {
-        return dav_push_error(r->pool, err->status, 0,
-                              apr_psprintf(r->pool,
-                                           "Could not get calendar provision URL: %s",
-                                           ap_escape_html(r->pool, r->unparsed_uri)),
-                              err);
+    /* the request is the resource, and must be a file */
+    if (!strcmp(r->uri, uri) && r->finfo.filetype != APR_REG) {
+        return NULL;
     }
 
-    /* already exists and is a collection? we're done */
-    if (resource->exists && resource->collection) {
+    return dav_calendar_resource_path(r, uri);
+}
+
+/*
+ * Read a calendar straight from its file into the parser, mapping the
+ * file into memory where we can. If the file cannot be opened, *handled
+ * is left unset, and the caller should fall back to a subrequest.
+ */
+static dav_error *dav_calendar_read_file(request_rec *r, dav_calendar_ctx *ctx,
+        const char *path, int *handled)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+    apr_file_t *fd;
+    apr_finfo_t finfo;
+    apr_status_t status;
+
+    if (apr_file_open(&fd, path, APR_FOPEN_READ | APR_FOPEN_BINARY,
+            APR_OS_DEFAULT, r->pool) != APR_SUCCESS) {
         return NULL;
     }
 
-    /* sanity check parents */
-    mkcols = apr_array_make(r->pool, 2, sizeof(dav_resource *));
-    if ((err = dav_calendar_check_calender(r, resource, provider, mkcols))) {
-        return err;
+    if (apr_file_info_get(&finfo, APR_FINFO_SIZE | APR_FINFO_TYPE, fd)
+            != APR_SUCCESS || finfo.filetype != APR_REG) {
+        apr_file_close(fd);
+        return NULL;
     }
 
-    /* create parent collections */
-    for (i = mkcols->nelts - 1; i >= 0; i--) {
-        dav_resource *parent = APR_ARRAY_IDX(mkcols, i, dav_resource *);
+    *handled = 1;
 
-        if (trigger->hooks->is_same_resource(trigger, parent)) {
-            err = trigger->hooks->create_collection(trigger);
+    if (finfo.size > conf->max_resource_size) {
+        apr_file_close(fd);
+        return dav_new_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0, APR_ENOSPC,
+                "Calendar resource is larger than DavCalendarMaxResourceSize.");
+    }
+
+    ctx->length = finfo.size;
+
+#if APR_HAS_MMAP
+    {
+        apr_mmap_t *mm;
+
+        if (finfo.size > 0 && apr_mmap_create(&mm, fd, 0,
+                (apr_size_t)finfo.size, APR_MMAP_READ, r->pool) == APR_SUCCESS) {
+
+            status = dav_calendar_split_lines(r, ctx, mm->mm, mm->size);
+            apr_mmap_delete(mm);
+            apr_file_close(fd);
+
+            goto done;
         }
-        else {
-            err = parent->hooks->create_collection(parent);
+    }
+#endif
+
+    {
+        char *buffer = apr_palloc(r->pool, APR_BUCKET_BUFF_SIZE);
+
+        do {
+            apr_size_t len = APR_BUCKET_BUFF_SIZE;
+
+            status = apr_file_read(fd, buffer, &len);
+            if (status == APR_SUCCESS) {
+                status = dav_calendar_split_lines(r, ctx, buffer, len);
+            }
+        } while (status == APR_SUCCESS);
+
+        apr_file_close(fd);
+
+        if (APR_STATUS_IS_EOF(status)) {
+            status = APR_SUCCESS;
         }
+    }
 
-        if (err) {
-            return dav_push_error(r->pool, err->status, 0,
-                                  apr_psprintf(r->pool,
-                                  "Could not create calendar provision "
-                                  "parent directory: %s",
-                                  ap_escape_html(r->pool, parent->uri)),
-                                  err);
+#if APR_HAS_MMAP
+done:
+#endif
+
+    /* parse errors are left in the context */
+    if (status != APR_SUCCESS && !ctx->err) {
+        return dav_new_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0, status,
+                apr_psprintf(r->pool, "Could not read calendar from %s.",
+                        ap_escape_html(r->pool, path)));
+    }
+
+    return NULL;
+}
+
+/*
+ * The parse pool.
+ *
+ * Parsing is CPU bound, and a calendar-query or GET over a large
+ * collection would otherwise parse every member one after the other on
+ * the request thread. When DavCalendarParseThreads is set, the members
+ * of the collection that can be read directly from disk are read and
+ * parsed ahead of the walk by a bounded pool of worker threads, each
+ * into a pool of its own. The members are known ahead of the walk from
+ * the collection state, so the collection is not walked twice. The walk
+ * still visits the members in order, and takes each parsed calendar as
+ * it reaches it, waiting if the worker is busy with it, so the response
+ * is the same as it would be without the workers. A member no worker
+ * has started on yet is taken back and parsed by the walk itself, as
+ * are the members the workers cannot handle.
+ */
+
+/* members parsed ahead of the walk, per worker thread */
+#define DAV_CALENDAR_PREFETCH_AHEAD 4
+
+#if APR_HAS_THREADS
+
+typedef enum {
+    DAV_CALENDAR_PREFETCH_WAITING,
+    DAV_CALENDAR_PREFETCH_QUEUED,
+    DAV_CALENDAR_PREFETCH_RUNNING,
+    DAV_CALENDAR_PREFETCH_DONE,
+    DAV_CALENDAR_PREFETCH_TAKEN
+} dav_calendar_prefetch_state;
+
+typedef struct dav_calendar_prefetch dav_calendar_prefetch;
+
+typedef struct dav_calendar_prefetch_task {
+    dav_calendar_prefetch *prefetch;
+    apr_pool_t *pool;
+    const char *path;
+    const char *etag;
+    icalcomponent *comp;
+    apr_off_t length;
+    apr_off_t max;
+    /* position in the order of the walk */
+    int index;
+    /* set once the task no longer counts towards those ahead */
+    int released;
+    dav_calendar_prefetch_state state;
+} dav_calendar_prefetch_task;
+
+struct dav_calendar_prefetch {
+    apr_thread_mutex_t *mutex;
+    apr_thread_cond_t *cond;
+    /* tasks by URI, and in the order the walk will want them */
+    apr_hash_t *tasks;
+    apr_array_header_t *order;
+    /* next task to hand to the workers, and next the walk will reach */
+    int next;
+    int visited;
+    /* tasks handed to the workers and not yet released */
+    int ahead;
+};
+
+static apr_thread_pool_t *dav_calendar_parse_pool;
+
+static void * APR_THREAD_FUNC dav_calendar_prefetch_run(apr_thread_t *thd,
+        void *data)
+{
+    dav_calendar_prefetch_task *task = data;
+    icalcomponent *comp = NULL;
+    apr_file_t *fd;
+    apr_finfo_t finfo;
+
+    /* taken back by the walk before we got to it? */
+    apr_thread_mutex_lock(task->prefetch->mutex);
+    if (task->state != DAV_CALENDAR_PREFETCH_QUEUED) {
+        apr_thread_mutex_unlock(task->prefetch->mutex);
+        return NULL;
+    }
+    task->state = DAV_CALENDAR_PREFETCH_RUNNING;
+    apr_thread_mutex_unlock(task->prefetch->mutex);
+
+    if (apr_file_open(&fd, task->path, APR_FOPEN_READ | APR_FOPEN_BINARY,
+            APR_OS_DEFAULT, task->pool) == APR_SUCCESS) {
+
+        if (apr_file_info_get(&finfo, APR_FINFO_SIZE | APR_FINFO_TYPE, fd)
+                == APR_SUCCESS && finfo.filetype == APR_REG
+                && finfo.size <= task->max) {
+            apr_size_t len = (apr_size_t)finfo.size;
+            char *buffer = apr_palloc(task->pool, len + 1);
+
+            if (apr_file_read_full(fd, buffer, len, &len) == APR_SUCCESS) {
+                buffer[len] = 0;
+                task->length = len;
+
+                comp = icalparser_parse_string(buffer);
+
+                /* anything unusual is left for the walk to deal with */
+                if (comp && (icalcomponent_isa(comp)
+                        != ICAL_VCALENDAR_COMPONENT
+                        || icalcomponent_count_errors(comp))) {
+                    icalcomponent_free(comp);
+                    comp = NULL;
+                }
+            }
+        }
+
+        apr_file_close(fd);
+    }
+
+    apr_thread_mutex_lock(task->prefetch->mutex);
+    task->comp = comp;
+    task->state = DAV_CALENDAR_PREFETCH_DONE;
+    apr_thread_cond_broadcast(task->prefetch->cond);
+    apr_thread_mutex_unlock(task->prefetch->mutex);
+
+    return NULL;
+}
+
+/* the task no longer counts towards those the workers are ahead by */
+static void dav_calendar_prefetch_release(dav_calendar_prefetch *prefetch,
+        dav_calendar_prefetch_task *task)
+{
+    if (!task->released && task->state != DAV_CALENDAR_PREFETCH_WAITING
+            && task->state != DAV_CALENDAR_PREFETCH_TAKEN) {
+        task->released = 1;
+        prefetch->ahead--;
+    }
+}
+
+/* hand the next tasks to the workers, keeping just enough ahead */
+static void dav_calendar_prefetch_push(dav_calendar_prefetch *prefetch)
+{
+    while (prefetch->ahead < DAV_CALENDAR_PREFETCH_AHEAD
+            * apr_thread_pool_thread_max_get(dav_calendar_parse_pool)
+            && prefetch->next < prefetch->order->nelts) {
+        dav_calendar_prefetch_task *task = APR_ARRAY_IDX(prefetch->order,
+                prefetch->next++, dav_calendar_prefetch_task *);
+        apr_allocator_t *allocator;
+
+        if (task->state != DAV_CALENDAR_PREFETCH_WAITING) {
+            continue;
+        }
+
+        /* the worker allocates alongside us, it needs its own allocator */
+        if (apr_allocator_create(&allocator) != APR_SUCCESS) {
+            break;
+        }
+        if (apr_pool_create_ex(&task->pool, NULL, NULL, allocator)
+                != APR_SUCCESS) {
+            apr_allocator_destroy(allocator);
+            break;
+        }
+        apr_allocator_owner_set(allocator, task->pool);
+
+        task->state = DAV_CALENDAR_PREFETCH_QUEUED;
+        if (apr_thread_pool_push(dav_calendar_parse_pool,
+                dav_calendar_prefetch_run, task,
+                APR_THREAD_TASK_PRIORITY_NORMAL, prefetch) != APR_SUCCESS) {
+            task->state = DAV_CALENDAR_PREFETCH_WAITING;
+            apr_pool_destroy(task->pool);
+            task->pool = NULL;
+            break;
+        }
+
+        prefetch->ahead++;
+    }
+}
+
+/*
+ * The walk is done with the task, whether it took the calendar or not.
+ * A task still queued is taken back from the workers, a task running is
+ * waited for if wait is set, or otherwise left for the cleanup. Returns
+ * the parsed calendar, if the walk is to have it.
+ */
+static icalcomponent *dav_calendar_prefetch_finish(
+        dav_calendar_prefetch *prefetch, dav_calendar_prefetch_task *task,
+        int wait, apr_off_t *length)
+{
+    icalcomponent *comp = NULL;
+
+    apr_thread_mutex_lock(prefetch->mutex);
+    if (task->state == DAV_CALENDAR_PREFETCH_TAKEN) {
+        apr_thread_mutex_unlock(prefetch->mutex);
+        return NULL;
+    }
+    while (wait && task->state == DAV_CALENDAR_PREFETCH_RUNNING) {
+        apr_thread_cond_wait(prefetch->cond, prefetch->mutex);
+    }
+
+    dav_calendar_prefetch_release(prefetch, task);
+
+    switch (task->state) {
+    case DAV_CALENDAR_PREFETCH_RUNNING:
+        /* the cleanup frees what the worker leaves behind */
+        apr_thread_mutex_unlock(prefetch->mutex);
+        return NULL;
+    case DAV_CALENDAR_PREFETCH_DONE:
+        comp = task->comp;
+        task->comp = NULL;
+        *length = task->length;
+        break;
+    default:
+        break;
+    }
+
+    task->state = DAV_CALENDAR_PREFETCH_TAKEN;
+    apr_thread_mutex_unlock(prefetch->mutex);
+
+    if (task->pool) {
+        apr_pool_destroy(task->pool);
+        task->pool = NULL;
+    }
+
+    return comp;
+}
+
+static apr_status_t dav_calendar_prefetch_cleanup(void *data)
+{
+    dav_calendar_prefetch *prefetch = data;
+    int i;
+
+    /* drop what has not started, wait for what has */
+    apr_thread_pool_tasks_cancel(dav_calendar_parse_pool, prefetch);
+
+    for (i = 0; i < prefetch->order->nelts; i++) {
+        dav_calendar_prefetch_task *task = APR_ARRAY_IDX(prefetch->order, i,
+                dav_calendar_prefetch_task *);
+
+        dav_calendar_prefetch_release(prefetch, task);
+
+        if (task->comp) {
+            icalcomponent_free(task->comp);
+            task->comp = NULL;
+        }
+        if (task->pool) {
+            apr_pool_destroy(task->pool);
+            task->pool = NULL;
+        }
+    }
+
+    return APR_SUCCESS;
+}
+
+static void dav_calendar_prefetch_add(request_rec *r,
+        dav_calendar_prefetch *prefetch, const char *uri, const char *etag)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+    dav_calendar_cache *cache = dav_calendar_cache_global;
+    dav_calendar_prefetch_task *task;
+    const char *path;
+
+    if (!etag || !(path = dav_calendar_direct_path(r, uri))) {
+        return;
+    }
+
+    /* already parsed, nothing to gain */
+    if (cache) {
+        int cached;
+
+        dav_calendar_cache_lock(cache);
+        cached = dav_calendar_cache_lookup(r, cache,
+                DAV_CALENDAR_CACHE_CALENDAR,
+                dav_calendar_cache_key(r, DAV_CALENDAR_CACHE_CALENDAR, uri),
+                etag) != NULL;
+        dav_calendar_cache_unlock(cache);
+
+        if (cached) {
+            return;
+        }
+    }
+
+    /* no sense parsing what the index will rule out */
+    if (dav_calendar_index_reject(r, dav_calendar_get_request_rec(r)->plan,
+            uri, etag, r->pool)) {
+        return;
+    }
+
+    task = apr_pcalloc(r->pool, sizeof(dav_calendar_prefetch_task));
+    task->prefetch = prefetch;
+    task->path = path;
+    task->etag = etag;
+    task->max = conf->max_resource_size;
+    task->index = prefetch->order->nelts;
+
+    apr_hash_set(prefetch->tasks, uri, APR_HASH_KEY_STRING, task);
+    APR_ARRAY_PUSH(prefetch->order, dav_calendar_prefetch_task *) = task;
+}
+
+/* are the members of collections parsed ahead of the walk? */
+static int dav_calendar_prefetch_enabled(request_rec *r)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+
+    return dav_calendar_parse_pool && conf->direct_read;
+}
+
+/*
+ * Start parsing the members of the collection ahead of the walk. The
+ * members are taken from the collection state; without it we would have
+ * to walk the collection twice, and the members are parsed by the walk.
+ */
+static void dav_calendar_prefetch_start(request_rec *r,
+        const dav_resource *resource,
+        const dav_calendar_collection_state *state, int depth)
+{
+    dav_calendar_request_rec *rconf = dav_calendar_get_request_rec(r);
+    dav_calendar_prefetch *prefetch;
+    int i;
+
+    if (!dav_calendar_prefetch_enabled(r) || !depth || !state
+            || !resource->collection || rconf->prefetch) {
+        return;
+    }
+
+    prefetch = apr_pcalloc(r->pool, sizeof(dav_calendar_prefetch));
+    if (apr_thread_mutex_create(&prefetch->mutex, APR_THREAD_MUTEX_DEFAULT,
+            r->pool) != APR_SUCCESS
+            || apr_thread_cond_create(&prefetch->cond, r->pool)
+            != APR_SUCCESS) {
+        return;
+    }
+    prefetch->tasks = apr_hash_make(r->pool);
+    prefetch->order = apr_array_make(r->pool, 16,
+            sizeof(dav_calendar_prefetch_task *));
+
+    for (i = 0; i < state->nelts; i++) {
+        dav_calendar_prefetch_add(r, prefetch, state->uris[i],
+                dav_calendar_strong_etag_str(state->etags[i]));
+    }
+
+    if (!prefetch->order->nelts) {
+        return;
+    }
+
+    /* runs before the mutex goes, and before the tasks are freed */
+    apr_pool_cleanup_register(r->pool, prefetch,
+            dav_calendar_prefetch_cleanup, apr_pool_cleanup_null);
+
+    rconf->prefetch = prefetch;
+
+    dav_calendar_prefetch_push(prefetch);
+}
+
+/*
+ * Take the calendar parsed for us by a worker, waiting for the worker
+ * to finish if it has started. Returns NULL if the member was not parsed
+ * ahead of us, and must be read the usual way. Members the walk passed
+ * over are done with, and make way for more.
+ */
+static icalcomponent *dav_calendar_prefetch_take(request_rec *r,
+        const char *uri, const char *etag, apr_off_t *length)
+{
+    dav_calendar_prefetch *prefetch = dav_calendar_get_request_rec(r)->prefetch;
+    dav_calendar_prefetch_task *task;
+    icalcomponent *comp;
+
+    if (!prefetch
+            || !(task = apr_hash_get(prefetch->tasks, uri, APR_HASH_KEY_STRING))) {
+        return NULL;
+    }
+
+    apr_hash_set(prefetch->tasks, uri, APR_HASH_KEY_STRING, NULL);
+
+    /* the walk will not be back for the members it passed over */
+    while (prefetch->visited < task->index) {
+        apr_off_t skipped;
+        dav_calendar_prefetch_task *passed = APR_ARRAY_IDX(prefetch->order,
+                prefetch->visited++, dav_calendar_prefetch_task *);
+
+        comp = dav_calendar_prefetch_finish(prefetch, passed, 0, &skipped);
+        if (comp) {
+            icalcomponent_free(comp);
+        }
+    }
+    prefetch->visited = task->index + 1;
+
+    comp = dav_calendar_prefetch_finish(prefetch, task, 1, length);
+
+    /* changed since we listed it? */
+    if (comp && (!etag || strcmp(task->etag, etag))) {
+        icalcomponent_free(comp);
+        comp = NULL;
+    }
+
+    /* the worker cannot count for us, count what we took */
+    if (comp) {
+        dav_calendar_metrics_count(r, DAV_CALENDAR_COUNT_BYTES_PARSED,
+                *length);
+    }
+
+    /* keep the workers busy */
+    dav_calendar_prefetch_push(prefetch);
+
+    return comp;
+}
+
+#else
+
+static int dav_calendar_prefetch_enabled(request_rec *r)
+{
+    return 0;
+}
+
+static void dav_calendar_prefetch_start(request_rec *r,
+        const dav_resource *resource,
+        const dav_calendar_collection_state *state, int depth)
+{
+}
+
+static icalcomponent *dav_calendar_prefetch_take(request_rec *r,
+        const char *uri, const char *etag, apr_off_t *length)
+{
+    return NULL;
+}
+
+#endif
+
+/*
+ * Would a GET of the collection holding the URI be allowed?
+ *
+ * The cache, the prefetch workers and direct reads all bypass the GET
+ * subrequest, and with it the access checks made by the server. Access
+ * is instead checked once per request for each collection, by running
+ * the checks of a GET of the collection, so that what the cache holds is
+ * only ever handed to those allowed to read the collection. Access
+ * controls applied to individual members are not consulted.
+ */
+static dav_error *dav_calendar_check_access(request_rec *r, const char *uri)
+{
+    dav_calendar_request_rec *rconf = dav_calendar_get_request_rec(r);
+    request_rec *top = r;
+    const char *slash;
+    char *collection;
+    int *status;
+
+    while (top->main) {
+        top = top->main;
+    }
+
+    /* the collection is everything up to the last segment */
+    slash = uri + strlen(uri);
+    while (slash > uri && slash[-1] == '/') {
+        slash--;
+    }
+    while (slash > uri && slash[-1] != '/') {
+        slash--;
+    }
+    collection = apr_pstrmemdup(top->pool, uri, slash - uri);
+
+    if (!rconf->access) {
+        rconf->access = apr_hash_make(top->pool);
+    }
+
+    status = apr_hash_get(rconf->access, collection, APR_HASH_KEY_STRING);
+    if (!status) {
+        request_rec *rr = ap_sub_req_method_uri("GET", collection, top, NULL);
+
+        status = apr_palloc(top->pool, sizeof(int));
+        *status = rr->status;
+        ap_destroy_sub_req(rr);
+
+        apr_hash_set(rconf->access, collection, APR_HASH_KEY_STRING, status);
+    }
+
+    if (*status != HTTP_OK) {
+        return dav_new_error(r->pool, *status, 0, 0,
+                "Access to calendar denied.");
+    }
+
+    return NULL;
+}
+
+/*
+ * Read and parse a calendar object resource into the context.
+ *
+ * The parsed calendar comes from the cache if an up to date copy is
+ * present, otherwise the resource is delivered through the parse filter,
+ * and what we learned is saved in the index and the cache. If no resource
+ * is given, the body is read with a GET subrequest to the URI, or when
+ * the subrequest is bypassed, the access checks of the collection are
+ * run in its place.
+ */
+static dav_error *dav_calendar_read_uri_internal(request_rec *r,
+        const char *uri, const char *etag, const dav_resource *resource,
+        dav_calendar_ctx *ctx)
+{
+    dav_error *err = NULL;
+    ap_filter_t *f;
+    icalcomponent *comp;
+    const char *path;
+    apr_off_t length = 0;
+    int direct = 0;
+
+    f = dav_calendar_create_parse_icalendar_filter(r, ctx);
+
+    ctx->uri = uri;
+    ctx->etag = etag;
+
+    /* only the parse may be skipped, never the access checks */
+    if (!resource && (dav_calendar_cache_global || dav_calendar_direct_path(r,
+            uri)) && (err = dav_calendar_check_access(r, uri))) {
+        return dav_push_error(r->pool, err->status, 0,
+                "Unable to read calendar.", err);
+    }
+
+    /* already parsed? */
+    if ((comp = dav_calendar_cache_get(r, uri, etag, &length))) {
+
+        ctx->length = length;
+
+        if (dav_calendar_process_calendar(r, ctx, comp) != APR_SUCCESS) {
+            return dav_push_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0,
+                    "Unable to parse calendar.", ctx->err);
+        }
+
+        return NULL;
+    }
+
+    ctx->cacheable = etag && dav_calendar_cache_global;
+
+    /* parsed ahead of us by a worker? */
+    if (!resource && (comp = dav_calendar_prefetch_take(r, uri, etag,
+            &length))) {
+        direct = 1;
+        ctx->length = length;
+
+        if (dav_calendar_process_calendar(r, ctx, comp) != APR_SUCCESS) {
+            err = dav_push_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0,
+                    "Unable to parse calendar.", ctx->err);
+        }
+    }
+
+    /* filesystem backed? skip the subrequest and read the file */
+    else if (!resource && (path = dav_calendar_direct_path(r, uri))) {
+        err = dav_calendar_read_file(r, ctx, path, &direct);
+        if (err) {
+            err = dav_push_error(r->pool, err->status, 0,
+                    "Unable to read calendar.", err);
+        }
+    }
+
+    if (direct) {
+        /* already read */
+    }
+
+    /* we have to "deliver" the stream into an output filter */
+    else if (!resource) {
+        int status;
+
+        request_rec *rr = ap_sub_req_method_uri("GET", uri, r, f);
+
+        status = ap_run_sub_req(rr);
+        if (status != OK) {
+            err = dav_push_error(r->pool, status, 0,
+                    "Unable to read calendar.",
+                    ctx->err);
+        }
+        ap_destroy_sub_req(rr);
+
+    }
+
+    /* mod_dav delivers the body */
+    else if ((err = (*resource->hooks->deliver)(resource, f)) != NULL) {
+
+        err = dav_push_error(r->pool, err->status, 0,
+                "Unable to read calendar.", err);
+
+    }
+
+    /* the subrequest swallows the EOS, parse the last line ourselves */
+    if (!err && !ctx->err) {
+        dav_calendar_parse_icalendar_finish(r, ctx);
+    }
+
+    /* how did the parsing go? */
+    if (!err && (ctx->err || !ctx->comp)) {
+        err = dav_push_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0,
+                "Unable to parse calendar.",
+                ctx->err);
+    }
+
+    if (err) {
+        return err;
+    }
+
+    /* remember what we learned for next time */
+    if (ctx->index) {
+        dav_calendar_index_store(r, uri, etag, ctx->index);
+    }
+
+    if (ctx->cache_comp) {
+        apr_pool_cleanup_kill(r->pool, ctx->cache_comp, icalcomponent_cleanup);
+        dav_calendar_cache_put(r, uri, etag, ctx->cache_comp,
+                ctx->length);
+        ctx->cache_comp = NULL;
+    }
+
+    return NULL;
+}
+
+static dav_error *dav_calendar_read_uri(request_rec *r, const char *uri,
+        const char *etag, const dav_resource *resource, dav_calendar_ctx *ctx)
+{
+    apr_time_t start = dav_calendar_timing_start(r);
+    dav_error *err;
+
+    err = dav_calendar_read_uri_internal(r, uri, etag, resource, ctx);
+
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_READ, start);
+
+    return err;
+}
+
+static dav_error *dav_calendar_read_resource(request_rec *r,
+        const dav_resource *resource, dav_calendar_ctx *ctx)
+{
+    return dav_calendar_read_uri(r, resource->uri,
+            dav_calendar_strong_etag(resource),
+            resource->hooks->handle_get ? resource : NULL, ctx);
+}
+
+/*
+ * The collection tag.
+ *
+ * Each calendar collection carries a dead property in our private
+ * namespace, replaced with a fresh token whenever a member of the
+ * collection is written. The token is served as the getctag property,
+ * and as the ETag of the collection GET, without walking the members.
+ */
+static const dav_prop_name dav_calendar_ctag_name =
+        { DAV_CALENDAR_PRIVATE_NAMESPACE, "ctag" };
+
+static const char *dav_calendar_ctag_get(request_rec *r,
+        const dav_resource *resource)
+{
+    const dav_provider *provider;
+    dav_db *db = NULL;
+    dav_error *err;
+    apr_text_header hdr[1] = { { 0 } };
+    apr_text *t;
+    const char *text = "", *start, *end;
+    int found = 0;
+
+    provider = dav_get_provider(r);
+    if (!provider || !provider->propdb || !resource->collection) {
+        return NULL;
+    }
+
+    if ((err = provider->propdb->open(r->pool, resource, 1, &db)) != NULL) {
+        dav_log_err(r, err, APLOG_DEBUG);
+        return NULL;
+    }
+    if (!db) {
+        return NULL;
+    }
+
+    err = provider->propdb->output_value(db, &dav_calendar_ctag_name, NULL,
+            hdr, &found);
+    provider->propdb->close(db);
+
+    if (err) {
+        dav_log_err(r, err, APLOG_DEBUG);
+        return NULL;
+    }
+    if (!found) {
+        return NULL;
+    }
+
+    for (t = hdr->first; t; t = t->next) {
+        text = apr_pstrcat(r->pool, text, t->text, NULL);
+    }
+
+    /* the value is the text of the element */
+    start = strchr(text, '>');
+    if (!start || start[-1] == '/') {
+        return NULL;
+    }
+    start++;
+    end = strchr(start, '<');
+    if (!end || end == start) {
+        return NULL;
+    }
+
+    return apr_pstrndup(r->pool, start, end - start);
+}
+
+static dav_error *dav_calendar_ctag_set(request_rec *r,
+        const dav_resource *resource)
+{
+    const dav_provider *provider;
+    dav_db *db = NULL;
+    dav_error *err;
+    apr_array_header_t *ns;
+    dav_namespace_map *map = NULL;
+    apr_xml_elem elem = { 0 };
+    apr_text text = { 0 };
+
+    provider = dav_get_provider(r);
+    if (!provider || !provider->propdb) {
+        return NULL;
+    }
+
+    if ((err = provider->propdb->open(r->pool, resource, 0, &db)) != NULL) {
+        return dav_push_error(r->pool, err->status, 0,
+                "Property database could not be opened, "
+                "cannot update the collection tag.",
+                err);
+    }
+    if (!db) {
+        return NULL;
+    }
+
+    ns = apr_array_make(r->pool, 1, sizeof(const char *));
+    APR_ARRAY_PUSH(ns, const char *) = DAV_CALENDAR_PRIVATE_NAMESPACE;
+
+    /* unique across processes, threads and time */
+    elem.name = dav_calendar_ctag_name.name;
+    elem.ns = 0;
+    elem.first_cdata.first = &text;
+    text.text = apr_psprintf(r->pool, "%" APR_TIME_T_FMT "-%ld",
+            apr_time_now(), r->connection->id);
+
+    if ((err = provider->propdb->map_namespaces(db, ns, &map)) != NULL) {
+        err = dav_push_error(r->pool, err->status, 0,
+                "Namespace could not be mapped, "
+                "cannot update the collection tag.",
+                err);
+    }
+    else if ((err = provider->propdb->store(db, &dav_calendar_ctag_name,
+            &elem, map)) != NULL) {
+        err = dav_push_error(r->pool, err->status, 0,
+                "Property 'ctag' could not be stored, "
+                "cannot update the collection tag.",
+                err);
+    }
+
+    provider->propdb->close(db);
+
+    return err;
+}
+
+static dav_prop_insert dav_calendar_insert_prop(const dav_resource *resource,
+        int propid, dav_prop_insert what, apr_text_header *phdr)
+{
+    request_rec *r = resource->hooks->get_request_rec(resource);
+
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+
+    apr_pool_t *p = resource->pool;
+    const dav_liveprop_spec *info;
+    int global_ns;
+
+    switch (propid) {
+    case DAV_CALENDAR_PROPID_calendar_data:
+        /* property allowed only in a calendar-multiget */
+        if (!r || r->method_number != M_REPORT) {
+            return DAV_PROP_INSERT_NOTDEF;
+        }
+
+        break;
+    case DAV_CALENDAR_PROPID_calendar_home_set:
+        /* property allowed, handled below */
+
+        break;
+    case DAV_CALENDAR_PROPID_max_resource_size:
+        /* property allowed, handled below */
+
+        break;
+    case DAV_CALENDAR_PROPID_max_instances:
+        /* property allowed on collections, handled below */
+        if (!resource->collection) {
+            return DAV_PROP_INSERT_NOTDEF;
+        }
+
+        break;
+    case DAV_CALENDAR_PROPID_getctag:
+    case DAV_CALENDAR_PROPID_sync_token:
+        /* property allowed on collections, handled below */
+        if (!resource->collection) {
+            return DAV_PROP_INSERT_NOTDEF;
+        }
+
+        break;
+    case DAV_CALENDAR_PROPID_supported_collation_set:
+        /* property allowed, handled below */
+
+        break;
+    default:
+        /* ### what the heck was this property? */
+        return DAV_PROP_INSERT_NOTDEF;
+    }
+
+    /* assert: value != NULL */
+
+    /* get the information and global NS index for the property */
+    global_ns = dav_get_liveprop_info(propid, &dav_calendar_liveprop_group, &info);
+
+    /* assert: info != NULL && info->name != NULL */
+
+    if (what == DAV_PROP_INSERT_VALUE) {
+
+        switch (propid) {
+        case DAV_CALENDAR_PROPID_calendar_data: {
+            dav_error *err;
+            dav_liveprop_elem *element = dav_get_liveprop_element(resource);
+            dav_calendar_ctx ctx = { 0 };
+            ctx.r = r;
+            ctx.plan = dav_calendar_get_request_rec(r)->plan;
+
+            if (element) {
+                ctx.doc = element->doc;
+                ctx.elem = element->elem;
+            }
+
+            if ((err = dav_calendar_read_resource(r, resource, &ctx))) {
+                dav_calendar_request_rec *rconf = dav_calendar_get_request_rec(r);
+
+                /* a failed precondition fails the whole report */
+                if (err->tagname && !rconf->err) {
+                    request_rec *rr = r;
+
+                    /* the error must outlive any subrequest */
+                    while (rr->main) {
+                        rr = rr->main;
+                    }
+                    rconf->err = dav_new_error(rr->pool, err->status,
+                            err->error_id, err->aprerr,
+                            apr_pstrdup(rr->pool, err->desc));
+                    rconf->err->tagname = err->tagname;
+                }
+                dav_log_err(r, err, APLOG_ERR);
+
+                return DAV_PROP_INSERT_NOTDEF;
+            }
+
+            if (ctx.match && ctx.comp) {
+                apr_time_t start = dav_calendar_timing_start(r);
+                const char *ical = apr_pescape_entity(p,
+                        icalcomponent_as_ical_string(ctx.comp), 0);
+
+                dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_SERIALISE, start);
+
+                apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>",
+                        global_ns, info->name));
+
+                apr_text_append(p, phdr, ical);
+
+                apr_text_append(p, phdr, apr_psprintf(p, "</lp%d:%s>" DEBUG_CR,
+                        global_ns, info->name));
+
+            }
+            else {
+
+                /* if there is no match, we want the entire resource to vanish from results */
+                apr_pool_userdata_setn(DAV_CALENDAR_SKIP, DAV_CALENDAR_SKIP, NULL,
+                    resource->pool);
+
+            }
+
+            break;
+        }
+        case DAV_CALENDAR_PROPID_calendar_home_set: {
+            int i;
+
+            apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>",
+                    global_ns, info->name));
+
+            for (i = 0; i < conf->dav_calendar_homes->nelts; ++i) {
+                const char *err = NULL, *url;
+                ap_expr_info_t *home = APR_ARRAY_IDX(conf->dav_calendar_homes, i, ap_expr_info_t *);
+
+                url = ap_expr_str_exec(r, home, &err);
+                if (err) {
+                    ap_log_rerror(APLOG_MARK, APLOG_WARNING, 0, r,
+                                    "Failure while evaluating the calendar-home-set URL expression for '%s', "
+                                    "calendar home value ignored: %s", r->uri, err);
+                }
+                else {
+                    apr_text_append(p, phdr,
+                            apr_psprintf(p, "<D:href>%s</D:href>", url));
+                }
+
+            }
+
+            apr_text_append(p, phdr, apr_psprintf(p, "</lp%d:%s>" DEBUG_CR,
+                    global_ns, info->name));
+
+            break;
+        }
+        case DAV_CALENDAR_PROPID_max_resource_size: {
+
+            apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>",
+                    global_ns, info->name));
+
+            apr_text_append(p, phdr,
+                    apr_psprintf(p, "<D:href>%" APR_OFF_T_FMT "</D:href>",
+                            conf->max_resource_size));
+
+            apr_text_append(p, phdr, apr_psprintf(p, "</lp%d:%s>" DEBUG_CR,
+                    global_ns, info->name));
+
+            break;
+        }
+        case DAV_CALENDAR_PROPID_max_instances: {
+
+            apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>%d</lp%d:%s>" DEBUG_CR,
+                    global_ns, info->name, conf->max_instances,
+                    global_ns, info->name));
+
+            break;
+        }
+        case DAV_CALENDAR_PROPID_getctag: {
+            const char *ctag = dav_calendar_ctag_get(r, resource);
+
+            if (!ctag) {
+                return DAV_PROP_INSERT_NOTDEF;
+            }
+
+            apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>%s</lp%d:%s>" DEBUG_CR,
+                    global_ns, info->name, apr_pescape_entity(p, ctag, 0),
+                    global_ns, info->name));
+
+            break;
+        }
+        case DAV_CALENDAR_PROPID_sync_token: {
+            const char *token = dav_calendar_journal_current(r, resource->uri);
+
+            if (!token) {
+                return DAV_PROP_INSERT_NOTDEF;
+            }
+
+            apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>%s</lp%d:%s>" DEBUG_CR,
+                    global_ns, info->name, apr_xml_quote_string(p, token, 0),
+                    global_ns, info->name));
+
+            break;
+        }
+        case DAV_CALENDAR_PROPID_supported_collation_set: {
+
+            apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s>",
+                    global_ns, info->name));
+
+            apr_text_append(p, phdr,
+                    apr_psprintf(p,
+                        "<lp%d:supported-collation>"
+                        DAV_CALENDAR_COLLATION_ASCII_CASEMAP
+                        "</lp%d:supported-collation>",
+                        global_ns, global_ns));
+            apr_text_append(p, phdr,
+                    apr_psprintf(p,
+                        "<lp%d:supported-collation>"
+                        DAV_CALENDAR_COLLATION_OCTET
+                        "</lp%d:supported-collation>",
+                        global_ns, global_ns));
+            apr_text_append(p, phdr,
+                    apr_psprintf(p,
+                        "<lp%d:supported-collation>"
+                        DAV_CALENDAR_COLLATION_UNICODE_CASEMAP
+                        "</lp%d:supported-collation>",
+                        global_ns, global_ns));
+
+            apr_text_append(p, phdr, apr_psprintf(p, "</lp%d:%s>" DEBUG_CR,
+                    global_ns, info->name));
+
+            break;
+        }
+        default:
+            break;
+        }
+
+    }
+    else if (what == DAV_PROP_INSERT_NAME) {
+        apr_text_append(p, phdr, apr_psprintf(p, "<lp%d:%s/>" DEBUG_CR, global_ns, info->name));
+    }
+    else {
+        /* assert: what == DAV_PROP_INSERT_SUPPORTED */
+        apr_text_append(p, phdr, "<D:supported-live-property D:name=\"");
+        apr_text_append(p, phdr, info->name);
+        apr_text_append(p, phdr, "\" D:namespace=\"");
+        apr_text_append(p, phdr, dav_calendar_namespace_uris[info->ns]);
+        apr_text_append(p, phdr, "\"/>" DEBUG_CR);
+    }
+
+    /* we inserted what was asked for */
+    return what;
+}
+
+static int dav_calendar_is_writable(const dav_resource *resource, int propid)
+{
+    const dav_liveprop_spec *info;
+
+    (void) dav_get_liveprop_info(propid, &dav_calendar_liveprop_group, &info);
+    return info->is_writable;
+}
+
+static dav_error *dav_calendar_patch_validate(const dav_resource *resource,
+    const apr_xml_elem *elem, int operation, void **context, int *defer_to_dead)
+{
+    /* We have no writable properties */
+    return NULL;
+}
+
+static dav_error *dav_calendar_patch_exec(const dav_resource *resource,
+    const apr_xml_elem *elem, int operation, void *context,
+    dav_liveprop_rollback **rollback_ctx)
+{
+    /* We have no writable properties */
+    return NULL;
+}
+
+static void dav_calendar_patch_commit(const dav_resource *resource, int operation,
+    void *context, dav_liveprop_rollback *rollback_ctx)
+{
+    /* We have no writable properties */
+}
+
+static dav_error *dav_calendar_patch_rollback(const dav_resource *resource,
+    int operation, void *context, dav_liveprop_rollback *rollback_ctx)
+{
+    /* We have no writable properties */
+    return NULL;
+}
+
+static const dav_hooks_liveprop dav_hooks_liveprop_calendar =
+{
+    dav_calendar_insert_prop,
+    dav_calendar_is_writable,
+    dav_calendar_namespace_uris,
+    dav_calendar_patch_validate,
+    dav_calendar_patch_exec,
+    dav_calendar_patch_commit,
+    dav_calendar_patch_rollback
+};
+
+static int dav_calendar_find_liveprop(const dav_resource *resource,
+    const char *ns_uri, const char *name, const dav_hooks_liveprop **hooks)
+{
+    return dav_do_find_liveprop(ns_uri, name, &dav_calendar_liveprop_group, hooks);
+}
+
+static dav_error *dav_calendar_options_header(request_rec *r,
+        const dav_resource *resource, apr_text_header *phdr)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+
+    if (conf && conf->dav_calendar) {
+        apr_text_append(r->pool, phdr, "calendar-access");
+    }
+
+    return NULL;
+}
+
+static dav_error *dav_calendar_options_method(request_rec *r,
+        const dav_resource *resource, apr_text_header *phdr)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+
+    if (conf && conf->dav_calendar) {
+        apr_text_append(r->pool, phdr, "MKCALENDAR");
+        apr_text_append(r->pool, phdr, "REPORT");
+    }
+
+    return NULL;
+}
+
+static dav_options_provider options =
+{
+    dav_calendar_options_header,
+    dav_calendar_options_method,
+    NULL
+};
+
+/*
+ * Is the collection a calendar?
+ *
+ * The resourcetype dead property is looked up by name. For collections
+ * stored on disk by mod_dav_fs, the answer is kept in the cache against
+ * the modification time and size of the property database in the .DAV
+ * directory of the collection, which changes whenever a property of the
+ * collection does.
+ */
+
+/* the names mod_dav_fs gives the property database of a directory */
+static const char * const dav_calendar_propdb_names[] = {
+    ".DAV/.state_for_dir.pag",
+    ".DAV/.state_for_dir.db",
+    ".DAV/.state_for_dir",
+    NULL
+};
+
+static const char dav_calendar_type_calendar[] = "calendar";
+static const char dav_calendar_type_other[] = "other";
+
+static void dav_calendar_cache_free_none(void *value)
+{
+}
+
+/*
+ * Work out the directory behind an ancestor of the request, the way
+ * mod_dav_fs finds the parent of a resource, by dropping one directory
+ * from the path for each segment dropped from the URI. As in mod_dav_fs,
+ * the path of the request is the filename with any path info appended,
+ * the path info being the part of the URI that does not exist yet.
+ */
+static const char *dav_calendar_ancestor_path(request_rec *r, const char *uri)
+{
+    apr_size_t len = strlen(uri);
+    const char *rest;
+    char *path, *slash;
+    int segments = 0;
+
+    if (!r->filename || len >= strlen(r->uri) || strncmp(r->uri, uri, len)
+            || (len && uri[len - 1] != '/' && r->uri[len] != '/')) {
+        return NULL;
+    }
+
+    for (rest = r->uri + len; *rest; rest++) {
+        if (*rest != '/' && (rest == r->uri || rest[-1] == '/')) {
+            segments++;
+        }
+    }
+
+    path = apr_pstrcat(r->pool, r->filename, r->path_info, NULL);
+
+    while (segments--) {
+        len = strlen(path);
+        while (len > 1 && path[len - 1] == '/') {
+            path[--len] = 0;
+        }
+        if (!(slash = strrchr(path, '/')) || slash == path) {
+            return NULL;
+        }
+        *slash = 0;
+    }
+
+    return path;
+}
+
+static const char *dav_calendar_propdb_validator(request_rec *r,
+        const dav_resource *resource)
+{
+    const char *path = dav_calendar_resource_path(r, resource->uri);
+    apr_finfo_t finfo;
+    int i;
+
+    if (!path) {
+        path = dav_calendar_ancestor_path(r, resource->uri);
+    }
+    if (!path) {
+        return NULL;
+    }
+
+    for (i = 0; dav_calendar_propdb_names[i]; i++) {
+        if (apr_stat(&finfo, apr_pstrcat(r->pool, path, "/",
+                dav_calendar_propdb_names[i], NULL),
+                APR_FINFO_MTIME | APR_FINFO_SIZE, r->pool) == APR_SUCCESS) {
+            return apr_psprintf(r->pool, "%" APR_TIME_T_FMT "-%" APR_OFF_T_FMT,
+                    finfo.mtime, finfo.size);
+        }
+    }
+
+    /* no database we know of, don't guess */
+    return NULL;
+}
+
+static dav_error *dav_calendar_is_calendar(request_rec *r,
+        const dav_resource *resource, int *calendar)
+{
+    dav_calendar_cache *cache = dav_calendar_cache_global;
+    const dav_provider *provider;
+    const dav_prop_name name = { "DAV:", "resourcetype" };
+    const char *validator = NULL, *key = NULL;
+    apr_text_header hdr = { 0 };
+    apr_text *t;
+    dav_db *db = NULL;
+    dav_error *err;
+    int found = 0;
+
+    *calendar = 0;
+
+    /* only collections can be calendars */
+    if (!resource->exists || !resource->collection) {
+        return NULL;
+    }
+
+    if (cache && (validator = dav_calendar_propdb_validator(r, resource))) {
+        dav_calendar_cache_entry *entry;
+
+        key = dav_calendar_cache_key(r, DAV_CALENDAR_CACHE_TYPE,
+                resource->uri);
+
+        dav_calendar_cache_lock(cache);
+        entry = dav_calendar_cache_lookup(r, cache, DAV_CALENDAR_CACHE_TYPE,
+                key, validator);
+        if (entry) {
+            *calendar = entry->value == dav_calendar_type_calendar;
+        }
+        dav_calendar_cache_unlock(cache);
+
+        if (entry) {
+            return NULL;
+        }
+    }
+
+    provider = dav_get_provider(r);
+    if (!provider || !provider->propdb) {
+        return NULL;
+    }
+
+    if ((err = provider->propdb->open(r->pool, resource, 1, &db)) != NULL) {
+        return err;
+    }
+
+    if (db) {
+        err = provider->propdb->output_value(db, &name, NULL, &hdr, &found);
+        provider->propdb->close(db);
+
+        if (err) {
+            return err;
+        }
+    }
+
+    for (t = found ? hdr.first : NULL; t; t = t->next) {
+        if (strstr(t->text, ">calendar<")) {
+            *calendar = 1;
+            break;
+        }
+    }
+
+    if (key) {
+        dav_calendar_cache_insert(r, cache, DAV_CALENDAR_CACHE_TYPE, key,
+                validator,
+                (void *)(*calendar ? dav_calendar_type_calendar
+                        : dav_calendar_type_other),
+                dav_calendar_cache_free_none, strlen(key) + strlen(validator));
+    }
+
+    return NULL;
+}
+
+static int dav_calendar_get_resource_type(const dav_resource *resource,
+                                    const char **type, const char **uri)
+{
+    request_rec *r;
+
+    dav_error *err;
+    int calendar;
+
+    *type = *uri = NULL;
+
+    if (resource && resource->hooks && resource->hooks->get_request_rec) {
+        r = resource->hooks->get_request_rec(resource);
+    }
+    else {
+        return DECLINED;
+    }
+
+    /* find the dav provider */
+    if (dav_get_provider(r) == NULL) {
+        return dav_handle_err(r, dav_new_error(r->pool, HTTP_METHOD_NOT_ALLOWED, 0, 0,
+                apr_psprintf(r->pool,
+                        "DAV not enabled for %s",
+                        ap_escape_html(r->pool, r->uri))), NULL);
+    }
+
+    if ((err = dav_calendar_is_calendar(r, resource, &calendar)) != NULL) {
+        return dav_handle_err(r, dav_push_error(r->pool, err->status, 0,
+                "Property could not be retrieved, "
+                "cannot retrieve the resource type.",
+                err), NULL);
+    }
+
+    if (!calendar) {
+        return DECLINED;
+    }
+
+    *type = "calendar";
+    *uri = DAV_CALENDAR_XML_NAMESPACE;
+
+    return OK;
+}
+
+/*
+ * Replace the collection tag of the calendar collection containing the
+ * given URI, if any, and journal the change to the member.
+ */
+static void dav_calendar_ctag_bump(request_rec *r, const char *uri,
+        int self, char op)
+{
+    dav_lookup_result lookup;
+    dav_resource *resource = NULL;
+    dav_error *err;
+    const char *type, *ns;
+    char *parent;
+    apr_size_t len;
+
+    if (self) {
+        parent = apr_pstrdup(r->pool, uri);
+    }
+    else {
+        /* strip any trailing slash, so that a collection finds its parent */
+        parent = apr_pstrdup(r->pool, uri);
+        len = strlen(parent);
+        while (len > 1 && parent[len - 1] == '/') {
+            parent[--len] = 0;
+        }
+        parent = ap_make_dirstr_parent(r->pool, parent);
+    }
+
+    lookup = dav_lookup_uri(parent, r, 0 /* must_be_absolute */);
+    if (lookup.rnew == NULL || lookup.rnew->status != HTTP_OK) {
+        if (lookup.rnew) {
+            ap_destroy_sub_req(lookup.rnew);
+        }
+        return;
+    }
+
+    if ((err = dav_get_resource(lookup.rnew, 0 /* label_allowed */,
+            0 /* use_checked_in */, &resource)) == NULL
+            && resource->exists && resource->collection
+            && dav_calendar_get_resource_type(resource, &type, &ns) == OK
+            && type && !strcmp(type, "calendar")) {
+
+        apr_status_t status = APR_SUCCESS;
+
+        /* one writer at a time, so that no bump is lost */
+        if (dav_calendar_journal_mutex
+                && (status = apr_global_mutex_lock(dav_calendar_journal_mutex))
+                        != APR_SUCCESS) {
+            ap_log_rerror(APLOG_MARK, APLOG_ERR, status, r,
+                    "mod_dav_calendar: Could not lock the calendar journal, "
+                    "collection tag not updated");
+        }
+        else {
+            if ((err = dav_calendar_ctag_set(lookup.rnew, resource))) {
+                dav_log_err(r, err, APLOG_ERR);
+            }
+            if (dav_calendar_journal_mutex) {
+                apr_global_mutex_unlock(dav_calendar_journal_mutex);
+            }
+        }
+
+        if (!self) {
+            dav_calendar_journal_append(lookup.rnew, resource->uri, uri, op);
+        }
+
+    }
+
+    ap_destroy_sub_req(lookup.rnew);
+}
+
+static dav_resource_type_provider resource_types =
+{
+    dav_calendar_get_resource_type
+};
+
+static dav_error * dav_calendar_etag_walker(dav_walk_resource *wres, int calltype)
+{
+    dav_calendar_ctx *cctx = wres->walk_ctx;
+    const char *etag;
+
+    /* avoid loops */
+    if (calltype != DAV_CALLTYPE_MEMBER) {
+        return NULL;
+    }
+
+    etag = (*wres->resource->hooks->getetag)(wres->resource);
+
+    if (etag) {
+        if (cctx->sha1) {
+            apr_sha1_update(cctx->sha1, etag, strlen(etag));
+        }
+        if (cctx->uris) {
+            APR_ARRAY_PUSH(cctx->uris, const char *) = wres->resource->uri;
+            APR_ARRAY_PUSH(cctx->etags, const char *) = etag;
+        }
+    }
+    else {
+        cctx->sha1 = NULL;
+    }
+
+    return NULL;
+}
+
+/*
+ * Write the components of a single calendar to the streamed response,
+ * leaving out any timezones that have already been sent.
+ */
+static dav_error *dav_calendar_stream_calendar(dav_calendar_ctx *ctx,
+        icalcomponent *comp)
+{
+    request_rec *r = ctx->r;
+    icalcomponent *sub;
+    apr_bucket *e;
+    apr_time_t start = dav_calendar_timing_start(r);
+    apr_status_t status;
+
+    for (sub = icalcomponent_get_first_component(comp, ICAL_ANY_COMPONENT);
+            sub;
+            sub = icalcomponent_get_next_component(comp, ICAL_ANY_COMPONENT)) {
+        char *ical;
+
+        if (icalcomponent_isa(sub) == ICAL_VTIMEZONE_COMPONENT) {
+            icalproperty *prop = icalcomponent_get_first_property(sub,
+                    ICAL_TZID_PROPERTY);
+            const char *tzid = prop ? icalproperty_get_tzid(prop) : NULL;
+
+            if (tzid) {
+                if (apr_hash_get(ctx->tzids, tzid, APR_HASH_KEY_STRING)) {
+                    continue;
+                }
+                tzid = apr_pstrdup(r->pool, tzid);
+                apr_hash_set(ctx->tzids, tzid, APR_HASH_KEY_STRING, tzid);
+            }
+        }
+
+        ical = icalcomponent_as_ical_string_r(sub);
+        if (!ical) {
+            continue;
+        }
+
+        e = apr_bucket_heap_create(ical, strlen(ical), icalmemory_free_buffer,
+                r->connection->bucket_alloc);
+        APR_BRIGADE_INSERT_TAIL(ctx->out, e);
+    }
+
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_SERIALISE, start);
+
+    /* let the core decide when to write */
+    start = dav_calendar_timing_start(r);
+    status = ap_pass_brigade(r->output_filters, ctx->out);
+    apr_brigade_cleanup(ctx->out);
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_SEND, start);
+
+    if (status != APR_SUCCESS) {
+        return dav_new_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0, status,
+                "Could not send calendar to the client.");
+    }
+
+    return NULL;
+}
+
+static dav_error *dav_calendar_get_member(request_rec *r,
+        dav_calendar_ctx *cctx, const char *uri, const char *etag,
+        const dav_resource *resource)
+{
+    dav_error *err;
+
+    cctx->err = NULL;
+
+    /* streaming? each resource is parsed on its own */
+    if (cctx->out) {
+        cctx->comp = NULL;
+    }
+
+    err = dav_calendar_read_uri(r, uri, etag, resource, cctx);
+
+    if (err) {
+        dav_log_err(r, err, APLOG_DEBUG);
+    }
+
+    /* send the resource on its way, give up if the client has gone */
+    else if (cctx->out) {
+        err = dav_calendar_stream_calendar(cctx, cctx->comp);
+        if (err) {
+            apr_pool_cleanup_run(r->pool, cctx->comp, icalcomponent_cleanup);
+            cctx->comp = NULL;
+            return err;
+        }
+    }
+
+    if (cctx->out && cctx->comp) {
+        apr_pool_cleanup_run(r->pool, cctx->comp, icalcomponent_cleanup);
+        cctx->comp = NULL;
+    }
+
+    return NULL;
+}
+
+static dav_error * dav_calendar_get_walker(dav_walk_resource *wres, int calltype)
+{
+    request_rec *r = wres->resource->hooks->get_request_rec(wres->resource);
+
+    dav_calendar_ctx *cctx = wres->walk_ctx;
+    dav_error *err;
+
+    /* avoid loops */
+    if (calltype != DAV_CALLTYPE_MEMBER) {
+        return NULL;
+    }
+
+    err = cctx->err = NULL;
+
+    /*
+     * Note the members as we go, if asked. The state is shared, so every
+     * member is noted, not just those this request goes on to read.
+     */
+    if (cctx->uris) {
+        const char *etag = (*wres->resource->hooks->getetag)(wres->resource);
+
+        if (etag) {
+            APR_ARRAY_PUSH(cctx->uris, const char *) = wres->resource->uri;
+            APR_ARRAY_PUSH(cctx->etags, const char *) = etag;
+        }
+        else {
+            cctx->uris = NULL;
+        }
+    }
+
+    /* check for any method preconditions */
+    if (dav_run_method_precondition(cctx->r, NULL, wres->resource, NULL, &err) != DECLINED
+            && err) {
+        dav_log_err(r, err, APLOG_DEBUG);
+        return NULL;
+    }
+
+    return dav_calendar_get_member(r, cctx, wres->resource->uri,
+            dav_calendar_strong_etag(wres->resource),
+            wres->resource->hooks->handle_get ? wres->resource : NULL);
+}
+
+/*
+ * Read each member of the collection in turn, either from the cached
+ * collection state, or by walking the collection.
+ */
+static dav_error *dav_calendar_get_members(request_rec *r,
+        dav_resource *resource, dav_walk_params *w, dav_calendar_ctx *cctx,
+        const dav_calendar_collection_state *state, int depth)
+{
+    dav_response *multi_status;
+    dav_error *err;
+    int i;
+
+    dav_calendar_prefetch_start(r, resource, state, depth);
+
+    if (!state) {
+        err = dav_calendar_walk(r, resource, w, depth, &multi_status);
+
+        if (!err && cctx->uris && cctx->collection_etag) {
+            dav_calendar_state_put(r, resource->uri, cctx->collection_etag,
+                    apr_table_get(r->headers_out, "ETag"), cctx->uris,
+                    cctx->etags);
+        }
+
+        return err;
+    }
+
+    /*
+     * The collection tag has not changed, so neither have the members: each
+     * is read by the ETag we noted, without a lookup of its own.
+     */
+    for (i = 0; i < state->nelts; i++) {
+        if ((err = dav_calendar_get_member(r, cctx, state->uris[i],
+                dav_calendar_strong_etag_str(state->etags[i]), NULL))) {
+            return err;
+        }
+    }
+
+    return NULL;
+}
+
+/* Use POOL to temporarily construct a dav_response object (from WRES
+   STATUS, and PROPSTATS) and stream it via WRES's ctx->brigade. */
+static void dav_stream_response(dav_walk_resource *wres,
+                                int status,
+                                dav_get_props_result *propstats,
+                                apr_pool_t *pool)
+{
+    dav_response resp = { 0 };
+    dav_walker_ctx *ctx = wres->walk_ctx;
+
+    apr_time_t start = dav_calendar_timing_start(ctx->r);
+
+    resp.href = wres->resource->uri;
+    resp.status = status;
+    if (propstats) {
+        resp.propresult = *propstats;
+    }
+
+    dav_send_one_response(&resp, ctx->bb, ctx->r, pool);
+
+    dav_calendar_timing_add(ctx->r, DAV_CALENDAR_PHASE_SEND, start);
+}
+
+static void dav_calendar_cache_badprops(dav_walker_ctx *ctx)
+{
+    const apr_xml_elem *elem;
+    apr_text_header hdr = { 0 };
+
+    /* just return if we built the thing already */
+    if (ctx->propstat_404 != NULL) {
+        return;
+    }
+
+    apr_text_append(ctx->w.pool, &hdr,
+                    "<D:propstat>" DEBUG_CR
+                    "<D:prop>" DEBUG_CR);
+
+    elem = dav_find_child(ctx->doc->root, "prop");
+    for (elem = elem->first_child; elem; elem = elem->next) {
+        apr_text_append(ctx->w.pool, &hdr,
+                        apr_xml_empty_elem(ctx->w.pool, elem));
+    }
+
+    apr_text_append(ctx->w.pool, &hdr,
+                    "</D:prop>" DEBUG_CR
+                    "<D:status>HTTP/1.1 404 Not Found</D:status>" DEBUG_CR
+                    "</D:propstat>" DEBUG_CR);
+
+    ctx->propstat_404 = hdr.first;
+}
+
+/*
+ * Work out the response to a report for a single resource, using pool for
+ * the properties. Returns zero if no response is to be sent.
+ */
+static int dav_calendar_report_props(dav_walk_resource *wres,
+        dav_walker_ctx *ctx, apr_pool_t *pool, int *status,
+        dav_get_props_result *propstats)
+{
+    dav_error *err = NULL;
+    dav_propdb *propdb;
+    void *skip;
+
+    /* check for any method preconditions */
+    if (dav_run_method_precondition(ctx->r, NULL, wres->resource, ctx->doc, &err) != DECLINED
+            && err) {
+        dav_log_err(ctx->r, err, APLOG_DEBUG);
+        return 0;
+    }
+
+    dav_calendar_metrics_count(ctx->r, DAV_CALENDAR_COUNT_SCANNED, 1);
+
+    /* can the index rule this resource out before we read it? */
+    if (dav_calendar_index_reject(ctx->r,
+            dav_calendar_get_request_rec(ctx->r)->plan, wres->resource->uri,
+            dav_calendar_strong_etag(wres->resource), pool)) {
+        return 0;
+    }
+
+    /*
+    ** Note: ctx->doc can only be NULL for DAV_PROPFIND_IS_ALLPROP. Since
+    ** dav_get_allprops() does not need to do namespace translation,
+    ** we're okay.
+    **
+    ** Note: we cast to lose the "const". The propdb won't try to change
+    ** the resource, however, since we are opening readonly.
+    */
+    err = dav_popen_propdb(pool,
+                           ctx->r, ctx->w.lockdb, wres->resource, 1,
+                           ctx->doc ? ctx->doc->namespaces : NULL, &propdb);
+    if (err != NULL) {
+        /* ### do something with err! */
+
+        if (ctx->propfind_type == DAV_PROPFIND_IS_PROP) {
+
+            /* some props were expected on this collection/resource */
+            dav_calendar_cache_badprops(ctx);
+            propstats->propstats = ctx->propstat_404;
+            *status = 0;
+        }
+        else {
+            /* no props on this collection/resource */
+            *status = HTTP_OK;
+        }
+
+        return 1;
+    }
+    /* ### what to do about closing the propdb on server failure? */
+
+    if (ctx->propfind_type == DAV_PROPFIND_IS_PROP) {
+        *propstats = dav_get_props(propdb, ctx->doc);
+    }
+    else {
+        dav_prop_insert what = ctx->propfind_type == DAV_PROPFIND_IS_ALLPROP
+                                 ? DAV_PROP_INSERT_VALUE
+                                 : DAV_PROP_INSERT_NAME;
+        *propstats = dav_get_allprops(propdb, what);
+    }
+    *status = 0;
+
+    /* only send a response if we're not skipped */
+    apr_pool_userdata_get(&skip, DAV_CALENDAR_SKIP, wres->resource->pool);
+
+    dav_close_propdb(propdb);
+
+    if (skip || dav_calendar_get_request_rec(ctx->r)->err) {
+        return 0;
+    }
+
+    dav_calendar_metrics_count(ctx->r, DAV_CALENDAR_COUNT_MATCHED, 1);
+
+    return 1;
+}
+
+static dav_error * dav_calendar_report_walker(dav_walk_resource *wres, int calltype)
+{
+    dav_walker_ctx *ctx = wres->walk_ctx;
+    dav_get_props_result propstats = { 0 };
+    dav_error *err;
+    int status;
+
+    /* ignore collections */
+    if (wres->resource->collection) {
+        return NULL;
+    }
+
+    if (dav_calendar_report_props(wres, ctx, ctx->scratchpool, &status,
+            &propstats)) {
+        dav_stream_response(wres, status,
+                propstats.propstats ? &propstats : NULL, ctx->scratchpool);
+    }
+
+    /* at this point, ctx->scratchpool has been used to stream a
+       single response.  this function fully controls the pool, and
+       thus has the right to clear it for the next iteration of this
+       callback. */
+    apr_pool_clear(ctx->scratchpool);
+
+    /* stop the walk if a precondition of the report failed */
+    if ((err = dav_calendar_get_request_rec(ctx->r)->err)) {
+        return err;
+    }
+
+    return NULL;
+}
+
+/*
+ * A precondition of the report failed part way through. If nothing has
+ * been sent yet, the report fails with the precondition, otherwise all
+ * we can do is abort the connection.
+ */
+static dav_error *dav_calendar_report_failed(request_rec *r,
+        apr_bucket_brigade *bb, dav_error *err)
+{
+    if (err->tagname && !r->sent_bodyct) {
+        apr_brigade_cleanup(bb);
+        return err;
+    }
+
+    /* If an error occurred during the resource walk, there's
+       basically nothing we can do but abort the connection and
+       log an error.  This is one of the limitations of HTTP; it
+       needs to "know" the entire status of the response before
+       generating it, which is just impossible in these streamy
+       response situations. */
+    err = dav_push_error(r->pool, err->status, 0,
+                         "Provider encountered an error while streaming"
+                         " a multistatus PROPFIND response.", err);
+    dav_log_err(r, err, APLOG_ERR);
+    r->connection->aborted = 1;
+    return NULL;
+}
+
+
+/*
+ * A calendar-query of a collection whose state is not yet cached notes
+ * the members as the walk goes, so that next time the members can be
+ * parsed ahead of the walk.
+ */
+typedef struct dav_calendar_query_ctx {
+    /* must be first, the report walker sees a dav_walker_ctx */
+    dav_walker_ctx ctx;
+    apr_array_header_t *uris;
+    apr_array_header_t *etags;
+} dav_calendar_query_ctx;
+
+static dav_error *dav_calendar_query_walker(dav_walk_resource *wres,
+        int calltype)
+{
+    dav_calendar_query_ctx *qctx = wres->walk_ctx;
+
+    if (qctx->uris && !wres->resource->collection) {
+        const char *etag = (*wres->resource->hooks->getetag)(wres->resource);
+
+        if (etag) {
+            APR_ARRAY_PUSH(qctx->uris, const char *) =
+                    apr_pstrdup(qctx->ctx.r->pool, wres->resource->uri);
+            APR_ARRAY_PUSH(qctx->etags, const char *) =
+                    apr_pstrdup(qctx->ctx.r->pool, etag);
+        }
+        else {
+            qctx->uris = NULL;
+        }
+    }
+
+    return dav_calendar_report_walker(wres, calltype);
+}
+
+static dav_error *dav_calendar_query_report(request_rec *r,
+    const dav_resource *resource,
+    const apr_xml_doc *doc, ap_filter_t *output)
+{
+    dav_error *err;
+    dav_calendar_query_ctx qctx = { { { 0 } } };
+    dav_walker_ctx ctx = { { 0 } };
+    dav_calendar_collection_state *state = NULL;
+    dav_calendar_filter_plan *plan;
+    dav_response *multi_status;
+    const char *ctag = NULL;
+    int depth;
+    int ns = 0;
+
+    /* ### validate that only one of these three elements is present */
+
+    /* default is allprop */
+    ctx.propfind_type = DAV_PROPFIND_IS_ALLPROP;
+    if (dav_find_child(doc->root, "propname") != NULL) {
+        ctx.propfind_type = DAV_PROPFIND_IS_PROPNAME;
+    }
+    else if (dav_find_child(doc->root, "prop") != NULL) {
+        ctx.propfind_type = DAV_PROPFIND_IS_PROP;
+    }
+
+    ns = apr_xml_insert_uri(doc->namespaces, DAV_CALENDAR_XML_NAMESPACE);
+
+    if (dav_find_child_ns(doc->root, ns, "filter") != NULL) {
+        ctx.propfind_type = DAV_PROPFIND_IS_PROP;
+    }
+    else {
+        /* "calendar-query" element must have filter */
+        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                "The \"calendar-query\" element does not contain a "
+                "filter element.");
+    }
+
+    /* validate and compile the filter once, before any resource is read */
+    if ((err = dav_calendar_compile_filter(r->pool, doc, ns, &plan))) {
+        return err;
+    }
+    dav_calendar_get_request_rec(r)->plan = plan;
+
+    if ((depth = dav_get_depth(r, 0)) < 0) {
+        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                "The \"depth\" header was not valid.");
+    }
+
+    ctx.w.walk_type = DAV_WALKTYPE_NORMAL | DAV_WALKTYPE_AUTH;
+    ctx.w.func = dav_calendar_report_walker;
+    ctx.w.walk_ctx = &ctx;
+    ctx.w.pool = r->pool;
+    ctx.w.root = resource;
+
+    ctx.doc = (apr_xml_doc *)doc;
+    ctx.r = r;
+    ctx.bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
+    apr_pool_create(&ctx.scratchpool, r->pool);
+    apr_pool_tag(ctx.scratchpool, "mod_dav-scratch");
+
+    if ((err = dav_calendar_open_lockdb(r, &ctx.w.lockdb)) != NULL) {
+        return dav_push_error(r->pool, err->status, 0,
+                             "The lock database could not be opened, "
+                             "preventing access to the various lock "
+                             "properties for the PROPFIND.",
+                             err);
+    }
+    if (ctx.w.lockdb != NULL) {
+        /* if we have a lock database, then we can walk locknull resources */
+        ctx.w.walk_type |= DAV_WALKTYPE_LOCKNULL;
+    }
+
+    /* send <multistatus> tag, with all doc->namespaces attached.  */
+
+    /* NOTE: we *cannot* leave out the doc's namespaces from the
+       initial <multistatus> tag.  if a 404 was generated for an HREF,
+       then we need to spit out the doc's namespaces for use by the
+       404. Note that <response> elements will override these ns0,
+       ns1, etc, but NOT within the <response> scope for the
+       badprops. */
+    dav_begin_multistatus(ctx.bb, r, HTTP_MULTI_STATUS,
+                          doc ? doc->namespaces : NULL);
+
+    /*
+     * Parse the members ahead of the walk, if we can. The members of the
+     * collection are known from the collection state, if we have it, and
+     * are otherwise noted by the walk for next time.
+     */
+    if (depth == 1 && resource->collection
+            && dav_calendar_prefetch_enabled(r)) {
+        ctag = dav_calendar_ctag_get(r, resource);
+        state = dav_calendar_state_get(r, resource->uri, ctag);
+    }
+    if (state) {
+        dav_calendar_prefetch_start(r, resource, state, depth);
+    }
+    else if (ctag && dav_calendar_cache_global) {
+        qctx.uris = apr_array_make(r->pool, 16, sizeof(const char *));
+        qctx.etags = apr_array_make(r->pool, 16, sizeof(const char *));
+    }
+
+    /* Have the provider walk the resource. */
+    if (qctx.uris) {
+        qctx.ctx = ctx;
+        qctx.ctx.w.func = dav_calendar_query_walker;
+        qctx.ctx.w.walk_ctx = &qctx;
+
+        err = dav_calendar_walk(r, resource, &qctx.ctx.w, depth,
+                &multi_status);
+
+        if (!err && qctx.uris) {
+            dav_calendar_state_put(r, resource->uri, ctag,
+                    apr_pstrcat(r->pool, "\"", ctag, "\"", NULL),
+                    qctx.uris, qctx.etags);
+        }
+    }
+    else {
+        err = dav_calendar_walk(r, resource, &ctx.w, depth, &multi_status);
+    }
+
+    if (ctx.w.lockdb != NULL) {
+        (*ctx.w.lockdb->hooks->close_lockdb)(ctx.w.lockdb);
+    }
+
+    if (err != NULL) {
+        return dav_calendar_report_failed(r, ctx.bb, err);
+    }
+
+    dav_finish_multistatus(r, ctx.bb);
+
+    /* the response has been sent. */
+    return NULL;
+}
+
+/*
+ * Batched calendar-multiget.
+ *
+ * Clients send a multiget with hundreds of hrefs after a sync, nearly
+ * all of them members of the collection the report was sent to. Rather
+ * than run a subrequest per href, the members named are found during a
+ * single walk of the collection, which has already been authorised as
+ * the target of the request. Hrefs anywhere else are looked up one at a
+ * time as before. The members found are answered as the walk reaches
+ * them, each in a scratch pool of its own, and only whether each member
+ * was found is kept until the walk is done. The members not found, and
+ * the hrefs looked up on their own, are then answered in the order
+ * requested.
+ */
+typedef struct dav_calendar_multiget_ctx {
+    /* must be first, the report walker sees a dav_walker_ctx */
+    dav_walker_ctx ctx;
+    /* members wanted, keyed by path, each pointing to a found flag */
+    apr_hash_t *members;
+} dav_calendar_multiget_ctx;
+
+static dav_error *dav_calendar_multiget_walker(dav_walk_resource *wres,
+        int calltype)
+{
+    dav_calendar_multiget_ctx *mctx = wres->walk_ctx;
+    int *found;
+
+    if (wres->resource->collection || !(found = apr_hash_get(mctx->members,
+            wres->resource->uri, APR_HASH_KEY_STRING)) || *found) {
+        return NULL;
+    }
+
+    *found = 1;
+
+    return dav_calendar_report_walker(wres, calltype);
+}
+
+/*
+ * Is the href a member of the collection? Returns the path of the member,
+ * or NULL if the href must be looked up on its own.
+ */
+static const char *dav_calendar_multiget_member(apr_pool_t *p,
+        const dav_resource *collection, const char *href)
+{
+    apr_size_t len = strlen(collection->uri);
+    char *path;
+
+    /* only plain absolute paths, anything else is looked up */
+    if (href[0] != '/' || strchr(href, '?') || strchr(href, '#')) {
+        return NULL;
+    }
+
+    path = apr_pstrdup(p, href);
+    if (ap_unescape_url(path) != OK) {
+        return NULL;
+    }
+
+    if (strncmp(path, collection->uri, len)) {
+        return NULL;
+    }
+    if (len && collection->uri[len - 1] != '/') {
+        if (path[len] != '/') {
+            return NULL;
+        }
+        len++;
+    }
+
+    /* a direct member, with nothing to normalise */
+    if (!path[len] || strchr(path + len, '/') || !strcmp(path + len, ".")
+            || !strcmp(path + len, "..")) {
+        return NULL;
+    }
+
+    return path;
+}
+
+static dav_error *dav_calendar_multiget_report(request_rec *r,
+    const dav_resource *resource,
+    const apr_xml_doc *doc, ap_filter_t *output)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+    dav_error *err = NULL;
+    apr_xml_elem *href_elem;
+    dav_resource *child_resource;
+    dav_calendar_multiget_ctx mctx = { { { 0 } } };
+    dav_walker_ctx ctx = { { 0 } };
+    dav_response *multi_status = NULL;
+    apr_array_header_t *paths = NULL;
+    int i;
+
+    /* ### validate that only one of these three elements is present */
+
+    if (doc == NULL || dav_find_child(doc->root, "allprop") != NULL) {
+        /* note: no request body implies allprop */
+        ctx.propfind_type = DAV_PROPFIND_IS_ALLPROP;
+    }
+    else if (dav_find_child(doc->root, "propname") != NULL) {
+        ctx.propfind_type = DAV_PROPFIND_IS_PROPNAME;
+    }
+    else if (dav_find_child(doc->root, "prop") != NULL) {
+        ctx.propfind_type = DAV_PROPFIND_IS_PROP;
+    }
+    else {
+        /* "calendar-multiget" element must have one of the above three children */
+        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                "The \"calendar-multiget\" element does not contain one of "
+                "the required child elements (the specific command).");
+    }
+
+    href_elem = dav_find_child(doc->root, "href");
+    if (!href_elem) {
+        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                "The \"calendar-multiget\" element does not contain one or "
+                "more href elements.");
+    }
+
+    ctx.w.walk_type = DAV_WALKTYPE_NORMAL | DAV_WALKTYPE_AUTH;
+    ctx.w.func = dav_calendar_report_walker;
+    ctx.w.walk_ctx = &ctx;
+    ctx.w.pool = r->pool;
+    ctx.w.root = NULL;
+
+    ctx.doc = (apr_xml_doc *)doc;
+    ctx.r = r;
+    ctx.bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
+    apr_pool_create(&ctx.scratchpool, r->pool);
+    apr_pool_tag(ctx.scratchpool, "mod_dav-scratch");
+
+    if ((err = dav_calendar_open_lockdb(r, &ctx.w.lockdb)) != NULL) {
+        return dav_push_error(r->pool, err->status, 0,
+                             "The lock database could not be opened, "
+                             "preventing access to the various lock "
+                             "properties for the PROPFIND.",
+                             err);
+    }
+    if (ctx.w.lockdb != NULL) {
+        /* if we have a lock database, then we can walk locknull resources */
+        ctx.w.walk_type |= DAV_WALKTYPE_LOCKNULL;
+    }
+
+    /* send <multistatus> tag, with all doc->namespaces attached.  */
+
+    /* NOTE: we *cannot* leave out the doc's namespaces from the
+       initial <multistatus> tag.  if a 404 was generated for an HREF,
+       then we need to spit out the doc's namespaces for use by the
+       404. Note that <response> elements will override these ns0,
+       ns1, etc, but NOT within the <response> scope for the
+       badprops. */
+    dav_begin_multistatus(ctx.bb, r, HTTP_MULTI_STATUS,
+                          doc ? doc->namespaces : NULL);
+
+    /* find the members of this collection in one walk */
+    if (conf->multiget_batch && resource->collection) {
+        apr_xml_elem *elem;
+
+        mctx.members = apr_hash_make(r->pool);
+        paths = apr_array_make(r->pool, 8, sizeof(const char *));
+
+        for (elem = href_elem; elem; elem = elem->next) {
+            const char *href, *path;
+
+            if (!elem->name || strcmp(elem->name, "href")) {
+                continue;
+            }
+
+            href = dav_xml_get_cdata(elem, r->pool, 1 /* strip_white */);
+            path = dav_calendar_multiget_member(r->pool, resource, href);
+
+            if (path && !apr_hash_get(mctx.members, path,
+                    APR_HASH_KEY_STRING)) {
+                apr_hash_set(mctx.members, path, APR_HASH_KEY_STRING,
+                        apr_pcalloc(r->pool, sizeof(int)));
+            }
+            APR_ARRAY_PUSH(paths, const char *) = path;
+        }
+
+        if (apr_hash_count(mctx.members)) {
+            mctx.ctx = ctx;
+            mctx.ctx.w.func = dav_calendar_multiget_walker;
+            mctx.ctx.w.walk_ctx = &mctx;
+            mctx.ctx.w.root = resource;
+
+            err = dav_calendar_walk(r, resource, &mctx.ctx.w, 1,
+                    &multi_status);
+
+            /* the negative propstats are built once, share them */
+            ctx.propstat_404 = mctx.ctx.propstat_404;
+        }
+    }
+
+    /* walk each href eleement */
+    for (i = 0; !err && href_elem; href_elem = href_elem->next) {
+        dav_lookup_result lookup;
+
+        const char *href, *path;
+
+        if (!href_elem->name || strcmp(href_elem->name, "href")) {
+            continue;
+        }
+
+        href = dav_xml_get_cdata(href_elem, ctx.scratchpool, 1 /* strip_white */);
+        path = paths ? APR_ARRAY_IDX(paths, i++, const char *) : NULL;
+
+        /* answered by the walk, or not there at all */
+        if (path) {
+            int *found = apr_hash_get(mctx.members, path, APR_HASH_KEY_STRING);
+
+            if (!*found) {
+                dav_response new_response = { 0 };
+
+                new_response.href = href;
+                new_response.status = HTTP_NOT_FOUND;
+
+                dav_send_one_response(&new_response, ctx.bb, r,
+                        ctx.scratchpool);
+
+                /* a repeated href is answered once */
+                *found = 1;
+            }
+            apr_pool_clear(ctx.scratchpool);
+
+            continue;
+        }
+
+        ctx.w.root = NULL;
+
+        /* get a subrequest for the source, so that we can get a dav_resource
+           for that source. */
+        lookup = dav_lookup_uri(href, r, 0 /* must_be_absolute */);
+        if (lookup.rnew == NULL) {
+            err = &lookup.err;
+        }
+        else if (lookup.rnew->status != HTTP_OK) {
+            err = dav_push_error(r->pool, lookup.rnew->status, 0,
+                    "Could not access the resource.",
+                    NULL);
+        }
+
+        /* get the resource from each subrequest */
+        else if ((err = dav_get_resource(lookup.rnew, 0 /* label_allowed */,
+                0 /* use_checked_in */, &child_resource)) == NULL) {
+            /* success */
+            ctx.w.root = child_resource;
+        }
+
+        /* send a response for any errors */
+        if (err != NULL) {
+            dav_response *new_response;
+
+            new_response = apr_pcalloc(ctx.scratchpool, sizeof(*new_response));
+
+            new_response->href = href;
+            new_response->status = err->status;
+            if (err->desc != NULL) {
+                new_response->desc = apr_pstrcat(r->pool,
+                                                new_response->desc,
+                                                " The error was: ",
+                                                err->desc, NULL);
+            }
+
+            dav_send_one_response(new_response, ctx.bb, r, ctx.scratchpool);
+            err = NULL;
+        }
+
+        /* Have the provider walk each resource. */
+        else {
+            err = dav_calendar_walk(r, resource, &ctx.w, 0, &multi_status);
+        }
+
+        if (lookup.rnew) {
+            ap_destroy_sub_req(lookup.rnew);
+        }
+
+    }
+
+    if (ctx.w.lockdb != NULL) {
+        (*ctx.w.lockdb->hooks->close_lockdb)(ctx.w.lockdb);
+    }
+
+    if (err != NULL) {
+        return dav_calendar_report_failed(r, ctx.bb, err);
+    }
+
+    dav_finish_multistatus(r, ctx.bb);
+
+    /* the response has been sent. */
+    return NULL;
+}
+
+/*
+ * An initial sync with a limit cannot know whether the members are
+ * within the limit until the walk is done. The responses are held until
+ * then, at most limit of them, and the walk stops as soon as the limit
+ * is exceeded.
+ */
+typedef struct dav_calendar_sync_ctx {
+    /* must be first, the report walker sees a dav_walker_ctx */
+    dav_walker_ctx ctx;
+    apr_int64_t limit;
+    apr_int64_t count;
+    apr_array_header_t *responses;
+} dav_calendar_sync_ctx;
+
+static dav_error *dav_calendar_sync_limit_walker(dav_walk_resource *wres,
+        int calltype)
+{
+    dav_calendar_sync_ctx *sctx = wres->walk_ctx;
+    request_rec *r = sctx->ctx.r;
+    dav_response response = { 0 };
+    dav_error *err;
+
+    if (calltype != DAV_CALLTYPE_MEMBER || wres->resource->collection) {
+        return NULL;
+    }
+
+    /* we cannot truncate the results, we can only refuse */
+    if (++sctx->count > sctx->limit) {
+        err = dav_new_error(r->pool, HTTP_INSUFFICIENT_STORAGE, 0, 0,
+                "The members of the collection exceed the requested "
+                "limit.");
+        err->tagname = "number-of-matches-within-limits";
+        return err;
+    }
+
+    if (dav_calendar_report_props(wres, &sctx->ctx, r->pool,
+            &response.status, &response.propresult)) {
+        response.href = apr_pstrdup(r->pool, wres->resource->uri);
+        APR_ARRAY_PUSH(sctx->responses, dav_response) = response;
+    }
+
+    return NULL;
+}
+
+static dav_error *dav_calendar_sync_collection_report(request_rec *r,
+    const dav_resource *resource,
+    const apr_xml_doc *doc, ap_filter_t *output)
+{
+    dav_error *err;
+    apr_xml_elem *elem;
+    dav_resource *child_resource;
+    dav_walker_ctx ctx = { { 0 } };
+    dav_calendar_sync_ctx sctx = { { { 0 } } };
+    dav_response *multi_status = NULL;
+    apr_array_header_t *hrefs, *ops;
+    const char *token = NULL, *new_token = NULL;
+    apr_int64_t limit = -1;
+    int i, count;
+
+    if (!resource->collection) {
+        return dav_new_error(resource->pool, HTTP_FORBIDDEN, 0, 0,
+                "The \"sync-collection\" report is only available on "
+                "collections.");
+    }
+
+    if (dav_find_child(doc->root, "prop") != NULL) {
+        ctx.propfind_type = DAV_PROPFIND_IS_PROP;
+    }
+    else {
+        /* "sync-collection" element must have a prop element */
+        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                "The \"sync-collection\" element does not contain a "
+                "prop element.");
+    }
+
+    if ((elem = dav_find_child(doc->root, "sync-token"))) {
+        token = dav_xml_get_cdata(elem, r->pool, 1 /* strip_white */);
+    }
+
+    /* calendar collections hold no collections, so infinite is one */
+    if ((elem = dav_find_child(doc->root, "sync-level"))) {
+        const char *level = dav_xml_get_cdata(elem, r->pool, 1 /* strip_white */);
+
+        if (strcmp(level, "1") && strcmp(level, "infinite")) {
+            return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                    "The \"sync-level\" element must be 1 or infinite.");
+        }
+    }
+
+    if ((elem = dav_find_child(doc->root, "limit"))
+            && (elem = dav_find_child(elem, "nresults"))) {
+        limit = apr_atoi64(dav_xml_get_cdata(elem, r->pool, 1 /* strip_white */));
+    }
+
+    /* what has changed? */
+    if ((err = dav_calendar_journal_changes(r, resource->uri, token, &hrefs,
+            &ops, &new_token))) {
+        return err;
+    }
+
+    /* we cannot truncate the results, we can only refuse */
+    if (limit >= 0 && token && *token) {
+        count = 0;
+
+        for (i = 0; i < hrefs->nelts; i++) {
+            if (APR_ARRAY_IDX(hrefs, i, const char *)) {
+                count++;
+            }
+        }
+
+        if (count > limit) {
+            err = dav_new_error(resource->pool, HTTP_INSUFFICIENT_STORAGE, 0, 0,
+                    "The changes to the collection exceed the requested "
+                    "limit.");
+            err->tagname = "number-of-matches-within-limits";
+            return err;
+        }
+    }
+
+    ctx.w.walk_type = DAV_WALKTYPE_NORMAL | DAV_WALKTYPE_AUTH;
+    ctx.w.func = dav_calendar_report_walker;
+    ctx.w.walk_ctx = &ctx;
+    ctx.w.pool = r->pool;
+    ctx.w.root = resource;
+
+    ctx.doc = (apr_xml_doc *)doc;
+    ctx.r = r;
+    ctx.bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
+    apr_pool_create(&ctx.scratchpool, r->pool);
+    apr_pool_tag(ctx.scratchpool, "mod_dav-scratch");
+
+    if ((err = dav_calendar_open_lockdb(r, &ctx.w.lockdb)) != NULL) {
+        return dav_push_error(r->pool, err->status, 0,
+                             "The lock database could not be opened, "
+                             "preventing access to the various lock "
+                             "properties for the PROPFIND.",
+                             err);
+    }
+    if (ctx.w.lockdb != NULL) {
+        /* if we have a lock database, then we can walk locknull resources */
+        ctx.w.walk_type |= DAV_WALKTYPE_LOCKNULL;
+    }
+
+    /* initial sync with a limit, walk the members before sending any */
+    if (limit >= 0 && (!token || !*token)) {
+        sctx.ctx = ctx;
+        sctx.ctx.w.func = dav_calendar_sync_limit_walker;
+        sctx.ctx.w.walk_ctx = &sctx;
+        sctx.limit = limit;
+        sctx.responses = apr_array_make(r->pool, 8, sizeof(dav_response));
+
+        if ((err = dav_calendar_walk(r, resource, &sctx.ctx.w, 1,
+                &multi_status))) {
+            if (ctx.w.lockdb != NULL) {
+                (*ctx.w.lockdb->hooks->close_lockdb)(ctx.w.lockdb);
+            }
+            return err;
+        }
+    }
+
+    /* send <multistatus> tag, with all doc->namespaces attached.  */
+    dav_begin_multistatus(ctx.bb, r, HTTP_MULTI_STATUS,
+                          doc ? doc->namespaces : NULL);
+
+    /* initial sync with a limit, send what the walk found */
+    if (sctx.responses) {
+        for (i = 0; i < sctx.responses->nelts; i++) {
+            dav_send_one_response(&APR_ARRAY_IDX(sctx.responses, i,
+                    dav_response), ctx.bb, r, ctx.scratchpool);
+            apr_pool_clear(ctx.scratchpool);
+        }
+        err = NULL;
+    }
+
+    /* initial sync, walk all the members */
+    else if (!token || !*token) {
+        err = dav_calendar_walk(r, resource, &ctx.w, 1, &multi_status);
+    }
+
+    /* incremental sync, walk just the changes */
+    else for (i = 0; i < hrefs->nelts; i++) {
+        const char *href = APR_ARRAY_IDX(hrefs, i, const char *);
+        dav_lookup_result lookup = { { 0 } };
+
+        if (!href) {
+            continue;
+        }
+
+        err = NULL;
+        child_resource = NULL;
+
+        if (APR_ARRAY_IDX(ops, i, char) != DAV_CALENDAR_JOURNAL_DELETE) {
+
+            /* get a subrequest for the member, so that we can get a
+               dav_resource for that member. */
+            lookup = dav_lookup_uri(ap_escape_uri(ctx.scratchpool, href), r,
+                    0 /* must_be_absolute */);
+            if (lookup.rnew == NULL) {
+                err = &lookup.err;
+            }
+            else if (lookup.rnew->status != HTTP_OK) {
+                err = dav_push_error(r->pool, lookup.rnew->status, 0,
+                        "Could not access the resource.",
+                        NULL);
+            }
+            else {
+                err = dav_get_resource(lookup.rnew, 0 /* label_allowed */,
+                        0 /* use_checked_in */, &child_resource);
+            }
+        }
+
+        /* gone, or an error, reported against the member */
+        if (!child_resource || !child_resource->exists || err) {
+            dav_response new_response = { 0 };
+
+            new_response.href = href;
+            new_response.status = err ? err->status : HTTP_NOT_FOUND;
+
+            dav_send_one_response(&new_response, ctx.bb, r, ctx.scratchpool);
+            apr_pool_clear(ctx.scratchpool);
+
+            err = NULL;
+        }
+
+        /* Have the provider walk each resource. */
+        else {
+            ctx.w.root = child_resource;
+            err = dav_calendar_walk(r, resource, &ctx.w, 0, &multi_status);
+        }
+
+        if (lookup.rnew) {
+            ap_destroy_sub_req(lookup.rnew);
+        }
+
+        if (err) {
+            break;
+        }
+
+    }
+
+    if (ctx.w.lockdb != NULL) {
+        (*ctx.w.lockdb->hooks->close_lockdb)(ctx.w.lockdb);
+    }
+
+    if (err != NULL) {
+        /* If an error occurred during the resource walk, there's
+           basically nothing we can do but abort the connection and
+           log an error.  This is one of the limitations of HTTP; it
+           needs to "know" the entire status of the response before
+           generating it, which is just impossible in these streamy
+           response situations. */
+        err = dav_push_error(r->pool, err->status, 0,
+                             "Provider encountered an error while streaming"
+                             " a multistatus sync-collection response.", err);
+        dav_log_err(r, err, APLOG_ERR);
+        r->connection->aborted = 1;
+        return NULL;
+    }
+
+    ap_fprintf(r->output_filters, ctx.bb, "<D:sync-token>%s</D:sync-token>"
+            DEBUG_CR, apr_xml_quote_string(r->pool, new_token, 0));
+
+    dav_finish_multistatus(r, ctx.bb);
+
+    /* the response has been sent. */
+    return NULL;
+}
+
+/*
+ * The free-busy-query report.
+ *
+ * The busy time of each resource is gathered as periods tagged with
+ * their FBTYPE, and the periods from every resource merged once the
+ * walk is complete. The busy time of a resource over the calendar years
+ * covering the time range is kept in the cache against the URI and ETag
+ * of the resource, so that the next free-busy-query covering those
+ * years needs neither read nor parse the resource.
+ */
+
+typedef struct dav_calendar_freebusy_ctx {
+    request_rec *r;
+    icaltimetype *stt;
+    icaltimetype *ett;
+    /* busy time across all resources, clipped to the time range */
+    apr_array_header_t *busy;
+    apr_pool_t *scratchpool;
+} dav_calendar_freebusy_ctx;
+
+typedef struct dav_calendar_busy_set {
+    int nelts;
+    dav_calendar_busy busy[1];
+} dav_calendar_busy_set;
+
+static void dav_calendar_busy_set_free(void *value)
+{
+    free(value);
+}
+
+static void dav_calendar_freebusy_add(dav_calendar_freebusy_ctx *fctx,
+        const dav_calendar_busy *busy, int nelts)
+{
+    time_t start = icaltime_as_timet_with_zone(*fctx->stt,
+            icaltimezone_get_utc_timezone());
+    time_t end = icaltime_as_timet_with_zone(*fctx->ett,
+            icaltimezone_get_utc_timezone());
+    int i;
+
+    for (i = 0; i < nelts; i++) {
+        if (busy[i].end > start && busy[i].start < end) {
+            dav_calendar_busy *b = apr_array_push(fctx->busy);
+
+            b->start = busy[i].start < start ? start : busy[i].start;
+            b->end = busy[i].end > end ? end : busy[i].end;
+            b->fbtype = busy[i].fbtype;
+        }
+    }
+}
+
+/*
+ * Read the busy time of the resource. Resources that cannot be read are
+ * left out with *pset set to NULL, running out of memory is an error.
+ */
+static dav_error *dav_calendar_freebusy_read(
+        dav_calendar_freebusy_ctx *fctx, const dav_resource *resource,
+        icaltimetype start, icaltimetype end, dav_calendar_busy_set **pset)
+{
+    dav_calendar_ctx cctx = { 0 };
+    dav_calendar_busy_set *set;
+    dav_error *err;
+    int nelts, max = 64;
+
+    *pset = NULL;
+
+    cctx.r = fctx->r;
+
+    if ((err = dav_calendar_read_resource(fctx->r, resource, &cctx))) {
+        dav_log_err(fctx->r, err, APLOG_DEBUG);
+        return NULL;
+    }
+
+    if (!cctx.comp) {
+        return NULL;
+    }
+
+    for (;;) {
+        set = malloc(sizeof(dav_calendar_busy_set)
+                + sizeof(dav_calendar_busy) * max);
+        if (!set) {
+            break;
+        }
+
+        nelts = dav_calendar_busy_collect(cctx.comp, start, end, set->busy,
+                max);
+        if (nelts < 0) {
+            free(set);
+            set = NULL;
+            break;
+        }
+        if (nelts <= max) {
+            set->nelts = dav_calendar_busy_merge(set->busy, nelts);
+            break;
+        }
+
+        /* too small, try again with room for everything */
+        free(set);
+        max = nelts;
+    }
+
+    apr_pool_cleanup_run(fctx->r->pool, cctx.comp, icalcomponent_cleanup);
+
+    if (!set) {
+        return dav_new_error(fctx->r->pool, HTTP_INTERNAL_SERVER_ERROR, 0,
+                APR_ENOMEM, "Out of memory gathering the busy time.");
+    }
+
+    *pset = set;
+
+    return NULL;
+}
+
+static dav_error *dav_calendar_freebusy_walker(dav_walk_resource *wres,
+        int calltype)
+{
+    dav_calendar_freebusy_ctx *fctx = wres->walk_ctx;
+    dav_calendar_cache *cache = dav_calendar_cache_global;
+    dav_calendar_cache_entry *entry;
+    dav_calendar_index_rec *rec;
+    dav_calendar_busy_set *set;
+    icaltimetype start = *fctx->stt, end = *fctx->ett;
+    const char *etag, *key = NULL;
+    dav_error *err = NULL;
+
+    /* ignore collections */
+    if (wres->resource->collection) {
+        return NULL;
+    }
+
+    /* check for any method preconditions */
+    if (dav_run_method_precondition(fctx->r, NULL, wres->resource, NULL, &err)
+            != DECLINED && err) {
+        dav_log_err(fctx->r, err, APLOG_DEBUG);
+        return NULL;
+    }
+
+    etag = dav_calendar_strong_etag(wres->resource);
+
+    /* can the index rule this resource out before we read it? */
+    rec = dav_calendar_index_fetch(fctx->r, fctx->scratchpool,
+            wres->resource->uri, etag);
+    if (rec && !ap_strstr_c(rec->kinds, ",VFREEBUSY,")
+            && (!ap_strstr_c(rec->kinds, ",VEVENT,") || (rec->span_valid
+                    && !dav_calendar_index_overlaps(rec, fctx->stt,
+                            fctx->ett)))) {
+        apr_pool_clear(fctx->scratchpool);
+        return NULL;
+    }
+    apr_pool_clear(fctx->scratchpool);
+
+    /* cache the busy time over whole calendar years */
+    if (cache && etag
+            && fctx->ett->year - fctx->stt->year < DAV_CALENDAR_SPANS_YEARS) {
+
+        key = dav_calendar_cache_key(fctx->r, DAV_CALENDAR_CACHE_BUSY,
+                apr_psprintf(fctx->r->pool, "%s %d", wres->resource->uri,
+                        fctx->stt->year));
+
+        dav_calendar_cache_lock(cache);
+        entry = dav_calendar_cache_lookup(fctx->r, cache,
+                DAV_CALENDAR_CACHE_BUSY, key, etag);
+        set = entry ? entry->value : NULL;
+        if (set) {
+            dav_calendar_freebusy_add(fctx, set->busy, set->nelts);
+        }
+        dav_calendar_cache_unlock(cache);
+
+        if (set) {
+            return NULL;
+        }
+
+        start = icaltime_from_string(apr_psprintf(fctx->r->pool,
+                "%04d0101T000000Z", fctx->stt->year));
+        end = icaltime_from_string(apr_psprintf(fctx->r->pool,
+                "%04d0101T000000Z",
+                fctx->stt->year + DAV_CALENDAR_SPANS_YEARS));
+    }
+
+    if ((err = dav_calendar_freebusy_read(fctx, wres->resource, start, end,
+            &set))) {
+        return err;
+    }
+    if (!set) {
+        return NULL;
+    }
+
+    dav_calendar_freebusy_add(fctx, set->busy, set->nelts);
+
+    if (key) {
+        dav_calendar_cache_insert(fctx->r, cache, DAV_CALENDAR_CACHE_BUSY, key,
+                etag, set,
+                dav_calendar_busy_set_free, sizeof(dav_calendar_busy_set)
+                        + sizeof(dav_calendar_busy) * set->nelts);
+    }
+    else {
+        free(set);
+    }
+
+    return NULL;
+}
+
+static dav_error *dav_calendar_free_busy_query_report(request_rec *r,
+    const dav_resource *resource,
+    const apr_xml_doc *doc, ap_filter_t *output)
+{
+    dav_error *err;
+    dav_walk_params w = { 0 };
+    dav_calendar_freebusy_ctx fctx = { 0 };
+    dav_response *multi_status;
+    apr_bucket_brigade *bb;
+    apr_bucket *e;
+    icalcomponent *calendar, *freebusy;
+    icaltimezone *utc_zone;
+    const apr_xml_elem *time_range;
+    char *ical;
+    apr_size_t ical_len;
+    int depth, i, nelts;
+    int ns = 0;
+    int status;
+
+    ns = apr_xml_insert_uri(doc->namespaces, DAV_CALENDAR_XML_NAMESPACE);
+
+    if (!(time_range = dav_find_child_ns(doc->root, ns, "time-range"))) {
+        /* "free-busy-query" element must have time-range */
+        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                "The \"free-busy-query\" element does not contain a "
+                "time-range element.");
+    }
+
+    if ((err = dav_calendar_time_range(r->pool, time_range, &fctx.stt,
+            &fctx.ett))) {
+        return err;
+    }
+
+    if ((depth = dav_get_depth(r, 0)) < 0) {
+        return dav_new_error(resource->pool, HTTP_BAD_REQUEST, 0, 0,
+                "The \"depth\" header was not valid.");
+    }
+
+    fctx.r = r;
+    fctx.busy = apr_array_make(r->pool, 64, sizeof(dav_calendar_busy));
+    apr_pool_create(&fctx.scratchpool, r->pool);
+    apr_pool_tag(fctx.scratchpool, "mod_dav_calendar-scratch");
+
+    w.walk_type = DAV_WALKTYPE_NORMAL | DAV_WALKTYPE_AUTH;
+    w.func = dav_calendar_freebusy_walker;
+    w.walk_ctx = &fctx;
+    w.pool = r->pool;
+    w.root = resource;
+
+    if ((err = dav_calendar_open_lockdb(r, &w.lockdb)) != NULL) {
+        return dav_push_error(r->pool, err->status, 0,
+                             "The lock database could not be opened, "
+                             "preventing access to the various lock "
+                             "properties for the PROPFIND.",
+                             err);
+    }
+    if (w.lockdb != NULL) {
+        /* if we have a lock database, then we can walk locknull resources */
+        w.walk_type |= DAV_WALKTYPE_LOCKNULL;
+    }
+
+    /* Have the provider walk the resource. */
+    err = dav_calendar_walk(r, resource, &w, depth, &multi_status);
+
+    if (w.lockdb != NULL) {
+        (*w.lockdb->hooks->close_lockdb)(w.lockdb);
+    }
+
+    if (err != NULL) {
+        return err;
+    }
+
+    /* one pass over everything, in FBTYPE and start order */
+    nelts = dav_calendar_busy_merge((dav_calendar_busy *)fctx.busy->elts,
+            fctx.busy->nelts);
+
+    utc_zone = icaltimezone_get_utc_timezone();
+
+    calendar = icalcomponent_new(ICAL_VCALENDAR_COMPONENT);
+    icalcomponent_add_property(calendar, icalproperty_new_version("2.0"));
+    icalcomponent_add_property(calendar,
+            icalproperty_new_prodid("-//Graham Leggett//" PACKAGE_STRING "//EN"));
+
+    freebusy = icalcomponent_new(ICAL_VFREEBUSY_COMPONENT);
+    icalcomponent_add_property(freebusy, icalproperty_new_dtstamp(
+            icaltime_from_timet_with_zone(apr_time_sec(r->request_time), 0,
+                    utc_zone)));
+    icalcomponent_add_property(freebusy, icalproperty_new_dtstart(*fctx.stt));
+    icalcomponent_add_property(freebusy, icalproperty_new_dtend(*fctx.ett));
+
+    for (i = 0; i < nelts; i++) {
+        const dav_calendar_busy *busy =
+                &APR_ARRAY_IDX(fctx.busy, i, dav_calendar_busy);
+        struct icalperiodtype period;
+        icalproperty *prop;
+
+        period.start = icaltime_from_timet_with_zone(busy->start, 0, utc_zone);
+        period.end = icaltime_from_timet_with_zone(busy->end, 0, utc_zone);
+        period.duration = icaldurationtype_null_duration();
+
+        prop = icalproperty_new_freebusy(period);
+        icalproperty_add_parameter(prop, icalparameter_new_fbtype(busy->fbtype));
+
+        icalcomponent_add_property(freebusy, prop);
+    }
+
+    icalcomponent_add_component(calendar, freebusy);
+
+    ical = icalcomponent_as_ical_string_r(calendar);
+    icalcomponent_free(calendar);
+
+    ical_len = strlen(ical);
+
+    bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
+
+    ap_set_content_length(r, ical_len);
+    ap_set_content_type(r, "text/calendar");
+
+    e = apr_bucket_heap_create(ical, ical_len, icalmemory_free_buffer,
+            r->connection->bucket_alloc);
+    APR_BRIGADE_INSERT_TAIL(bb, e);
+
+    e = apr_bucket_eos_create(r->connection->bucket_alloc);
+    APR_BRIGADE_INSERT_TAIL(bb, e);
+
+    status = ap_pass_brigade(r->output_filters, bb);
+
+    if (status == APR_SUCCESS
+        || r->status != HTTP_OK
+        || r->connection->aborted) {
+        /* all ok */
+    }
+    else {
+        /* no way to know what type of error occurred */
+        ap_log_rerror(APLOG_MARK, APLOG_DEBUG, status, r,
+                      "dav_calendar_handler: ap_pass_brigade returned %i",
+                      status);
+    }
+
+    /* the response has been sent. */
+    return NULL;
+}
+
+static int dav_calendar_find_ns(const apr_array_header_t *namespaces, const char *uri)
+{
+    int i;
+
+    for (i = 0; i < namespaces->nelts; ++i) {
+        if (strcmp(APR_XML_GET_URI_ITEM(namespaces, i), uri) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int dav_calendar_deliver_report(request_rec *r,
+        const dav_resource *resource,
+        const apr_xml_doc *doc,
+        ap_filter_t *output, dav_error **err)
+{
+    int ns = dav_calendar_find_ns(doc->namespaces, DAV_CALENDAR_XML_NAMESPACE);
+    apr_time_t start = apr_time_now();
+
+    if (doc->root->ns == ns) {
+
+        if (strcmp(doc->root->name, "calendar-query") == 0) {
+            *err = dav_calendar_query_report(r, resource, doc, output);
+            dav_calendar_metrics_time(DAV_CALENDAR_OP_QUERY, start);
+        }
+        else if (strcmp(doc->root->name, "calendar-multiget") == 0) {
+            *err = dav_calendar_multiget_report(r, resource, doc, output);
+            dav_calendar_metrics_time(DAV_CALENDAR_OP_MULTIGET, start);
+        }
+        else if (strcmp(doc->root->name, "free-busy-query") == 0) {
+            *err = dav_calendar_free_busy_query_report(r, resource, doc, output);
+            dav_calendar_metrics_time(DAV_CALENDAR_OP_FREEBUSY, start);
+        }
+        else {
+            /* NOTE: if you add a report, don't forget to add it to the
+             *       dav_svn__reports_list[] array.
+             */
+            *err = dav_new_error(resource->pool, HTTP_NOT_IMPLEMENTED, 0, 0,
+                                 "The requested report is unknown");
+            return HTTP_NOT_IMPLEMENTED;
+        }
+        dav_calendar_timing_finish(r);
+        if (*err) {
+            return (*err)->status;
+        }
+        return DONE;
+    }
+
+    if (doc->root->ns == dav_calendar_find_ns(doc->namespaces, DAV_XML_NAMESPACE)
+            && strcmp(doc->root->name, "sync-collection") == 0) {
+        dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+                &dav_calendar_module);
+
+        if (!conf->journal_db) {
+            return DECLINED;
+        }
+
+        *err = dav_calendar_sync_collection_report(r, resource, doc, output);
+        dav_calendar_metrics_time(DAV_CALENDAR_OP_SYNC, start);
+        dav_calendar_timing_finish(r);
+        if (*err) {
+            return (*err)->status;
+        }
+        return DONE;
+    }
+
+    return DECLINED;
+}
+
+void dav_calendar_gather_reports(request_rec *r, const dav_resource *resource,
+    apr_array_header_t *reports, dav_error **err)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+    dav_report_elem *report;
+
+    report = apr_array_push(reports);
+    report->nmspace = DAV_CALENDAR_XML_NAMESPACE;
+    report->name = "calendar-query";
+
+    report = apr_array_push(reports);
+    report->nmspace = DAV_CALENDAR_XML_NAMESPACE;
+    report->name = "calendar-multiget";
+
+    if (conf->journal_db) {
+        report = apr_array_push(reports);
+        report->nmspace = DAV_XML_NAMESPACE;
+        report->name = "sync-collection";
+    }
+
+    report = apr_array_push(reports);
+    report->nmspace = DAV_CALENDAR_XML_NAMESPACE;
+    report->name = "free-busy-query";
+}
+
+static dav_error *dav_calendar_check_calender(request_rec *r, dav_resource *resource,
+        const dav_provider *provider, apr_array_header_t *mkcols)
+{
+    dav_error *err;
+    dav_resource *parent;
+
+    /* a calendar resource must not already exist */
+    if (resource->exists) {
+        return dav_new_error(r->pool, HTTP_CONFLICT, 0, 0,
+                             apr_psprintf(r->pool,
+                             "Calendar collection already exists: %s",
+                             ap_escape_html(r->pool, resource->uri)));
+    }
+
+    /* walk backwards through the parents, until NULL. Parents must
+     * either exist and be collections, or not exist. If the parent is a
+     * non-collection, or is a calendar collection, we fail.
+     *
+     * Keep track of non existing parents - they will be created.
+     */
+
+    if ((err = resource->hooks->get_parent_resource(resource, &parent)) != NULL) {
+        return err;
+    }
+
+    while ((parent)) {
+
+        if (!parent->collection) {
+            return dav_new_error(r->pool, HTTP_CONFLICT, 0, 0,
+                               apr_psprintf(r->pool,
+                                            "The parent resource of %s "
+                                            "is not a collection.",
+                                            ap_escape_html(r->pool, r->uri)));
+        }
+
+        if (mkcols && !parent->exists) {
+            dav_resource **mkcol = apr_array_push(mkcols);
+            *mkcol = parent;
+        }
+
+        if (parent->exists) {
+            int calendar;
+
+            if ((err = dav_calendar_is_calendar(r, parent, &calendar)) != NULL) {
+                return dav_push_error(r->pool, err->status, 0,
+                                      "The property database could not be read, "
+                                      "preventing the checking of a parent "
+                                      "calendar collection.",
+                                      err);
+            }
+
+            if (calendar) {
+                return dav_new_error(r->pool, HTTP_CONFLICT, 0, 0,
+                        apr_psprintf(r->pool,
+                                "A calendar collection cannot be created "
+                                "under another calendar collection: %s",
+                                ap_escape_html(r->pool, r->uri)));
+            }
+
+        }
+
+        if ((err = parent->hooks->get_parent_resource(parent, &parent)) != NULL) {
+            return err;
+        }
+    }
+
+    return NULL;
+}
+
+static dav_error *dav_calendar_make_calendar(request_rec *r, dav_resource *resource, const char *name)
+{
+    dav_error *err;
+    const dav_provider *provider;
+    dav_lockdb *lockdb;
+    dav_propdb *propdb;
+
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+
+    /* find the dav provider */
+    provider = dav_get_provider(r);
+    if (provider == NULL) {
+        return dav_new_error(r->pool, HTTP_METHOD_NOT_ALLOWED, 0, 0,
+                             apr_psprintf(r->pool,
+                             "DAV not enabled for %s",
+                             ap_escape_html(r->pool, r->uri)));
+    }
+
+    /* resource->collection = 1; */
+    if ((err = resource->hooks->create_collection(resource))) {
+        return dav_push_error(r->pool, err->status, 0,
+                apr_psprintf(r->pool,
+                        "Could not create calendar collection: %s",
+                        ap_escape_html(r->pool, resource->uri)),
+                        err);
+    }
+
+    /* sync tokens of any calendar that was here before are void */
+    dav_calendar_journal_reset(r, resource->uri, 0);
+
+    /* set the resource type to calendar */
+
+    /* open lock database, to report on supported lock properties */
+    /* ### should open read-only */
+    if ((err = dav_open_lockdb(r, 0, &lockdb)) != NULL) {
+        return dav_push_error(r->pool, err->status, 0,
+                              "The lock database could not be opened, "
+                              "preventing the creation of a "
+                              "calendar collection.",
+                              err);
+    }
+
+    /* open the property database (readonly) for the resource */
+    if ((err = dav_open_propdb(r, lockdb, resource, 1, NULL,
+                               &propdb)) != NULL) {
+        if (lockdb != NULL) {
+            dav_close_lockdb(lockdb);
+        }
+
+        return dav_push_error(r->pool, err->status, 0,
+                              "The property database could not be opened, "
+                              "preventing the creation of a "
+                              "calendar collection.",
+                              err);
+    }
+
+    if (propdb) {
+        dav_db *db = NULL;
+
+        if ((err = provider->propdb->open(resource->pool, resource, 0, &db)) != NULL) {
+            err = dav_push_error(r->pool, err->status, 0,
+                                  "Property database could not be opened, "
+                                  "preventing the creation of a "
+                                  "calendar collection.",
+                                  err);
+        }
+        else {
+
+            apr_array_header_t *ns;
+            apr_xml_elem elem[3] = { { 0 } };
+            apr_text text[3] = { { 0 } };
+            dav_prop_name restype[3] = { { DAV_XML_NAMESPACE, "resourcetype" },
+                    { DAV_CALENDAR_XML_NAMESPACE, "calendar-timezone" },
+                    { DAV_XML_NAMESPACE, "displayname" } };
+            dav_namespace_map *map = NULL;
+
+            ns = apr_array_make(resource->pool, 3, sizeof(const char *));
+
+            *(const char **)apr_array_push(ns) = DAV_XML_NAMESPACE;
+            *(const char **)apr_array_push(ns) = DAV_CALENDAR_XML_NAMESPACE;
+
+            elem[0].name = restype[0].name;
+            elem[0].ns = 1;
+            elem[0].first_cdata.first = &text[0];
+            text[0].text = "calendar";
+
+            elem[1].name = restype[1].name;
+            elem[1].ns = 1;
+            elem[1].first_cdata.first = &text[1];
+            text[1].text = conf->dav_calendar_timezone;
+
+            if ((err = provider->propdb->map_namespaces(db, ns, &map)) != NULL) {
+                err = dav_push_error(r->pool, err->status, 0,
+                                      "Namespace could not be mapped, "
+                                      "preventing the creation of a "
+                                      "calendar collection.",
+                                      err);
+            }
+            else if ((err =  provider->propdb->store(db, &restype[0], &elem[0], map)) != NULL) {
+                err = dav_push_error(r->pool, err->status, 0,
+                                      "Property 'calendar' could not be stored, "
+                                      "preventing the creation of a "
+                                      "calendar collection.",
+                                      err);
+            }
+            else if ((err =  provider->propdb->store(db, &restype[1], &elem[1], map)) != NULL) {
+                err = dav_push_error(r->pool, err->status, 0,
+                                      "Property 'calendar-timezone' could not be stored, "
+                                      "preventing the creation of a "
+                                      "calendar collection.",
+                                      err);
+            }
+
+            if (name) {
+
+                elem[2].name = restype[2].name;
+                elem[2].ns = 0;
+                elem[2].first_cdata.first = &text[2];
+                text[2].text = name;
+
+                if ((err =  provider->propdb->store(db, &restype[2], &elem[2], map)) != NULL) {
+                    err = dav_push_error(r->pool, err->status, 0,
+                                          "Property 'displayname' could not be stored, "
+                                          "preventing the creation of a "
+                                          "calendar collection.",
+                                          err);
+                }
+
+            }
+
+            provider->propdb->close(db);
+
+        }
+
+        dav_close_propdb(propdb);
+    }
+
+    if (lockdb != NULL) {
+        dav_close_lockdb(lockdb);
+    }
+
+    /* start the collection tag off */
+    if (!err) {
+        err = dav_calendar_ctag_set(r, resource);
+    }
+
+    return err;
+}
+
+static dav_error *dav_calendar_provision_calendar(request_rec *r, dav_resource *trigger, const char *name)
+{
+    dav_error *err;
+    const dav_provider *provider;
+    dav_resource *resource = NULL;
+    apr_array_header_t *mkcols;
+    int i;
+
+    /* find the dav provider */
+    provider = dav_get_provider(r);
+    if (provider == NULL) {
+        return dav_new_error(r->pool, HTTP_METHOD_NOT_ALLOWED, 0, 0,
+                             apr_psprintf(r->pool,
+                             "DAV not enabled for %s",
+                             ap_escape_html(r->pool, r->unparsed_uri)));
+    }
+
+    /* resolve calendar resource */
+    if ((err = provider->repos->get_resource(r, NULL, NULL, 0, &resource))) {
+        return dav_push_error(r->pool, err->status, 0,
+                              apr_psprintf(r->pool,
+                                           "Could not get calendar provision URL: %s",
+                                           ap_escape_html(r->pool, r->unparsed_uri)),
+                              err);
+    }
+
+    /* already exists and is a collection? we're done */
+    if (resource->exists && resource->collection) {
+        return NULL;
+    }
+
+    /* sanity check parents */
+    mkcols = apr_array_make(r->pool, 2, sizeof(dav_resource *));
+    if ((err = dav_calendar_check_calender(r, resource, provider, mkcols))) {
+        return err;
+    }
+
+    /* create parent collections */
+    for (i = mkcols->nelts - 1; i >= 0; i--) {
+        dav_resource *parent = APR_ARRAY_IDX(mkcols, i, dav_resource *);
+
+        if (trigger->hooks->is_same_resource(trigger, parent)) {
+            err = trigger->hooks->create_collection(trigger);
+        }
+        else {
+            err = parent->hooks->create_collection(parent);
+        }
+
+        if (err) {
+            return dav_push_error(r->pool, err->status, 0,
+                                  apr_psprintf(r->pool,
+                                  "Could not create calendar provision "
+                                  "parent directory: %s",
+                                  ap_escape_html(r->pool, parent->uri)),
+                                  err);
+        }
+    }
+
+    /* create calendar */
+    if (trigger->hooks->is_same_resource(trigger, resource)) {
+        err = dav_calendar_make_calendar(r, trigger, name);
+    }
+    else {
+        err = dav_calendar_make_calendar(r, resource, name);
+    }
+
+    return err;
+}
+
+/*
+ * The provision cache.
+ *
+ * Each provision URL that has been provisioned, or found to exist, is
+ * remembered in a shared object cache for DavCalendarProvisionCacheTimeout
+ * seconds, so that requests for missing resources in the provision URL
+ * space do not look the provision URL up again in every process. A
+ * provisioned collection removed through WebDAV is forgotten straight away.
+ */
+
+#define DAV_CALENDAR_PROVISION_MUTEX "dav_calendar-provision"
+
+static ap_socache_provider_t *dav_calendar_provision_cache;
+static ap_socache_instance_t *dav_calendar_provision_instance;
+static apr_global_mutex_t *dav_calendar_provision_mutex;
+
+/*
+ * Is the URI the provision URL, or one of the collections above it?
+ */
+static int dav_calendar_provision_under(const char *uri, const char *path)
+{
+    apr_size_t len = strlen(uri);
+
+    if (!len || strncmp(uri, path, len)) {
+        return 0;
+    }
+
+    return uri[len - 1] == '/' || path[len] == '/' || !path[len];
+}
+
+static const char *dav_calendar_provision_key(request_rec *r, const char *path)
+{
+    apr_size_t len = strlen(path);
+
+    /* with or without the trailing slash, the collection is the same */
+    while (len > 1 && path[len - 1] == '/') {
+        len--;
+    }
+
+    return apr_psprintf(r->pool, "%s:%u%.*s", r->server->server_hostname,
+            (unsigned int) r->server->port, (int) len, path);
+}
+
+static int dav_calendar_provision_lock(request_rec *r)
+{
+    apr_status_t status;
+
+    if (dav_calendar_provision_mutex
+            && (status = apr_global_mutex_lock(dav_calendar_provision_mutex))
+                    != APR_SUCCESS) {
+        ap_log_rerror(APLOG_MARK, APLOG_ERR, status, r,
+                "mod_dav_calendar: Could not lock the calendar provision cache");
+        return 0;
+    }
+
+    return 1;
+}
+
+static void dav_calendar_provision_unlock(void)
+{
+    if (dav_calendar_provision_mutex) {
+        apr_global_mutex_unlock(dav_calendar_provision_mutex);
+    }
+}
+
+static int dav_calendar_provision_seen(request_rec *r, const char *key)
+{
+    unsigned char flag;
+    unsigned int len = sizeof(flag);
+    apr_status_t status;
+
+    if (!dav_calendar_provision_cache || !dav_calendar_provision_lock(r)) {
+        return 0;
+    }
+
+    status = dav_calendar_provision_cache->retrieve(
+            dav_calendar_provision_instance, r->server,
+            (const unsigned char *) key, strlen(key), &flag, &len, r->pool);
+
+    dav_calendar_provision_unlock();
+
+    return status == APR_SUCCESS;
+}
+
+static void dav_calendar_provision_remember(request_rec *r, const char *key)
+{
+    dav_calendar_server_rec *sconf = ap_get_module_config(r->server->module_config,
+            &dav_calendar_module);
+    unsigned char flag = 1;
+    apr_status_t status;
+
+    if (!dav_calendar_provision_cache || !dav_calendar_provision_lock(r)) {
+        return;
+    }
+
+    status = dav_calendar_provision_cache->store(
+            dav_calendar_provision_instance, r->server,
+            (const unsigned char *) key, strlen(key),
+            apr_time_now() + sconf->provision_timeout, &flag, sizeof(flag),
+            r->pool);
+    if (status != APR_SUCCESS) {
+        ap_log_rerror(APLOG_MARK, APLOG_DEBUG, status, r,
+                "mod_dav_calendar: Could not remember provisioned calendar %s",
+                key);
+    }
+
+    dav_calendar_provision_unlock();
+}
+
+static void dav_calendar_provision_forget(request_rec *r, const char *key)
+{
+    if (!dav_calendar_provision_cache || !dav_calendar_provision_lock(r)) {
+        return;
+    }
+
+    dav_calendar_provision_cache->remove(dav_calendar_provision_instance,
+            r->server, (const unsigned char *) key, strlen(key), r->pool);
+
+    dav_calendar_provision_unlock();
+}
+
+/*
+ * A collection has been removed, forget any provision URL at or below it
+ * so that it is provisioned again on next use.
+ */
+static void dav_calendar_provision_removed(request_rec *r, const char *uri)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+    dav_calendar_provision_entry *provs;
+    int i;
+
+    if (!dav_calendar_provision_cache || !conf->dav_calendar_provisions) {
+        return;
+    }
+
+    provs = (dav_calendar_provision_entry *)conf->dav_calendar_provisions->elts;
+
+    for (i = 0; i < conf->dav_calendar_provisions->nelts; ++i) {
+        const char *error = NULL, *path;
+
+        path = ap_expr_str_exec(r, provs[i].provision, &error);
+        if (!error && dav_calendar_provision_under(uri, path)) {
+            dav_calendar_provision_forget(r,
+                    dav_calendar_provision_key(r, path));
+        }
+    }
+}
+
+static int dav_calendar_auto_provision(request_rec *r, dav_resource *resource,
+        dav_error **err)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+
+    dav_calendar_provision_entry *provs = (dav_calendar_provision_entry *)conf->dav_calendar_provisions->elts;
+    apr_time_t start;
+    int i;
+
+    if (!conf->dav_calendar_provisions->nelts) {
+        return DECLINED;
+    }
+
+    for (i = 0; i < conf->dav_calendar_provisions->nelts; ++i) {
+        const char *error = NULL, *path, *name, *key;
+
+        dav_lookup_result lookup = { 0 };
+
+        path = ap_expr_str_exec(r, provs[i].provision, &error);
+        if (error) {
+            *err = dav_new_error(r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
+                    apr_psprintf(r->pool, "Could not evaluate calendar provision URL: %s",
+                            error));
+            return DONE;
+        }
+
+        /* sanity - if not the provision URL or above it, skip */
+        if (!dav_calendar_provision_under(r->uri, path)) {
+            continue;
+        }
+
+        /* provisioned recently? skip */
+        key = dav_calendar_provision_key(r, path);
+        if (dav_calendar_provision_seen(r, key)) {
+            continue;
+        }
+
+        if (provs[i].displayname) {
+            name = ap_expr_str_exec(r, provs[i].displayname, &error);
+            if (error) {
+                *err = dav_new_error(r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
+                        apr_psprintf(r->pool, "Could not evaluate calendar provision name: %s",
+                                error));
+                return DONE;
+            }
+        }
+        else {
+            name = NULL;
+        }
+
+        lookup = dav_lookup_uri(path, r, 0 /* must_be_absolute */);
+
+        if (lookup.rnew == NULL) {
+            *err = dav_new_error(r->pool, lookup.err.status, 0, APR_SUCCESS,
+                    lookup.err.desc);
+            return DONE;
+        }
+        if (lookup.rnew->status != HTTP_OK) {
+            *err = dav_new_error(r->pool, lookup.rnew->status, 0, APR_SUCCESS,
+                    apr_psprintf(r->pool, "Could not lookup calendar provision URL: %s", path));
+            return DONE;
+        }
+
+        /* make the calendar */
+        start = apr_time_now();
+        *err = dav_calendar_provision_calendar(lookup.rnew, resource, name);
+        dav_calendar_metrics_time(DAV_CALENDAR_OP_PROVISION, start);
+        if (*err != NULL) {
+            return DONE;
+        }
+
+        dav_calendar_provision_remember(r, key);
+
+        ap_log_rerror(APLOG_MARK, APLOG_INFO, 0, r,
+                        "mod_dav_calendar: Auto provisioned %s", lookup.rnew->uri);
+
+        /* clean up */
+        if (lookup.rnew) {
+            ap_destroy_sub_req(lookup.rnew);
+        }
+    }
+
+    return DONE;
+}
+
+static void *create_dav_calendar_config(apr_pool_t *p, server_rec *s)
+{
+    dav_calendar_server_rec *a =
+    (dav_calendar_server_rec *) apr_pcalloc(p, sizeof(dav_calendar_server_rec));
+
+    a->aliases = apr_array_make(p, 5, sizeof(dav_calendar_alias_entry));
+    a->provision_timeout = apr_time_from_sec(DEFAULT_PROVISION_CACHE_TIMEOUT);
+
+    return a;
+}
+
+static void *create_dav_calendar_dir_config(apr_pool_t *p, char *d)
+{
+    dav_calendar_config_rec *conf = apr_pcalloc(p, sizeof(dav_calendar_config_rec));
+
+    conf->dav_calendar_timezone = DEFAULT_TIMEZONE;
+    conf->max_resource_size = DEFAULT_MAX_RESOURCE_SIZE;
+    conf->max_instances = DEFAULT_MAX_INSTANCES;
+    conf->feed_cache_max_age = apr_time_from_sec(DEFAULT_FEED_CACHE_MAX_AGE);
+
+    conf->dav_calendar_homes = apr_array_make(p, 2, sizeof(ap_expr_info_t *));
+    conf->dav_calendar_provisions = apr_array_make(p, 2, sizeof(dav_calendar_provision_entry));
+
+    return conf;
+}
+
+static void *merge_dav_calendar_config(apr_pool_t *p, void *basev, void *overridesv)
+{
+    dav_calendar_server_rec *a =
+    (dav_calendar_server_rec *) apr_pcalloc(p, sizeof(dav_calendar_server_rec));
+    dav_calendar_server_rec *base = (dav_calendar_server_rec *) basev;
+    dav_calendar_server_rec *overrides = (dav_calendar_server_rec *) overridesv;
+
+    a->aliases = apr_array_append(p, overrides->aliases, base->aliases);
+
+    a->cache_size = (overrides->cache_size_set == 0) ? base->cache_size : overrides->cache_size;
+    a->cache_size_set = overrides->cache_size_set || base->cache_size_set;
+
+    a->parse_threads = (overrides->parse_threads_set == 0) ? base->parse_threads : overrides->parse_threads;
+    a->parse_threads_set = overrides->parse_threads_set || base->parse_threads_set;
+
+    a->provision_timeout = (overrides->provision_timeout_set == 0) ? base->provision_timeout : overrides->provision_timeout;
+    a->provision_timeout_set = overrides->provision_timeout_set || base->provision_timeout_set;
+
+    a->metrics = (overrides->metrics_set == 0) ? base->metrics : overrides->metrics;
+    a->metrics_set = overrides->metrics_set || base->metrics_set;
+
+    return a;
+}
+
+static void *merge_dav_calendar_dir_config(apr_pool_t *p, void *basev, void *addv)
+{
+    dav_calendar_config_rec *new = (dav_calendar_config_rec *) apr_pcalloc(p,
+            sizeof(dav_calendar_config_rec));
+    dav_calendar_config_rec *add = (dav_calendar_config_rec *) addv;
+    dav_calendar_config_rec *base = (dav_calendar_config_rec *) basev;
+
+    new->dav_calendar = (add->dav_calendar_set == 0) ? base->dav_calendar : add->dav_calendar;
+    new->dav_calendar_set = add->dav_calendar_set || base->dav_calendar_set;
+
+    new->dav_calendar_timezone = (add->dav_calendar_timezone_set == 0) ?
+            base->dav_calendar_timezone : add->dav_calendar_timezone;
+    new->dav_calendar_timezone_set = add->dav_calendar_timezone_set || base->dav_calendar_timezone_set;
+
+    new->max_resource_size = (add->max_resource_size_set == 0) ? base->max_resource_size : add->max_resource_size;
+    new->max_resource_size_set = add->max_resource_size_set || base->max_resource_size_set;
+
+    new->max_instances = (add->max_instances_set == 0) ? base->max_instances : add->max_instances;
+    new->max_instances_set = add->max_instances_set || base->max_instances_set;
+
+    new->index_db = (add->index_db_set == 0) ? base->index_db : add->index_db;
+    new->index_db_set = add->index_db_set || base->index_db_set;
+
+    new->journal_db = (add->journal_db_set == 0) ? base->journal_db : add->journal_db;
+    new->journal_db_set = add->journal_db_set || base->journal_db_set;
+
+    new->feed_cache = (add->feed_cache_set == 0) ? base->feed_cache : add->feed_cache;
+    new->feed_cache_set = add->feed_cache_set || base->feed_cache_set;
+
+    new->feed_cache_max_age = (add->feed_cache_max_age_set == 0) ? base->feed_cache_max_age : add->feed_cache_max_age;
+    new->feed_cache_max_age_set = add->feed_cache_max_age_set || base->feed_cache_max_age_set;
+
+    new->direct_read = (add->direct_read_set == 0) ? base->direct_read : add->direct_read;
+    new->direct_read_set = add->direct_read_set || base->direct_read_set;
+
+    new->stream = (add->stream_set == 0) ? base->stream : add->stream;
+    new->stream_set = add->stream_set || base->stream_set;
+
+    new->multiget_batch = (add->multiget_batch_set == 0) ? base->multiget_batch : add->multiget_batch;
+    new->multiget_batch_set = add->multiget_batch_set || base->multiget_batch_set;
+
+    new->server_timing = (add->server_timing_set == 0) ? base->server_timing : add->server_timing;
+    new->server_timing_set = add->server_timing_set || base->server_timing_set;
+
+    new->dav_calendar_homes = apr_array_append(p, add->dav_calendar_homes, base->dav_calendar_homes);
+    new->dav_calendar_provisions = apr_array_append(p, add->dav_calendar_provisions, base->dav_calendar_provisions);
+
+    return new;
+}
+
+static const char *set_dav_calendar(cmd_parms *cmd, void *dconf, int flag)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    conf->dav_calendar = flag;
+    conf->dav_calendar_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_timezone(cmd_parms *cmd, void *dconf, const char *tz)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    icalcomponent *calendar, *timezone;
+
+    calendar = icalcomponent_new(ICAL_VCALENDAR_COMPONENT);
+    icalcomponent_add_property(calendar, icalproperty_new_version("2.0"));
+    icalcomponent_add_property(calendar,
+            icalproperty_new_prodid("-//Graham Leggett//" PACKAGE_STRING "//EN"));
+
+    timezone = icalcomponent_new(ICAL_VTIMEZONE_COMPONENT);
+    icalcomponent_add_property(timezone, icalproperty_new_tzid(tz));
+
+    icalcomponent_add_component(calendar,timezone);
+
+    conf->dav_calendar_timezone = icalcomponent_as_ical_string(calendar);
+    conf->dav_calendar_timezone_set = 1;
+
+    icalcomponent_free(calendar);
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_max_resource_size(cmd_parms *cmd,
+        void *dconf, const char *arg)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    if (apr_strtoff(&conf->max_resource_size, arg, NULL, 10) != APR_SUCCESS
+            || conf->max_resource_size < 4096) {
+        return "DavCalendarMaxResourceSize needs to be a positive integer larger than 4096.";
+    }
+
+    conf->max_resource_size_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_max_instances(cmd_parms *cmd,
+        void *dconf, const char *arg)
+{
+    dav_calendar_config_rec *conf = dconf;
+    char *end;
+
+    conf->max_instances = strtol(arg, &end, 10);
+    if (*end || conf->max_instances < 1) {
+        return "DavCalendarMaxInstances needs to be a positive integer.";
+    }
+
+    conf->max_instances_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_index(cmd_parms *cmd, void *dconf,
+        const char *arg)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    if (!strcasecmp(arg, "none")) {
+        conf->index_db = NULL;
+    }
+    else {
+        conf->index_db = ap_server_root_relative(cmd->pool, arg);
+        if (!conf->index_db) {
+            return apr_pstrcat(cmd->pool, "DavCalendarIndex: invalid path '",
+                    arg, "'", NULL);
+        }
+    }
+
+    conf->index_db_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_journal(cmd_parms *cmd, void *dconf,
+        const char *arg)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    if (!strcasecmp(arg, "none")) {
+        conf->journal_db = NULL;
+    }
+    else {
+        conf->journal_db = ap_server_root_relative(cmd->pool, arg);
+        if (!conf->journal_db) {
+            return apr_pstrcat(cmd->pool, "DavCalendarJournal: invalid path '",
+                    arg, "'", NULL);
+        }
+    }
+
+    conf->journal_db_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_server_timing(cmd_parms *cmd, void *dconf,
+        int flag)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    conf->server_timing = flag;
+    conf->server_timing_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_feed_cache(cmd_parms *cmd, void *dconf,
+        const char *arg)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    if (!strcasecmp(arg, "none")) {
+        conf->feed_cache = NULL;
+    }
+    else {
+        conf->feed_cache = ap_server_root_relative(cmd->pool, arg);
+        if (!conf->feed_cache) {
+            return apr_pstrcat(cmd->pool, "DavCalendarFeedCache: invalid path '",
+                    arg, "'", NULL);
+        }
+    }
+
+    conf->feed_cache_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_feed_cache_max_age(cmd_parms *cmd,
+        void *dconf, const char *arg)
+{
+    dav_calendar_config_rec *conf = dconf;
+    char *end;
+    long age;
+
+    age = strtol(arg, &end, 10);
+    if (*end || age <= 0) {
+        return "DavCalendarFeedCacheMaxAge needs to be a positive number of seconds.";
+    }
+
+    conf->feed_cache_max_age = apr_time_from_sec(age);
+    conf->feed_cache_max_age_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_direct_read(cmd_parms *cmd, void *dconf,
+        int flag)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    conf->direct_read = flag;
+    conf->direct_read_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_multiget_batch(cmd_parms *cmd,
+        void *dconf, int flag)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    conf->multiget_batch = flag;
+    conf->multiget_batch_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_stream(cmd_parms *cmd, void *dconf, int flag)
+{
+    dav_calendar_config_rec *conf = dconf;
+
+    conf->stream = flag;
+    conf->stream_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_cache_size(cmd_parms *cmd, void *dconf,
+        const char *arg)
+{
+    dav_calendar_server_rec *conf = ap_get_module_config(cmd->server->module_config,
+            &dav_calendar_module);
+    apr_off_t size;
+
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+
+    if (err != NULL) {
+        return err;
+    }
+
+    if (apr_strtoff(&size, arg, NULL, 10) != APR_SUCCESS || size < 0) {
+        return "DavCalendarCacheSize needs to be zero or a positive integer.";
+    }
+
+    conf->cache_size = (apr_size_t) size;
+    conf->cache_size_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_parse_threads(cmd_parms *cmd, void *dconf,
+        const char *arg)
+{
+    dav_calendar_server_rec *conf = ap_get_module_config(cmd->server->module_config,
+            &dav_calendar_module);
+    char *end;
+
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+
+    if (err != NULL) {
+        return err;
+    }
+
+    conf->parse_threads = strtol(arg, &end, 10);
+    if (*end || conf->parse_threads < 0) {
+        return "DavCalendarParseThreads needs to be zero or a positive integer.";
+    }
+
+#if !APR_HAS_THREADS
+    if (conf->parse_threads) {
+        return "DavCalendarParseThreads is not supported without thread support in APR.";
+    }
+#endif
+
+    conf->parse_threads_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_provision_cache(cmd_parms *cmd,
+        void *dconf, const char *arg)
+{
+    const char *sep, *name;
+
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+
+    if (err != NULL) {
+        return err;
+    }
+
+    /* the provider name, optionally followed by a colon and its arguments */
+    if ((sep = ap_strchr_c(arg, ':'))) {
+        name = apr_pstrmemdup(cmd->pool, arg, sep - arg);
+        sep++;
+    }
+    else {
+        name = arg;
+    }
+
+    dav_calendar_provision_cache = ap_lookup_provider(AP_SOCACHE_PROVIDER_GROUP,
+            name, AP_SOCACHE_PROVIDER_VERSION);
+    if (!dav_calendar_provision_cache) {
+        return apr_psprintf(cmd->pool, "DavCalendarProvisionCache: unknown "
+                "cache type '%s', is the mod_socache_%s module loaded?",
+                name, name);
+    }
+
+    err = dav_calendar_provision_cache->create(&dav_calendar_provision_instance,
+            sep, cmd->temp_pool, cmd->pool);
+    if (err) {
+        dav_calendar_provision_cache = NULL;
+        return apr_psprintf(cmd->pool, "DavCalendarProvisionCache: %s", err);
+    }
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_provision_timeout(cmd_parms *cmd,
+        void *dconf, const char *arg)
+{
+    dav_calendar_server_rec *conf = ap_get_module_config(cmd->server->module_config,
+            &dav_calendar_module);
+    char *end;
+    long timeout;
+
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+
+    if (err != NULL) {
+        return err;
+    }
+
+    timeout = strtol(arg, &end, 10);
+    if (*end || timeout <= 0) {
+        return "DavCalendarProvisionCacheTimeout needs to be a positive number of seconds.";
+    }
+
+    conf->provision_timeout = apr_time_from_sec(timeout);
+    conf->provision_timeout_set = 1;
+
+    return NULL;
+}
+
+static const char *set_dav_calendar_metrics(cmd_parms *cmd, void *dconf,
+        int flag)
+{
+    dav_calendar_server_rec *conf = ap_get_module_config(cmd->server->module_config,
+            &dav_calendar_module);
+
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+
+    if (err != NULL) {
+        return err;
+    }
+
+    conf->metrics = flag;
+    conf->metrics_set = 1;
+
+    return NULL;
+}
+
+static const char *add_dav_calendar_home(cmd_parms *cmd, void *dconf, const char *home)
+{
+    dav_calendar_config_rec *conf = dconf;
+    const char *expr_err = NULL;
+
+    ap_expr_info_t **homes = apr_array_push(conf->dav_calendar_homes);
+
+    (*homes) = ap_expr_parse_cmd(cmd, home, AP_EXPR_FLAG_STRING_RESULT,
+            &expr_err, NULL);
+
+    if (expr_err) {
+        return apr_pstrcat(cmd->temp_pool,
+                "Cannot parse expression '", home, "': ",
+                expr_err, NULL);
+    }
+
+    return NULL;
+}
+
+static const char *add_dav_calendar_provision(cmd_parms *cmd, void *dconf, const char *prov, const char *name)
+{
+    dav_calendar_config_rec *conf = dconf;
+    const char *expr_err = NULL;
+
+    dav_calendar_provision_entry *provs = apr_array_push(conf->dav_calendar_provisions);
+
+    provs->provision = ap_expr_parse_cmd(cmd, prov, AP_EXPR_FLAG_STRING_RESULT,
+            &expr_err, NULL);
+
+    if (expr_err) {
+        return apr_pstrcat(cmd->temp_pool,
+                "Cannot parse expression '", prov, "': ",
+                expr_err, NULL);
+    }
+
+    if (name) {
+
+        provs->displayname = ap_expr_parse_cmd(cmd, name, AP_EXPR_FLAG_STRING_RESULT,
+                &expr_err, NULL);
+
+        if (expr_err) {
+            return apr_pstrcat(cmd->temp_pool,
+                    "Cannot parse expression '", name, "': ",
+                    expr_err, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+static const char *add_alias_internal(cmd_parms *cmd, void *dummy,
+                                      const char *fake, const char *real,
+                                      int use_regex)
+{
+    server_rec *s = cmd->server;
+    dav_calendar_server_rec *conf = ap_get_module_config(s->module_config,
+                                                   &dav_calendar_module);
+    dav_calendar_alias_entry *new = apr_array_push(conf->aliases);
+
+    const char *err = ap_check_cmd_context(cmd, NOT_IN_DIR_CONTEXT);
+
+    if (err != NULL) {
+        return err;
+    }
+
+    if (use_regex) {
+        new->regexp = ap_pregcomp(cmd->pool, fake, AP_REG_EXTENDED);
+        if (new->regexp == NULL)
+            return "Regular expression could not be compiled.";
+        new->real = real;
+    }
+    else {
+        new->real = real;
+    }
+    new->fake = fake;
+
+    return NULL;
+}
+
+static const char *add_dav_calendar_alias(cmd_parms *cmd, void *dummy, const char *fake,
+        const char *real)
+{
+    return add_alias_internal(cmd, dummy, fake, real, 0);
+}
+
+static const char *add_dav_calendar_alias_regex(cmd_parms *cmd, void *dummy,
+                                   const char *fake, const char *real)
+{
+    return add_alias_internal(cmd, dummy, fake, real, 1);
+}
+
+/*
+ * The alias index.
+ *
+ * Aliases are tried in configuration order, and the first to match wins.
+ * To avoid testing every alias against every request, the exact aliases
+ * are hashed by URL, and the regular expressions are hashed by the
+ * literal text they must start with, if any. A request need only try the
+ * aliases found by looking up the URL and those of its leading parts that
+ * are the length of a literal prefix, along with the regular expressions
+ * that have no literal prefix, still in configuration order.
+ */
+typedef struct dav_calendar_alias_index {
+    /* URL of an exact alias to its position */
+    apr_hash_t *exact;
+    /* literal prefix of a regular expression to an array of positions */
+    apr_hash_t *prefixes;
+    /* the distinct lengths of the literal prefixes */
+    apr_array_header_t *lengths;
+    /* positions of the regular expressions without a literal prefix */
+    apr_array_header_t *unprefixed;
+} dav_calendar_alias_index;
+
+/*
+ * Find the literal text that every match of the regular expression must
+ * start with, or the empty string if there is none we can be sure of.
+ */
+static const char *dav_calendar_alias_prefix(apr_pool_t *p,
+        const char *pattern)
+{
+    char *prefix, *out;
+    const char *c;
+
+    /* unanchored, or an alternative might match something else */
+    if (pattern[0] != '^' || ap_strchr_c(pattern, '|')) {
+        return "";
+    }
+
+    prefix = out = apr_palloc(p, strlen(pattern));
+
+    for (c = pattern + 1; *c; c++) {
+        char literal;
+
+        if (*c == '\\' && c[1] && !apr_isalnum(c[1])) {
+            literal = *++c;
+        }
+        else if (ap_strchr_c(".[]()*+?{}\\$^", *c)) {
+            break;
+        }
+        else {
+            literal = *c;
+        }
+
+        /* an optional or repeated character ends the prefix */
+        if (c[1] && ap_strchr_c("*+?{", c[1])) {
+            break;
+        }
+
+        *out++ = literal;
+    }
+    *out = 0;
+
+    return prefix;
+}
+
+static dav_calendar_alias_index *dav_calendar_alias_compile(apr_pool_t *p,
+        apr_array_header_t *aliases)
+{
+    dav_calendar_alias_entry *entries = (dav_calendar_alias_entry *) aliases->elts;
+    dav_calendar_alias_index *index = apr_pcalloc(p, sizeof(*index));
+    int i;
+
+    index->exact = apr_hash_make(p);
+    index->prefixes = apr_hash_make(p);
+    index->lengths = apr_array_make(p, 2, sizeof(apr_size_t));
+    index->unprefixed = apr_array_make(p, 2, sizeof(int));
+
+    for (i = 0; i < aliases->nelts; ++i) {
+        dav_calendar_alias_entry *alias = &entries[i];
+
+        if (alias->regexp) {
+            const char *prefix = dav_calendar_alias_prefix(p, alias->fake);
+            apr_size_t len = strlen(prefix);
+            apr_array_header_t *positions;
+            int j;
+
+            if (!len) {
+                APR_ARRAY_PUSH(index->unprefixed, int) = i;
+                continue;
+            }
+
+            positions = apr_hash_get(index->prefixes, prefix, len);
+            if (!positions) {
+                positions = apr_array_make(p, 1, sizeof(int));
+                apr_hash_set(index->prefixes, prefix, len, positions);
+
+                for (j = 0; j < index->lengths->nelts; j++) {
+                    if (APR_ARRAY_IDX(index->lengths, j, apr_size_t) == len) {
+                        break;
+                    }
+                }
+                if (j == index->lengths->nelts) {
+                    APR_ARRAY_PUSH(index->lengths, apr_size_t) = len;
+                }
+            }
+            APR_ARRAY_PUSH(positions, int) = i;
+        }
+
+        /* a later alias with the same URL can never match */
+        else if (!apr_hash_get(index->exact, alias->fake, APR_HASH_KEY_STRING)) {
+            int *position = apr_palloc(p, sizeof(int));
+
+            *position = i;
+            apr_hash_set(index->exact, alias->fake, APR_HASH_KEY_STRING,
+                    position);
+        }
+    }
+
+    return index;
+}
+
+/*
+ * Add positions to the candidates, keeping them in configuration order.
+ */
+static void dav_calendar_alias_add(apr_array_header_t *candidates,
+        const int *positions, int nelts)
+{
+    int i, j;
+
+    for (i = 0; i < nelts; i++) {
+        int *elts;
+
+        apr_array_push(candidates);
+        elts = (int *) candidates->elts;
+
+        for (j = candidates->nelts - 1; j > 0 && elts[j - 1] > positions[i]; j--) {
+            elts[j] = elts[j - 1];
+        }
+        elts[j] = positions[i];
+    }
+}
+
+/*
+ * Find the positions of the aliases that could match the request, or
+ * NULL if none could.
+ */
+static apr_array_header_t *dav_calendar_alias_candidates(request_rec *r,
+        const dav_calendar_alias_index *index)
+{
+    apr_array_header_t *candidates = NULL;
+    apr_size_t len = strlen(r->uri);
+    const int *position;
+    int i;
+
+    if ((position = apr_hash_get(index->exact, r->uri, len))) {
+        candidates = apr_array_make(r->pool, 4, sizeof(int));
+        dav_calendar_alias_add(candidates, position, 1);
+    }
+
+    for (i = 0; i < index->lengths->nelts; i++) {
+        apr_size_t plen = APR_ARRAY_IDX(index->lengths, i, apr_size_t);
+        apr_array_header_t *positions;
+
+        if (plen > len
+                || !(positions = apr_hash_get(index->prefixes, r->uri, plen))) {
+            continue;
+        }
+
+        if (!candidates) {
+            candidates = apr_array_make(r->pool, 4, sizeof(int));
+        }
+        dav_calendar_alias_add(candidates, (const int *) positions->elts,
+                positions->nelts);
+    }
+
+    if (index->unprefixed->nelts) {
+        if (!candidates) {
+            candidates = apr_array_make(r->pool, 4, sizeof(int));
+        }
+        dav_calendar_alias_add(candidates,
+                (const int *) index->unprefixed->elts,
+                index->unprefixed->nelts);
+    }
+
+    return candidates;
+}
+
+static const command_rec dav_calendar_cmds[] =
+{
+    AP_INIT_FLAG("DavCalendar",
+        set_dav_calendar, NULL, RSRC_CONF | ACCESS_CONF,
+        "When enabled, the URL space will support calendars."),
+    AP_INIT_TAKE1("DavCalendarTimezone", set_dav_calendar_timezone, NULL, RSRC_CONF | ACCESS_CONF,
+        "Set the default timezone for auto provisioned calendars. Defaults to UTC."),
+    AP_INIT_TAKE1("DavCalendarMaxResourceSize", set_dav_calendar_max_resource_size, NULL, RSRC_CONF | ACCESS_CONF,
+        "Set the maximum resource size of an individual calendar. Defaults to 10MB."),
+    AP_INIT_TAKE1("DavCalendarMaxInstances", set_dav_calendar_max_instances, NULL, RSRC_CONF | ACCESS_CONF,
+        "Set the maximum number of recurrence instances returned when a calendar-data "
+        "element asks for a recurring component to be expanded. Defaults to 1000."),
+    AP_INIT_TAKE1("DavCalendarIndex", set_dav_calendar_index, NULL, RSRC_CONF | ACCESS_CONF,
+        "Set the path of the DBM file used to index calendar resources, or 'none' "
+        "to disable the index. Defaults to none."),
+    AP_INIT_TAKE1("DavCalendarJournal", set_dav_calendar_journal, NULL, RSRC_CONF | ACCESS_CONF,
+        "Set the path of the DBM file used to journal changes to calendar "
+        "collections for the sync-collection report, or 'none' to disable "
+        "the journal. Defaults to none."),
+    AP_INIT_TAKE1("DavCalendarFeedCache", set_dav_calendar_feed_cache, NULL, RSRC_CONF | ACCESS_CONF,
+        "Set the directory used to keep the rendered calendars reached through "
+        "DavCalendarAlias or DavCalendarAliasMatch, or 'none' to render each "
+        "time. Defaults to none."),
+    AP_INIT_TAKE1("DavCalendarFeedCacheMaxAge", set_dav_calendar_feed_cache_max_age, NULL, RSRC_CONF | ACCESS_CONF,
+        "Set the number of seconds after which a kept calendar that has not "
+        "been rendered again is removed from DavCalendarFeedCache. Defaults "
+        "to 86400."),
+    AP_INIT_FLAG("DavCalendarDirectRead", set_dav_calendar_direct_read, NULL, RSRC_CONF | ACCESS_CONF,
+        "When enabled, calendar resources stored as files are read directly "
+        "rather than through a subrequest. Defaults to off."),
+    AP_INIT_FLAG("DavCalendarMultigetBatch", set_dav_calendar_multiget_batch, NULL, RSRC_CONF | ACCESS_CONF,
+        "When enabled, the members of the collection named in a calendar-multiget "
+        "report are found in a single walk of the collection rather than through a "
+        "subrequest each. Defaults to off."),
+    AP_INIT_FLAG("DavCalendarServerTiming", set_dav_calendar_server_timing, NULL, RSRC_CONF | ACCESS_CONF,
+        "When enabled, the time spent in each phase of calendar reports and GET "
+        "requests is sent in the Server-Timing header and noted for the log. "
+        "Defaults to off."),
+    AP_INIT_FLAG("DavCalendarStream", set_dav_calendar_stream, NULL, RSRC_CONF | ACCESS_CONF,
+        "When enabled, a GET on a calendar collection is streamed to the client "
+        "as each calendar resource is read. Defaults to off."),
+    AP_INIT_TAKE1("DavCalendarCacheSize", set_dav_calendar_cache_size, NULL, RSRC_CONF,
+        "Set the maximum size in bytes of the per process cache of parsed calendar "
+        "resources, or zero to disable the cache. Defaults to 0."),
+    AP_INIT_TAKE1("DavCalendarParseThreads", set_dav_calendar_parse_threads, NULL, RSRC_CONF,
+        "Set the number of threads in each process used to parse calendar resources "
+        "ahead of a calendar-query or GET, or zero to parse on the request thread. "
+        "Defaults to 0."),
+    AP_INIT_TAKE1("DavCalendarHome", add_dav_calendar_home, NULL, RSRC_CONF | ACCESS_CONF,
+        "Set the URL template to use for the calendar home. "
+        "Recommended value is \"/calendars/%{escape:%{REMOTE_USER}}\"."),
+    AP_INIT_TAKE12("DavCalendarProvision", add_dav_calendar_provision, NULL, RSRC_CONF | ACCESS_CONF,
+        "Set the URL template to use for calendar auto provision. "
+        "If provided, the name is given to the displayname property, otherwise the name is "
+        "set to the path to the right of the last slash, if present. "
+        "Recommended value is \"/calendars/%{escape:%{REMOTE_USER}}/Home\"."),
+    AP_INIT_FLAG("DavCalendarMetrics", set_dav_calendar_metrics, NULL, RSRC_CONF,
+        "Keep timings and counters of calendar operations in shared memory, "
+        "reported by mod_status and the dav-calendar-metrics handler. "
+        "Defaults to off."),
+    AP_INIT_TAKE1("DavCalendarProvisionCache", set_dav_calendar_provision_cache, NULL, RSRC_CONF,
+        "Set the shared object cache used to remember provisioned calendars, given as "
+        "the cache type followed by optional arguments, like \"shmcb\"."),
+    AP_INIT_TAKE1("DavCalendarProvisionCacheTimeout", set_dav_calendar_provision_timeout, NULL, RSRC_CONF,
+        "Set the number of seconds a provisioned calendar is remembered. "
+        "Defaults to 3600."),
+    AP_INIT_TAKE2("DavCalendarAlias", add_dav_calendar_alias, NULL, RSRC_CONF | ACCESS_CONF,
+        "Calendar alias and the real calendar collection."),
+    AP_INIT_TAKE2("DavCalendarAliasMatch", add_dav_calendar_alias_regex, NULL, RSRC_CONF,
+        "A calendar alias regular expression and a calendar collecion URL to alias to"),
+    { NULL }
+};
+
+static int dav_calendar_pre_config(apr_pool_t *pconf, apr_pool_t *plog,
+                                   apr_pool_t *ptemp)
+{
+    apr_status_t rv;
+
+    /* forget the provision cache of the previous generation */
+    dav_calendar_provision_cache = NULL;
+    dav_calendar_provision_instance = NULL;
+    dav_calendar_provision_mutex = NULL;
+
+    rv = ap_mutex_register(pconf, DAV_CALENDAR_JOURNAL_MUTEX, NULL,
+            APR_LOCK_DEFAULT, 0);
+    if (rv != APR_SUCCESS) {
+        return rv;
+    }
+
+    rv = ap_mutex_register(pconf, DAV_CALENDAR_INDEX_MUTEX, NULL,
+            APR_LOCK_DEFAULT, 0);
+    if (rv != APR_SUCCESS) {
+        return rv;
+    }
+
+    rv = ap_mutex_register(pconf, DAV_CALENDAR_METRICS_MUTEX, NULL,
+            APR_LOCK_DEFAULT, 0);
+    if (rv != APR_SUCCESS) {
+        return rv;
+    }
+
+    return ap_mutex_register(pconf, DAV_CALENDAR_PROVISION_MUTEX, NULL,
+            APR_LOCK_DEFAULT, 0);
+}
+
+static apr_status_t dav_calendar_provision_cache_cleanup(void *data)
+{
+    server_rec *s = data;
+
+    if (dav_calendar_provision_cache) {
+        dav_calendar_provision_cache->destroy(dav_calendar_provision_instance,
+                s);
+    }
+
+    return APR_SUCCESS;
+}
+
+static int dav_calendar_post_config(apr_pool_t *p, apr_pool_t *plog,
+                                    apr_pool_t *ptemp, server_rec *s)
+{
+    apr_status_t rv;
+
+    dav_calendar_server_rec *sconf = ap_get_module_config(s->module_config,
+            &dav_calendar_module);
+    server_rec *sp;
+
+    /* Register CalDAV methods */
+    iM_MKCALENDAR = ap_method_register(p, "MKCALENDAR");
+
+    /* the metrics of this generation, shared by all its processes */
+    dav_calendar_metrics_global = NULL;
+    if (sconf->metrics
+            && ap_state_query(AP_SQ_MAIN_STATE) != AP_SQ_MS_CREATE_PRE_CONFIG) {
+        apr_shm_t *shm;
+
+        rv = apr_shm_create(&shm, sizeof(dav_calendar_metrics), NULL, p);
+        if (rv != APR_SUCCESS) {
+            ap_log_error(APLOG_MARK, APLOG_ERR, rv, s,
+                    "mod_dav_calendar: Could not create the calendar metrics "
+                    "shared memory, metrics disabled");
+        }
+        else if ((rv = ap_global_mutex_create(&dav_calendar_metrics_mutex,
+                NULL, DAV_CALENDAR_METRICS_MUTEX, NULL, s, p, 0))
+                != APR_SUCCESS) {
+            ap_log_error(APLOG_MARK, APLOG_ERR, rv, s,
+                    "mod_dav_calendar: Could not create the calendar metrics "
+                    "mutex, metrics disabled");
+        }
+        else {
+            dav_calendar_metrics_global = apr_shm_baseaddr_get(shm);
+            memset(dav_calendar_metrics_global, 0, sizeof(dav_calendar_metrics));
+        }
+    }
+
+    /* index the aliases of each server once they are merged */
+    for (sp = s; sp; sp = sp->next) {
+        dav_calendar_server_rec *vconf = ap_get_module_config(sp->module_config,
+                &dav_calendar_module);
+
+        if (vconf->aliases->nelts) {
+            vconf->alias_index = dav_calendar_alias_compile(p, vconf->aliases);
+        }
+    }
+
+    /* serialise writes to the journal */
+    rv = ap_global_mutex_create(&dav_calendar_journal_mutex, NULL,
+            DAV_CALENDAR_JOURNAL_MUTEX, NULL, s, p, 0);
+    if (rv != APR_SUCCESS) {
+        ap_log_error(APLOG_MARK, APLOG_ERR, rv, s,
+                "mod_dav_calendar: Could not create the calendar journal "
+                "mutex");
+        return HTTP_INTERNAL_SERVER_ERROR;
+    }
+
+    /* serialise writes to the index */
+    rv = ap_global_mutex_create(&dav_calendar_index_mutex, NULL,
+            DAV_CALENDAR_INDEX_MUTEX, NULL, s, p, 0);
+    if (rv != APR_SUCCESS) {
+        ap_log_error(APLOG_MARK, APLOG_ERR, rv, s,
+                "mod_dav_calendar: Could not create the calendar index "
+                "mutex");
+        return HTTP_INTERNAL_SERVER_ERROR;
+    }
+
+    /* the provision cache is shared by all processes */
+    if (dav_calendar_provision_cache) {
+        dav_calendar_server_rec *conf = ap_get_module_config(s->module_config,
+                &dav_calendar_module);
+        struct ap_socache_hints hints = { 0 };
+
+        if (dav_calendar_provision_cache->flags & AP_SOCACHE_FLAG_NOTMPSAFE) {
+            rv = ap_global_mutex_create(&dav_calendar_provision_mutex, NULL,
+                    DAV_CALENDAR_PROVISION_MUTEX, NULL, s, p, 0);
+            if (rv != APR_SUCCESS) {
+                ap_log_error(APLOG_MARK, APLOG_ERR, rv, s,
+                        "mod_dav_calendar: Could not create the calendar "
+                        "provision cache mutex");
+                return HTTP_INTERNAL_SERVER_ERROR;
+            }
+        }
+
+        hints.avg_id_len = 64;
+        hints.avg_obj_size = 1;
+        hints.expiry_interval = conf->provision_timeout;
+
+        rv = dav_calendar_provision_cache->init(dav_calendar_provision_instance,
+                DAV_CALENDAR_PROVISION_MUTEX, &hints, s, p);
+        if (rv != APR_SUCCESS) {
+            ap_log_error(APLOG_MARK, APLOG_ERR, rv, s,
+                    "mod_dav_calendar: Could not initialise the calendar "
+                    "provision cache");
+            return HTTP_INTERNAL_SERVER_ERROR;
+        }
+
+        apr_pool_cleanup_register(p, s, dav_calendar_provision_cache_cleanup,
+                apr_pool_cleanup_null);
+    }
+
+    return OK;
+}
+
+static void dav_calendar_child_init(apr_pool_t *p, server_rec *s)
+{
+    dav_calendar_server_rec *conf = ap_get_module_config(s->module_config,
+            &dav_calendar_module);
+    apr_status_t rv;
+
+    if (dav_calendar_journal_mutex) {
+        rv = apr_global_mutex_child_init(&dav_calendar_journal_mutex,
+                apr_global_mutex_lockfile(dav_calendar_journal_mutex), p);
+        if (rv != APR_SUCCESS) {
+            ap_log_error(APLOG_MARK, APLOG_CRIT, rv, s,
+                    "mod_dav_calendar: Could not reopen the calendar "
+                    "journal mutex, journal disabled");
+            dav_calendar_journal_mutex = NULL;
+        }
+    }
+
+    if (dav_calendar_index_mutex) {
+        rv = apr_global_mutex_child_init(&dav_calendar_index_mutex,
+                apr_global_mutex_lockfile(dav_calendar_index_mutex), p);
+        if (rv != APR_SUCCESS) {
+            ap_log_error(APLOG_MARK, APLOG_CRIT, rv, s,
+                    "mod_dav_calendar: Could not reopen the calendar "
+                    "index mutex, index updates disabled");
+            dav_calendar_index_mutex = NULL;
+        }
+    }
+
+    if (dav_calendar_metrics_global) {
+        rv = apr_global_mutex_child_init(&dav_calendar_metrics_mutex,
+                apr_global_mutex_lockfile(dav_calendar_metrics_mutex), p);
+        if (rv != APR_SUCCESS) {
+            ap_log_error(APLOG_MARK, APLOG_CRIT, rv, s,
+                    "mod_dav_calendar: Could not reopen the calendar "
+                    "metrics mutex, metrics disabled");
+            dav_calendar_metrics_global = NULL;
         }
     }
 
-    /* create calendar */
-    if (trigger->hooks->is_same_resource(trigger, resource)) {
-        err = dav_calendar_make_calendar(r, trigger, name);
+    if (dav_calendar_provision_mutex) {
+        rv = apr_global_mutex_child_init(&dav_calendar_provision_mutex,
+                apr_global_mutex_lockfile(dav_calendar_provision_mutex), p);
+        if (rv != APR_SUCCESS) {
+            ap_log_error(APLOG_MARK, APLOG_CRIT, rv, s,
+                    "mod_dav_calendar: Could not reopen the calendar "
+                    "provision cache mutex, provision cache disabled");
+            dav_calendar_provision_mutex = NULL;
+            dav_calendar_provision_cache = NULL;
+        }
     }
-    else {
-        err = dav_calendar_make_calendar(r, resource, name);
+
+    /* parsed calendars cannot be shared between processes, each child has its own */
+    if (conf->cache_size) {
+        dav_calendar_cache_global = dav_calendar_cache_create(p, s,
+                conf->cache_size);
     }
 
-    return err;
+#if APR_HAS_THREADS
+    if (conf->parse_threads) {
+        rv = apr_thread_pool_create(&dav_calendar_parse_pool, 0,
+                conf->parse_threads, p);
+        if (rv != APR_SUCCESS) {
+            ap_log_error(APLOG_MARK, APLOG_ERR, rv, s,
+                    "mod_dav_calendar: Could not create the parse thread "
+                    "pool, calendars will be parsed on the request thread");
+            dav_calendar_parse_pool = NULL;
+        }
+    }
+#endif
 }
 
-static int dav_calendar_auto_provision(request_rec *r, dav_resource *resource,
-        dav_error **err)
+/*
+ * Stream the calendar collection to the client.
+ *
+ * The calendar header is sent up front, followed by the components of
+ * each resource as it is read, so that neither the merged calendar nor
+ * the response body is ever held in memory in full. Without a
+ * Content-Length, HTTP/1.1 clients receive the body chunked.
+ */
+static int dav_calendar_stream_get(request_rec *r, dav_resource *resource,
+        dav_walk_params *w, dav_calendar_ctx *cctx,
+        const dav_calendar_collection_state *state, int depth)
 {
-    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
-            &dav_calendar_module);
+    dav_error *err;
+    apr_bucket *e;
+    apr_time_t start;
+    apr_status_t status;
 
-    dav_calendar_provision_entry *provs = (dav_calendar_provision_entry *)conf->dav_calendar_provisions->elts;
-    int i;
+    ap_set_content_type(r, "text/calendar");
 
-    if (!conf->dav_calendar_provisions->nelts) {
-        return DECLINED;
-    }
+    cctx->out = apr_brigade_create(r->pool, r->connection->bucket_alloc);
+    cctx->tzids = apr_hash_make(r->pool);
 
-    for (i = 0; i < conf->dav_calendar_provisions->nelts; ++i) {
-        const char *error = NULL, *path, *name;
+    /* get the headers to the client as soon as possible */
+    e = apr_bucket_immortal_create(DAV_CALENDAR_STREAM_HEADER,
+            strlen(DAV_CALENDAR_STREAM_HEADER), r->connection->bucket_alloc);
+    APR_BRIGADE_INSERT_TAIL(cctx->out, e);
+    e = apr_bucket_flush_create(r->connection->bucket_alloc);
+    APR_BRIGADE_INSERT_TAIL(cctx->out, e);
 
-        dav_lookup_result lookup = { 0 };
+    dav_calendar_timing_header(r);
 
-        path = ap_expr_str_exec(r, provs[i].provision, &error);
-        if (error) {
-            *err = dav_new_error(r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
-                    apr_psprintf(r->pool, "Could not evaluate calendar provision URL: %s",
-                            error));
-            return DONE;
-        }
+    start = dav_calendar_timing_start(r);
+    status = ap_pass_brigade(r->output_filters, cctx->out);
+    apr_brigade_cleanup(cctx->out);
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_SEND, start);
 
-        /* sanity - if no path prefix, skip */
-        if (strncmp(r->uri, path, strlen(r->uri))) {
-            continue;
-        }
+    if (status == APR_SUCCESS) {
+        err = dav_calendar_get_members(r, resource, w, cctx, state, depth);
+    }
+    else {
+        err = dav_new_error(r->pool, HTTP_INTERNAL_SERVER_ERROR, 0, status,
+                "Could not send calendar to the client.");
+    }
 
-        if (provs[i].displayname) {
-            name = ap_expr_str_exec(r, provs[i].displayname, &error);
-            if (error) {
-                *err = dav_new_error(r->pool, HTTP_FORBIDDEN, 0, APR_SUCCESS,
-                        apr_psprintf(r->pool, "Could not evaluate calendar provision name: %s",
-                                error));
-                return DONE;
-            }
-        }
-        else {
-            name = NULL;
-        }
+    if (w->lockdb != NULL) {
+        (*w->lockdb->hooks->close_lockdb)(w->lockdb);
+    }
 
-        lookup = dav_lookup_uri(path, r, 0 /* must_be_absolute */);
+    if (err != NULL) {
 
-        if (lookup.rnew == NULL) {
-            *err = dav_new_error(r->pool, lookup.err.status, 0, APR_SUCCESS,
-                    lookup.err.desc);
-        }
-        if (lookup.rnew->status != HTTP_OK) {
-            *err = dav_new_error(r->pool, lookup.rnew->status, 0, APR_SUCCESS,
-                    apr_psprintf(r->pool, "Could not lookup calendar provision URL: %s", path));
-        }
+        /*
+         * The response is already on its way, all we can do is make
+         * sure the client does not mistake a truncated calendar for
+         * a complete one, by dropping the connection.
+         */
+        dav_log_err(r, err, APLOG_ERR);
 
-        /* make the calendar */
-        *err = dav_calendar_provision_calendar(lookup.rnew, resource, name);
-        if (*err != NULL) {
-            return DONE;
-        }
+        r->connection->keepalive = AP_CONN_CLOSE;
+        e = ap_bucket_error_create(HTTP_BAD_GATEWAY, NULL, r->pool,
+                r->connection->bucket_alloc);
+        APR_BRIGADE_INSERT_TAIL(cctx->out, e);
+    }
+    else {
+        e = apr_bucket_immortal_create(DAV_CALENDAR_STREAM_TRAILER,
+                strlen(DAV_CALENDAR_STREAM_TRAILER),
+                r->connection->bucket_alloc);
+        APR_BRIGADE_INSERT_TAIL(cctx->out, e);
+    }
 
-        ap_log_rerror(APLOG_MARK, APLOG_INFO, 0, r,
-                        "mod_dav_calendar: Auto provisioned %s", lookup.rnew->uri);
+    e = apr_bucket_eos_create(r->connection->bucket_alloc);
+    APR_BRIGADE_INSERT_TAIL(cctx->out, e);
 
-        /* clean up */
-        if (lookup.rnew) {
-            ap_destroy_sub_req(lookup.rnew);
-        }
-    }
+    start = dav_calendar_timing_start(r);
+    status = ap_pass_brigade(r->output_filters, cctx->out);
+    apr_brigade_cleanup(cctx->out);
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_SEND, start);
 
-    return DONE;
+    if (status == APR_SUCCESS
+        || r->status != HTTP_OK
+        || r->connection->aborted) {
+        return OK;
+    }
+    else {
+        /* no way to know what type of error occurred */
+        ap_log_rerror(APLOG_MARK, APLOG_DEBUG, status, r,
+                      "dav_calendar_handler: ap_pass_brigade returned %i",
+                      status);
+        return AP_FILTER_ERROR;
+    }
 }
 
-static void *create_dav_calendar_config(apr_pool_t *p, server_rec *s)
+/*
+ * The feed cache.
+ *
+ * Calendars reached through DavCalendarAlias or DavCalendarAliasMatch are
+ * usually subscriptions, polled by clients every few minutes. When
+ * DavCalendarFeedCache is set, the rendered calendar is kept in a file
+ * named after the collection and headed by the ETag it was rendered for,
+ * and a poll of an unchanged collection is answered by sending the file.
+ * With zlib, a gzip compressed copy is kept alongside for the clients
+ * that accept it, sent under an ETag of its own. What a user may see of
+ * a collection depends on who they are, so each user has a feed of their
+ * own, kept in a directory for the collection.
+ *
+ * A feed is rewritten in place when the collection changes. Feeds not
+ * rendered again within DavCalendarFeedCacheMaxAge, such as those of
+ * users who went away, are swept from the directory at most once in
+ * that time, and the directory of a collection is emptied when the
+ * collection is deleted or moved away.
+ */
+
+static const char *dav_calendar_feed_hash(apr_pool_t *p, const char *s)
 {
-    dav_calendar_server_rec *a =
-    (dav_calendar_server_rec *) apr_pcalloc(p, sizeof(dav_calendar_server_rec));
+    apr_sha1_ctx_t sha1;
+    unsigned char digest[APR_SHA1_DIGESTSIZE];
 
-    a->aliases = apr_array_make(p, 5, sizeof(dav_calendar_alias_entry));
+    apr_sha1_init(&sha1);
+    apr_sha1_update(&sha1, s, strlen(s));
+    apr_sha1_final(digest, &sha1);
 
-    return a;
+    return apr_pencode_base16_binary(p, digest, APR_SHA1_DIGESTSIZE,
+            APR_ENCODE_LOWER, NULL);
 }
 
-static void *create_dav_calendar_dir_config(apr_pool_t *p, char *d)
+static const char *dav_calendar_feed_dir(request_rec *r, const char *dir,
+        const char *uri)
 {
-    dav_calendar_config_rec *conf = apr_pcalloc(p, sizeof(dav_calendar_config_rec));
-
-    conf->dav_calendar_timezone = DEFAULT_TIMEZONE;
-    conf->max_resource_size = DEFAULT_MAX_RESOURCE_SIZE;
-
-    conf->dav_calendar_homes = apr_array_make(p, 2, sizeof(ap_expr_info_t *));
-    conf->dav_calendar_provisions = apr_array_make(p, 2, sizeof(dav_calendar_provision_entry));
+    /* with or without the trailing slash, the collection is the same */
+    uri = dav_calendar_journal_collection(r->pool, uri);
 
-    return conf;
+    return apr_pstrcat(r->pool, dir, "/",
+            dav_calendar_feed_hash(r->pool, uri), NULL);
 }
 
-static void *merge_dav_calendar_config(apr_pool_t *p, void *basev, void *overridesv)
+static const char *dav_calendar_feed_path(request_rec *r, const char *dir,
+        const char *uri)
 {
-    dav_calendar_server_rec *a =
-    (dav_calendar_server_rec *) apr_pcalloc(p, sizeof(dav_calendar_server_rec));
-    dav_calendar_server_rec *base = (dav_calendar_server_rec *) basev;
-    dav_calendar_server_rec *overrides = (dav_calendar_server_rec *) overridesv;
-
-    a->aliases = apr_array_append(p, overrides->aliases, base->aliases);
-
-    return a;
+    return apr_pstrcat(r->pool, dav_calendar_feed_dir(r, dir, uri), "/",
+            dav_calendar_feed_hash(r->pool, r->user ? r->user : ""), ".ics",
+            NULL);
 }
 
-static void *merge_dav_calendar_dir_config(apr_pool_t *p, void *basev, void *addv)
+/*
+ * Remove the files in the directory last written before the given time,
+ * and below, the directories left empty.
+ */
+static void dav_calendar_feed_expire(apr_pool_t *p, const char *dir,
+        apr_time_t before, int below)
 {
-    dav_calendar_config_rec *new = (dav_calendar_config_rec *) apr_pcalloc(p,
-            sizeof(dav_calendar_config_rec));
-    dav_calendar_config_rec *add = (dav_calendar_config_rec *) addv;
-    dav_calendar_config_rec *base = (dav_calendar_config_rec *) basev;
+    apr_dir_t *d;
+    apr_finfo_t finfo;
+    apr_pool_t *sp;
+    apr_status_t status;
 
-    new->dav_calendar = (add->dav_calendar_set == 0) ? base->dav_calendar : add->dav_calendar;
-    new->dav_calendar_set = add->dav_calendar_set || base->dav_calendar_set;
+    if (apr_dir_open(&d, dir, p) != APR_SUCCESS) {
+        return;
+    }
 
-    new->dav_calendar_timezone = (add->dav_calendar_timezone_set == 0) ?
-            base->dav_calendar_timezone : add->dav_calendar_timezone;
-    new->dav_calendar_timezone_set = add->dav_calendar_timezone_set || base->dav_calendar_timezone_set;
+    apr_pool_create(&sp, p);
 
-    new->max_resource_size = (add->max_resource_size_set == 0) ? base->max_resource_size : add->max_resource_size;
-    new->max_resource_size_set = add->max_resource_size_set || base->max_resource_size_set;
+    while ((status = apr_dir_read(&finfo, APR_FINFO_NAME | APR_FINFO_TYPE
+            | APR_FINFO_MTIME, d)) == APR_SUCCESS
+            || status == APR_INCOMPLETE) {
+        const char *path;
 
-    new->dav_calendar_homes = apr_array_append(p, add->dav_calendar_homes, base->dav_calendar_homes);
-    new->dav_calendar_provisions = apr_array_append(p, add->dav_calendar_provisions, base->dav_calendar_provisions);
+        /* dot files include the marker of the last sweep */
+        if ((finfo.valid & (APR_FINFO_NAME | APR_FINFO_TYPE | APR_FINFO_MTIME))
+                != (APR_FINFO_NAME | APR_FINFO_TYPE | APR_FINFO_MTIME)
+                || finfo.name[0] == '.') {
+            continue;
+        }
 
-    return new;
-}
+        apr_pool_clear(sp);
 
-static const char *set_dav_calendar(cmd_parms *cmd, void *dconf, int flag)
-{
-    dav_calendar_config_rec *conf = dconf;
+        path = apr_pstrcat(sp, dir, "/", finfo.name, NULL);
 
-    conf->dav_calendar = flag;
-    conf->dav_calendar_set = 1;
+        if (finfo.filetype == APR_DIR) {
+            if (below) {
+                dav_calendar_feed_expire(sp, path, before, 0);
+                apr_dir_remove(path, sp);
+            }
+        }
+        else if (finfo.mtime < before) {
+            apr_file_remove(path, sp);
+        }
+    }
 
-    return NULL;
+    apr_pool_destroy(sp);
+
+    apr_dir_close(d);
 }
 
-static const char *set_dav_calendar_timezone(cmd_parms *cmd, void *dconf, const char *tz)
+/*
+ * Sweep the expired feeds from the directory, unless that was done
+ * within the max age already.
+ */
+static void dav_calendar_feed_sweep(request_rec *r, const char *dir,
+        apr_interval_time_t max_age)
 {
-    dav_calendar_config_rec *conf = dconf;
+    const char *marker = apr_pstrcat(r->pool, dir, "/.swept", NULL);
+    apr_time_t now = apr_time_now();
+    apr_finfo_t finfo;
+    apr_file_t *fd;
 
-    icalcomponent *calendar, *timezone;
+    if (apr_stat(&finfo, marker, APR_FINFO_MTIME, r->pool) == APR_SUCCESS
+            && finfo.mtime > now - max_age) {
+        return;
+    }
 
-    calendar = icalcomponent_new(ICAL_VCALENDAR_COMPONENT);
-    icalcomponent_add_property(calendar, icalproperty_new_version("2.0"));
-    icalcomponent_add_property(calendar,
-            icalproperty_new_prodid("-//Graham Leggett//" PACKAGE_STRING "//EN"));
+    if (apr_file_open(&fd, marker, APR_FOPEN_CREATE | APR_FOPEN_WRITE,
+            APR_OS_DEFAULT, r->pool) != APR_SUCCESS) {
+        return;
+    }
+    apr_file_close(fd);
+    apr_file_mtime_set(marker, now, r->pool);
 
-    timezone = icalcomponent_new(ICAL_VTIMEZONE_COMPONENT);
-    icalcomponent_add_property(timezone, icalproperty_new_tzid(tz));
+    dav_calendar_feed_expire(r->pool, dir, now - max_age, 1);
+}
 
-    icalcomponent_add_component(calendar,timezone);
+/*
+ * The collection is gone, and so are the feeds of every user.
+ */
+static void dav_calendar_feed_removed(request_rec *r, const char *uri)
+{
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+    const char *dir;
 
-    conf->dav_calendar_timezone = icalcomponent_as_ical_string(calendar);
-    conf->dav_calendar_timezone_set = 1;
+    if (!conf->feed_cache) {
+        return;
+    }
 
-    icalcomponent_free(calendar);
+    dir = dav_calendar_feed_dir(r, conf->feed_cache, uri);
 
-    return NULL;
+    dav_calendar_feed_expire(r->pool, dir, APR_INT64_MAX, 0);
+    apr_dir_remove(dir, r->pool);
 }
 
-static const char *set_dav_calendar_max_resource_size(cmd_parms *cmd,
-        void *dconf, const char *arg)
+/*
+ * Send the feed in the file, if it was rendered for this ETag.
+ */
+static int dav_calendar_feed_send(request_rec *r, const char *path,
+        const char *etag, const char *encoding)
 {
-    dav_calendar_config_rec *conf = dconf;
+    apr_file_t *fd;
+    apr_finfo_t finfo;
+    apr_bucket_brigade *bb;
+    apr_bucket *e;
+    apr_size_t hlen = strlen(etag) + 1, got;
+    char *head;
+    apr_time_t start;
+    apr_status_t status;
+
+    if (apr_file_open(&fd, path, APR_FOPEN_READ | APR_FOPEN_BINARY
+            | APR_FOPEN_SENDFILE_ENABLED, APR_OS_DEFAULT, r->pool)
+            != APR_SUCCESS) {
+        return DECLINED;
+    }
 
-    if (apr_strtoff(&conf->max_resource_size, arg, NULL, 10) != APR_SUCCESS
-            || conf->max_resource_size < 4096) {
-        return "DavCalendarMaxResourceSize needs to be a positive integer larger than 4096.";
+    head = apr_palloc(r->pool, hlen);
+
+    if (apr_file_read_full(fd, head, hlen, &got) != APR_SUCCESS
+            || memcmp(head, etag, hlen - 1) || head[hlen - 1] != '\n'
+            || apr_file_info_get(&finfo, APR_FINFO_SIZE, fd) != APR_SUCCESS) {
+        apr_file_close(fd);
+        return DECLINED;
     }
 
-    conf->max_resource_size_set = 1;
+    ap_set_content_length(r, finfo.size - hlen);
+    ap_set_content_type(r, "text/calendar");
+    if (encoding) {
+        apr_table_setn(r->headers_out, "Content-Encoding", encoding);
+    }
 
-    return NULL;
-}
+    bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
 
+    apr_brigade_insert_file(bb, fd, hlen, finfo.size - hlen, r->pool);
 
-static const char *add_dav_calendar_home(cmd_parms *cmd, void *dconf, const char *home)
-{
-    dav_calendar_config_rec *conf = dconf;
-    const char *expr_err = NULL;
+    e = apr_bucket_eos_create(r->connection->bucket_alloc);
+    APR_BRIGADE_INSERT_TAIL(bb, e);
 
-    ap_expr_info_t **homes = apr_array_push(conf->dav_calendar_homes);
+    dav_calendar_timing_header(r);
 
-    (*homes) = ap_expr_parse_cmd(cmd, home, AP_EXPR_FLAG_STRING_RESULT,
-            &expr_err, NULL);
+    start = dav_calendar_timing_start(r);
+    status = ap_pass_brigade(r->output_filters, bb);
+    apr_brigade_cleanup(bb);
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_SEND, start);
 
-    if (expr_err) {
-        return apr_pstrcat(cmd->temp_pool,
-                "Cannot parse expression '", home, "': ",
-                expr_err, NULL);
+    if (status == APR_SUCCESS
+        || r->status != HTTP_OK
+        || r->connection->aborted) {
+        return OK;
+    }
+    else {
+        /* no way to know what type of error occurred */
+        ap_log_rerror(APLOG_MARK, APLOG_DEBUG, status, r,
+                      "dav_calendar_handler: ap_pass_brigade returned %i",
+                      status);
+        return AP_FILTER_ERROR;
     }
-
-    return NULL;
 }
 
-static const char *add_dav_calendar_provision(cmd_parms *cmd, void *dconf, const char *prov, const char *name)
+static int dav_calendar_feed_serve(request_rec *r, const char *path,
+        const char *etag)
 {
-    dav_calendar_config_rec *conf = dconf;
-    const char *expr_err = NULL;
-
-    dav_calendar_provision_entry *provs = apr_array_push(conf->dav_calendar_provisions);
+#ifdef HAVE_ZLIB
+    const char *accept = apr_table_get(r->headers_in, "Accept-Encoding");
 
-    provs->provision = ap_expr_parse_cmd(cmd, prov, AP_EXPR_FLAG_STRING_RESULT,
-            &expr_err, NULL);
+    apr_table_mergen(r->headers_out, "Vary", "Accept-Encoding");
 
-    if (expr_err) {
-        return apr_pstrcat(cmd->temp_pool,
-                "Cannot parse expression '", prov, "': ",
-                expr_err, NULL);
-    }
+    if (accept && ap_find_token(r->pool, accept, "gzip")) {
+        apr_size_t len = strlen(etag);
+        int status;
 
-    if (name) {
+        /* a different representation needs a different strong ETag */
+        if (len && etag[len - 1] == '"') {
+            apr_table_set(r->headers_out, "ETag", apr_pstrcat(r->pool,
+                    apr_pstrmemdup(r->pool, etag, len - 1), "-gzip\"", NULL));
 
-        provs->displayname = ap_expr_parse_cmd(cmd, name, AP_EXPR_FLAG_STRING_RESULT,
-                &expr_err, NULL);
+            status = ap_meets_conditions(r);
+            if (status) {
+                return status;
+            }
 
-        if (expr_err) {
-            return apr_pstrcat(cmd->temp_pool,
-                    "Cannot parse expression '", name, "': ",
-                    expr_err, NULL);
+            status = dav_calendar_feed_send(r,
+                    apr_pstrcat(r->pool, path, ".gz", NULL), etag, "gzip");
+            if (status != DECLINED) {
+                return status;
+            }
+
+            apr_table_set(r->headers_out, "ETag", etag);
         }
     }
+#endif
 
-    return NULL;
+    return dav_calendar_feed_send(r, path, etag, NULL);
 }
 
-static const char *add_alias_internal(cmd_parms *cmd, void *dummy,
-                                      const char *fake, const char *real,
-                                      int use_regex)
+/*
+ * Write the file in one go, and move it into place, so that readers
+ * never see half a feed.
+ */
+static void dav_calendar_feed_write(request_rec *r, const char *path,
+        const char *etag, const char *data, apr_size_t len)
 {
-    server_rec *s = cmd->server;
-    dav_calendar_server_rec *conf = ap_get_module_config(s->module_config,
-                                                   &dav_calendar_module);
-    dav_calendar_alias_entry *new = apr_array_push(conf->aliases);
-
-    const char *err = ap_check_cmd_context(cmd, NOT_IN_DIR_CONTEXT);
-
-    if (err != NULL) {
-        return err;
+    apr_file_t *fd;
+    char *tmp = apr_pstrcat(r->pool, path, ".XXXXXX", NULL);
+    apr_status_t status;
+
+    status = apr_file_mktemp(&fd, tmp, APR_FOPEN_CREATE | APR_FOPEN_WRITE
+            | APR_FOPEN_EXCL | APR_FOPEN_BINARY, r->pool);
+    if (status != APR_SUCCESS) {
+        ap_log_rerror(APLOG_MARK, APLOG_WARNING, status, r,
+                "mod_dav_calendar: Could not create calendar feed '%s'", tmp);
+        return;
     }
 
-    if (use_regex) {
-        new->regexp = ap_pregcomp(cmd->pool, fake, AP_REG_EXTENDED);
-        if (new->regexp == NULL)
-            return "Regular expression could not be compiled.";
-        new->real = real;
+    if ((status = apr_file_write_full(fd, etag, strlen(etag), NULL))
+            == APR_SUCCESS
+            && (status = apr_file_write_full(fd, "\n", 1, NULL)) == APR_SUCCESS
+            && (status = apr_file_write_full(fd, data, len, NULL))
+                    == APR_SUCCESS) {
+        status = apr_file_close(fd);
     }
     else {
-        new->real = real;
+        apr_file_close(fd);
     }
-    new->fake = fake;
 
-    return NULL;
-}
+    if (status == APR_SUCCESS) {
+        status = apr_file_rename(tmp, path, r->pool);
+    }
 
-static const char *add_dav_calendar_alias(cmd_parms *cmd, void *dummy, const char *fake,
-        const char *real)
-{
-    return add_alias_internal(cmd, dummy, fake, real, 0);
+    if (status != APR_SUCCESS) {
+        ap_log_rerror(APLOG_MARK, APLOG_WARNING, status, r,
+                "mod_dav_calendar: Could not write calendar feed '%s'", path);
+        apr_file_remove(tmp, r->pool);
+    }
 }
 
-static const char *add_dav_calendar_alias_regex(cmd_parms *cmd, void *dummy,
-                                   const char *fake, const char *real)
+static void dav_calendar_feed_store(request_rec *r, const char *path,
+        const char *etag, const char *ical, apr_size_t ical_len)
 {
-    return add_alias_internal(cmd, dummy, fake, real, 1);
-}
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
+#ifdef HAVE_ZLIB
+    z_stream zs = { 0 };
+    unsigned char *gz;
+    uLong bound;
+#endif
 
-static const command_rec dav_calendar_cmds[] =
-{
-    AP_INIT_FLAG("DavCalendar",
-        set_dav_calendar, NULL, RSRC_CONF | ACCESS_CONF,
-        "When enabled, the URL space will support calendars."),
-    AP_INIT_TAKE1("DavCalendarTimezone", set_dav_calendar_timezone, NULL, RSRC_CONF | ACCESS_CONF,
-        "Set the default timezone for auto provisioned calendars. Defaults to UTC."),
-    AP_INIT_TAKE1("DavCalendarMaxResourceSize", set_dav_calendar_max_resource_size, NULL, RSRC_CONF | ACCESS_CONF,
-        "Set the maximum resource size of an individual calendar. Defaults to 10MB."),
-    AP_INIT_TAKE1("DavCalendarHome", add_dav_calendar_home, NULL, RSRC_CONF | ACCESS_CONF,
-        "Set the URL template to use for the calendar home. "
-        "Recommended value is \"/calendars/%{escape:%{REMOTE_USER}}\"."),
-    AP_INIT_TAKE12("DavCalendarProvision", add_dav_calendar_provision, NULL, RSRC_CONF | ACCESS_CONF,
-        "Set the URL template to use for calendar auto provision. "
-        "If provided, the name is given to the displayname property, otherwise the name is "
-        "set to the path to the right of the last slash, if present. "
-        "Recommended value is \"/calendars/%{escape:%{REMOTE_USER}}/Home\"."),
-    AP_INIT_TAKE2("DavCalendarAlias", add_dav_calendar_alias, NULL, RSRC_CONF | ACCESS_CONF,
-        "Calendar alias and the real calendar collection."),
-    AP_INIT_TAKE2("DavCalendarAliasMatch", add_dav_calendar_alias_regex, NULL, RSRC_CONF,
-        "A calendar alias regular expression and a calendar collecion URL to alias to"),
-    { NULL }
-};
+    dav_calendar_feed_sweep(r, conf->feed_cache, conf->feed_cache_max_age);
 
-static int dav_calendar_post_config(apr_pool_t *p, apr_pool_t *plog,
-                                    apr_pool_t *ptemp, server_rec *s)
-{
-    /* Register CalDAV methods */
-    iM_MKCALENDAR = ap_method_register(p, "MKCALENDAR");
+    apr_dir_make(ap_make_dirstr_parent(r->pool, path), APR_OS_DEFAULT,
+            r->pool);
 
-    return OK;
+    dav_calendar_feed_write(r, path, etag, ical, ical_len);
+
+#ifdef HAVE_ZLIB
+    /* window bits above 15 ask for a gzip wrapper */
+    if (ical_len > UINT_MAX || deflateInit2(&zs, Z_BEST_COMPRESSION, Z_DEFLATED,
+            15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return;
+    }
+
+    bound = deflateBound(&zs, ical_len);
+    gz = apr_palloc(r->pool, bound);
+
+    zs.next_in = (Bytef *) ical;
+    zs.avail_in = ical_len;
+    zs.next_out = gz;
+    zs.avail_out = bound;
+
+    if (deflate(&zs, Z_FINISH) == Z_STREAM_END) {
+        dav_calendar_feed_write(r, apr_pstrcat(r->pool, path, ".gz", NULL),
+                etag, (const char *) gz, zs.total_out);
+    }
+
+    deflateEnd(&zs);
+#endif
 }
 
 static int dav_calendar_handle_get(request_rec *r)
@@ -3853,10 +9170,16 @@ static int dav_calendar_handle_get(request_rec *r)
     dav_resource *resource = NULL;
     apr_bucket_brigade *bb;
     apr_bucket *e;
+    dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
+            &dav_calendar_module);
     dav_calendar_ctx cctx = { 0 };
     dav_walk_params w = { 0 };
     dav_response *multi_status;
+    dav_calendar_collection_state *state = NULL;
+    const char *collection_etag = NULL, *ctag;
+    const char *feed_path = NULL, *feed_etag = NULL;
     const char *type, *ns, *ical;
+    apr_time_t start;
     apr_sha1_ctx_t sha1 = { { 0 } };
     unsigned char digest[APR_SHA1_DIGESTSIZE];
     apr_size_t ical_len;
@@ -3913,8 +9236,7 @@ static int dav_calendar_handle_get(request_rec *r)
     w.root = resource;
     cctx.r = r;
 
-    /* ### should open read-only */
-    if ((err = dav_open_lockdb(r, 0, &w.lockdb)) != NULL) {
+    if ((err = dav_calendar_open_lockdb(r, &w.lockdb)) != NULL) {
         err = dav_push_error(r->pool, err->status, 0,
                              "The lock database could not be opened, "
                              "preventing access to the various lock "
@@ -3927,36 +9249,95 @@ static int dav_calendar_handle_get(request_rec *r)
         w.walk_type |= DAV_WALKTYPE_LOCKNULL;
     }
 
-    /* Have the provider walk the etags. */
-    w.func = dav_calendar_etag_walker;
-    cctx.sha1 = &sha1;
-    apr_sha1_init(&sha1);
-    err = (*resource->hooks->walk)(&w, depth, &multi_status);
-    apr_sha1_final(digest, &sha1);
+    /*
+     * If the collection tag is unchanged since we last walked the
+     * collection, the members are known and need not be walked again.
+     * Without a tag, only a walk of the member ETags tells us whether
+     * anything changed.
+     */
+    ctag = dav_calendar_ctag_get(r, resource);
 
-    /* Have the provider walk the resource. */
-    if (!err) {
+    if (!resource->hooks->handle_get && ctag) {
+        collection_etag = ctag;
+        state = dav_calendar_state_get(r, resource->uri, collection_etag);
+    }
+
+    if (state) {
+        apr_table_set(r->headers_out, "ETag", state->etag);
+    }
+
+    /* the collection tag changes whenever a member does */
+    else if (ctag) {
+        apr_table_set(r->headers_out, "ETag",
+                apr_pstrcat(r->pool, "\"", ctag, "\"", NULL));
+
+        /* the body walk gives us the members for next time */
+        if (collection_etag && dav_calendar_cache_global) {
+            cctx.collection_etag = collection_etag;
+            cctx.uris = apr_array_make(r->pool, 16, sizeof(const char *));
+            cctx.etags = apr_array_make(r->pool, 16, sizeof(const char *));
+        }
+    }
 
-        if (cctx.sha1) {
-            apr_table_set(r->headers_out, "ETag", apr_pstrcat(r->pool, "\"",
+    /* Have the provider walk the etags. */
+    else {
+        w.func = dav_calendar_etag_walker;
+        cctx.sha1 = &sha1;
+        apr_sha1_init(&sha1);
+        err = dav_calendar_walk(r, resource, &w, depth, &multi_status);
+        apr_sha1_final(digest, &sha1);
+
+        if (!err && cctx.sha1) {
+            const char *etag = apr_pstrcat(r->pool, "\"",
                     apr_pencode_base64_binary(r->pool, digest, APR_SHA1_DIGESTSIZE,
-                            APR_ENCODE_NOPADDING, NULL), "\"", NULL));
+                            APR_ENCODE_NOPADDING, NULL), "\"", NULL);
+
+            apr_table_set(r->headers_out, "ETag", etag);
         }
+    }
+
+    /* Have the provider walk the resource. */
+    if (!err) {
 
         /* handle conditional requests */
         status = ap_meets_conditions(r);
         if (status) {
+            if (w.lockdb != NULL) {
+                (*w.lockdb->hooks->close_lockdb)(w.lockdb);
+            }
             return status;
         }
 
+        /* a subscription to an unchanged calendar? send what we sent before */
+        if (conf->feed_cache && r->prev
+                && apr_table_get(r->prev->notes, DAV_CALENDAR_ALIASED)
+                && (feed_etag = apr_table_get(r->headers_out, "ETag"))) {
+            feed_path = dav_calendar_feed_path(r, conf->feed_cache,
+                    resource->uri);
+
+            status = dav_calendar_feed_serve(r, feed_path, feed_etag);
+            if (status != DECLINED) {
+                if (w.lockdb != NULL) {
+                    (*w.lockdb->hooks->close_lockdb)(w.lockdb);
+                }
+                return status;
+            }
+        }
+
+        w.func = dav_calendar_get_walker;
+
+        /* a feed to be kept is rendered in full */
+        if (conf->stream && !r->header_only && !feed_path) {
+            return dav_calendar_stream_get(r, resource, &w, &cctx, state,
+                    depth);
+        }
+
         cctx.comp = icalcomponent_new(ICAL_VCALENDAR_COMPONENT);
 
         apr_pool_cleanup_register(r->pool, cctx.comp, icalcomponent_cleanup,
                 apr_pool_cleanup_null);
 
-        w.func = dav_calendar_get_walker;
-
-        err = (*resource->hooks->walk)(&w, depth, &multi_status);
+        err = dav_calendar_get_members(r, resource, &w, &cctx, state, depth);
     }
 
     if (w.lockdb != NULL) {
@@ -3967,8 +9348,19 @@ static int dav_calendar_handle_get(request_rec *r)
         return dav_handle_err(r, err, NULL);
     }
 
+    start = dav_calendar_timing_start(r);
     ical = icalcomponent_as_ical_string(cctx.comp);
     ical_len = strlen(ical);
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_SERIALISE, start);
+
+    if (feed_path) {
+        dav_calendar_feed_store(r, feed_path, feed_etag, ical, ical_len);
+
+        status = dav_calendar_feed_serve(r, feed_path, feed_etag);
+        if (status != DECLINED) {
+            return status;
+        }
+    }
 
     bb = apr_brigade_create(r->pool, r->connection->bucket_alloc);
 
@@ -3982,8 +9374,12 @@ static int dav_calendar_handle_get(request_rec *r)
     e = apr_bucket_eos_create(r->connection->bucket_alloc);
     APR_BRIGADE_INSERT_TAIL(bb, e);
 
+    dav_calendar_timing_header(r);
+
+    start = dav_calendar_timing_start(r);
     status = ap_pass_brigade(r->output_filters, bb);
     apr_brigade_cleanup(bb);
+    dav_calendar_timing_add(r, DAV_CALENDAR_PHASE_SEND, start);
 
     if (status == APR_SUCCESS
         || r->status != HTTP_OK
@@ -4237,15 +9633,25 @@ static int dav_calendar_handle_mkcalendar(request_rec *r)
     }
 }
 
-static int dav_calendar_try_alias_list(request_rec *r, apr_array_header_t *aliases)
+static int dav_calendar_try_alias_list(request_rec *r, apr_array_header_t *aliases,
+        const dav_calendar_alias_index *index)
 {
     dav_calendar_alias_entry *entries = (dav_calendar_alias_entry *) aliases->elts;
     ap_regmatch_t regm[AP_MAX_REG_MATCH];
+    apr_array_header_t *candidates = NULL;
     const char *found = NULL;
-    int i;
+    int i, n = aliases->nelts;
 
-    for (i = 0; i < aliases->nelts; ++i) {
-        dav_calendar_alias_entry *alias = &entries[i];
+    if (index) {
+        if (!(candidates = dav_calendar_alias_candidates(r, index))) {
+            return DECLINED;
+        }
+        n = candidates->nelts;
+    }
+
+    for (i = 0; i < n; ++i) {
+        dav_calendar_alias_entry *alias = &entries[candidates ?
+                APR_ARRAY_IDX(candidates, i, int) : i];
 
         if (alias->regexp) {
             if (!ap_regexec(alias->regexp, r->uri, AP_MAX_REG_MATCH, regm, 0)) {
@@ -4280,6 +9686,9 @@ static int dav_calendar_try_alias_list(request_rec *r, apr_array_header_t *alias
                                       "?", r->args, NULL);
             }
 
+            /* let the calendar know it is being subscribed to */
+            apr_table_setn(r->notes, DAV_CALENDAR_ALIASED, "1");
+
             ap_internal_redirect(found, r);
 
             return OK;
@@ -4300,7 +9709,8 @@ static int dav_calendar_handler(request_rec *r)
 
     int status;
 
-    status = dav_calendar_try_alias_list(r, serverconf->aliases);
+    status = dav_calendar_try_alias_list(r, serverconf->aliases,
+            serverconf->alias_index);
     if (status != DECLINED) {
         return status;
     }
@@ -4310,20 +9720,228 @@ static int dav_calendar_handler(request_rec *r)
     }
 
     if (r->method_number == M_GET) {
-        return dav_calendar_handle_get(r);
+        apr_time_t start = apr_time_now();
+
+        status = dav_calendar_handle_get(r);
+        if (status != DECLINED) {
+            dav_calendar_metrics_time(DAV_CALENDAR_OP_GET, start);
+            dav_calendar_timing_finish(r);
+        }
+
+        return status;
     }
 
     if (r->method_number == iM_MKCALENDAR) {
-        return dav_calendar_handle_mkcalendar(r);
+        apr_time_t start = apr_time_now();
+
+        status = dav_calendar_handle_mkcalendar(r);
+        dav_calendar_metrics_time(DAV_CALENDAR_OP_MKCALENDAR, start);
+
+        return status;
     }
 
     return DECLINED;
 }
 
+/*
+ * Report the metrics in the Prometheus text format.
+ */
+static int dav_calendar_metrics_handler(request_rec *r)
+{
+    dav_calendar_metrics *m;
+    int i, j;
+
+    if (!r->handler || strcmp(r->handler, DAV_CALENDAR_METRICS_HANDLER)) {
+        return DECLINED;
+    }
+
+    if (!dav_calendar_metrics_global) {
+        return HTTP_NOT_FOUND;
+    }
+
+    r->allowed = (AP_METHOD_BIT << M_GET);
+    if (r->method_number != M_GET) {
+        return DECLINED;
+    }
+
+    ap_set_content_type(r, "text/plain; version=0.0.4");
+    apr_table_setn(r->headers_out, "Cache-Control", "no-cache");
+
+    if (r->header_only) {
+        return OK;
+    }
+
+    if (!(m = dav_calendar_metrics_snapshot(r))) {
+        return HTTP_INTERNAL_SERVER_ERROR;
+    }
+
+    ap_rputs("# TYPE dav_calendar_duration_microseconds histogram\n", r);
+    for (i = 0; i < DAV_CALENDAR_OP_MAX; i++) {
+        dav_calendar_histogram *h = &m->ops[i];
+        apr_uint64_t seen = 0;
+
+        /* the last bucket is unbounded, and reported as +Inf */
+        for (j = 0; j < DAV_CALENDAR_METRICS_BUCKETS - 1; j++) {
+            apr_uint64_t n = h->buckets[j];
+
+            /* empty buckets say nothing the next bucket does not */
+            if (!n) {
+                continue;
+            }
+            seen += n;
+
+            ap_rprintf(r, "dav_calendar_duration_microseconds_bucket"
+                    "{op=\"%s\",le=\"%" APR_UINT64_T_FMT "\"} %"
+                    APR_UINT64_T_FMT "\n", dav_calendar_op_names[i],
+                    dav_calendar_metrics_bound(j), seen);
+        }
+        ap_rprintf(r, "dav_calendar_duration_microseconds_bucket"
+                "{op=\"%s\",le=\"+Inf\"} %" APR_UINT64_T_FMT "\n",
+                dav_calendar_op_names[i], h->count);
+        ap_rprintf(r, "dav_calendar_duration_microseconds_sum"
+                "{op=\"%s\"} %" APR_UINT64_T_FMT "\n",
+                dav_calendar_op_names[i], h->total);
+        ap_rprintf(r, "dav_calendar_duration_microseconds_count"
+                "{op=\"%s\"} %" APR_UINT64_T_FMT "\n",
+                dav_calendar_op_names[i], h->count);
+    }
+
+    for (i = 0; i < DAV_CALENDAR_COUNT_MAX; i++) {
+        ap_rprintf(r, "# TYPE dav_calendar_%s_total counter\n"
+                "dav_calendar_%s_total %" APR_UINT64_T_FMT "\n",
+                dav_calendar_count_names[i], dav_calendar_count_names[i],
+                m->counts[i]);
+    }
+
+    for (j = 0; j < DAV_CALENDAR_CACHE_COUNT_MAX; j++) {
+        ap_rprintf(r, "# TYPE dav_calendar_cache_%s_total counter\n",
+                dav_calendar_cache_count_names[j]);
+        for (i = 0; i < DAV_CALENDAR_CACHE_MAX; i++) {
+            ap_rprintf(r, "dav_calendar_cache_%s_total{kind=\"%s\"} %"
+                    APR_UINT64_T_FMT "\n", dav_calendar_cache_count_names[j],
+                    dav_calendar_cache_kind_names[i], m->cache[i][j]);
+        }
+    }
+
+    return OK;
+}
+
+/*
+ * Add the metrics to the mod_status page.
+ */
+static int dav_calendar_status_hook(request_rec *r, int flags)
+{
+    dav_calendar_metrics *m = dav_calendar_metrics_snapshot(r);
+    int i;
+
+    if (!m) {
+        return OK;
+    }
+
+    if (flags & AP_STATUS_SHORT) {
+        for (i = 0; i < DAV_CALENDAR_OP_MAX; i++) {
+            ap_rprintf(r, "DavCalendar %s: %" APR_UINT64_T_FMT " %"
+                    APR_UINT64_T_FMT "\n", dav_calendar_op_names[i],
+                    m->ops[i].count, m->ops[i].total);
+        }
+        for (i = 0; i < DAV_CALENDAR_COUNT_MAX; i++) {
+            ap_rprintf(r, "DavCalendar %s: %" APR_UINT64_T_FMT "\n",
+                    dav_calendar_count_names[i], m->counts[i]);
+        }
+        for (i = 0; i < DAV_CALENDAR_CACHE_MAX; i++) {
+            ap_rprintf(r, "DavCalendar cache %s: %" APR_UINT64_T_FMT " %"
+                    APR_UINT64_T_FMT " %" APR_UINT64_T_FMT "\n",
+                    dav_calendar_cache_kind_names[i],
+                    m->cache[i][DAV_CALENDAR_CACHE_HIT],
+                    m->cache[i][DAV_CALENDAR_CACHE_MISS],
+                    m->cache[i][DAV_CALENDAR_CACHE_EVICTION]);
+        }
+        return OK;
+    }
+
+    ap_rputs("<hr />\n<h2>CalDAV operations</h2>\n"
+            "<table border=\"0\"><tr><th>operation</th><th>count</th>"
+            "<th>mean ms</th><th>p50 ms</th><th>p99 ms</th><th>max ms</th></tr>\n",
+            r);
+    for (i = 0; i < DAV_CALENDAR_OP_MAX; i++) {
+        dav_calendar_histogram *h = &m->ops[i];
+        apr_uint64_t count = h->count;
+
+        ap_rprintf(r, "<tr><td>%s</td><td>%" APR_UINT64_T_FMT "</td>"
+                "<td>%.3f</td><td>%.3f</td><td>%.3f</td><td>%.3f</td></tr>\n",
+                dav_calendar_op_names[i], count,
+                count ? h->total / 1000.0 / count : 0,
+                count ? dav_calendar_metrics_quantile(h, count, 0.5) / 1000.0 : 0,
+                count ? dav_calendar_metrics_quantile(h, count, 0.99) / 1000.0 : 0,
+                h->max / 1000.0);
+    }
+    ap_rputs("</table>\n<table border=\"0\">\n", r);
+    for (i = 0; i < DAV_CALENDAR_COUNT_MAX; i++) {
+        ap_rprintf(r, "<tr><td>%s</td><td>%" APR_UINT64_T_FMT "</td></tr>\n",
+                dav_calendar_count_names[i], m->counts[i]);
+    }
+    ap_rputs("</table>\n<table border=\"0\"><tr><th>cache</th><th>hits</th>"
+            "<th>misses</th><th>evictions</th></tr>\n", r);
+    for (i = 0; i < DAV_CALENDAR_CACHE_MAX; i++) {
+        ap_rprintf(r, "<tr><td>%s</td><td>%" APR_UINT64_T_FMT "</td>"
+                "<td>%" APR_UINT64_T_FMT "</td><td>%" APR_UINT64_T_FMT
+                "</td></tr>\n", dav_calendar_cache_kind_names[i],
+                m->cache[i][DAV_CALENDAR_CACHE_HIT],
+                m->cache[i][DAV_CALENDAR_CACHE_MISS],
+                m->cache[i][DAV_CALENDAR_CACHE_EVICTION]);
+    }
+    ap_rputs("</table>\n", r);
+
+    return OK;
+}
+
+/*
+ * The collection tag lives in the property database, but is ours alone.
+ * Refuse any attempt to set or remove it with PROPPATCH.
+ */
+static dav_error *dav_calendar_check_proppatch(request_rec *r,
+        const apr_xml_doc *doc)
+{
+    const apr_xml_elem *update, *prop, *elem;
+    dav_error *err;
+
+    if (!doc || !dav_validate_root(doc, "propertyupdate")) {
+        return NULL;
+    }
+
+    for (update = doc->root->first_child; update; update = update->next) {
+        if (update->ns != APR_XML_NS_DAV_ID
+                || (strcmp(update->name, "set")
+                        && strcmp(update->name, "remove"))
+                || !(prop = dav_find_child(update, "prop"))) {
+            continue;
+        }
+        for (elem = prop->first_child; elem; elem = elem->next) {
+            if (elem->ns >= 0 && !strcmp(elem->name,
+                    dav_calendar_ctag_name.name)
+                    && !strcmp(APR_XML_GET_URI_ITEM(doc->namespaces,
+                            elem->ns), dav_calendar_ctag_name.ns)) {
+                err = dav_new_error(r->pool, HTTP_FORBIDDEN, 0, 0,
+                        "The collection tag cannot be modified.");
+                err->tagname = "cannot-modify-protected-property";
+                return err;
+            }
+        }
+    }
+
+    return NULL;
+}
+
 static int dav_calendar_method_precondition(request_rec *r,
         dav_resource *src, const dav_resource *dst,
         const apr_xml_doc *doc, dav_error **err)
 {
+    /* protect the collection tag */
+    if (r->method_number == M_PROPPATCH
+            && (*err = dav_calendar_check_proppatch(r, doc))) {
+        return DONE;
+    }
+
     /* handle auto provisioning */
     if (src && !src->exists) {
 
@@ -4343,6 +9961,105 @@ static int dav_calendar_method_precondition(request_rec *r,
     return DECLINED;
 }
 
+/*
+ * Is there a collection at the given URI?
+ */
+static int dav_calendar_is_collection(request_rec *r, const char *uri)
+{
+    dav_lookup_result lookup;
+    dav_resource *resource;
+    dav_error *err;
+    int collection = 0;
+
+    lookup = dav_lookup_uri(uri, r, 0 /* must_be_absolute */);
+    if (lookup.rnew && lookup.rnew->status == HTTP_OK) {
+        if ((err = dav_get_resource(lookup.rnew, 0 /* label_allowed */,
+                0 /* use_checked_in */, &resource)) == NULL) {
+            collection = resource->exists && resource->collection;
+        }
+        else {
+            dav_log_err(r, err, APLOG_DEBUG);
+        }
+    }
+    if (lookup.rnew) {
+        ap_destroy_sub_req(lookup.rnew);
+    }
+
+    return collection;
+}
+
+/*
+ * A member of a calendar collection has been written, record that the
+ * collection has changed.
+ */
+static void dav_calendar_changed(request_rec *r)
+{
+    const char *dest;
+    apr_uri_t uri;
+
+    if (!ap_is_HTTP_SUCCESS(r->status)) {
+        return;
+    }
+
+    switch (r->method_number) {
+    case M_PROPPATCH:
+        /* the properties of the collection itself count as well */
+        dav_calendar_ctag_bump(r, r->uri, 1, 0);
+
+        /* fall through */
+    case M_PUT:
+        dav_calendar_ctag_bump(r, r->uri, 0, DAV_CALENDAR_JOURNAL_UPDATE);
+
+        break;
+    case M_DELETE:
+        dav_calendar_ctag_bump(r, r->uri, 0, DAV_CALENDAR_JOURNAL_DELETE);
+        dav_calendar_provision_removed(r, r->uri);
+        dav_calendar_feed_removed(r, r->uri);
+
+        break;
+    case M_MOVE:
+    case M_COPY:
+        if (r->method_number == M_MOVE) {
+            dav_calendar_ctag_bump(r, r->uri, 0, DAV_CALENDAR_JOURNAL_DELETE);
+            dav_calendar_provision_removed(r, r->uri);
+            dav_calendar_feed_removed(r, r->uri);
+        }
+
+        dest = apr_table_get(r->headers_in, "Destination");
+        if (dest && apr_uri_parse(r->pool, dest, &uri) == APR_SUCCESS
+                && uri.path && ap_unescape_url(uri.path) == OK) {
+            dav_calendar_ctag_bump(r, uri.path, 0, DAV_CALENDAR_JOURNAL_UPDATE);
+
+            /* collections arriving here replace any that were here before */
+            if (dav_calendar_is_collection(r, uri.path)) {
+                dav_calendar_journal_reset(r, uri.path, 1);
+            }
+        }
+
+        break;
+    default:
+        break;
+    }
+}
+
+/*
+ * The response to a write leaves the handler once the write is done, and
+ * with its final status. Record the change as the response passes, so
+ * that it is recorded before the client learns of the write, and is not
+ * lost should the server go away before logging the request.
+ */
+static apr_status_t dav_calendar_change_filter(ap_filter_t *f,
+        apr_bucket_brigade *bb)
+{
+    request_rec *r = f->r;
+
+    ap_remove_output_filter(f);
+
+    dav_calendar_changed(r);
+
+    return ap_pass_brigade(f->next, bb);
+}
+
 static int dav_calendar_fixups(request_rec *r)
 {
     dav_calendar_config_rec *conf = ap_get_module_config(r->per_dir_config,
@@ -4350,6 +10067,22 @@ static int dav_calendar_fixups(request_rec *r)
 
     if (conf->dav_calendar) {
         AP_REQUEST_SET_BNOTE(r, AP_REQUEST_STRONG_ETAG, AP_REQUEST_STRONG_ETAG);
+
+        /* writes change the collection */
+        if (!r->main) {
+            switch (r->method_number) {
+            case M_PROPPATCH:
+            case M_PUT:
+            case M_DELETE:
+            case M_MOVE:
+            case M_COPY:
+                ap_add_output_filter_handle(dav_calendar_change_filter_handle,
+                        NULL, r, r->connection);
+                break;
+            default:
+                break;
+            }
+        }
     }
 
     return OK;
@@ -4374,7 +10107,9 @@ static void register_hooks(apr_pool_t *p)
                                           "mod_userdir.c",
                                           "mod_vhost_alias.c", NULL };
 
+    ap_hook_pre_config(dav_calendar_pre_config, NULL, NULL, APR_HOOK_MIDDLE);
     ap_hook_post_config(dav_calendar_post_config, NULL, NULL, APR_HOOK_MIDDLE);
+    ap_hook_child_init(dav_calendar_child_init, NULL, NULL, APR_HOOK_MIDDLE);
 
     dav_register_liveprop_group(p, &dav_calendar_liveprop_group);
     dav_hook_find_liveprop(dav_calendar_find_liveprop, NULL, NULL, APR_HOOK_MIDDLE);
@@ -4385,6 +10120,13 @@ static void register_hooks(apr_pool_t *p)
     ap_hook_type_checker(dav_calendar_type_checker, NULL, NULL, APR_HOOK_MIDDLE);
     ap_hook_fixups(dav_calendar_fixups, NULL, NULL, APR_HOOK_MIDDLE);
     ap_hook_handler(dav_calendar_handler, NULL, aszSucc, APR_HOOK_MIDDLE);
+    ap_hook_handler(dav_calendar_metrics_handler, NULL, NULL, APR_HOOK_MIDDLE);
+    APR_OPTIONAL_HOOK(ap, status_hook, dav_calendar_status_hook, NULL, NULL,
+            APR_HOOK_MIDDLE);
+
+    dav_calendar_change_filter_handle = ap_register_output_filter(
+            DAV_CALENDAR_CHANGE_FILTER, dav_calendar_change_filter, NULL,
+            AP_FTYPE_PROTOCOL);
 
     dav_hook_deliver_report(dav_calendar_deliver_report, NULL, NULL, APR_HOOK_MIDDLE);
     dav_hook_gather_reports(dav_calendar_gather_reports,